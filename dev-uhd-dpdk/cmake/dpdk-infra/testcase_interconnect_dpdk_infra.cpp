@@ -21,6 +21,7 @@
 #include "conf/config_params.hpp"
 #include "transport/flexsdr_primary.hpp"
 #include "transport/eal_bootstrap.hpp"
+#include "transport/mbuf_stamp.hpp"
 
 // Global flag for graceful shutdown
 static std::atomic<bool> g_shutdown_requested{false};
@@ -202,6 +203,7 @@ int main(int argc, char** argv) {
       m->pkt_len = 2048;
       
       // First enqueue to gnb_tx_ch1 (simulating transmission)
+      flexsdr::mbuf_stamp_set(m, rte_get_tsc_cycles());
       unsigned n = rte_ring_enqueue_burst(gnb_tx_ch1, reinterpret_cast<void**>(&m), 1, nullptr);
       if (n == 0) {
         std::fprintf(stderr, "[interconnect] WARNING: gnb_tx_ch1 full, burst %lu\n", burst);
@@ -350,6 +352,7 @@ int main(int argc, char** argv) {
           }
           
           // Step 2a: Enqueue to ue_tx_ch1 (simulating UE transmission)
+          flexsdr::mbuf_stamp_set(m, rte_get_tsc_cycles());
           unsigned sent = rte_ring_enqueue_burst(ue_tx_ch1, reinterpret_cast<void**>(&m), 1, nullptr);
           if (sent == 0) {
             std::fprintf(stderr, "[interconnect] WARNING: ue_tx_ch1 full\n");
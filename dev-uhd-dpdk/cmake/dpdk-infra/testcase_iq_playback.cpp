@@ -0,0 +1,150 @@
+/**
+ * @file testcase_iq_playback.cpp
+ * @brief Replays a captured IQ trace into an inbound ring at a paced rate
+ *
+ * Runs as a DPDK secondary (same config as the UE/GNB secondary):
+ * - Looks up rings/pools through FlexSDRSecondary
+ * - Replays a SigMF (.sigmf-data/.sigmf-meta) or raw sc16 file into the
+ *   inbound ring (default: first RX ring / first pool of the config)
+ * - Paced by TSC at the trace sample rate times --mult, optional --loop
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <csignal>
+#include <atomic>
+#include <unistd.h>
+
+#include <rte_mempool.h>
+#include <rte_ring.h>
+
+#include "conf/config_params.hpp"
+#include "transport/flexsdr_secondary.hpp"
+#include "transport/eal_bootstrap.hpp"
+#include "workers/iq_playback.hpp"
+
+// Global flag for graceful shutdown
+static std::atomic<bool> g_shutdown_requested{false};
+
+static void signal_handler(int signum) {
+  std::fprintf(stderr, "\n[iq_playback] caught signal %d, requesting shutdown...\n", signum);
+  g_shutdown_requested.store(true);
+}
+
+static void setup_signal_handlers() {
+  signal(SIGINT, signal_handler);
+  signal(SIGTERM, signal_handler);
+}
+
+static void usage(const char* prog) {
+  std::fprintf(stderr, "Usage: %s <config.yaml> <trace> [options]\n", prog);
+  std::fprintf(stderr, "Options:\n");
+  std::fprintf(stderr, "  --ring NAME      target ring (default: first RX ring in config)\n");
+  std::fprintf(stderr, "  --pool NAME      mbuf pool (default: first pool in config)\n");
+  std::fprintf(stderr, "  --spp N          samples per packet (default 512)\n");
+  std::fprintf(stderr, "  --hdr BYTES      packet header bytes (default 32, 0 = raw IQ)\n");
+  std::fprintf(stderr, "  --rate HZ        sample rate (default: from .sigmf-meta, else 30.72e6)\n");
+  std::fprintf(stderr, "  --channels N     interleaved channels (default: from .sigmf-meta, else 1)\n");
+  std::fprintf(stderr, "  --mult X         rate multiplier (default 1.0)\n");
+  std::fprintf(stderr, "  --burst N        packets per pacing step (default 8)\n");
+  std::fprintf(stderr, "  --loop           restart at end of file\n");
+  std::fprintf(stderr, "  --block          wait for ring space instead of dropping\n");
+  std::fprintf(stderr, "  --cpu N          pin playback thread to CPU N\n");
+  std::fprintf(stderr, "Example: %s conf/configurations-ue.yaml /data/cap0.sigmf-meta --loop\n", prog);
+}
+
+int main(int argc, char** argv) {
+  std::fprintf(stderr, "========================================\n");
+  std::fprintf(stderr, "FlexSDR IQ Playback\n");
+  std::fprintf(stderr, "PID: %d\n", getpid());
+  std::fprintf(stderr, "========================================\n\n");
+
+  if (argc < 3) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  std::string cfg_path = argv[1];
+  flexsdr::IqPlayback::options opt;
+  opt.path = argv[2];
+  opt.ring_name.clear();
+  opt.pool_name.clear();
+
+  for (int i = 3; i < argc; i++) {
+    const std::string a = argv[i];
+    const bool has_val = (i + 1 < argc);
+    if (a == "--ring" && has_val)           opt.ring_name       = argv[++i];
+    else if (a == "--pool" && has_val)      opt.pool_name       = argv[++i];
+    else if (a == "--spp" && has_val)       opt.spp             = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--hdr" && has_val)       opt.vrt_hdr_bytes   = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--rate" && has_val)      opt.sample_rate     = std::strtod(argv[++i], nullptr);
+    else if (a == "--channels" && has_val)  opt.num_channels    = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--mult" && has_val)      opt.rate_multiplier = std::strtod(argv[++i], nullptr);
+    else if (a == "--burst" && has_val)     opt.burst           = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--cpu" && has_val)       opt.cpu             = std::atoi(argv[++i]);
+    else if (a == "--loop")                 opt.loop            = true;
+    else if (a == "--block")                opt.block_on_full   = true;
+    else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  setup_signal_handlers();
+
+  flexsdr::conf::PrimaryConfig cfg;
+  int cfg_rc = flexsdr::conf::load_from_yaml(cfg_path.c_str(), cfg);
+  if (cfg_rc) {
+    std::fprintf(stderr, "[iq_playback] ERROR: Failed to load config (rc=%d)\n", cfg_rc);
+    return 1;
+  }
+
+  std::fprintf(stderr, "[iq_playback] Initializing DPDK EAL in secondary mode...\n");
+  flexsdr::EalBootstrap eal(cfg, "flexsdr-iq-playback");
+  eal.build_args({"--proc-type=secondary"});
+
+  int eal_rc = eal.init();
+  if (eal_rc < 0) {
+    std::fprintf(stderr, "[iq_playback] ERROR: EAL initialization failed (rc=%d)\n", eal_rc);
+    std::fprintf(stderr, "[iq_playback] Is the primary process running?\n");
+    return 1;
+  }
+
+  flexsdr::FlexSDRSecondary secondary_app(cfg_path);
+  int rc = secondary_app.init_resources();
+  if (rc) {
+    std::fprintf(stderr, "[iq_playback] ERROR: Resource lookup failed (rc=%d)\n", rc);
+    return 1;
+  }
+
+  if (opt.ring_name.empty() && secondary_app.rx_ring_for_queue(0)) {
+    opt.ring_name = secondary_app.rx_ring_for_queue(0)->name;
+  }
+  if (opt.pool_name.empty() && secondary_app.pool_for_queue(0)) {
+    opt.pool_name = secondary_app.pool_for_queue(0)->name;
+  }
+
+  flexsdr::IqPlayback playback(secondary_app, opt);
+  rc = playback.start();
+  if (rc) {
+    std::fprintf(stderr, "[iq_playback] ERROR: start failed (rc=%d)\n", rc);
+    return 1;
+  }
+
+  std::fprintf(stderr, "[iq_playback] Playing. Press Ctrl+C to stop...\n\n");
+
+  unsigned elapsed = 0;
+  while (!g_shutdown_requested.load() && !playback.finished()) {
+    sleep(1);
+    elapsed++;
+    const auto s = playback.get_stats();
+    std::fprintf(stderr, "[iq_playback] %us: packets=%lu samples=%lu loops=%lu ring_full=%lu alloc_fail=%lu late=%lu\n",
+                 elapsed, s.packets, s.samples, s.loops, s.ring_full_drops, s.mbuf_alloc_fails, s.late_bursts);
+  }
+
+  playback.stop();
+  std::fprintf(stderr, "\n[iq_playback] Shutdown complete.\n");
+  return 0;
+}
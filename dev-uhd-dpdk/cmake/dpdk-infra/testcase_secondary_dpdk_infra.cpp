@@ -14,6 +14,7 @@
 #include "conf/config_params.hpp"
 #include "transport/flexsdr_secondary.hpp"
 #include "transport/eal_bootstrap.hpp"
+#include "transport/mbuf_stamp.hpp"
 
 // Global flag for graceful shutdown
 static std::atomic<bool> g_shutdown_requested{false};
@@ -121,6 +122,12 @@ int main(int argc, char** argv) {
   for (const auto& ring : rx_rings) {
     std::fprintf(stderr, "    * %s (size=%u)\n", ring->name, rte_ring_get_size(ring));
   }
+  if (const auto* ctl = secondary_app.ctl()) {
+    std::fprintf(stderr, "  - control memzone: %u entries, primary role=%s, attach slot %d\n",
+                 ctl->n_entries, ctl->role, secondary_app.ctl_slot());
+  } else {
+    std::fprintf(stderr, "  - control memzone: not found (resolved by name)\n");
+  }
   std::fprintf(stderr, "\n[ue] Secondary process is ready!\n");
   std::fprintf(stderr, "[ue] Generating and sending IQ samples to primary...\n");
   std::fprintf(stderr, "[ue] Press Ctrl+C to shutdown gracefully...\n\n");
@@ -236,6 +243,10 @@ int main(int argc, char** argv) {
     // 2. Use round-robin to different rings
     // 3. Send different data to each ring
     rte_ring* ring = tx_rings[0];  // Use first ring
+
+    // Recycled mbufs keep their last enqueue stamp; restamp for the switch
+    const uint64_t now = rte_get_tsc_cycles();
+    for (unsigned i = 0; i < batch_size; i++) flexsdr::mbuf_stamp_set(mbufs[i], now);
     
     // Enqueue the burst of mbufs
     unsigned n_sent = rte_ring_enqueue_burst(ring, reinterpret_cast<void**>(mbufs), 
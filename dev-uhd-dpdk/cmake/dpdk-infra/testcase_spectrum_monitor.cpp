@@ -0,0 +1,146 @@
+/**
+ * @file testcase_spectrum_monitor.cpp
+ * @brief Live power / spectrum of a tap point, exported through DPDK telemetry
+ *
+ * Runs as a DPDK secondary next to testcase_traffic_switch:
+ * - Creates the tap ring + control block (default name "iq_mon_tap") and
+ *   asks producers to clone only one packet in --every
+ * - Averages PSD and RMS power per channel on its own thread
+ * - Prints a one-line summary per second; the full PSD is read with
+ *   dpdk-telemetry.py (/flexsdr/spectrum/psd,<name>,<chan>)
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <csignal>
+#include <atomic>
+#include <unistd.h>
+
+#include "conf/config_params.hpp"
+#include "transport/eal_bootstrap.hpp"
+#include "workers/spectrum_monitor.hpp"
+
+// Global flag for graceful shutdown
+static std::atomic<bool> g_shutdown_requested{false};
+
+static void signal_handler(int signum) {
+  std::fprintf(stderr, "\n[spectrum_monitor] caught signal %d, requesting shutdown...\n", signum);
+  g_shutdown_requested.store(true);
+}
+
+static void setup_signal_handlers() {
+  signal(SIGINT, signal_handler);
+  signal(SIGTERM, signal_handler);
+}
+
+static void usage(const char* prog) {
+  std::fprintf(stderr, "Usage: %s <config.yaml> [options]\n", prog);
+  std::fprintf(stderr, "Options:\n");
+  std::fprintf(stderr, "  --name NAME      telemetry name (default mon0)\n");
+  std::fprintf(stderr, "  --tap NAME       tap point name (default iq_mon_tap)\n");
+  std::fprintf(stderr, "  --every N        producers clone 1 packet in N (default 16)\n");
+  std::fprintf(stderr, "  --hdr BYTES      per-packet header to skip (default 32, 0 = raw IQ)\n");
+  std::fprintf(stderr, "  --chans N        interleaved channels per sample (default 1)\n");
+  std::fprintf(stderr, "  --fft N          FFT size, power of two (default 1024)\n");
+  std::fprintf(stderr, "  --avg N          frames per published PSD (default 64)\n");
+  std::fprintf(stderr, "  --rate HZ        sample rate, for reporting (default 30.72e6)\n");
+  std::fprintf(stderr, "  --freq HZ        center frequency, for reporting (default 3.5e9)\n");
+  std::fprintf(stderr, "  --cpu N          pin monitor thread to CPU N\n");
+  std::fprintf(stderr, "  --seconds N      stop after N seconds (default: until Ctrl+C)\n");
+  std::fprintf(stderr, "Example: %s conf/configurations-unified.yaml --hdr 0 --every 8\n", prog);
+}
+
+int main(int argc, char** argv) {
+  std::fprintf(stderr, "========================================\n");
+  std::fprintf(stderr, "FlexSDR Spectrum Monitor\n");
+  std::fprintf(stderr, "PID: %d\n", getpid());
+  std::fprintf(stderr, "========================================\n\n");
+
+  if (argc < 2) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  std::string cfg_path = argv[1];
+  flexsdr::SpectrumMonitor::options opt;
+  unsigned seconds = 0;
+
+  for (int i = 2; i < argc; i++) {
+    const std::string a = argv[i];
+    const bool has_val = (i + 1 < argc);
+    if (a == "--name" && has_val)           opt.name          = argv[++i];
+    else if (a == "--tap" && has_val)       opt.tap_name      = argv[++i];
+    else if (a == "--every" && has_val)     opt.sample_every  = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--hdr" && has_val)       opt.vrt_hdr_bytes = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--chans" && has_val)     opt.num_channels  = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--fft" && has_val)       opt.fft_size      = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--avg" && has_val)       opt.avg_frames    = std::strtoul(argv[++i], nullptr, 0);
+    else if (a == "--rate" && has_val)      opt.sample_rate   = std::strtod(argv[++i], nullptr);
+    else if (a == "--freq" && has_val)      opt.center_freq   = std::strtod(argv[++i], nullptr);
+    else if (a == "--cpu" && has_val)       opt.cpu           = std::atoi(argv[++i]);
+    else if (a == "--seconds" && has_val)   seconds           = std::strtoul(argv[++i], nullptr, 0);
+    else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  setup_signal_handlers();
+
+  flexsdr::conf::PrimaryConfig cfg;
+  int cfg_rc = flexsdr::conf::load_from_yaml(cfg_path.c_str(), cfg);
+  if (cfg_rc) {
+    std::fprintf(stderr, "[spectrum_monitor] ERROR: Failed to load config (rc=%d)\n", cfg_rc);
+    return 1;
+  }
+
+  std::fprintf(stderr, "[spectrum_monitor] Initializing DPDK EAL in secondary mode...\n");
+  flexsdr::EalBootstrap eal(cfg, "flexsdr-spectrum-monitor");
+  eal.build_args({"--proc-type=secondary"});
+
+  int eal_rc = eal.init();
+  if (eal_rc < 0) {
+    std::fprintf(stderr, "[spectrum_monitor] ERROR: EAL initialization failed (rc=%d)\n", eal_rc);
+    std::fprintf(stderr, "[spectrum_monitor] Is the primary process running?\n");
+    return 1;
+  }
+
+  flexsdr::SpectrumMonitor mon(opt);
+  int rc = mon.start();
+  if (rc) {
+    std::fprintf(stderr, "[spectrum_monitor] ERROR: start failed (rc=%d)\n", rc);
+    return 1;
+  }
+
+  std::fprintf(stderr, "[spectrum_monitor] Monitoring tap '%s' as '%s'. Press Ctrl+C to stop...\n\n",
+               opt.tap_name.c_str(), opt.name.c_str());
+
+  unsigned elapsed = 0;
+  while (!g_shutdown_requested.load()) {
+    sleep(1);
+    elapsed++;
+    const auto s = mon.get_stats();
+    std::fprintf(stderr, "[spectrum_monitor] %us: packets=%lu frames=%lu tap_drops=%lu cpu=%.2f%%",
+                 elapsed, s.packets, s.frames, s.tap_drops, s.cpu_load * 100.0);
+
+    for (unsigned c = 0; c < mon.opts().num_channels; c++) {
+      flexsdr::SpectrumMonitor::snapshot sn;
+      if (!mon.get_snapshot(c, sn)) continue;
+      std::fprintf(stderr, " | ch%u rms=%.1f dBFS", c, sn.rms_dbfs);
+      if (sn.psd_dbfs.empty()) continue;
+      size_t pk = 0;
+      for (size_t k = 1; k < sn.psd_dbfs.size(); k++) {
+        if (sn.psd_dbfs[k] > sn.psd_dbfs[pk]) pk = k;
+      }
+      const double off = (double(pk) - double(sn.psd_dbfs.size() / 2)) * opt.sample_rate / sn.psd_dbfs.size();
+      std::fprintf(stderr, " peak %.1f dBFS @ %+.3f MHz", sn.psd_dbfs[pk], off / 1e6);
+    }
+    std::fprintf(stderr, "\n");
+    if (seconds && elapsed >= seconds) break;
+  }
+
+  mon.stop();
+  return 0;
+}
@@ -8,6 +8,28 @@
  * - Switches traffic: ue_tx_ch1 → gnb_inbound_ring
  * 
  * This simulates the interconnect between GNB and UE without requiring separate processes.
+ *
+ * Optional tap spec "<src_ring>:<tap_name>" (argv[2]) clones every packet
+ * switched from <src_ring> onto the named tap point (see testcase_iq_recorder).
+ *
+ * Routes, burst size and idle sleep come from the "tunables:" section of the
+ * config and are reloaded live when the file changes or on SIGHUP.
+ *
+ * Scheduling (per pass):
+ * - "control" routes are strict priority: drained before any bulk route and
+ *   polled again after every bulk burst, so a timing burst waits for at most
+ *   one bulk burst
+ * - "bulk" routes share what is left by deficit round-robin, each getting
+ *   weight * burst packets per round while it has backlog
+ * - A route only forwards what its destination can take (bulk leaves
+ *   'reserve' slots free for control traffic); the rest waits and is
+ *   dropped once older than the route's max_age_us, judged by the
+ *   producer's enqueue stamp (transport/mbuf_stamp.hpp). With max_age_us
+ *   set and the destination full, one burst is pulled and held so its
+ *   stale head still ages out
+ * - Every dequeue/enqueue refreshes the rings' back-pressure flags (RingSpec
+ *   hi_wm/lo_wm), so a producer held at its high watermark is released as
+ *   soon as the switch drains the ring to the low one
  */
 
 #include <cstdio>
@@ -17,13 +39,19 @@
 #include <csignal>
 #include <atomic>
 #include <unistd.h>
+#include <algorithm>
+#include <vector>
 
+#include <rte_cycles.h>
 #include <rte_mbuf.h>
 #include <rte_ring.h>
 
 #include "conf/config_params.hpp"
 #include "transport/flexsdr_primary.hpp"
 #include "transport/eal_bootstrap.hpp"
+#include "transport/mbuf_stamp.hpp"
+#include "transport/shm_control.hpp"
+#include "workers/iq_tap.hpp"
 
 // Global flag for graceful shutdown
 static std::atomic<bool> g_shutdown_requested{false};
@@ -46,14 +74,29 @@ int main(int argc, char** argv) {
   std::fprintf(stderr, "========================================\n\n");
 
   if (argc < 2) {
-    std::fprintf(stderr, "Usage: %s <config.yaml>\n", argv[0]);
+    std::fprintf(stderr, "Usage: %s <config.yaml> [<src_ring>:<tap_name>]\n", argv[0]);
     std::fprintf(stderr, "Example: %s conf/configurations-unified.yaml\n", argv[0]);
+    std::fprintf(stderr, "Example: %s conf/configurations-unified.yaml gnb_tx_ch1:iq_rec_tap\n", argv[0]);
     return 2;
   }
 
   std::string cfg_path = argv[1];
   std::fprintf(stderr, "[traffic_switch] Loading config from: %s\n", cfg_path.c_str());
 
+  // Optional IQ tap on one switched direction
+  std::string tap_src, tap_name;
+  if (argc >= 3) {
+    const std::string spec = argv[2];
+    const auto colon = spec.find(':');
+    if (colon == std::string::npos || colon == 0 || colon + 1 == spec.size()) {
+      std::fprintf(stderr, "[traffic_switch] ERROR: bad tap spec '%s' (want <src_ring>:<tap_name>)\n", spec.c_str());
+      return 2;
+    }
+    tap_src  = spec.substr(0, colon);
+    tap_name = spec.substr(colon + 1);
+    std::fprintf(stderr, "[traffic_switch] Tap: %s -> %s\n", tap_src.c_str(), tap_name.c_str());
+  }
+
   setup_signal_handlers();
 
   // Enable verbose DPDK logging
@@ -165,101 +208,310 @@ int main(int argc, char** argv) {
     return 1;
   }
   rte_mempool* pool = pools[0];
+
+  // The recorder may start before or after us; the tap point resolves lazily.
+  flexsdr::IqTapPoint tap(tap_name.empty() ? "none" : tap_name);
+
+  // Routes and loop pacing come from the live tunables (YAML "tunables:"),
+  // re-read on file change or SIGHUP without restarting the switch.
+  primary_app.watch_tunables();
+  auto tunables = primary_app.tunables();
+  const int tun_slot = tunables->register_reader();
+
+  auto find_ring = [&](const std::string& name) -> rte_ring* {
+    for (auto* r : tx_rings) if (name == r->name) return r;
+    for (auto* r : rx_rings) if (name == r->name) return r;
+    for (auto* r : primary_app.ic_tx_rings()) if (name == r->name) return r;
+    for (auto* r : primary_app.ic_rx_rings()) if (name == r->name) return r;
+    return nullptr;
+  };
+
+  struct route {
+    std::string name;
+    rte_ring*   src;
+    rte_ring*   dst;
+    flexsdr::shm_ring_bp* src_bp;  // watermarks, null = none
+    flexsdr::shm_ring_bp* dst_bp;
+    bool        tap;
+    bool        control;
+    unsigned    weight;
+    uint64_t    max_age_tsc;     // 0 = no age limit
+    unsigned    deficit;         // DRR credit, packets
+    uint64_t    total;
+    uint64_t    age_drops;       // dropped for exceeding max_age_us
+    uint64_t    full_drops;      // dequeued but rejected by the destination
+    uint64_t    blocked;         // passes the destination had no room
+    uint64_t    max_wait_tsc;    // oldest forwarded packet since the last status
+    std::vector<void*> held;     // dequeued while the destination was full, oldest first
+  };
+  std::vector<route> routes;
+  uint64_t routes_gen = 0;
+  const uint64_t tsc_hz = rte_get_tsc_hz();
+  auto tsc_to_us = [&](uint64_t c) -> unsigned long {
+    return static_cast<unsigned long>(c * 1000000.0 / tsc_hz);
+  };
+
+  // Rebuild the route table when a new tunables generation shows up.
+  // Counters and held packets survive for routes that stay; unknown rings
+  // are skipped.
+  auto rebuild_routes = [&](const flexsdr::conf::Tunables& t) {
+    std::vector<flexsdr::conf::Tunables::Route> want = t.routes;
+    if (want.empty()) {
+      want = {{"gnb_tx_ch1", "ue_inbound_ring"}, {"ue_tx_ch1", "gnb_inbound_ring"}};
+    }
+    std::vector<route> next;
+    for (const auto& w : want) {
+      rte_ring* src = find_ring(w.src);
+      rte_ring* dst = find_ring(w.dst);
+      if (!src || !dst) {
+        std::fprintf(stderr, "[traffic_switch] route %s -> %s: unknown ring, skipped\n",
+                     w.src.c_str(), w.dst.c_str());
+        continue;
+      }
+      route r{};
+      r.name        = w.src + "->" + w.dst;
+      r.src         = src;
+      r.dst         = dst;
+      r.src_bp      = flexsdr::shm_ctl_bp(primary_app.ctl(), src);
+      r.dst_bp      = flexsdr::shm_ctl_bp(primary_app.ctl(), dst);
+      r.tap         = w.src == tap_src;
+      r.control     = w.control;
+      r.weight      = w.weight;
+      r.max_age_tsc = w.max_age_us * tsc_hz / 1000000;
+      for (auto& old : routes) {
+        if (old.name != r.name) continue;
+        r.total      = old.total;
+        r.age_drops  = old.age_drops;
+        r.full_drops = old.full_drops;
+        r.blocked    = old.blocked;
+        r.held       = std::move(old.held);
+        old.held.clear();
+      }
+      next.push_back(std::move(r));
+    }
+    for (auto& old : routes) {
+      if (old.held.empty()) continue;
+      rte_pktmbuf_free_bulk(reinterpret_cast<rte_mbuf**>(old.held.data()), old.held.size());
+    }
+    // Control routes first: the strict-priority pass walks them in order
+    std::stable_partition(next.begin(), next.end(), [](const route& r) { return r.control; });
+    routes = std::move(next);
+    routes_gen = t.generation;
+    std::fprintf(stderr, "[traffic_switch] routes (gen %lu): %zu active, burst=%u idle_us=%u reserve=%u\n",
+                 routes_gen, routes.size(), t.switch_burst, t.switch_idle_us, t.switch_reserve);
+    for (const auto& r : routes) {
+      std::fprintf(stderr, "  - %s %s", r.name.c_str(), r.control ? "control" : "bulk");
+      if (!r.control) std::fprintf(stderr, " weight=%u", r.weight);
+      if (r.max_age_tsc) std::fprintf(stderr, " max_age=%luus", tsc_to_us(r.max_age_tsc));
+      std::fprintf(stderr, "%s\n", r.tap ? " [tap]" : "");
+    }
+    if (flexsdr::mbuf_stamp_offset() < 0) {
+      for (const auto& r : routes) {
+        if (!r.max_age_tsc) continue;
+        std::fprintf(stderr, "[traffic_switch] WARNING: no enqueue stamp field; max_age_us is inactive\n");
+        break;
+      }
+    }
+  };
+  rebuild_routes(*tunables->get());
+
+  if (!tap_src.empty()) {
+    bool found = false;
+    for (const auto& r : routes) found = found || r.tap;
+    if (!found) {
+      std::fprintf(stderr, "[traffic_switch] ERROR: tap source %s is not the source of any route\n",
+                   tap_src.c_str());
+      return 2;
+    }
+  }
   
   std::fprintf(stderr, "\n========================================\n");
   std::fprintf(stderr, "Traffic Switcher Running\n");
   std::fprintf(stderr, "========================================\n");
   std::fprintf(stderr, "Waiting for traffic from secondary processes...\n");
-  std::fprintf(stderr, "Traffic flow:\n");
-  std::fprintf(stderr, "  1. GNB → UE: gnb_tx_ch1 → ue_inbound_ring\n");
-  std::fprintf(stderr, "  2. UE → GNB: ue_tx_ch1 → gnb_inbound_ring\n");
-  std::fprintf(stderr, "========================================\n");
   std::fprintf(stderr, "Ready for secondary-gnb and secondary-ue to connect.\n");
+  std::fprintf(stderr, "Edit the tunables section of %s (or send SIGHUP) to change routes live.\n",
+               cfg_path.c_str());
   std::fprintf(stderr, "Press Ctrl+C to shutdown...\n\n");
   
-  uint64_t total_gnb_to_ue = 0;
-  uint64_t total_ue_to_gnb = 0;
   uint64_t loop_count = 0;
-  
-  // Main traffic switching loop - runs continuously until interrupted
-  while (!g_shutdown_requested.load()) {
-    loop_count++;
-    bool switched_traffic = false;
-    
-    // ===== Part 1: Switch GNB → UE traffic =====
-    const unsigned batch_size = 32;
-    void* gnb_mbufs[batch_size];
-    
-    // Dequeue from gnb_tx_ch1 (traffic from secondary GNB)
-    unsigned n = rte_ring_dequeue_burst(gnb_tx_ch1, gnb_mbufs, batch_size, nullptr);
-    if (n > 0) {
-      // Forward to ue_inbound_ring (deliver to secondary UE)
-      unsigned enqueued = rte_ring_enqueue_burst(ue_inbound_ring, gnb_mbufs, n, nullptr);
+  constexpr unsigned MAX_BURST = 256;
+  void* mbufs[MAX_BURST];
+
+  // Move up to 'max' packets along one route; returns how many were taken
+  // off the source (forwarded or dropped).
+  auto forward = [&](route& r, unsigned max, unsigned reserve,
+                     const flexsdr::conf::Tunables& t) -> unsigned {
+    // Leave what the destination cannot take in the source ring
+    const unsigned room = rte_ring_free_count(r.dst);
+    const unsigned want = max;
+    max = std::min(max, room > reserve ? room - reserve : 0u);
+    const bool aging = r.max_age_tsc && flexsdr::mbuf_stamp_offset() >= 0;
+
+    // Packets held back while the destination was full go first: they are
+    // older than anything still in the source ring
+    void** pkts = mbufs;
+    unsigned n = 0;
+    if (!r.held.empty()) {
+      pkts = r.held.data();
+      n = static_cast<unsigned>(r.held.size());
+    } else if (max || aging) {
+      // With the destination full, still pull a burst (and hold it) so the
+      // stale head of the source ages out instead of waiting for room
+      unsigned left = 0;
+      n = rte_ring_dequeue_burst(r.src, mbufs, max ? max : want, &left);
+      shm_bp_update(r.src_bp, left);
+    }
+    if (n == 0) {
+      if (!max && !rte_ring_empty(r.src)) r.blocked++;
+      return 0;
+    }
+
+    // One producer per source ring, so stamps ascend: the stale packets are
+    // a prefix of the burst and the first fresh one ends the scan
+    unsigned first = 0;
+    const uint64_t now = rte_get_tsc_cycles();
+    for (; first < n; first++) {
+      const uint64_t stamp = flexsdr::mbuf_stamp_get(static_cast<rte_mbuf*>(pkts[first]));
+      const uint64_t age = stamp && now > stamp ? now - stamp : 0;
+      if (!r.max_age_tsc || age <= r.max_age_tsc) {
+        if (max) r.max_wait_tsc = std::max(r.max_wait_tsc, age);
+        break;
+      }
+    }
+    if (first) {
+      rte_pktmbuf_free_bulk(reinterpret_cast<rte_mbuf**>(pkts), first);
+      r.age_drops += first;
+    }
+
+    void** fwd = pkts + first;
+    const unsigned nf = std::min(n - first, max);
+    if (nf) {
+      // Clone before forwarding: once enqueued the receiver may free the mbufs
+      if (r.tap) tap.push(reinterpret_cast<rte_mbuf* const*>(fwd), nf);
+
+      // The stamp has been read; clear it so a receiver that re-enqueues
+      // the mbuf, or a later user of it from the pool, is not aged by it
+      for (unsigned i = 0; i < nf; i++) flexsdr::mbuf_stamp_clear(static_cast<rte_mbuf*>(fwd[i]));
+
+      unsigned free_space = 0;
+      const unsigned enqueued = rte_ring_enqueue_burst(r.dst, fwd, nf, &free_space);
+      shm_bp_update(r.dst_bp, rte_ring_get_capacity(r.dst) - free_space);
       if (enqueued > 0) {
-        total_gnb_to_ue += enqueued;
-        switched_traffic = true;
-        
-        // Log first packet in batch
-        if (total_gnb_to_ue <= 3 || (total_gnb_to_ue % 100 == 0)) {
-          rte_mbuf* m = static_cast<rte_mbuf*>(gnb_mbufs[0]);
+        const uint64_t before = r.total;
+        r.total += enqueued;
+
+        // Log first packets and then one batch per log_every packets
+        if (before < 3 ||
+            (t.switch_log_every && before / t.switch_log_every != r.total / t.switch_log_every)) {
+          rte_mbuf* m = static_cast<rte_mbuf*>(fwd[0]);
           int16_t* data = rte_pktmbuf_mtod(m, int16_t*);
-          std::fprintf(stderr, "[traffic_switch] GNB→UE: switched %u packets (total=%lu) | Sample: I=%d, Q=%d\n",
-                      enqueued, total_gnb_to_ue, data[0], data[1]);
+          std::fprintf(stderr, "[traffic_switch] %s: switched %u packets (total=%lu) | Sample: I=%d, Q=%d\n",
+                       r.name.c_str(), enqueued, r.total, data[0], data[1]);
         }
       }
-      
-      // Free any packets that couldn't be enqueued
-      for (unsigned i = enqueued; i < n; i++) {
-        rte_pktmbuf_free(static_cast<rte_mbuf*>(gnb_mbufs[i]));
+
+      // Only another producer on the destination can have taken the room
+      if (enqueued < nf) {
+        rte_pktmbuf_free_bulk(reinterpret_cast<rte_mbuf**>(fwd + enqueued), nf - enqueued);
+        r.full_drops += nf - enqueued;
       }
+    } else if (!max && !first) {
+      r.blocked++;
     }
-    
-    // ===== Part 2: Switch UE → GNB traffic =====
-    void* ue_mbufs[batch_size];
-    
-    // Dequeue from ue_tx_ch1 (traffic from secondary UE)
-    n = rte_ring_dequeue_burst(ue_tx_ch1, ue_mbufs, batch_size, nullptr);
-    if (n > 0) {
-      // Forward to gnb_inbound_ring (deliver to secondary GNB)
-      unsigned enqueued = rte_ring_enqueue_burst(gnb_inbound_ring, ue_mbufs, n, nullptr);
-      if (enqueued > 0) {
-        total_ue_to_gnb += enqueued;
-        switched_traffic = true;
-        
-        // Log first packet in batch
-        if (total_ue_to_gnb <= 3 || (total_ue_to_gnb % 100 == 0)) {
-          rte_mbuf* m = static_cast<rte_mbuf*>(ue_mbufs[0]);
-          int16_t* data = rte_pktmbuf_mtod(m, int16_t*);
-          std::fprintf(stderr, "[traffic_switch] UE→GNB: switched %u packets (total=%lu) | Sample: I=%d, Q=%d\n",
-                      enqueued, total_ue_to_gnb, data[0], data[1]);
-        }
+
+    // Whatever the destination could not take yet waits in r.held
+    const unsigned done = first + nf;
+    if (pkts == mbufs) r.held.assign(mbufs + done, mbufs + n);
+    else               r.held.erase(r.held.begin(), r.held.begin() + done);
+    return done;
+  };
+
+  // Strict priority: drain every control route (short burst = ring ran dry).
+  auto serve_control = [&](unsigned batch, const flexsdr::conf::Tunables& t) -> bool {
+    bool moved = false;
+    for (auto& r : routes) {
+      if (!r.control) break;
+      unsigned got;
+      while ((got = forward(r, batch, 0, t)) > 0) {
+        moved = true;
+        if (got < batch) break;
       }
-      
-      // Free any packets that couldn't be enqueued
-      for (unsigned i = enqueued; i < n; i++) {
-        rte_pktmbuf_free(static_cast<rte_mbuf*>(ue_mbufs[i]));
+    }
+    return moved;
+  };
+
+  // Main traffic switching loop - runs continuously until interrupted
+  while (!g_shutdown_requested.load()) {
+    loop_count++;
+    bool switched_traffic = false;
+
+    // Snapshot is valid until quiescent() at the bottom of the loop
+    const flexsdr::conf::Tunables* t = tunables->get();
+    if (t->generation != routes_gen) rebuild_routes(*t);
+    const unsigned batch_size = std::min(t->switch_burst, MAX_BURST);
+
+    switched_traffic |= serve_control(batch_size, *t);
+
+    // Deficit round-robin over bulk routes, in bursts of at most batch_size
+    for (auto& r : routes) {
+      if (r.control) continue;
+      if (r.held.empty() && rte_ring_empty(r.src)) {
+        r.deficit = 0;         // no credit banked while idle
+        continue;
       }
+      const unsigned quantum = r.weight * batch_size;
+      r.deficit = std::min(r.deficit + quantum, 2 * quantum);
+      while (r.deficit > 0) {
+        const unsigned got = forward(r, std::min(r.deficit, batch_size), t->switch_reserve, *t);
+        if (got == 0) break;
+        r.deficit -= got;
+        switched_traffic = true;
+        switched_traffic |= serve_control(batch_size, *t);
+      }
+      if (r.held.empty() && rte_ring_empty(r.src)) r.deficit = 0;
     }
-    
+
     // Print periodic status
     if (loop_count % 10000 == 0) {
-      std::fprintf(stderr, "[traffic_switch] Status: GNB→UE=%lu, UE→GNB=%lu packets\n",
-                  total_gnb_to_ue, total_ue_to_gnb);
+      std::fprintf(stderr, "[traffic_switch] Status:");
+      for (auto& r : routes) {
+        std::fprintf(stderr, " %s=%lu", r.name.c_str(), r.total);
+        if (r.age_drops || r.full_drops || r.blocked) {
+          std::fprintf(stderr, " (aged=%lu full=%lu blocked=%lu)", r.age_drops, r.full_drops, r.blocked);
+        }
+        std::fprintf(stderr, " wait<=%luus", tsc_to_us(r.max_wait_tsc));
+        if (flexsdr::shm_bp_asserted(r.src_bp)) std::fprintf(stderr, " [bp]");
+        r.max_wait_tsc = 0;
+      }
+      std::fprintf(stderr, " packets\n");
     }
-    
+
     // Small sleep to avoid busy-waiting when no traffic
-    if (!switched_traffic) {
-      usleep(100);  // 100us sleep if no traffic to switch
+    const unsigned idle_us = t->switch_idle_us;
+    tunables->quiescent(tun_slot);
+    if (!switched_traffic && idle_us) {
+      usleep(idle_us);
     }
   }
+  tunables->unregister_reader(tun_slot);
+  for (auto& r : routes) {
+    if (r.held.empty()) continue;
+    rte_pktmbuf_free_bulk(reinterpret_cast<rte_mbuf**>(r.held.data()), r.held.size());
+    r.held.clear();
+  }
   
   std::fprintf(stderr, "\n========================================\n");
   std::fprintf(stderr, "Traffic Switcher Shutting Down\n");
   std::fprintf(stderr, "========================================\n");
   std::fprintf(stderr, "Final Statistics:\n");
-  std::fprintf(stderr, "  - GNB→UE packets switched: %lu\n", total_gnb_to_ue);
-  std::fprintf(stderr, "  - UE→GNB packets switched: %lu\n", total_ue_to_gnb);
-  std::fprintf(stderr, "  - Total packets switched: %lu\n", total_gnb_to_ue + total_ue_to_gnb);
+  uint64_t total = 0;
+  for (const auto& r : routes) {
+    std::fprintf(stderr, "  - %s packets switched: %lu (dropped: %lu aged, %lu dst full; blocked passes: %lu)\n",
+                 r.name.c_str(), r.total, r.age_drops, r.full_drops, r.blocked);
+    total += r.total;
+  }
+  std::fprintf(stderr, "  - Total packets switched: %lu\n", total);
   std::fprintf(stderr, "========================================\n");
   
   std::fprintf(stderr, "\n[traffic_switch] Shutdown complete.\n");
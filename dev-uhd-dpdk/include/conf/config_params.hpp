@@ -4,6 +4,8 @@
 #include <vector>
 #include <optional>
 
+#include "conf/tunables.hpp"
+
 namespace flexsdr {
 namespace conf {
 
@@ -37,21 +39,62 @@ struct EalConfig {
   std::optional<std::string> lcores;             // --lcores
   std::optional<int>         main_lcore;         // --main-lcore
   std::optional<std::string> socket_limit;       // --socket-limit
+
+  // Pre-flight check run by EalBootstrap::init before rte_eal_init:
+  // "off" | "warn" (report only) | "strict" (refuse to start on any finding)
+  std::string              preflight{"warn"};
 };
 
 // -------- Rings / Pools -----------------------------------------------------
 struct RingSpec {
   std::string name;
   unsigned    size{512};
+  // Back-pressure watermarks, percent of size (YAML: hi_wm, lo_wm). A
+  // producer leaving the ring at or above hi_wm raises the ring's flag in
+  // the control memzone; it drops once occupancy is back at or below lo_wm
+  // (default hi_wm / 2). hi_wm 0 = no back-pressure.
+  unsigned    hi_wm{0};
+  unsigned    lo_wm{0};
 };
 
 struct PoolSpec {
   std::string name;        // base name (e.g., "ue_inbound_pool")
-  unsigned    size{8192};  // total mbufs
+  unsigned    size{8192};  // total mbufs              (YAML: size | n)
   unsigned    elt_size{2048};
-  unsigned    cache_size{256};  // per-lcore cache (new: fixes prior build errors)
+  unsigned    cache_size{256};  // per-lcore cache     (YAML: cache_size | cache)
+                                // (also sizes the per-thread caches of secondaries)
+  // Mempool driver (YAML: ops | mempool_ops): ring_mp_mc, ring_sp_sc, ring_mp_sc,
+  // ring_sp_mc, stack, lf_stack. Empty = DPDK's default. The single-producer /
+  // single-consumer variants are only safe with one freeing and one allocating
+  // thread across all processes (e.g. one TX thread feeding the primary).
+  std::string ops;
 };
 
+// -------- Sizing ------------------------------------------------------------
+// High-level stream parameters (YAML: defaults.sizing). When present,
+// load_from_yaml derives ring/pool sizes per direction from them and uses the
+// result wherever the explicit field (ring size, pool n/elt_size/cache) is absent.
+struct StreamSizing {
+  double      sample_rate{0};   // samples/s per channel (required)
+  unsigned    spp{1024};        // samples per channel per packet
+  std::string otw;              // sc16 | sc12 | sc8 | fc32; empty = defaults.data_format
+  double      buffer_ms{10.0};  // target queueing per ring
+  unsigned    hdr_bytes{32};    // per-packet header (VRT / pkt_header)
+};
+
+struct DerivedSizing {
+  unsigned ring_size{0};        // power of two, holds >= buffer_ms of packets
+  unsigned nb_mbuf{0};          // 2^k - 1 (mempool's preferred size)
+  unsigned elt_size{0};         // header + one packet of samples, 64B aligned
+  unsigned cache_size{0};
+  double   pkts_per_sec{0};
+};
+
+// Pure function so tools/tests can print the table without a YAML file.
+// Returns false (and leaves 'out' untouched) if the parameters are unusable.
+bool derive_sizing(const StreamSizing& s, unsigned num_channels,
+                   const std::string& default_otw, DerivedSizing& out);
+
 // -------- Streams -----------------------------------------------------------
 struct Stream {
   std::string              mode{"planar"};  // or "interleaved"
@@ -83,6 +126,10 @@ struct DefaultConfig {
   Stream      tx_stream{};
   Stream      rx_stream{};
   InterconnectConfig interconnect{}; // present in defaults; used by primaries
+
+  std::optional<StreamSizing>  sizing;     // defaults.sizing (optional)
+  std::optional<DerivedSizing> sized_tx;   // filled by load_from_yaml from 'sizing'
+  std::optional<DerivedSizing> sized_rx;
 };
 
 // -------- Per-role config blocks -------------------------------------------
@@ -103,6 +150,8 @@ struct PrimaryConfig {
 
   std::optional<RoleConfig> primary_gnb;
   std::optional<RoleConfig> gnb;
+
+  Tunables      tunables;   // startup values; see TunablesStore for live ones
 };
 
 // YAML loader (implemented in src/conf/config_params.cpp)
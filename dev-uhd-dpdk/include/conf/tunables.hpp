@@ -0,0 +1,148 @@
+// include/conf/tunables.hpp
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace flexsdr {
+namespace conf {
+
+// -------- Tunables (YAML: top-level "tunables:") ----------------------------
+// Runtime knobs that may change while processes are running. Everything else
+// in PrimaryConfig (rings, pools, EAL) is fixed at startup.
+struct Tunables {
+  struct Route {
+    std::string src;            // ring to drain
+    std::string dst;            // ring to forward to
+    bool        control{false}; // strict priority over bulk routes (YAML class: control|bulk)
+    unsigned    weight{1};      // bulk: deficit round-robin share, quantum = weight * burst packets
+    unsigned    max_age_us{0};  // drop packets queued longer than this (0 = never)
+  };
+
+  // Interconnect switch
+  unsigned           switch_burst{32};       // packets per dequeue (1..256)
+  unsigned           switch_idle_us{100};    // sleep when a pass moved nothing (0 = spin)
+  unsigned           switch_log_every{100};  // log one line per N packets per route (0 = off)
+  unsigned           switch_reserve{0};      // dst ring slots bulk routes leave to control routes
+  std::vector<Route> routes;                 // empty = switch's built-in routes
+
+  // RX streamer poll policy (single-ring recv)
+  unsigned           rx_tight_polls{1000};   // empty polls before sleeping
+  unsigned           rx_poll_sleep_us{1};    // sleep per empty poll after that
+
+  uint64_t           generation{0};          // set by TunablesStore::publish
+};
+
+// Parse only the "tunables:" section of 'path' into 'out' (fields not
+// present keep their value in 'out'). Returns 0, or <0 on YAML errors with
+// 'out' untouched.
+int load_tunables(const char* path, Tunables& out);
+
+/**
+ * Lock-free snapshot of the current Tunables for the data path.
+ *
+ * Quiescent-state RCU: publish() swaps in a new immutable snapshot and
+ * retires the old one; a retired snapshot is freed once every registered
+ * reader has passed a quiescent point after the swap. Readers never block
+ * or take a lock:
+ *
+ *   int slot = store.register_reader();
+ *   for (;;) {
+ *     const Tunables* t = store.get();   // valid until quiescent(slot)
+ *     ... use t ...
+ *     store.quiescent(slot);
+ *   }
+ *   store.unregister_reader(slot);
+ *
+ * Readers that are not registered must not keep the pointer beyond a copy.
+ */
+class TunablesStore {
+public:
+  static constexpr unsigned MAX_READERS = 64;
+
+  explicit TunablesStore(const Tunables& initial);
+  ~TunablesStore();
+
+  TunablesStore(const TunablesStore&) = delete;
+  TunablesStore& operator=(const TunablesStore&) = delete;
+
+  // ---- data path -----------------------------------------------------------
+  int  register_reader();              // slot, or -1 if all are taken
+  void unregister_reader(int slot);
+
+  const Tunables* get() const { return cur_.load(std::memory_order_acquire); }
+
+  void quiescent(int slot) {
+    if (slot >= 0)
+      slots_[slot].seen.store(epoch_.load(std::memory_order_acquire),
+                              std::memory_order_release);
+  }
+
+  // ---- control path --------------------------------------------------------
+  // Never waits for readers: old snapshots are reclaimed on later publishes
+  // (or by the destructor) once all readers have moved on.
+  void     publish(const Tunables& t);
+  uint64_t generation() const { return get()->generation; }
+  size_t   retired_pending() const;
+
+private:
+  struct alignas(64) reader_slot {
+    std::atomic<uint64_t> seen{0};
+    std::atomic<bool>     online{false};
+  };
+
+  void reclaim_();                     // pub_mtx_ held
+
+  std::atomic<const Tunables*> cur_{nullptr};
+  std::atomic<uint64_t>        epoch_{1};
+  reader_slot                  slots_[MAX_READERS];
+
+  mutable std::mutex                                 pub_mtx_;   // writers only
+  std::vector<std::pair<uint64_t, const Tunables*>> retired_;    // (epoch, snapshot)
+};
+
+/**
+ * Re-reads the tunables section of a YAML file and publishes it to a
+ * TunablesStore when the file is rewritten (inotify on its directory, so
+ * editors that save via rename are caught) or on SIGHUP.
+ */
+class TunablesWatcher {
+public:
+  TunablesWatcher(std::string yaml_path, TunablesStore& store);
+  ~TunablesWatcher();
+
+  TunablesWatcher(const TunablesWatcher&) = delete;
+  TunablesWatcher& operator=(const TunablesWatcher&) = delete;
+
+  int  start();    // 0 on success
+  void stop();
+
+  // Route SIGHUP to every running watcher (process-wide handler).
+  static void install_sighup();
+
+  uint64_t reloads()  const { return reloads_.load(std::memory_order_relaxed); }
+  uint64_t failures() const { return failures_.load(std::memory_order_relaxed); }
+
+private:
+  void run_();
+  void reload_(const char* why);
+
+  std::string           path_;
+  std::string           dir_;
+  std::string           base_;
+  TunablesStore&        store_;
+  int                   ifd_ = -1;
+  std::atomic<bool>     stop_req_{false};
+  std::thread           thr_;
+  uint64_t              sighup_seen_ = 0;
+  std::atomic<uint64_t> reloads_{0};
+  std::atomic<uint64_t> failures_{0};
+};
+
+} // namespace conf
+} // namespace flexsdr
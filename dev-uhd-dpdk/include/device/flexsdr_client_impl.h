@@ -6,6 +6,7 @@
 #include <string>
 #include <algorithm>
 #include <cctype>
+#include <vector>
 #include <grpcpp/grpcpp.h>
 #include "flexsdr.grpc.pb.h"
 #include <uhd/types/tune_request.hpp>
@@ -42,39 +43,106 @@ public:
         UNIT_BOTH = int('b'),
     };
 
+    // Per-call behaviour of every RPC (blocking and batched).
+    struct rpc_options {
+        unsigned deadline_ms      = 1000;  // 0 = no deadline
+        unsigned retries          = 2;     // extra attempts on UNAVAILABLE / DEADLINE_EXCEEDED
+        unsigned retry_backoff_ms = 20;    // grows linearly per attempt
+    };
+
+    // One entry of apply_settings(); frequencies use an auto tune request.
+    struct param_change {
+        enum kind_t { RX_GAIN, TX_GAIN, RX_RATE, TX_RATE, RX_FREQ, TX_FREQ, CLOCK_RATE };
+        kind_t   kind;
+        size_t   chan  = 0;
+        double   value = 0.0;
+        uint64_t command_time_ticks = 0;   // gain/freq only; 0 = client command time (if any)
+        uint32_t command_id         = 0;
+    };
+
+    struct param_result {
+        bool        success = false;
+        double      actual  = 0.0;   // frequencies: effective tuned value (RF LO - DSP)
+        std::string error;
+    };
+
     FlexSDRClient(std::shared_ptr<Channel> channel);
+    FlexSDRClient(std::shared_ptr<Channel> channel, const rpc_options& opt);
+
+    /**
+     * Timed commands (like UHD's set_command_time): while set, gain and
+     * frequency setters carry the tick (RX TSF units) and id. The server
+     * applies the change at that sample and marks the first packet at the
+     * new setting with PKT_F_CMD_BOUNDARY / cmd_seq (see pkt_header.hpp).
+     */
+    void set_command_time(uint64_t ticks, uint32_t command_id) { cmd_ticks_ = ticks; cmd_id_ = command_id; }
+    void clear_command_time() { cmd_ticks_ = 0; cmd_id_ = 0; }
+    bool has_command_time() const { return cmd_ticks_ != 0; }
+
+    void set_rpc_options(const rpc_options& opt) { opt_ = opt; }
+    const rpc_options& get_rpc_options() const { return opt_; }
+
+    /**
+     * Apply many parameter changes at once. Uses the ApplySettings batch RPC
+     * (one round trip) when the generated stubs and the server support it,
+     * otherwise issues all unary setters concurrently on a CompletionQueue.
+     * Either way the wall time is about one round trip instead of N.
+     *
+     * @return true if every change succeeded; 'results' (optional) is
+     *         filled in request order.
+     */
+    bool apply_settings(const std::vector<param_change>& changes,
+                        std::vector<param_result>* results = nullptr);
 
     // Set and Get clock rate
     bool set_clock_rate(double rate, unit_t unit = UNIT_BOTH);
     double get_clock_rate(unit_t unit = UNIT_BOTH);
 
     // UHD-style API methods
-    bool set_rx_gain(double gain, size_t chan=0, const std::string& name = "");
-    double get_rx_gain(size_t chan = 0, const std::string& name = "");
+    // 'actual' (optional) receives the value the server applied.
+    bool set_rx_gain(double gain, size_t chan=0, const std::string& name = "", double* actual = nullptr);
+    // 'ok' (optional) distinguishes a real 0.0 from an RPC failure.
+    double get_rx_gain(size_t chan = 0, const std::string& name = "", bool* ok = nullptr);
 
-    bool set_tx_gain(double gain, size_t chan = 0, const std::string& name = "");
-    double get_tx_gain(size_t chan = 0, const std::string& name = "");
+    bool set_tx_gain(double gain, size_t chan = 0, const std::string& name = "", double* actual = nullptr);
+    double get_tx_gain(size_t chan = 0, const std::string& name = "", bool* ok = nullptr);
 
     uhd_tune_result_t set_rx_freq(const uhd::tune_request_t& tune_request, size_t chan = 0);
-    double get_rx_freq(size_t chan = 0);
+    double get_rx_freq(size_t chan = 0, bool* ok = nullptr);
 
     uhd_tune_result_t set_tx_freq(const uhd::tune_request_t& tune_request, size_t chan = 0);
-    double get_tx_freq(size_t chan = 0);
+    double get_tx_freq(size_t chan = 0, bool* ok = nullptr);
 
-    bool set_rx_rate(double rate, size_t chan = ALL_CHANS);
-    double get_rx_rate(size_t chan);
+    bool set_rx_rate(double rate, size_t chan = ALL_CHANS, double* actual = nullptr);
+    double get_rx_rate(size_t chan, bool* ok = nullptr);
 
-    bool set_tx_rate(double rate, size_t chan = ALL_CHANS);
-    double get_tx_rate(size_t chan);
+    bool set_tx_rate(double rate, size_t chan = ALL_CHANS, double* actual = nullptr);
+    double get_tx_rate(size_t chan, bool* ok = nullptr);
 
     DeviceInfoResponse get_device_info();
 
+    struct async_call;
+
 private:
+    // Blocking call with deadline + retries; 'fn' issues the RPC on a fresh context.
+    template <typename Fn>
+    Status invoke_(Fn&& fn);
+
+    void arm_(ClientContext& ctx) const;
+
+    bool apply_batch_(const std::vector<param_change>& changes, std::vector<param_result>& results, bool& unsupported);
+    bool apply_pipelined_(const std::vector<param_change>& changes, std::vector<param_result>& results);
+
     std::unique_ptr<FlexSDRControl::Stub> stub_;
+    rpc_options opt_;
+    bool batch_unsupported_ = false;   // server answered UNIMPLEMENTED once
+    uint64_t cmd_ticks_ = 0;
+    uint32_t cmd_id_    = 0;
 };
 
 // Function declarations
 std::unique_ptr<FlexSDRClient> GetClient(const std::string& server_address = "127.0.0.1:50051");
+std::unique_ptr<FlexSDRClient> GetClient(const std::string& server_address, const FlexSDRClient::rpc_options& opt);
 
 bool server_request(FlexSDRClient& client, const std::string& op_type);
 
@@ -13,9 +13,12 @@
 #include <thread>
 #include <memory>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 
 #include "device/flexsdr_client_impl.h"   // FlexSDRClient, GetClient(endpoint)
+#include "device/radio_param_cache.hpp"
 
 struct rte_ring; // fwd decl - use global scope
 struct rte_mempool;
@@ -25,10 +28,12 @@ namespace flexsdr {
 // Forward declarations
 enum class Role { UE, GNB };
 class FlexSDRSecondary;
+class rx_correction;
 
 // DPDK-native context (non-owning views of primary-owned objects)
 struct DpdkContext {
-  // Prefer names + pointers (names allow late re-resolve if primary restarts)
+  // Prefer names + pointers (names allow re-resolve after a primary pause;
+  // a restarted primary needs a new secondary process, see PrimaryLink)
   std::string ue_inbound_ring_name;
   std::string ue_tx_ring0_name;
   std::string gnb_inbound_ring_name;
@@ -88,8 +93,38 @@ public:
     void   set_tx_freq(const uhd::tune_request_t& tune_req, size_t chan = 0);
     double get_tx_freq(size_t chan = 0) const;
 
+    // Host-side RX front-end correction, fused into the RX unpack (see
+    // rx_correction). Applies to open and future RX streams. With device
+    // arg rx_nco=1, set_rx_freq() also shifts out the residual between
+    // the requested and the tuned frequency.
+    void   set_rx_dc_offset(bool enb, size_t chan = ALL_CHANS);   // DC notch
+    void   set_rx_iq_correction(float a, float b, float c, float d, size_t chan = ALL_CHANS);
+    void   set_rx_freq_shift(double hz, size_t chan = ALL_CHANS);
+
     std::string get_endpoint() const { return _endpoint; }
 
+    // Parameter cache: bumps on every effective change (setter or refresh).
+    uint64_t get_param_version() const { return _params.version(); }
+
+    // Forget cached parameters; next getter per slot goes to the server.
+    void invalidate_params() { _params.invalidate_all(); }
+
+    /**
+     * Timed commands: gain/frequency setters after this call take effect at
+     * 'time' on the RX sample timeline instead of immediately. The first RX
+     * packet at the new setting carries PKT_F_CMD_BOUNDARY with
+     * cmd_seq == (last_command_id() & 0xffff); flexsdr_rx_streamer reports it
+     * as start_of_burst so callers can drop the transient precisely.
+     */
+    void     set_command_time(const uhd::time_spec_t& time);
+    void     clear_command_time();
+    uint32_t last_command_id() const { return _cmd_id.load(std::memory_order_relaxed); }
+
+    // Many changes in ~one round trip (startup, multi-channel retune); the
+    // parameter cache is updated from the per-change results.
+    bool apply_settings(const std::vector<FlexSDRClient::param_change>& changes,
+                        std::vector<FlexSDRClient::param_result>* results = nullptr);
+
 private:
     struct Impl;  
     std::unique_ptr<Impl> p_;
@@ -98,10 +133,24 @@ private:
 
     void _start_ingress_if_needed();
 
+    // Corrector for a new RX stream over device channels 'chans'
+    std::shared_ptr<rx_correction> _make_rx_correction(const std::vector<size_t>& chans);
+    // Run f(corrector, stream channel) for every live stream channel on 'chan'
+    template <typename F> void _for_rx_correction(size_t chan, F&& f);
+
+    // One RPC for a parameter (cache miss or refresh).
+    double _fetch_param(radio_param p, size_t chan, bool* ok) const;
+    double _get_param(radio_param p, size_t chan, double fallback) const;
+    // Cache updates after a setter; chan may be ALL_CHANS.
+    void   _store_param(radio_param p, size_t chan, double v);
+    void   _drop_param(radio_param p, size_t chan);
+    void   _refresh_loop();
+
     // DPDK ring name (from args or default)
     std::string _ring_name{"ue_inbound_ring"};
 
-    // FIFO + ingress thread for RX
+    // RX ring resolved; the optional FIFO + ingress thread (RxIngress) is
+    // started by get_rx_stream when rx_ingress=1
     std::atomic<bool> _ingress_started{false};
     ::rte_ring* _rx_ring{nullptr};
 
@@ -111,10 +160,15 @@ private:
     template <typename T> static inline T _clamp(T v, T lo, T hi) {
         return (v < lo) ? lo : (v > hi) ? hi : v;
     }
+    // Frequency the stream is centred on (UHD: RF LO minus the DSP offset)
+    static inline double _tuned_freq(const uhd_tune_result_t& r) {
+        return r.actual_rf_freq - r.actual_dsp_freq;
+    }
 
     // cached state
     double _mcr  = 200e6;                 // master clock (Hz)
     double _rxr  = 10e6, _txr = 10e6;     // rates
+    double _rx_host = 0.0, _tx_host = 0.0; // rates as requested, before clamping
     double _rxf  = 2.45e9, _txf = 2.45e9; // freqs
     double _rxg  = 10.0,  _txg = 10.0;    // gains
 
@@ -123,6 +177,19 @@ private:
     // backend client (keep intact)
     std::shared_ptr<FlexSDRClient> _client;
     std::string _endpoint;
+
+    // Getter cache (args: param_cache=0 disables, param_refresh_ms=N
+    // re-reads cached slots from the server every N ms off the caller path;
+    // default 1000, 0 = never, so changes made by other clients show up)
+    mutable RadioParamCache _params;
+    bool                    _cache_enabled{true};
+    unsigned                _refresh_ms{0};
+    std::thread             _refresher;
+    std::mutex              _refresh_mtx;
+    std::condition_variable _refresh_cv;
+    bool                    _refresh_stop{false};
+
+    std::atomic<uint32_t>   _cmd_id{0};       // timed command ids handed to the server
 };
 
 }
@@ -6,6 +6,11 @@
 #include <atomic>
 #include <vector>
 
+#include "device/polyphase_resampler.hpp"
+#include "device/rx_correction.hpp"
+#include "device/rx_ingress.hpp"
+#include "conf/tunables.hpp"
+
 // Forward declarations
 namespace uhd { namespace rfnoc { struct action_info; } }
 struct rte_mbuf;
@@ -13,6 +18,8 @@ struct rte_ring;
 
 namespace flexsdr {
 
+struct shm_queue_counters;
+
 /**
  * High-performance RX streamer for DPDK-based IQ data path
  * Optimized for 50-60 Gbps throughput with optional SIMD unpacking
@@ -28,6 +35,18 @@ public:
   struct options {
     // REQUIRED: DPDK ring from FlexSDRSecondary::rx_ring_for_queue()
     rte_ring*   ring            = nullptr;
+
+    // Multi-queue mode: one ring per channel, rings[i] feeds buffs[i].
+    // Each packet carries planar sc16 for its channel only; the lanes are
+    // aligned by TSF before copying. When non-empty, `ring` is ignored and
+    // num_channels is rings.size().
+    std::vector<rte_ring*> rings;
+    bool        align_tsf       = true;     // Drop leading samples until all lanes share a TSF
+
+    // Ingress-worker mode: samples come pre-deinterleaved from this FIFO
+    // (an RxIngress draining `ring` on its own lcore); recv() only copies
+    // out of it and acquire_samples() hands out pointers without copying.
+    std::shared_ptr<RxIngress> ingress;
     
     // Format specification
     std::string cpu_fmt         = "sc16";   // OAI expects SC16 (complex int16)
@@ -43,6 +62,44 @@ public:
     bool        parse_tsf       = false;    // Extract timestamp from payload
     size_t      tsf_offset      = 24;       // Byte offset to TSF/timestamp
     size_t      vrt_hdr_bytes   = 32;       // Header bytes to skip before IQ data
+    double      tick_rate       = 1.0;      // TSF ticks per second (time_spec conversion)
+
+    // Secondary's view of the primary: while it is not UP recv() returns
+    // ERROR_CODE_TIMEOUT without touching the rings (null = always up).
+    std::shared_ptr<const PrimaryLink> link;
+
+    // Counters of `ring` in the control memzone
+    // (FlexSDRSecondary::rx_counters()); single-ring mode only. The
+    // consumer side is updated here; a rise in the producer's drops is
+    // reported as ERROR_CODE_OVERFLOW.
+    shm_queue_counters* counters = nullptr;
+
+    // Live poll policy (tunables.rx.*); null = built-in defaults. Read
+    // lock-free once per recv() from the calling thread.
+    std::shared_ptr<conf::TunablesStore> tunables;
+
+    // Timed commands: end a recv() before a packet flagged PKT_F_CMD_BOUNDARY
+    // so one buffer never mixes old and new settings; the next recv()
+    // starts at the boundary with start_of_burst set.
+    bool        split_on_cmd_boundary = true;
+
+    // Default unpacker: write the output with non-temporal (streaming)
+    // stores so samples the PHY won't reread soon bypass L2/LLC. Pays off
+    // for large recv() buffers; hurts when the caller reads them right away.
+    bool        nt_stores       = false;
+
+    // Host-side rate conversion: recv() delivers samples at host_rate,
+    // resampled from tick_rate (the radio rate) by a polyphase filter
+    // designed at construction. 0 or equal rates = off. recv() only;
+    // recv_exact() and acquire_samples() stay at the radio rate.
+    double      host_rate       = 0.0;
+    unsigned    resample_taps   = 24;
+
+    // Front-end correction (NCO shift, DC notch, IQ matrix), applied per
+    // packet inside the unpack loop; channel i of the stream is channel i
+    // of the corrector. Runs at the radio rate, before any resampling.
+    // Turns nt_stores off while enabled. Not applied by acquire_samples().
+    std::shared_ptr<rx_correction> correction;
     
     /**
      * CRITICAL: Custom SIMD unpacker for high throughput (50-60 Gbps)
@@ -76,7 +133,7 @@ public:
   }
 
   explicit flexsdr_rx_streamer(const options& opt);
-  ~flexsdr_rx_streamer() override = default;
+  ~flexsdr_rx_streamer() override;
 
   // UHD rx_streamer interface
   size_t get_num_channels() const override { 
@@ -100,6 +157,34 @@ public:
       const std::shared_ptr<uhd::rfnoc::action_info>&, 
       const size_t) override {}
 
+  /**
+   * Fill exactly nsamps samples per channel in one call, crossing packet
+   * and block boundaries, unless the deadline passes or the stream is
+   * discontinuous. Returns the samples written: short on deadline or while
+   * the stream is stopped (md.error_code = TIMEOUT), at a TSF gap
+   * (md.out_of_sequence) or after an overflow. ERROR_CODE_OVERFLOW is
+   * reported for any overflow during the call, even if the buffer was
+   * filled afterwards. Samples already read past a gap are
+   * kept and returned first by the next call. *tsf, if given, receives the
+   * tick of the first sample (parse_tsf only). No allocation per call.
+   */
+  size_t recv_exact(void* const* buffs, size_t nchans, size_t nsamps,
+                    uhd::rx_metadata_t& md, double timeout, uint64_t* tsf = nullptr);
+
+  /**
+   * Ingress-worker mode only: borrow up to 'max' samples of the next FIFO
+   * block in place (ch_ptrs[c] -> planar sc16 for channel c) instead of
+   * copying into caller buffers. The pointers stay valid until
+   * release_samples(n) with the number actually consumed.
+   * Returns 0 on timeout or overflow report (see md.error_code).
+   */
+  size_t acquire_samples(const void** ch_ptrs, size_t max,
+                         uhd::rx_metadata_t& md, double timeout = 0.1);
+  void   release_samples(size_t n);
+
+  // Null unless options::host_rate asked for conversion
+  const polyphase_resampler* resampler() const { return rs_.get(); }
+
   // Accessors
   uint16_t queue_id() const { return opt_.qid; }
   rte_ring* ring() const { return opt_.ring; }
@@ -110,21 +195,40 @@ public:
   uint64_t bursts_consumed() const { return bursts_cons_.load(); }
   uint64_t mbuf_errors() const { return mbuf_errors_.load(); }
   uint64_t underruns() const { return underruns_.load(); }
+  uint64_t align_drops() const { return align_drops_.load(); }  // samples dropped to align lanes
+  uint64_t realigns() const { return realigns_.load(); }        // TSF gaps seen on a lane
+  uint64_t overflows() const { return overflows_.load(); }      // single-ring loss reports
   
+  // Last timed-command boundary seen in the stream (tsf of its first sample)
+  struct cmd_boundary {
+    uint64_t tsf;
+    uint16_t cmd_seq;
+  };
+  cmd_boundary last_cmd_boundary() const {
+    return { boundary_tsf_.load(std::memory_order_acquire),
+             boundary_seq_.load(std::memory_order_acquire) };
+  }
+  uint64_t cmd_boundaries() const { return boundaries_.load(); }
+
   void reset_stats() {
     samples_out_.store(0);
     bursts_cons_.store(0);
     mbuf_errors_.store(0);
     underruns_.store(0);
+    align_drops_.store(0);
+    realigns_.store(0);
+    overflows_.store(0);
   }
 
 private:
   /**
    * Default unpacker: SC16 interleaved → planar
    * 
-   * Handles multi-channel deinterleaving without SIMD.
-   * For production 50-60 Gbps, replace with AVX2/AVX512 version
-   * via options::iq_unpack.
+   * Software-pipelined over the burst: while packet N is copied, the
+   * header of N+2 and the first payload lines of N+1 are prefetched.
+   * 1/2/4 channels use SSE2 (optionally with streaming stores, see
+   * options::nt_stores); other counts copy per sample. AVX2/AVX512
+   * versions can still be plugged in via options::iq_unpack.
    * 
    * Format: Input:  [CH0_I, CH0_Q, CH1_I, CH1_Q, CH2_I, CH2_Q, ...]
    *         Output: ch_buffs[0]: [CH0_I, CH0_Q, CH0_I, CH0_Q, ...]
@@ -137,9 +241,83 @@ private:
       uint16_t count,
       uhd::rx_metadata_t& md);
 
+  // recv() body on a plain pointer list (recv_exact() calls it directly)
+  size_t recv_(void* const* buffs, size_t nbuffs, size_t nsamps_per_buff,
+               uhd::rx_metadata_t& metadata, double timeout, bool one_packet);
+
   // Helper: Extract timestamp from packet payload
   uint64_t extract_tsf_(rte_mbuf* m);
 
+  // Single-ring loss detection: the producer's ring-full count moved, or
+  // (default unpacker with parse_tsf) 'head' does not continue the last
+  // packet. Loss with neither, e.g. without parse_tsf from a producer that
+  // does not count its drops, goes unreported.
+  bool ring_loss_(rte_mbuf* head);
+  void sync_prod_drops_();        // don't report drops from before a start
+  uint64_t prod_drops_seen_ = 0;
+
+  // Empty polls before sleeping, and the sleep, from opt_.tunables (if any)
+  void poll_policy_(uint64_t& tight_polls, unsigned& sleep_us);
+  int  tun_slot_ = -1;            // TunablesStore reader slot (recv thread)
+  bool tun_registered_ = false;
+
+  // Single-ring carry state: held_[0] is partly read up to held_off_
+  size_t   held_off_    = 0;
+  unsigned unpack_done_ = 0;      // default unpacker: mbufs fully consumed
+  size_t   unpack_off_  = 0;      // ... and samples used from the next one
+  uint64_t next_tsf_    = 0;      // expected TSF of the next packet
+  bool     have_tsf_    = false;
+  uint64_t last_tsf_    = 0;      // TSF of the first sample of the last recv()
+  std::vector<void*> ch_buffs_;   // reused recv() channel pointer list
+
+  // recv_exact() scratch: per-channel pointers and post-gap carry (planar)
+  std::vector<void*>    exact_ptrs_;
+  std::vector<uint32_t> carry_;
+  size_t   carry_cap_ = 0;        // samples per channel
+  size_t   carry_n_   = 0;
+  size_t   carry_off_ = 0;
+  uint64_t carry_tsf_ = 0;
+
+  // Multi-queue mode (options::rings)
+  struct lane {
+    rte_ring*              ring = nullptr;
+    std::vector<rte_mbuf*> pend;          // dequeued, not yet consumed
+    size_t                 head  = 0;
+    size_t                 count = 0;
+    size_t                 off   = 0;     // samples already taken from pend[head]
+  };
+  size_t recv_multi_(void* const* buffs, size_t nbuffs, size_t nsamps, uhd::rx_metadata_t& md,
+                     double timeout, bool one_packet);
+  bool   lane_fill_(lane& l);                 // non-blocking; false if the ring is empty
+  void   lane_pop_(lane& l);
+  size_t lane_samps_(const rte_mbuf* m) const;
+  uint64_t lane_tsf_(lane& l) { return extract_tsf_(l.pend[l.head]) + l.off; }
+
+  // options::correction on [off, off+n) of every channel, if enabled
+  void correct_(void* const* buffs, size_t nch, size_t off, size_t n) {
+    if (!corr_on_) return;
+    for (size_t c = 0; c < nch; c++)
+      opt_.correction->apply(c, static_cast<uint32_t*>(buffs[c]) + off, n);
+  }
+  bool corr_on_ = false;          // sampled once per recv_()
+
+  // Host-rate conversion (options::host_rate): radio-rate recv_() into
+  // rs_in_, then the filter into the caller's buffers
+  size_t recv_resampled_(void* const* buffs, size_t nbuffs, size_t nsamps, uhd::rx_metadata_t& md,
+                         double timeout, bool one_packet);
+  std::unique_ptr<polyphase_resampler> rs_;
+  std::vector<std::vector<uint32_t>>   rs_in_;
+  std::vector<void*>                   rs_in_ptrs_;
+  uhd::time_spec_t                     rs_t0_;          // time of the first input since reset
+  uint64_t                             rs_out_    = 0;  // outputs since reset
+  bool                                 rs_have_t0_ = false;
+
+  // Ingress-worker mode (options::ingress)
+  size_t recv_ingress_(void* const* buffs, size_t nbuffs, size_t nsamps, uhd::rx_metadata_t& md,
+                       double timeout, bool one_packet);
+  bool   ingress_open_(double timeout);
+  bool   ingress_touch_(uhd::rx_metadata_t& md);   // false = overflow reported
+
 private:
   options               opt_{};
   std::atomic<uint64_t> samples_out_{0};
@@ -147,6 +325,19 @@ private:
   std::atomic<uint64_t> mbuf_errors_{0};
   std::atomic<uint64_t> underruns_{0};
   std::atomic<bool>     running_{false};
+  std::atomic<uint64_t> align_drops_{0};
+  std::atomic<uint64_t> realigns_{0};
+  std::atomic<uint64_t> overflows_{0};
+  std::vector<lane>     lanes_;
+  const RxIngress::block* ing_blk_ = nullptr;
+  size_t                ing_off_  = 0;
+  bool                  ing_seen_ = false;   // block flags already reported
+
+  // Packets dequeued but held back behind a command boundary
+  std::vector<rte_mbuf*> held_;
+  std::atomic<uint64_t>  boundaries_{0};
+  std::atomic<uint64_t>  boundary_tsf_{0};
+  std::atomic<uint16_t>  boundary_seq_{0};
 };
 
 } // namespace flexsdr
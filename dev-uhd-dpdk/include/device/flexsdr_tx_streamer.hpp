@@ -2,10 +2,14 @@
 #include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+
+#include "device/polyphase_resampler.hpp"
 #include <atomic>
+#include <vector>
 
 // Forward declarations for DPDK types
 struct rte_ring;
@@ -15,16 +19,125 @@ namespace flexsdr {
 
 struct TxBackend {
   virtual ~TxBackend() = default;
-  // Sends one channel burst; returns true if fully enqueued.
+
+  // Outcome of a send. would_block: the queue or its pool is full, a retry
+  // can succeed. rejected: the packet cannot go out as given (bad channel
+  // or buffer, larger than an mbuf, backend gone); the backend has logged
+  // why and retrying is pointless.
+  enum class tx_status { sent, would_block, rejected };
+
+  // Sends one channel burst; sent if fully enqueued.
   // 'data' is the raw IQ payload for this channel (already interleaved/planar as configured).
-  virtual bool send_burst(std::size_t chan,
-                          const void* data,
-                          std::size_t bytes,
-                          uint64_t tsf,
-                         uint32_t spp,
-                          uint16_t fmt,
-                          bool sob,
-                          bool eob) = 0;
+  // would_block leaves no trace (no counters, no log): the sender retries,
+  // or reports the loss with tx_dropped() when it gives up.
+  virtual tx_status send_burst(std::size_t chan,
+                               const void* data,
+                               std::size_t bytes,
+                               uint64_t tsf,
+                               uint32_t spp,
+                               uint16_t fmt,
+                               bool sob,
+                               bool eob) = 0;
+
+  // Sends one burst on several channels: either every channel's packet is
+  // enqueued or none is. data[i] goes to chans[i]; all carry 'bytes'.
+  // Default: per-channel send_burst (not atomic; a failure mid-way leaves
+  // the earlier channels enqueued).
+  virtual tx_status send_burst_multi(const std::size_t* chans,
+                                     const void* const* data,
+                                     std::size_t nchans,
+                                     std::size_t bytes,
+                                     uint64_t tsf,
+                                     uint32_t spp,
+                                     uint16_t fmt,
+                                     bool sob,
+                                     bool eob) {
+    for (std::size_t i = 0; i < nchans; ++i) {
+      const tx_status st = send_burst(chans[i], data[i], bytes, tsf, spp, fmt, sob, eob);
+      if (st != tx_status::sent) return st;
+    }
+    return tx_status::sent;
+  }
+
+  // ---- Zero-copy ---------------------------------------------------------
+  // fn(data, opaque) runs once the backend no longer references 'data'.
+  struct tx_done {
+    void (*fn)(const void* data, void* opaque) = nullptr;
+    void* opaque = nullptr;
+  };
+
+  // Like send_burst(), but the packet may reference 'data' instead of a
+  // copy. On success 'done' runs exactly once: right away if the backend
+  // copied, else from a later *_zc() or reap_tx_completions() call on the
+  // same thread. On failure it never runs and the buffer stays the caller's.
+  virtual tx_status send_burst_zc(std::size_t chan,
+                                  const void* data,
+                                  std::size_t bytes,
+                                  uint64_t tsf,
+                                  uint32_t spp,
+                                  uint16_t fmt,
+                                  bool sob,
+                                  bool eob,
+                                  const tx_done& done) {
+    const tx_status st = send_burst(chan, data, bytes, tsf, spp, fmt, sob, eob);
+    if (st == tx_status::sent && done.fn) done.fn(data, done.opaque);
+    return st;
+  }
+
+  // send_burst_multi() counterpart; done[i] belongs to data[i].
+  virtual tx_status send_burst_multi_zc(const std::size_t* chans,
+                                        const void* const* data,
+                                        std::size_t nchans,
+                                        std::size_t bytes,
+                                        uint64_t tsf,
+                                        uint32_t spp,
+                                        uint16_t fmt,
+                                        bool sob,
+                                        bool eob,
+                                        const tx_done* done) {
+    const tx_status st = send_burst_multi(chans, data, nchans, bytes, tsf, spp, fmt, sob, eob);
+    if (st != tx_status::sent) return st;
+    for (std::size_t i = 0; i < nchans; ++i) {
+      if (done[i].fn) done[i].fn(data[i], done[i].opaque);
+    }
+    return st;
+  }
+
+  // Deliver pending zero-copy completions; returns how many ran.
+  virtual std::size_t reap_tx_completions() { return 0; }
+
+  // Largest payload one send_burst() can carry on 'chan' (0 = unknown).
+  virtual std::size_t max_burst_bytes(std::size_t chan) const {
+    (void)chan;
+    return 0;
+  }
+
+  // True while 'chan' is above its high watermark and has not drained to
+  // the low one; senders should hold off rather than overrun the queue.
+  // Default: never.
+  virtual bool tx_backpressure(std::size_t chan) {
+    (void)chan;
+    return false;
+  }
+
+  // False when a failed send cannot succeed by trying again (backend gone),
+  // so callers stop retrying before their deadline. Retrying assumes a
+  // failed send_burst_multi() sent nothing (true of FlexSDRSecondary).
+  virtual bool tx_ready() { return true; }
+
+  // True if one packet on each of chans[0..n) would not be accepted right
+  // now (ring or pool full). No side effects; senders poll it while waiting.
+  virtual bool tx_would_block(const std::size_t* chans, std::size_t n) {
+    (void)chans;
+    (void)n;
+    return false;
+  }
+
+  // The sender gave up on a packet for chans[0..n): count and report it.
+  virtual void tx_dropped(const std::size_t* chans, std::size_t n) {
+    (void)chans;
+    (void)n;
+  }
 };
 
 /// Minimal UHD TX streamer that forwards SC16 interleaved samples to a DPDK ring
@@ -33,8 +146,69 @@ class flexsdr_tx_streamer final : public uhd::tx_streamer {
 public:
     using buffs_type = uhd::tx_streamer::buffs_type;
 
+    enum class tx_mode {
+      per_channel_ring,   // buffs[i] -> its own TX ring, enqueued all-or-nothing
+      interleaved,        // buffs packed [CH0, CH1, ...] per sample into one ring;
+                          // send() needs a buffer for every channel (uhd::value_error)
+    };
+
+    // What send() does between tries while a queue is full or back-pressured
+    enum class tx_wait {
+      spin,               // re-try at once (lowest latency, burns the core)
+      pause,              // CPU pause hint between tries
+      yield,              // give the core away between tries
+    };
+
+    struct options {
+      std::size_t              num_channels = 1;
+      tx_mode                  mode = tx_mode::per_channel_ring;
+      // Backend channel (TX queue) per stream channel; empty = 0..N-1.
+      // In interleaved mode only chans[0] is used.
+      std::vector<std::size_t> chans;
+      std::size_t              spp = 1024;   // Max samples per channel per packet
+      double                   tick_rate = 1.0;  // time_spec -> TSF ticks (sample rate)
+
+      // Zero-copy (per-channel mode): packets reference the caller's buffers
+      // instead of copies where the backend can (DPDK hugepage memory), so
+      // send() may return before the data is consumed. Every buffer passed
+      // to send() is reported exactly once through on_buffer_done(buf,
+      // done_opaque), after which it may be reused; completions run on the
+      // sending thread from send() or reap() and must not call send().
+      // Null = always copy.
+      void (*on_buffer_done)(const void* buf, void* opaque) = nullptr;
+      void*                    done_opaque = nullptr;
+
+      // Zero-copy without a callback, for buffers from iq_arena: each send()
+      // whose buffers all live in the arena pins them until the backend lets
+      // go (iq_arena::pins() tells when); other buffers are copied. Ignored
+      // when on_buffer_done is set.
+      bool                     arena_zero_copy = false;
+
+      // Host-side rate conversion: send() takes samples at host_rate and
+      // a polyphase filter turns them into tick_rate (the radio rate)
+      // before packetising. 0 or equal rates = off. Resampling copies, so
+      // zero-copy is off and buffers complete before send() returns.
+      // send() needs a buffer for every channel (uhd::value_error).
+      double                   host_rate = 0.0;
+      unsigned                 resample_taps = 24;
+
+      // send() waits up to its timeout for a back-pressured queue, a full
+      // ring or an exhausted pool instead of returning short at once.
+      // spin/pause fall back to yield after wait_tight tries per wait.
+      tx_wait                  wait = tx_wait::pause;
+      unsigned                 wait_tight = 1000;
+    };
+
+    // Waiting done by one send() call
+    struct send_report {
+      uint64_t retries;       // polls of a full queue/pool before it took the packet or gave up
+      uint64_t blocked_ns;    // time spent waiting (back-pressure and retries)
+      bool     timed_out;     // returned short at the deadline
+    };
+
     // Constructor that accepts a backend
     explicit flexsdr_tx_streamer(TxBackend *backend) : backend_(backend) {}
+    flexsdr_tx_streamer(TxBackend *backend, const options& opt);
 
     ~flexsdr_tx_streamer() override = default;
 
@@ -46,7 +220,17 @@ public:
                 const size_t nsamps_per_buff,
                 const uhd::tx_metadata_t& metadata,
                 const double timeout = 0.1) override;
+
+    // send() on a plain pointer list; avoids building a buffs_type per call
+    size_t send_ptrs(const void* const* buffs,
+                     std::size_t nbuffs,
+                     std::size_t nsamps_per_buff,
+                     const uhd::tx_metadata_t& metadata,
+                     double timeout = 0.1);
   
+    // Zero-copy: run completions of buffers the backend has released
+    std::size_t reap();
+
     bool recv_async_msg(uhd::async_metadata_t& /*md*/, double /*timeout*/ = 0.1) override {
         return false;
     }
@@ -55,8 +239,88 @@ public:
         const std::shared_ptr<uhd::rfnoc::action_info>& ,
         const size_t ) override {};
 
+    // Null unless options::host_rate asked for conversion
+    const polyphase_resampler* resampler() const { return rs_.get(); }
+
+    // The most recent send() (sending thread only)
+    const send_report& last_send() const { return last_; }
+
+    // Statistics since construction (atomic for thread-safety)
+    uint64_t send_retries() const    { return retries_.load(std::memory_order_relaxed); }
+    uint64_t send_blocked_ns() const { return blocked_ns_.load(std::memory_order_relaxed); }
+    uint64_t send_timeouts() const   { return timeouts_.load(std::memory_order_relaxed); }
+
 private:
+    // send_ptrs() body; own_bufs = internal scratch (no zero-copy, no
+    // completions)
+    size_t send_(const void* const* buffs, std::size_t nch, std::size_t nsamps,
+                 const uhd::tx_metadata_t& md, bool own_bufs);
+    size_t send_resampled_(const void* const* buffs, std::size_t nch, std::size_t nsamps,
+                           const uhd::tx_metadata_t& md);
+
+    // False once the send() deadline passes with a target queue still
+    // back-pressured (TxBackend::tx_backpressure); true when clear.
+    bool wait_backpressure_(std::size_t nch);
+    // One pause between tries ('tries' counts this wait); false once the
+    // deadline has passed. end_wait_() books the wait into the stats.
+    bool wait_step_(uint64_t& tries);
+    void end_wait_(uint64_t retries, bool timed_out);
+
+    // Packs nsamps samples of every channel into pack_buf_ as
+    // [CH0 I/Q, CH1 I/Q, ...] per sample.
+    void pack_interleaved_(const void* const* buffs, std::size_t nch,
+                           std::size_t offset, std::size_t nsamps);
+
+    // Zero-copy bookkeeping: one token per caller buffer per send(), held
+    // by every packet built from it plus send() itself until it returns.
+    struct zc_token {
+      flexsdr_tx_streamer* self;
+      const void*          buf;
+      unsigned             refs;
+    };
+    static void zc_packet_done_(const void* data, void* opaque);
+    static void arena_unpin_(const void* buf, void* opaque);
+    void        zc_unref_(zc_token* t);
+    void        zc_complete_now_(const void* const* buffs, std::size_t nch);
+
     TxBackend* backend_ = nullptr; // non-owning
+    tx_mode    mode_ = tx_mode::per_channel_ring;
+    std::vector<std::size_t> chans_;
+    std::vector<const void*> chunk_ptrs_;   // per-channel payload pointers for one packet
+    std::vector<const void*> send_ptrs_;    // send(): buffs_type -> pointer list (reused)
+    std::vector<uint32_t>    pack_buf_;     // interleaved packet staging (one sc16 per word)
+    double                   tick_rate_ = 1.0;
+    void (*on_buffer_done_)(const void*, void*) = nullptr;
+    void*                    done_opaque_ = nullptr;
+    bool                     arena_zc_ = false;
+    std::vector<zc_token>    zc_tokens_;    // fixed storage; pointers handed to the backend
+    std::vector<zc_token*>   zc_free_;
+    std::vector<zc_token*>   zc_cur_;       // per channel, current send()
+    std::vector<TxBackend::tx_done> zc_done_;   // per channel, current packet
+
+    // Host-rate conversion (options::host_rate)
+    std::unique_ptr<polyphase_resampler> rs_;
+    std::vector<std::vector<uint32_t>>   rs_buf_;    // per channel, radio-rate output
+    std::vector<void*>                   rs_ptrs_;
+    std::vector<const void*>             rs_in_;
+    std::size_t                          rs_in_max_ = 0;   // host samples per round
+    double                               host_rate_ = 0.0;
+    bool                                 rs_active_ = false;   // mid-stream (history valid)
+    bool                                 rs_timed_  = false;
+    uint64_t                             rs_tsf_    = 0;       // radio tick of the next output
+    uhd::time_spec_t                     rs_next_;             // host time of the next input
+
+    // Current send(): timeout and the deadline it turns into on the first wait
+    double                                timeout_ = 0.1;
+    bool                                  deadline_set_ = false;
+    std::chrono::steady_clock::time_point deadline_{};
+    std::chrono::steady_clock::time_point wait_start_{};
+    tx_wait                               wait_ = tx_wait::pause;
+    unsigned                              wait_tight_ = 1000;
+    send_report                           last_{};
+    std::atomic<uint64_t>                 retries_{0};
+    std::atomic<uint64_t>                 blocked_ns_{0};
+    std::atomic<uint64_t>                 timeouts_{0};
 
    // Basic TX parameters
     std::size_t spp_   = 1024;
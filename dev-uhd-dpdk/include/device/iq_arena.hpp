@@ -0,0 +1,113 @@
+// include/device/iq_arena.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace flexsdr {
+
+/**
+ * Process-wide allocator for application sample buffers in DPDK hugepage
+ * memory, so the zero-copy TX path (TxExtbuf) can reference them directly.
+ *
+ * Buffers come from per-NUMA-socket slab classes sized for common slot
+ * lengths; each class grows by whole chunks from rte_malloc_socket() and
+ * recycles freed blocks. Chunks are kept until the process exits (DPDK
+ * memory cannot be returned after rte_eal_cleanup() anyway). Requests
+ * larger than the biggest class get a chunk of their own.
+ *
+ * Needs an initialised EAL; alloc() returns nullptr otherwise, and callers
+ * are expected to fall back to ordinary memory (which still works, only
+ * with copies).
+ *
+ * Blocks can be pinned while packets reference them: a block freed while
+ * pinned is recycled by the last unpin().
+ */
+class iq_arena {
+public:
+  struct options {
+    // Slab classes in sc16 samples (4 bytes each), ascending. Defaults cover
+    // 0.5 ms NR slots / LTE subframes at 7.68 ... 122.88 Msps.
+    std::vector<std::size_t> class_samps{1024, 3840, 7680, 15360, 30720, 61440};
+    std::size_t              align          = 64;   // power of two >= 64
+    unsigned                 blocks_per_chunk = 8;
+  };
+
+  struct class_stats {
+    int         socket_id;
+    std::size_t block_bytes;
+    bool        dedicated;     // larger than every class
+    std::size_t blocks;
+    std::size_t in_use;
+  };
+
+  // The process-wide arena; configure() before the first alloc() to change
+  // the defaults (returns -1 once blocks exist).
+  static iq_arena& instance();
+  int configure(const options& opt);
+
+  // 'bytes' rounded up to the arena alignment; socket_id -1 = the calling
+  // lcore's socket (any socket from non-EAL threads).
+  void* alloc(std::size_t bytes, int socket_id = -1);
+  void* alloc_samps(std::size_t nsamps, int socket_id = -1) { return alloc(nsamps * 4, socket_id); }
+  void  free(void* p);
+
+  // True if p points into an arena block (any offset)
+  bool owns(const void* p) const { return find_(p) != nullptr; }
+  // True if [p, p+bytes) is DPDK memory of any kind (arena or not)
+  static bool resident(const void* p, std::size_t bytes);
+
+  // In-flight references held by the TX path; false if p is not ours.
+  bool     pin(const void* p);
+  void     unpin(const void* p);
+  uint32_t pins(const void* p) const;
+
+  std::vector<class_stats> stats() const;
+
+private:
+  static constexpr unsigned MAX_CHUNKS = 256;
+
+  struct block_state {
+    std::atomic<uint32_t> pins{0};
+    std::atomic<bool>     freed{false};   // free() ran while pinned
+  };
+
+  struct chunk {
+    uint8_t*     base;
+    std::size_t  block_bytes;   // stride
+    unsigned     nblocks;
+    int          cls;           // index into options::class_samps, -1 = dedicated
+    int          socket_id;
+    block_state* state;         // [nblocks]
+  };
+
+  struct free_list {
+    int                socket_id;
+    int                cls;
+    std::size_t        block_bytes;
+    std::size_t        blocks = 0;
+    std::vector<void*> free;
+  };
+
+  iq_arena() = default;
+
+  const chunk* find_(const void* p) const;
+  block_state* state_(const void* p, const chunk** c = nullptr) const;
+  free_list&   list_(int socket_id, int cls, std::size_t block_bytes);   // mtx_ held
+  bool         grow_(free_list& fl);                                      // mtx_ held
+  void         recycle_(void* block, const chunk* c);
+
+  options opt_{};
+  mutable std::mutex     mtx_;         // allocation path only
+  std::vector<free_list> lists_;       // per (socket, class)
+
+  // Lookups (pin/owns) are lock-free: a chunk is filled before n_chunks_
+  // is published and never removed.
+  chunk                 chunks_[MAX_CHUNKS]{};
+  std::atomic<unsigned> n_chunks_{0};
+};
+
+} // namespace flexsdr
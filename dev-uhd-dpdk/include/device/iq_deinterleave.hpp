@@ -0,0 +1,25 @@
+// include/device/iq_deinterleave.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flexsdr {
+
+/**
+ * Interleaved sc16 frames (nch channels, 4 bytes per sample) -> planar.
+ *
+ * Copies nsamps frames from src to ch_buffs[c] + dst_samp. 1, 2 and 4
+ * channels use SSE2 shuffles (a plain memcpy for 1 channel); other counts
+ * copy per sample. With nt the SIMD part uses streaming stores once
+ * channel 0 is 16-byte aligned (all channels must share that alignment);
+ * the stores are left unfenced, so the caller issues one sfence before the
+ * data is read.
+ *
+ * Used by the RX streamer's default unpacker; kept free of DPDK types so it
+ * can be exercised on its own (bench_rx_unpack).
+ */
+void deinterleave_sc16(void* const* ch_buffs, std::size_t nch, std::size_t dst_samp,
+                       const std::uint8_t* src, std::size_t nsamps, bool nt);
+
+} // namespace flexsdr
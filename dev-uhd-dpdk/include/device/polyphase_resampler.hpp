@@ -0,0 +1,82 @@
+// include/device/polyphase_resampler.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace flexsdr {
+
+/**
+ * Rational (L/M) polyphase resampler for planar sc16, all channels in
+ * lockstep.
+ *
+ * The prototype is a Kaiser-windowed sinc designed once in make() at
+ * L * taps_per_phase taps, then split into L Q15 phases (gain L folded in).
+ * Each output is one phase's dot product over the last taps_per_phase
+ * inputs. Input is split into I and Q planes on push() so that, with
+ * SSE2, eight taps of each go through one pmaddwd.
+ *
+ * Streaming use: push() input, pull() output; history carries across calls
+ * so block boundaries are seamless. input_needed(n) tells how much input
+ * the next n outputs take. The filter delays the signal by delay() output
+ * samples.
+ *
+ * Not thread-safe: one instance per stream.
+ */
+class polyphase_resampler {
+public:
+  struct options {
+    double   in_rate        = 0.0;
+    double   out_rate       = 0.0;
+    size_t   num_channels   = 1;
+    unsigned taps_per_phase = 24;      // rounded up to a multiple of 8
+    double   passband       = 0.90;    // cutoff as a fraction of the lower Nyquist rate
+    double   kaiser_beta    = 8.0;
+    unsigned max_factor     = 1024;    // cap on L and M (ratio approximated beyond)
+  };
+
+  // nullptr if the options are invalid; logs the chosen L/M.
+  static std::unique_ptr<polyphase_resampler> make(const options& opt);
+
+  unsigned up() const { return L_; }
+  unsigned down() const { return M_; }
+  double   out_rate() const { return in_rate_ * L_ / M_; }   // exact for this L/M
+  double   delay() const;                                   // group delay, output samples
+  size_t   num_channels() const { return nch_; }
+
+  // Input samples still missing before nout more outputs can be pulled
+  size_t input_needed(size_t nout) const;
+  // Largest output pull() can give once nin more samples are pushed
+  size_t output_for(size_t nin) const;
+
+  // Appends nin samples per channel (planar sc16); in[c] for channel c.
+  void   push(const void* const* in, size_t nin);
+  // Writes up to max_out samples per channel; returns the count.
+  size_t pull(void* const* out, size_t max_out);
+
+  // Drop history and pending input (discontinuity)
+  void reset();
+
+private:
+  polyphase_resampler() = default;
+
+  void compact_();
+
+  double   in_rate_ = 0.0;
+  unsigned L_ = 1, M_ = 1;
+  unsigned K_ = 0;                   // taps per phase (multiple of 8)
+  unsigned phase_ = 0;               // phase of the next output
+  size_t   nch_ = 1;
+
+  // Phase p: taps_[p*K_ .. p*K_ + K_), oldest input first
+  std::vector<int16_t>  taps_;
+  // Per channel I and Q planes; the next output's window is [pos_, pos_ + K_)
+  // and [pos_, fill_) is kept across push() (history + unconsumed input).
+  std::vector<std::vector<int16_t>> bi_, bq_;
+  size_t pos_  = 0;
+  size_t fill_ = 0;
+};
+
+} // namespace flexsdr
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace flexsdr {
+
+enum class radio_param : uint8_t {
+  RX_RATE = 0,
+  TX_RATE,
+  RX_FREQ,
+  TX_FREQ,
+  RX_GAIN,
+  TX_GAIN,
+  COUNT
+};
+
+/**
+ * Client-side copy of the radio parameters held by the control server.
+ *
+ * Getters are lock-free loads; writers (setters, the refresher) store the
+ * value and then stamp the slot with a new global version. A slot whose
+ * stamp is older than the last invalidate() is treated as a miss, so a
+ * caller falls back to one RPC and re-fills it. version() changes on every
+ * effective update and lets consumers detect "something was retuned"
+ * without comparing values.
+ */
+class RadioParamCache {
+public:
+  static constexpr size_t MAX_CHANS = 16;
+
+  // Returns false on miss (never filled, invalidated, or chan out of range).
+  bool get(radio_param p, size_t chan, double& out) const {
+    if (chan >= MAX_CHANS) return false;
+    const slot& s = slots_[idx_(p)][chan];
+    const uint64_t stamp = s.stamp.load(std::memory_order_acquire);
+    if (stamp == 0 || stamp <= floor_.load(std::memory_order_acquire)) return false;
+    out = s.value.load(std::memory_order_relaxed);
+    return true;
+  }
+
+  // Store one channel; chan >= MAX_CHANS is ignored (served uncached).
+  // Only bumps the version when the value actually changes or was missing.
+  void put(radio_param p, size_t chan, double v) {
+    if (chan >= MAX_CHANS) return;
+    slot& s = slots_[idx_(p)][chan];
+    const uint64_t stamp = s.stamp.load(std::memory_order_acquire);
+    if (stamp > floor_.load(std::memory_order_acquire) &&
+        s.value.load(std::memory_order_relaxed) == v) {
+      return;
+    }
+    s.value.store(v, std::memory_order_relaxed);
+    s.stamp.store(version_.fetch_add(1, std::memory_order_acq_rel) + 1, std::memory_order_release);
+  }
+
+  // Store the same value on every channel (setters called with ALL_CHANS).
+  void put_all(radio_param p, double v) {
+    for (size_t c = 0; c < MAX_CHANS; c++) put(p, c, v);
+  }
+
+  // Drop one slot (e.g. a setter failed and the server state is unknown).
+  void invalidate(radio_param p, size_t chan) {
+    if (chan >= MAX_CHANS) return;
+    slots_[idx_(p)][chan].stamp.store(0, std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  // Drop one parameter on every channel (setters called with ALL_CHANS).
+  void invalidate_all(radio_param p) {
+    for (size_t c = 0; c < MAX_CHANS; c++) slots_[idx_(p)][c].stamp.store(0, std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  // Drop everything (reconnect, server restart).
+  void invalidate_all() {
+    floor_.store(version_.fetch_add(1, std::memory_order_acq_rel) + 1, std::memory_order_release);
+  }
+
+  // True if the slot has been filled since the last invalidate (refresher
+  // only re-reads slots somebody has asked for).
+  bool cached(radio_param p, size_t chan) const {
+    double unused;
+    return get(p, chan, unused);
+  }
+
+  uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+private:
+  struct alignas(16) slot {
+    std::atomic<double>   value{0.0};
+    std::atomic<uint64_t> stamp{0};   // 0 = empty
+  };
+
+  static constexpr size_t idx_(radio_param p) { return static_cast<size_t>(p); }
+
+  std::array<std::array<slot, MAX_CHANS>, static_cast<size_t>(radio_param::COUNT)> slots_{};
+  std::atomic<uint64_t> version_{0};
+  std::atomic<uint64_t> floor_{0};    // stamps <= floor_ are stale
+};
+
+} // namespace flexsdr
@@ -0,0 +1,92 @@
+// include/device/rx_correction.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace flexsdr {
+
+/**
+ * Per-channel RX front-end correction, applied in place by the RX streamer
+ * right after each packet is unpacked (the samples are still in L1), so the
+ * PHY does not need a second pass over the buffer:
+ *
+ *   1. DC notch: subtracts a running DC estimate, updated once per packet
+ *      from the packet mean (single-pole, bandwidth dc_bandwidth_hz).
+ *   2. IQ imbalance: [I' Q'] = [a b; c d] [I Q].
+ *   3. NCO: multiplies by exp(j*2*pi*shift*t), e.g. to remove the residual
+ *      offset left by coarse RF tuning.
+ *
+ * Samples go through fp32 (SSE2, four at a time); the oscillator is reset
+ * from a double-precision phase every call so it never drifts.
+ *
+ * Setters may be called from any thread; apply() picks up the change at its
+ * next call (per-channel seqlock, no locking on the RX path). apply() and
+ * reset() belong to the receiving thread.
+ */
+class rx_correction {
+public:
+  struct options {
+    size_t num_channels    = 1;
+    double sample_rate     = 0.0;     // Hz, rate of the samples apply() sees
+    double dc_bandwidth_hz = 100.0;   // DC notch tracking bandwidth
+  };
+
+  explicit rx_correction(const options& opt);
+
+  rx_correction(const rx_correction&) = delete;
+  rx_correction& operator=(const rx_correction&) = delete;
+
+  size_t num_channels() const { return ch_.size(); }
+
+  void set_freq_shift(size_t ch, double hz);
+  void set_iq_matrix(size_t ch, float a, float b, float c, float d);
+  void set_dc_notch(size_t ch, bool on);
+
+  double freq_shift(size_t ch) const;
+  bool   dc_notch(size_t ch) const;
+
+  // True if any channel has something to do (cheap; read per recv())
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // In place on n sc16 samples of channel ch, continuing its state
+  void apply(size_t ch, uint32_t* samps, size_t n);
+  // Forget DC estimates and oscillator phases (stream discontinuity)
+  void reset();
+
+private:
+  struct params {
+    double shift_hz = 0.0;
+    float  a = 1.f, b = 0.f, c = 0.f, d = 1.f;
+    bool   dc = false;
+    bool active() const {
+      return dc || shift_hz != 0.0 || a != 1.f || b != 0.f || c != 0.f || d != 1.f;
+    }
+  };
+  struct alignas(64) chan {
+    // Written by setters
+    std::atomic<uint32_t> seq{0};       // odd while a setter writes
+    params                shared;
+
+    // Receiving thread only
+    uint32_t seen  = ~0u;
+    params   cur;
+    bool     active = false;
+    double   phase  = 0.0;              // cycles, [0, 1)
+    float    dc_i   = 0.f, dc_q = 0.f;
+  };
+
+  template <typename F> void update_(size_t ch, F&& f);
+  void refresh_(chan& c);
+
+  double            rate_;
+  double            dc_alpha_;          // per-sample pole
+  std::mutex        wr_mtx_;            // setters only
+  std::vector<chan> ch_;
+  std::atomic<bool> enabled_{false};
+};
+
+} // namespace flexsdr
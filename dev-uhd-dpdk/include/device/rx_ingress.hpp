@@ -0,0 +1,130 @@
+// include/device/rx_ingress.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "transport/primary_link.hpp"
+
+struct rte_ring;
+
+namespace flexsdr {
+
+struct shm_queue_counters;
+
+/**
+ * RX ingress worker: drains one inbound ring on its own (pinned) thread and
+ * deinterleaves into a preallocated SPSC FIFO of planar sample blocks.
+ *
+ * The FIFO lives in hugepage memory (rte_zmalloc_socket on the ring's NUMA
+ * node by default). The worker keeps the ring empty even while the consumer
+ * stalls; if the FIFO is full it drops whole packets there instead and
+ * counts them. A block is published when it is full, at a TSF gap, before
+ * a PKT_F_CMD_BOUNDARY packet, or when the ring runs dry (low latency).
+ *
+ * The consumer side (flexsdr_rx_streamer) borrows blocks with acquire()
+ * and hands them back with release(); channel data is read in place.
+ */
+class RxIngress {
+public:
+  static constexpr size_t MAX_CHANS = 8;
+
+  enum : uint16_t {
+    BLK_F_GAP      = 1u << 0,   // TSF did not follow the previous block
+    BLK_F_BOUNDARY = 1u << 1,   // first sample at a timed-command setting
+    BLK_F_OVERFLOW = 1u << 2,   // packets were dropped before this block
+  };
+
+  struct options {
+    rte_ring* ring          = nullptr;
+    size_t    num_channels  = 1;       // interleaved channels per packet
+    size_t    vrt_hdr_bytes = 32;
+    bool      parse_tsf     = true;    // needed for gap detection
+    size_t    tsf_offset    = 24;
+
+    size_t    block_samps   = 4096;    // samples per channel per block (rounded to 16)
+    size_t    num_blocks    = 64;      // FIFO depth (rounded to a power of two)
+    int       socket_id     = -1;      // -1 = lcore's socket (else SOCKET_ID_ANY)
+    unsigned  burst         = 32;      // ring dequeue burst
+    int       lcore         = -1;      // EAL lcore (or plain CPU) to pin to; -1 = no pinning
+    std::shared_ptr<const PrimaryLink> link;   // pause draining while the primary is away
+    shm_queue_counters* counters = nullptr;    // consumer side in the control memzone (optional)
+  };
+
+  struct block {
+    uint64_t tsf;        // tick of the first sample
+    uint32_t nsamps;     // samples per channel
+    uint16_t flags;      // BLK_F_*
+    uint16_t cmd_seq;    // with BLK_F_BOUNDARY: pkt_header::cmd_seq
+  };
+
+  struct stats {
+    uint64_t packets;
+    uint64_t samples;
+    uint64_t blocks;
+    uint64_t fifo_full_drops;   // packets dropped because the consumer lagged
+    uint64_t gaps;
+  };
+
+  explicit RxIngress(const options& opt);
+  ~RxIngress();
+
+  RxIngress(const RxIngress&) = delete;
+  RxIngress& operator=(const RxIngress&) = delete;
+
+  int  start();   // allocates the FIFO and launches the worker; 0 on success
+  void stop();
+  bool running() const { return running_.load(std::memory_order_acquire); }
+
+  // Consumer side (single thread). acquire() returns the oldest published
+  // block or nullptr after 'timeout' seconds; it stays valid until release().
+  const block* acquire(double timeout);
+  void         release();
+  const void*  chan_data(const block* b, size_t chan) const {
+    return reinterpret_cast<const uint8_t*>(b) + hdr_bytes_ + chan * chan_stride_;
+  }
+
+  size_t num_channels() const { return opt_.num_channels; }
+  size_t block_samps()  const { return opt_.block_samps; }
+  stats  get_stats() const;
+
+private:
+  void    run_();
+  block*  slot_(uint64_t idx) const {
+    return reinterpret_cast<block*>(mem_ + (idx & mask_) * block_stride_);
+  }
+  bool    open_block_();               // claim the head slot; false if FIFO full
+  void    publish_();
+
+  options  opt_;
+  uint8_t* mem_          = nullptr;
+  size_t   hdr_bytes_    = 64;
+  size_t   chan_stride_  = 0;
+  size_t   block_stride_ = 0;
+  uint64_t mask_         = 0;
+
+  // Producer-private fill state
+  block*   cur_         = nullptr;
+  uint64_t next_tsf_    = 0;
+  bool     have_tsf_    = false;
+  uint16_t pend_flags_  = 0;
+  uint16_t pend_seq_    = 0;
+
+  alignas(64) std::atomic<uint64_t> head_{0};   // written by the worker
+  alignas(64) std::atomic<uint64_t> tail_{0};   // written by the consumer
+
+  alignas(64) std::atomic<uint64_t> packets_{0};
+  std::atomic<uint64_t> samples_{0};
+  std::atomic<uint64_t> blocks_{0};
+  std::atomic<uint64_t> fifo_full_drops_{0};
+  std::atomic<uint64_t> gaps_{0};
+
+  std::atomic<bool> running_{false};
+  std::atomic<bool> stop_req_{false};
+  std::thread       worker_;
+};
+
+} // namespace flexsdr
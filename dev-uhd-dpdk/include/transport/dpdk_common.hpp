@@ -1,5 +1,6 @@
 // include/transport/dpdk_common.hpp
 #pragma once
+#include <cstddef>
 #include <string>
 #include <unordered_map>
 
@@ -8,6 +9,7 @@ extern "C" {
 #include <rte_eal.h>
 #include <rte_errno.h>
 #include <rte_mbuf.h>    // <-- needed for rte_pktmbuf_data_room_size
+#include <rte_memory.h>
 #include <rte_mempool.h>
 #include <rte_ring.h>
 }
@@ -32,4 +34,14 @@ static inline uint32_t pool_data_room(const rte_mempool* mp) {
   return pool_data_room(const_cast<rte_mempool*>(mp));
 }
 
+// True if [p, p+bytes) lies in one DPDK hugepage mapping, i.e. memory every
+// process of this EAL instance sees at the same address (rte_malloc,
+// memzones, mempools; not rte_extmem_register'ed memory).
+static inline bool dpdk_resident(const void* p, std::size_t bytes) {
+  if (!p || bytes == 0) return false;
+  const rte_memseg_list* msl = rte_mem_virt2memseg_list(p);
+  if (!msl || msl->external) return false;
+  return rte_mem_virt2memseg_list(static_cast<const char*>(p) + bytes - 1) == msl;
+}
+
 } // namespace flexsdr
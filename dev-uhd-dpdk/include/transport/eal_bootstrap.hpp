@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <optional>
@@ -11,6 +12,41 @@
 
 namespace flexsdr {
 
+// Result of EalBootstrap::preflight(): what the host offers (hugepages per
+// NUMA node, isolated/nohz_full CPUs, our affinity) against what the config
+// asks for (socket_mem, pools, lcores), plus one finding per problem seen.
+struct EalPreflight {
+  enum class Severity { Info, Warn, Error };
+
+  struct Finding {
+    Severity    sev;
+    std::string what;
+  };
+
+  struct NumaNode {
+    int                   node{0};
+    uint64_t              free_bytes{0};    // free hugepage memory, all page sizes
+    uint64_t              total_bytes{0};
+    uint64_t              socket_mem{0};    // requested via --socket-mem (0 = none)
+    std::vector<unsigned> cpus;
+  };
+
+  std::vector<NumaNode> nodes;
+  uint64_t              pool_bytes{0};      // estimated footprint of the pools this process creates
+  std::vector<unsigned> lcore_cpus;         // physical CPUs the EAL lcores will run on
+  std::vector<unsigned> isolated;           // /sys/devices/system/cpu/isolated
+  std::vector<unsigned> nohz_full;          // /sys/devices/system/cpu/nohz_full
+  std::vector<unsigned> affinity;           // sched_getaffinity of this process
+  std::vector<Finding>  findings;
+
+  size_t count(Severity s) const;
+  bool   ok() const { return count(Severity::Error) == 0; }
+  // No errors and no warnings: nothing known to make the run slow.
+  bool   clean() const { return ok() && count(Severity::Warn) == 0; }
+
+  std::string to_string() const;
+};
+
 class EalBootstrap {
 public:
   // Build from full config; you can also pass an explicit "program name" for argv[0].
@@ -21,8 +57,16 @@ public:
   void build_args(const std::vector<std::string>& extra_flags = {});
 
   // Returns number of consumed args (>=0) or negative on error (same contract as rte_eal_init).
+  // Runs preflight() first unless cfg.eal.preflight is "off"; with "strict" a
+  // report that is not clean() refuses to start (returns -1, EAL untouched).
   int init();
 
+  // Check hugepages and CPU placement against the config without touching EAL.
+  // Safe to call before build_args(). Secondaries skip the pool footprint
+  // check since they do not create pools; the process type comes from
+  // cfg.defaults.role (ue/gnb = secondary), or --proc-type once args are built.
+  EalPreflight preflight() const;
+
   // Return the exact argv vector that will be/was passed to EAL (for logging/testing).
   const std::vector<std::string>& args() const { return args_str_storage_; }
 
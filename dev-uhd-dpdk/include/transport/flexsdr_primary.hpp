@@ -1,18 +1,23 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <rte_mempool.h>
 #include <rte_ring.h>
 
 #include "conf/config_params.hpp"
+#include "transport/shm_control.hpp"
 
 namespace flexsdr {
 
 class FlexSDRPrimary {
 public:
   explicit FlexSDRPrimary(std::string yaml_path);
+  ~FlexSDRPrimary();
   int init_resources();
 
   const std::vector<rte_mempool*>& pools()       const { return pools_;       }
@@ -23,6 +28,19 @@ public:
   const std::vector<rte_ring*>&     ic_tx_rings() const { return ic_tx_rings_; }
   const std::vector<rte_ring*>&     ic_rx_rings() const { return ic_rx_rings_; }
 
+  // Live tunables ("tunables:" section of the YAML). The store always holds
+  // the startup values; watch_tunables() re-reads the file on change/SIGHUP.
+  const std::shared_ptr<conf::TunablesStore>& tunables() const { return tunables_; }
+  int watch_tunables();
+
+  // Identifies this primary instance to secondaries (see PrimaryLink)
+  uint64_t boot_id() const { return boot_id_; }
+
+  // Control/status memzone (valid after init_resources); nullptr if it
+  // could not be created. A heartbeat thread keeps primary_heartbeat_ns
+  // fresh and frees attach slots of secondaries that have exited.
+  shm_ctl* ctl() const { return ctl_; }
+
 private:
   // config
   int load_config_();
@@ -43,10 +61,22 @@ private:
   int create_interconnect_(); // primary-gnb creates IC rings (+pool if configured)
   int lookup_interconnect_(); // primary-ue looks up IC rings
 
+  // control memzone
+  int  publish_ctl_();
+  void heartbeat_loop_();
+
 private:
   std::string yaml_path_;
   conf::PrimaryConfig cfg_;
 
+  std::shared_ptr<conf::TunablesStore>   tunables_;
+  std::unique_ptr<conf::TunablesWatcher> tunables_watcher_;   // stopped before tunables_ goes
+  uint64_t                               boot_id_ = 0;
+
+  shm_ctl*          ctl_ = nullptr;
+  std::thread       hb_thr_;
+  std::atomic<bool> hb_stop_{false};
+
   // local IO
   std::vector<rte_mempool*> pools_;
   std::vector<rte_ring*>    tx_rings_;
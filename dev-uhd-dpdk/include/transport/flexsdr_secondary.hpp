@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
-#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 #include <rte_mempool.h>
 #include <rte_mbuf.h>
@@ -10,6 +14,9 @@
 
 #include "conf/config_params.hpp"
 #include "device/flexsdr_tx_streamer.hpp"  // for TxBackend
+#include "transport/primary_link.hpp"
+#include "transport/shm_control.hpp"
+#include "transport/tx_extbuf.hpp"
 
 namespace flexsdr {
 
@@ -21,14 +28,61 @@ public:
   int init_resources(); // lookup-only
 
   // TxBackend interface implementation
-  bool send_burst(std::size_t chan,
-                  const void* data,
-                  std::size_t bytes,
-                  uint64_t tsf,
-                  uint32_t spp,
-                  uint16_t fmt,
-                  bool sob,
-                  bool eob) override;
+  tx_status send_burst(std::size_t chan,
+                       const void* data,
+                       std::size_t bytes,
+                       uint64_t tsf,
+                       uint32_t spp,
+                       uint16_t fmt,
+                       bool sob,
+                       bool eob) override;
+
+  // All-or-nothing across TX rings (one packet per listed channel)
+  tx_status send_burst_multi(const std::size_t* chans,
+                             const void* const* data,
+                             std::size_t nchans,
+                             std::size_t bytes,
+                             uint64_t tsf,
+                             uint32_t spp,
+                             uint16_t fmt,
+                             bool sob,
+                             bool eob) override;
+
+  // Zero-copy: packets reference 'data' when it is DPDK hugepage memory
+  // (see TxExtbuf), otherwise these copy like send_burst*(). Each sending
+  // thread has its own TxExtbuf, so completions are reaped on the thread
+  // that sent the buffer.
+  tx_status send_burst_zc(std::size_t chan,
+                          const void* data,
+                          std::size_t bytes,
+                          uint64_t tsf,
+                          uint32_t spp,
+                          uint16_t fmt,
+                          bool sob,
+                          bool eob,
+                          const tx_done& done) override;
+
+  tx_status send_burst_multi_zc(const std::size_t* chans,
+                                const void* const* data,
+                                std::size_t nchans,
+                                std::size_t bytes,
+                                uint64_t tsf,
+                                uint32_t spp,
+                                uint16_t fmt,
+                                bool sob,
+                                bool eob,
+                                const tx_done* done) override;
+
+  std::size_t reap_tx_completions() override;
+
+  std::size_t max_burst_bytes(std::size_t chan) const override;
+
+  // Back-pressure flag of TX queue 'chan' (ring watermarks, see RingSpec);
+  // while raised, re-checks the ring so it clears even without a consumer update.
+  bool tx_backpressure(std::size_t chan) override;
+  bool tx_ready() override { return link_->up(); }
+  bool tx_would_block(const std::size_t* chans, std::size_t nchans) override;
+  void tx_dropped(const std::size_t* chans, std::size_t nchans) override;
 
   // Legacy vector access
   const std::vector<rte_mempool*>& pools()    const { return pools_;    }
@@ -48,12 +102,58 @@ public:
     return (qid < pools_.size()) ? pools_[qid] : nullptr;
   }
   
+  // Name-based access (tools that target one ring, e.g. playback)
+  rte_ring* rx_ring_by_name(const std::string& name) const {
+    for (auto* r : rx_rings_) if (r && name == r->name) return r;
+    return nullptr;
+  }
+
+  rte_ring* tx_ring_by_name(const std::string& name) const {
+    for (auto* r : tx_rings_) if (r && name == r->name) return r;
+    return nullptr;
+  }
+
+  rte_mempool* pool_by_name(const std::string& name) const {
+    for (auto* p : pools_) if (p && name == p->name) return p;
+    return nullptr;
+  }
+
   // NEW: Get queue counts
   size_t num_rx_queues() const { return rx_rings_.size(); }
   size_t num_tx_queues() const { return tx_rings_.size(); }
   size_t num_pools() const { return pools_.size(); }
+
+  // Live tunables ("tunables:" section of the YAML). The store always holds
+  // the startup values; watch_tunables() re-reads the file on change/SIGHUP.
+  const std::shared_ptr<conf::TunablesStore>& tunables() const { return tunables_; }
+  int watch_tunables();
+
+  // ---- Primary liveness / re-attach (see PrimaryLink for the DPDK limits) ----
+  // Polls rte_eal_primary_proc_alive() every period_ms. On loss the link
+  // goes LOST: send_burst*() fail fast and streamers holding the link stop
+  // polling rings. When a primary is back and it is the same instance (boot
+  // id), rings and pools are checked by name and the link returns to UP;
+  // otherwise the link goes STALE.
+  int  watch_primary(unsigned period_ms = 100);
+  void stop_watch_primary();
+  // Called from the watch thread on every state change (set before watch_primary)
+  void on_primary_change(std::function<void(uint32_t state)> cb);
+  const std::shared_ptr<PrimaryLink>& primary_link() const { return link_; }
+  // Confirm by name that the pools and rings held are still the primary's;
+  // 0 on success (link back to UP). Never replaces them, so it is safe while
+  // TX/RX threads run.
+  int reattach();
   
-  // NEW: Statistics support
+  // ---- Shared control memzone (see shm_control.hpp) ------------------------
+  // nullptr when the primary predates it; lookups then fall back to names.
+  shm_ctl* ctl() const { return ctl_; }
+  int      ctl_slot() const { return ctl_slot_; }
+  // Consumer-side counters of RX queue qid, for the streamer that drains it
+  shm_queue_counters* rx_counters(uint16_t qid) const {
+    return (qid < rx_ctr_.size()) ? rx_ctr_[qid] : nullptr;
+  }
+
+  // Statistics (from the control memzone; zeros without one)
   struct queue_stats {
     uint64_t rx_packets;
     uint64_t rx_bytes;
@@ -61,16 +161,18 @@ public:
     uint64_t tx_bytes;
     uint64_t ring_full_drops;
     uint64_t mbuf_alloc_fails;
+    uint64_t backpressure_raised;   // times the TX ring crossed its high watermark
+    bool     backpressure;          // flag currently raised
+    // This process only: TX allocations from queue qid's pool (see alloc_mbuf_)
+    uint64_t mbuf_cache_hits;       // served by the calling thread's cache
+    uint64_t mbuf_cache_refills;    // cache empty: one bulk get from the pool
+    uint64_t mbuf_cache_bypass;     // EAL lcore or no cache: plain rte_pktmbuf_alloc
   };
   
-  queue_stats get_stats(uint16_t qid) const {
-    // For now, return zeros - implementation can be added later
-    // Real implementation would query DPDK ring stats
-    return queue_stats{};
-  }
+  queue_stats get_stats(uint16_t qid) const;
   
   void reset_stats(uint16_t qid) {
-    // Placeholder for stats reset
+    // Counters are shared with the primary and other tools: read deltas instead
     (void)qid;
   }
 
@@ -84,30 +186,68 @@ private:
   int lookup_rings_rx_();
   int lookup_ring_(const std::string& name, rte_ring** out);
 
+  // TX helpers
+  tx_status send_multi_(const std::size_t* chans, const void* const* data, std::size_t nchans,
+                        std::size_t bytes, const tx_done* done);
+
 private:
   std::string yaml_path_;
   conf::PrimaryConfig cfg_;
 
+  std::shared_ptr<conf::TunablesStore>   tunables_;
+  std::unique_ptr<conf::TunablesWatcher> tunables_watcher_;   // stopped before tunables_ goes
+
+  // Primary watch
+  void watch_loop_(unsigned period_ms);
+  static uint64_t read_boot_id();
+  void set_link_state_(uint32_t st);
+  std::shared_ptr<PrimaryLink>      link_ = std::make_shared<PrimaryLink>();
+  uint64_t                          boot_id_ = 0;     // primary instance we attached to
+  std::thread                       watch_thr_;
+  std::atomic<bool>                 watch_stop_{false};
+  std::mutex                        watch_mtx_;       // guards on_change_
+  std::function<void(uint32_t)>     on_change_;
+
+  // Control memzone
+  void attach_ctl_();
+  void release_ctl_();
+  shm_ctl*                          ctl_ = nullptr;
+  int                               ctl_slot_ = -1;
+  std::vector<shm_queue_counters*>  tx_ctr_;          // parallel to tx_rings_
+  std::vector<shm_queue_counters*>  rx_ctr_;          // parallel to rx_rings_
+  std::vector<shm_ring_bp*>         tx_bp_;           // parallel to tx_rings_; null = no watermarks
+
+  // Zero-copy TX: one TxExtbuf per sending thread (it is not thread-safe),
+  // created on the thread's first *_zc() call. nullptr: none, or init failed.
+  struct thread_extbufs;                     // thread_local
+  TxExtbuf* thread_extbuf_(bool create);
+
   std::vector<rte_mempool*> pools_;
   std::vector<rte_ring*>    tx_rings_;
   std::vector<rte_ring*>    rx_rings_;
   
-  // Per-channel mbuf cache to avoid repeated allocations
-  // Each channel maintains a small cache of pre-allocated mbufs
-  std::vector<std::deque<rte_mbuf*>> mbuf_cache_;
-  static constexpr size_t MBUF_CACHE_SIZE = 32;  // Cache size per channel
-  
-  // Helper to get mbuf from cache or allocate new one
-  rte_mbuf* get_mbuf_from_cache(size_t chan);
-  
-  // Helper to return unused mbuf to cache
-  void return_mbuf_to_cache(size_t chan, rte_mbuf* m);
-  
-  // Initialize mbuf cache for all channels
-  int init_mbuf_cache_();
-  
-  // Cleanup mbuf cache
-  void cleanup_mbuf_cache_();
+  // Per-thread mbuf caches. OAI's TX threads are not EAL lcores, so the
+  // pools' per-lcore caches never serve them and every rte_pktmbuf_alloc()
+  // would hit the shared pool ring. Each such thread gets its own
+  // rte_mempool_cache per pool instead (sized by the pool's cache_size),
+  // refilled in bulk. Registering the threads with rte_thread_register()
+  // is avoided on purpose: a secondary's lcore ids can collide with the
+  // primary's, and the per-lcore caches live in the shared pool.
+  struct mbuf_cache_ctr {
+    size_t                pool;              // index into pools_
+    std::atomic<uint64_t> hits{0};           // written by the owning thread only
+    std::atomic<uint64_t> refills{0};
+    std::atomic<uint64_t> bypass{0};
+  };
+  struct thread_caches;                      // thread_local, flushed on thread exit
+  rte_mbuf* alloc_mbuf_(size_t chan);
+  // This thread's cache for pools_[chan]; with !create only an existing one
+  // (nullptr if none, *cache untouched)
+  mbuf_cache_ctr* thread_cache_(size_t chan, rte_mempool_cache** cache, bool create);
+
+  std::vector<unsigned>                        pool_cache_size_;   // parallel to pools_
+  mutable std::mutex                           cache_mtx_;         // guards cache_ctrs_
+  std::vector<std::shared_ptr<mbuf_cache_ctr>> cache_ctrs_;        // one per (thread, pool)
 };
 
 } // namespace flexsdr
@@ -0,0 +1,58 @@
+// include/transport/mbuf_stamp.hpp
+#pragma once
+
+#include <cstdint>
+
+extern "C" {
+#include <rte_config.h>
+#include <rte_cycles.h>
+#include <rte_mbuf.h>
+#include <rte_mbuf_dyn.h>
+}
+
+namespace flexsdr {
+
+/**
+ * Enqueue time of a TX packet, carried in an mbuf dynamic field so the
+ * interconnect switch can tell how long a packet has been queued (age-based
+ * dropping, wait-time stats) without a header on the raw IQ payload.
+ *
+ * The value is the producer's TSC (rte_get_tsc_cycles) at enqueue; 0 means
+ * "not stamped". The field is registered by name in shared memory, so every
+ * process that calls mbuf_stamp_init() gets the same offset; until then
+ * stamping is a no-op and every packet reads as unstamped.
+ *
+ * rte_pktmbuf_alloc() does not reset dynamic fields, so a recycled mbuf
+ * still carries the stamp of its previous trip. Every producer that
+ * enqueues onto a switched ring must therefore stamp each packet, and the
+ * switch clears the stamp of what it forwards.
+ */
+inline int& mbuf_stamp_offset() {
+  static int off = -1;
+  return off;
+}
+
+// Register (or look up) the field. Returns the offset, or <0 (rte_errno set).
+inline int mbuf_stamp_init() {
+  if (mbuf_stamp_offset() >= 0) return mbuf_stamp_offset();
+  static const rte_mbuf_dynfield desc = {
+    "flexsdr_dynfield_enq_tsc", sizeof(uint64_t), alignof(uint64_t), 0
+  };
+  const int off = rte_mbuf_dynfield_register(&desc);
+  if (off >= 0) mbuf_stamp_offset() = off;
+  return off;
+}
+
+inline void mbuf_stamp_set(rte_mbuf* m, uint64_t tsc) {
+  const int off = mbuf_stamp_offset();
+  if (off >= 0) *RTE_MBUF_DYNFIELD(m, off, uint64_t*) = tsc;
+}
+
+inline void mbuf_stamp_clear(rte_mbuf* m) { mbuf_stamp_set(m, 0); }
+
+inline uint64_t mbuf_stamp_get(const rte_mbuf* m) {
+  const int off = mbuf_stamp_offset();
+  return off >= 0 ? *RTE_MBUF_DYNFIELD(m, off, const uint64_t*) : 0;
+}
+
+} // namespace flexsdr
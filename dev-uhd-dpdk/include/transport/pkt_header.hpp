@@ -0,0 +1,36 @@
+// include/transport/pkt_header.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flexsdr {
+
+/**
+ * 32-byte header in front of every IQ payload on the rings
+ * (vrt_hdr_bytes = 32, TSF at tsf_offset = 24 in the streamer options).
+ *
+ * Producers that do not know a field leave it zero; consumers must treat
+ * an all-zero header as "TSF only".
+ */
+struct pkt_header {
+  uint16_t flags;      // PKT_F_*
+  uint16_t chan;       // channel / stream index
+  uint32_t spp;        // samples in this packet (0 = derive from length)
+  uint32_t seq;        // per-stream packet counter
+  uint16_t cmd_seq;    // low 16 bits of the last timed command applied
+  uint16_t reserved0;
+  uint64_t reserved1;
+  uint64_t tsf;        // sample tick of the first sample
+};
+
+static_assert(sizeof(pkt_header) == 32, "pkt_header must stay 32 bytes");
+static_assert(offsetof(pkt_header, tsf) == 24, "TSF offset is part of the ring format");
+
+enum : uint16_t {
+  PKT_F_SOB          = 1u << 0,   // first packet of a burst
+  PKT_F_EOB          = 1u << 1,   // last packet of a burst
+  PKT_F_CMD_BOUNDARY = 1u << 2,   // first sample taken with the settings of timed command 'cmd_seq'
+};
+
+} // namespace flexsdr
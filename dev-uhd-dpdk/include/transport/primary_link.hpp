@@ -0,0 +1,56 @@
+// include/transport/primary_link.hpp
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace flexsdr {
+
+/**
+ * Secondary-side view of the primary process, shared (read-only) with the
+ * streamers and the ingress worker so they stop touching rings and pools
+ * the moment the primary goes away.
+ *
+ * DPDK limitation: a secondary's EAL stays bound to the memory layout of the
+ * primary it attached to. A primary that fails the liveness check only
+ * briefly is still the same instance; it is re-attached once its rings and
+ * pools are confirmed by name. A restarted primary is a new process that rebuilds the
+ * shared runtime config. The secondary cannot attach to it from the same
+ * process: rte_eal_init cannot run twice, and names looked up through the old
+ * mapping could resolve to memory the secondary has not mapped. Such a primary
+ * is reported as STALE, and the secondary process has to be restarted.
+ */
+struct PrimaryLink {
+  enum : uint32_t {
+    UP    = 0,   // attached; rings/pools valid
+    LOST  = 1,   // primary not alive; data path quiesced
+    STALE = 2,   // a different primary instance is up; restart required
+  };
+
+  std::atomic<uint32_t> state{UP};
+  std::atomic<uint64_t> generation{0};   // bumped on every successful re-attach
+  std::atomic<uint64_t> losses{0};
+  std::atomic<bool>     closed{false};   // owning FlexSDRSecondary destroyed
+
+  bool up() const { return state.load(std::memory_order_acquire) == UP; }
+};
+
+inline const char* primary_link_state_str(uint32_t s) {
+  switch (s) {
+    case PrimaryLink::UP:    return "up";
+    case PrimaryLink::LOST:  return "lost";
+    case PrimaryLink::STALE: return "stale";
+    default:                 return "unknown";
+  }
+}
+
+// Boot id file of the current primary instance in the EAL runtime dir
+// (rte_eal_get_runtime_dir(), i.e. /var/run/dpdk/<file-prefix>). A plain
+// file rather than a memzone so a secondary can read it without walking the
+// shared memory config.
+inline std::string primary_boot_path(const char* runtime_dir) {
+  return std::string(runtime_dir) + "/flexsdr_primary.boot";
+}
+
+} // namespace flexsdr
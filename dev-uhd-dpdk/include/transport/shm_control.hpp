@@ -0,0 +1,254 @@
+// include/transport/shm_control.hpp
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+#include <rte_memzone.h>
+
+struct rte_ring;
+struct rte_mempool;
+
+namespace flexsdr {
+
+/**
+ * Control/status memzone shared by the primary and its secondaries.
+ *
+ * Created by FlexSDRPrimary::init_resources() once all pools and rings
+ * exist, then marked ready. A secondary resolves every pool/ring it needs
+ * from the directory with a single rte_memzone_lookup() (DPDK maps shared
+ * objects at the same address in every process), claims an attach slot,
+ * and from then on both sides bump heartbeats and per-queue counters with
+ * plain relaxed stores; nobody takes a lock.
+ *
+ * Layout rules: bump SHM_CTL_VERSION on any change; every block written by
+ * a different party sits in its own cache line.
+ */
+constexpr const char* SHM_CTL_NAME    = "flexsdr_ctl";
+constexpr uint32_t    SHM_CTL_MAGIC   = 0x46534452u;   // "FSDR"
+constexpr uint32_t    SHM_CTL_VERSION = 2;
+
+constexpr unsigned SHM_CTL_MAX_ENTRIES = 64;
+constexpr unsigned SHM_CTL_MAX_SLOTS   = 16;
+constexpr unsigned SHM_CTL_NAMESIZE    = 32;    // RTE_RING_NAMESIZE / RTE_MEMPOOL_NAMESIZE
+
+enum : uint8_t {
+  SHM_KIND_POOL = 1,
+  SHM_KIND_RING = 2,
+};
+
+enum : uint8_t {
+  SHM_DIR_NONE = 0,
+  SHM_DIR_TX   = 1,     // secondary -> primary
+  SHM_DIR_RX   = 2,     // primary -> secondary
+  SHM_DIR_IC   = 3,     // interconnect between primaries
+};
+
+struct alignas(64) shm_dir_entry {
+  char     name[SHM_CTL_NAMESIZE];
+  void*    obj;          // rte_ring* / rte_mempool*
+  uint32_t size;         // ring size or pool element count
+  uint8_t  kind;         // SHM_KIND_*
+  uint8_t  dir;          // SHM_DIR_*
+  uint16_t qid;          // index within its kind+dir (tx_rings()[qid], ...)
+};
+
+// One producer and one consumer per ring: each side owns a cache line.
+struct shm_queue_counters {
+  struct alignas(64) side {
+    std::atomic<uint64_t> pkts{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> drops{0};        // producer: ring full; consumer: discarded
+    std::atomic<uint64_t> alloc_fails{0};  // producer only
+  };
+  side prod;
+  side cons;
+
+  // Single writer per side: a load+store avoids a locked RMW on the hot path.
+  static void add(std::atomic<uint64_t>& c, uint64_t v) {
+    c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+  }
+};
+
+// Occupancy watermarks of a ring and the back-pressure flag they drive.
+// hi/lo (entries) are written once by the primary; hi 0 = off. Whoever
+// observes the occupancy (producer after an enqueue, consumer after a
+// dequeue, a producer waiting for room) calls shm_bp_update(): at or above
+// hi raises the flag, at or below lo clears it. A stale observation can
+// only flip it early or late by one update, never leave it stuck, as long
+// as someone keeps looking.
+struct alignas(64) shm_ring_bp {
+  uint32_t              hi;
+  uint32_t              lo;
+  std::atomic<uint32_t> asserted{0};
+  std::atomic<uint64_t> raised{0};      // times the flag went up
+};
+
+inline void shm_bp_update(shm_ring_bp* b, uint32_t used) {
+  if (!b || !b->hi) return;
+  const uint32_t on = b->asserted.load(std::memory_order_relaxed);
+  if (!on && used >= b->hi) {
+    b->asserted.store(1, std::memory_order_release);
+    b->raised.fetch_add(1, std::memory_order_relaxed);
+  } else if (on && used <= b->lo) {
+    b->asserted.store(0, std::memory_order_release);
+  }
+}
+
+inline bool shm_bp_asserted(const shm_ring_bp* b) {
+  return b && b->asserted.load(std::memory_order_acquire) != 0;
+}
+
+enum : uint32_t {
+  SHM_SLOT_FREE     = 0,
+  SHM_SLOT_ATTACHED = 1,
+};
+
+struct alignas(64) shm_attach_slot {
+  std::atomic<uint32_t> state{SHM_SLOT_FREE};
+  int32_t               pid{0};
+  char                  role[16]{};
+  std::atomic<uint64_t> attached_ns{0};
+  std::atomic<uint64_t> heartbeat_ns{0};   // CLOCK_MONOTONIC, written by the secondary
+};
+
+struct shm_ctl {
+  // ---- header (written once by the primary) -------------------------------
+  uint32_t magic;
+  uint32_t version;
+  uint32_t struct_size;
+  uint32_t n_entries;
+  uint64_t boot_id;                              // FlexSDRPrimary::boot_id()
+  char     role[16];                             // primary role
+  alignas(64) std::atomic<uint32_t> ready;       // directory complete
+  alignas(64) std::atomic<uint64_t> primary_heartbeat_ns;
+
+  shm_dir_entry      dir[SHM_CTL_MAX_ENTRIES];
+  shm_queue_counters counters[SHM_CTL_MAX_ENTRIES];   // parallel to dir (rings only)
+  shm_ring_bp        bp[SHM_CTL_MAX_ENTRIES];         // parallel to dir (rings only)
+  shm_attach_slot    slots[SHM_CTL_MAX_SLOTS];
+};
+
+inline uint64_t shm_now_ns() {
+  timespec ts{};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000ull + uint64_t(ts.tv_nsec);
+}
+
+// ---- primary side -------------------------------------------------------------
+
+// Reserve (or reuse) the memzone and reset it to an empty, not-ready directory.
+inline shm_ctl* shm_ctl_create(int socket_id, uint64_t boot_id, const char* role) {
+  const rte_memzone* mz = rte_memzone_reserve_aligned(SHM_CTL_NAME, sizeof(shm_ctl),
+                                                      socket_id, 0, 64);
+  if (!mz) mz = rte_memzone_lookup(SHM_CTL_NAME);
+  if (!mz || mz->len < sizeof(shm_ctl)) return nullptr;
+
+  auto* c = static_cast<shm_ctl*>(mz->addr);
+  c->ready.store(0, std::memory_order_release);
+  std::memset(static_cast<void*>(c), 0, sizeof(shm_ctl));
+  c->magic       = SHM_CTL_MAGIC;
+  c->version     = SHM_CTL_VERSION;
+  c->struct_size = sizeof(shm_ctl);
+  c->boot_id     = boot_id;
+  std::strncpy(c->role, role ? role : "", sizeof(c->role) - 1);
+  return c;
+}
+
+// Returns the entry index or -1 if the directory is full.
+inline int shm_ctl_add(shm_ctl* c, const char* name, void* obj, uint32_t size,
+                       uint8_t kind, uint8_t dir, uint16_t qid) {
+  if (!c || c->n_entries >= SHM_CTL_MAX_ENTRIES) return -1;
+  shm_dir_entry& e = c->dir[c->n_entries];
+  std::strncpy(e.name, name, SHM_CTL_NAMESIZE - 1);
+  e.obj  = obj;
+  e.size = size;
+  e.kind = kind;
+  e.dir  = dir;
+  e.qid  = qid;
+  return static_cast<int>(c->n_entries++);
+}
+
+inline void shm_ctl_publish(shm_ctl* c) {
+  if (c) c->ready.store(1, std::memory_order_release);
+}
+
+// Counters of the ring 'obj' (by address), nullptr if it is not in the directory.
+inline shm_queue_counters* shm_ctl_counters(shm_ctl* c, const void* obj) {
+  if (!c || !obj) return nullptr;
+  for (uint32_t i = 0; i < c->n_entries; i++) {
+    if (c->dir[i].obj == obj && c->dir[i].kind == SHM_KIND_RING) return &c->counters[i];
+  }
+  return nullptr;
+}
+
+// Back-pressure block of the ring 'obj', nullptr if it is not in the directory.
+inline shm_ring_bp* shm_ctl_bp(shm_ctl* c, const void* obj) {
+  if (!c || !obj) return nullptr;
+  for (uint32_t i = 0; i < c->n_entries; i++) {
+    if (c->dir[i].obj == obj && c->dir[i].kind == SHM_KIND_RING) return &c->bp[i];
+  }
+  return nullptr;
+}
+
+// Watermarks in percent of the ring's usable capacity (hi_pct 0 = off).
+inline void shm_bp_configure(shm_ring_bp* b, uint32_t capacity, unsigned hi_pct, unsigned lo_pct) {
+  if (!b) return;
+  b->hi = hi_pct ? std::max<uint32_t>(1, uint32_t(uint64_t(capacity) * hi_pct / 100)) : 0;
+  b->lo = b->hi ? std::min<uint32_t>(b->hi - 1, uint32_t(uint64_t(capacity) * lo_pct / 100)) : 0;
+  b->asserted.store(0, std::memory_order_relaxed);
+}
+
+// ---- secondary side -----------------------------------------------------------
+
+// nullptr if absent, not ready, or from an incompatible build.
+inline shm_ctl* shm_ctl_attach() {
+  const rte_memzone* mz = rte_memzone_lookup(SHM_CTL_NAME);
+  if (!mz || mz->len < sizeof(shm_ctl)) return nullptr;
+  auto* c = static_cast<shm_ctl*>(mz->addr);
+  if (c->magic != SHM_CTL_MAGIC || c->version != SHM_CTL_VERSION ||
+      c->struct_size != sizeof(shm_ctl) || !c->ready.load(std::memory_order_acquire))
+    return nullptr;
+  return c;
+}
+
+inline int shm_ctl_find(const shm_ctl* c, const char* name, uint8_t kind) {
+  if (!c) return -1;
+  for (uint32_t i = 0; i < c->n_entries; i++) {
+    if (c->dir[i].kind == kind && std::strncmp(c->dir[i].name, name, SHM_CTL_NAMESIZE) == 0)
+      return static_cast<int>(i);
+  }
+  return -1;
+}
+
+// Claim a free attach slot; -1 if all are taken.
+inline int shm_ctl_claim_slot(shm_ctl* c, int32_t pid, const char* role) {
+  if (!c) return -1;
+  for (unsigned i = 0; i < SHM_CTL_MAX_SLOTS; i++) {
+    shm_attach_slot& s = c->slots[i];
+    uint32_t expected = SHM_SLOT_FREE;
+    if (s.state.load(std::memory_order_relaxed) != SHM_SLOT_FREE) continue;
+    if (!s.state.compare_exchange_strong(expected, SHM_SLOT_ATTACHED, std::memory_order_acq_rel))
+      continue;
+    s.pid = pid;
+    std::memset(s.role, 0, sizeof(s.role));
+    std::strncpy(s.role, role ? role : "", sizeof(s.role) - 1);
+    const uint64_t now = shm_now_ns();
+    s.attached_ns.store(now, std::memory_order_relaxed);
+    s.heartbeat_ns.store(now, std::memory_order_release);
+    return static_cast<int>(i);
+  }
+  return -1;
+}
+
+inline void shm_ctl_release_slot(shm_ctl* c, int slot) {
+  if (!c || slot < 0 || slot >= static_cast<int>(SHM_CTL_MAX_SLOTS)) return;
+  c->slots[slot].pid = 0;
+  c->slots[slot].state.store(SHM_SLOT_FREE, std::memory_order_release);
+}
+
+} // namespace flexsdr
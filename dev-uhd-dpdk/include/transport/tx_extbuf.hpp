@@ -0,0 +1,85 @@
+// include/transport/tx_extbuf.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "device/flexsdr_tx_streamer.hpp"   // TxBackend::tx_done
+
+struct rte_mbuf;
+struct rte_mempool;
+struct rte_mbuf_ext_shared_info;
+
+namespace flexsdr {
+
+/**
+ * Zero-copy TX: builds mbufs whose data is the caller's IQ buffer
+ * (rte_pktmbuf_attach_extbuf) instead of a memcpy into the mbuf.
+ *
+ * The consumer is the primary, a different process, so the extbuf free
+ * callback can never run there (its address is only valid in this
+ * process). Each attached buffer therefore starts with two references: one
+ * owned by the mbuf and dropped when the primary frees it, one kept here.
+ * reap() looks for shared infos that are down to our reference and reports
+ * the buffer as done on the calling thread. It walks buffers in send order
+ * and stops at the first one still held, so its cost follows the number of
+ * completions; a full scan only happens when every slot is in use.
+ *
+ * Only memory the primary has mapped at the same address can be attached:
+ * DPDK hugepage memory (rte_malloc, mempools, memzones), not anonymous or
+ * rte_extmem_register'ed memory. attach() returns nullptr for anything
+ * else and the caller copies instead.
+ *
+ * Not thread-safe: one instance per sending thread.
+ */
+class TxExtbuf {
+public:
+  TxExtbuf() = default;
+  ~TxExtbuf();
+
+  TxExtbuf(const TxExtbuf&) = delete;
+  TxExtbuf& operator=(const TxExtbuf&) = delete;
+
+  // Shared infos live in hugepage memory so the primary can drop its reference.
+  int  init(unsigned slots, int socket_id);
+  bool ready() const { return shinfo_ != nullptr; }
+
+  // True if the primary can read [data, data+bytes) at the same address.
+  static bool eligible(const void* data, std::size_t bytes);
+
+  // An mbuf from 'pool' referencing 'data', or nullptr (not eligible, no
+  // free slot, or pool empty; *alloc_failed tells the last one apart).
+  // 'done' runs from a later reap() once the primary has released it; if the
+  // mbuf is freed here instead (enqueue failed), call cancel() rather than
+  // rte_pktmbuf_free() so the callback does not fire for an unsent buffer.
+  rte_mbuf* attach(rte_mempool* pool, const void* data, std::size_t bytes,
+                   const TxBackend::tx_done& done, bool* alloc_failed = nullptr);
+  void      cancel(rte_mbuf* m);
+  // Drop the callback of an mbuf that was handed off anyway.
+  void      forget(rte_mbuf* m);
+
+  // Run callbacks of buffers the primary is done with; returns how many.
+  // Callbacks must not send (they run in the middle of the scan).
+  std::size_t reap();
+  std::size_t in_flight() const { return count_; }
+
+private:
+  struct slot_meta {
+    TxBackend::tx_done done;
+    const void*        data;
+  };
+
+  bool        released_(uint32_t s) const;
+  void        complete_(uint32_t s);
+  std::size_t reap_all_();                        // full scan, keeps send order
+
+  rte_mbuf_ext_shared_info* shinfo_ = nullptr;   // [slots], hugepage
+  std::vector<slot_meta>    meta_;                // [slots], process-local
+  std::vector<uint32_t>     free_;                // free slot stack
+  std::vector<uint32_t>     fifo_;                // attached slots in send order (ring)
+  std::size_t               head_  = 0;           // oldest entry in fifo_
+  std::size_t               count_ = 0;
+};
+
+} // namespace flexsdr
@@ -0,0 +1,48 @@
+// include/workers/batch_fft.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flexsdr {
+
+/**
+ * Small in-place complex FFT (forward, fp32) that transforms kLanes frames
+ * at once.
+ *
+ * Data is split re/im and lane-interleaved: element n of frame f lives at
+ * re[n * kLanes + f] (same for im), so each SSE2 register carries the same
+ * element of four frames and every radix-4 stage (plus one radix-2 stage for
+ * odd log2 sizes) is plain vertical arithmetic with no shuffles.
+ *
+ * Output is left in digit-reversed order; bin(p) maps an output position to
+ * its frequency index (0 = DC, N/2 = Nyquist). Callers that only accumulate
+ * power do the reordering once, after averaging.
+ */
+class BatchFft {
+public:
+  static constexpr size_t kLanes = 4;
+
+  // n: power of two in [16, 65536]; anything else is rounded down into range.
+  explicit BatchFft(size_t n);
+
+  size_t size() const { return n_; }
+  size_t bin(size_t pos) const { return perm_[pos]; }
+
+  // re/im: size() * kLanes floats each, 16-byte aligned.
+  void forward(float* re, float* im) const;
+
+private:
+  struct stage {
+    size_t quarter;     // span / 4 (radix-4), 0 marks the final radix-2 stage
+    size_t tw;          // offset into tw_ (3 * quarter complex twiddles)
+  };
+
+  size_t              n_;
+  std::vector<stage>  stages_;
+  std::vector<float>  tw_;       // per stage: w^j, w^2j, w^3j as re,im pairs
+  std::vector<uint32_t> perm_;
+};
+
+} // namespace flexsdr
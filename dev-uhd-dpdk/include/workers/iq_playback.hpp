@@ -0,0 +1,108 @@
+// include/workers/iq_playback.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+struct rte_mempool;
+struct rte_ring;
+
+namespace flexsdr {
+
+class FlexSDRSecondary;
+
+/**
+ * IQ playback source: replays a captured sc16 trace (SigMF or raw) into an
+ * inbound ring as if it came from the switch/radio.
+ *
+ * The file is memory-mapped; each packet is one mbuf from the shared pool
+ * carrying a zeroed header (TSF at tsf_offset) followed by 'spp' samples,
+ * i.e. the layout flexsdr_rx_streamer expects. Packets are released at the
+ * file's sample rate (times 'rate_multiplier') against the TSC, so OAI sees
+ * the same timing it would get from live RF, or a controlled overload.
+ */
+class IqPlayback {
+public:
+  struct options {
+    std::string path;                        // .sigmf-data, .sigmf-meta or raw sc16 file
+    std::string ring_name = "ue_inbound_ring";
+    std::string pool_name = "ue_inbound_pool";
+
+    // Packet layout (same meaning as flexsdr_rx_streamer::options)
+    uint32_t spp           = 512;            // samples per packet (per channel)
+    size_t   vrt_hdr_bytes = 32;             // 0 = raw IQ payload only
+    size_t   tsf_offset    = 24;
+
+    // Pacing
+    double   sample_rate     = 0.0;          // 0 = take it from .sigmf-meta (else 30.72e6)
+    double   rate_multiplier = 1.0;          // >1 plays faster than real time
+    unsigned num_channels    = 0;            // 0 = from .sigmf-meta (else 1)
+    unsigned burst           = 8;            // packets enqueued per pacing step
+    bool     loop            = false;
+    bool     block_on_full   = false;        // wait for ring space instead of dropping
+    int      cpu             = -1;           // pin playback thread (-1 = no pinning)
+  };
+
+  struct stats {
+    uint64_t packets;
+    uint64_t samples;
+    uint64_t loops;            // completed passes over the file
+    uint64_t ring_full_drops;
+    uint64_t mbuf_alloc_fails;
+    uint64_t late_bursts;      // bursts released more than one period late
+  };
+
+  // Ring and pool are resolved through the secondary's lookup tables.
+  IqPlayback(FlexSDRSecondary& sec, options opt);
+  ~IqPlayback();
+
+  IqPlayback(const IqPlayback&) = delete;
+  IqPlayback& operator=(const IqPlayback&) = delete;
+
+  int  start();
+  void stop();
+
+  bool  running()   const { return running_.load(std::memory_order_acquire); }
+  bool  finished()  const { return finished_.load(std::memory_order_acquire); }
+  stats get_stats() const;
+
+  double sample_rate() const { return opt_.sample_rate; }
+
+private:
+  int  resolve_();
+  int  read_meta_(const std::string& meta_path);
+  int  map_file_(const std::string& data_path);
+  void unmap_();
+  void run_();
+  unsigned fill_burst_(unsigned n);
+
+  FlexSDRSecondary& sec_;
+  options           opt_;
+
+  rte_ring*         ring_ = nullptr;
+  rte_mempool*      pool_ = nullptr;
+
+  const uint8_t*    map_       = nullptr;
+  size_t            map_bytes_ = 0;
+  size_t            frame_bytes_ = 4;       // sc16 * channels
+  size_t            pkt_bytes_   = 0;       // payload bytes per packet
+  size_t            pos_         = 0;       // read offset into the map
+  uint64_t          tsf_         = 0;
+
+  std::thread       worker_;
+  std::atomic<bool> running_{false};
+  std::atomic<bool> stop_req_{false};
+  std::atomic<bool> finished_{false};
+
+  std::atomic<uint64_t> packets_{0};
+  std::atomic<uint64_t> samples_{0};
+  std::atomic<uint64_t> loops_{0};
+  std::atomic<uint64_t> ring_full_drops_{0};
+  std::atomic<uint64_t> alloc_fails_{0};
+  std::atomic<uint64_t> late_bursts_{0};
+};
+
+} // namespace flexsdr
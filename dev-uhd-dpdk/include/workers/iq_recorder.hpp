@@ -0,0 +1,146 @@
+// include/workers/iq_recorder.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "workers/iq_tap.hpp"
+
+struct rte_mbuf;
+struct rte_ring;
+
+namespace flexsdr {
+
+/**
+ * High-rate IQ recorder writing SigMF (<base>.sigmf-data + <base>.sigmf-meta).
+ *
+ * The data path only pays for iq_tap_push(): a refcnt bump and one ring
+ * enqueue per burst. A writer thread drains the tap ring, strips the
+ * per-packet header, packs payloads into large page-aligned blocks and writes
+ * them with io_uring + O_DIRECT (pwrite fallback when built without liburing
+ * or when the filesystem refuses O_DIRECT).
+ *
+ * Usable inside the primary (call tap() from the switch) or as its own
+ * secondary (the primary's switch attaches through IqTapPoint by name).
+ */
+class IqRecorder {
+public:
+  struct options {
+    std::string path_base;                     // output path without extension
+
+    // Tap point
+    std::string tap_name        = "iq_rec_tap";
+    unsigned    tap_ring_size   = 8192;        // power of two; absorbs writer stalls
+
+    // Packet layout (same meaning as flexsdr_rx_streamer::options)
+    size_t      vrt_hdr_bytes   = 32;          // header bytes stripped from each packet
+    bool        parse_tsf       = true;
+    size_t      tsf_offset      = 24;
+
+    // Writer
+    size_t      block_bytes     = 4u << 20;    // one write request (multiple of 4 KiB)
+    unsigned    num_blocks      = 16;          // buffers in flight + filling
+    unsigned    dequeue_burst   = 64;
+    bool        direct_io       = true;        // O_DIRECT, falls back if unsupported
+    int         cpu             = -1;          // pin writer thread (-1 = no pinning)
+
+    // SigMF metadata
+    double      sample_rate     = 30.72e6;
+    double      center_freq     = 3.5e9;
+    unsigned    num_channels    = 1;           // interleaved channels per sample
+    std::string description;
+  };
+
+  struct stats {
+    uint64_t packets;
+    uint64_t bytes;             // payload bytes written to the data file
+    uint64_t tap_drops;         // tap ring full (live path never waits)
+    uint64_t write_errors;
+    uint64_t discontinuities;   // TSF gaps (each opens a new SigMF capture)
+  };
+
+  explicit IqRecorder(options opt);
+  ~IqRecorder();
+
+  IqRecorder(const IqRecorder&) = delete;
+  IqRecorder& operator=(const IqRecorder&) = delete;
+
+  // Open the tap point and output file, start the writer thread, go active.
+  int start();
+
+  // Go inactive, drain the tap ring, flush, write .sigmf-meta and close.
+  void stop();
+
+  // Data-path entry when the recorder lives in the same process.
+  unsigned tap(rte_mbuf* const* pkts, unsigned n) {
+    return iq_tap_push(tap_, ctl_, pkts, n);
+  }
+
+  rte_ring* tap_ring() const { return tap_; }
+  bool      running()  const { return running_.load(std::memory_order_acquire); }
+  stats     get_stats() const;
+
+private:
+  struct block {
+    uint8_t* buf      = nullptr;
+    size_t   fill     = 0;        // bytes filled (padded length once submitted)
+    bool     inflight = false;
+  };
+
+  struct capture {
+    uint64_t sample_start;
+    uint64_t tsf;
+  };
+
+  struct io_backend;
+
+  void     writer_loop_();
+  void     consume_(rte_mbuf* m);
+  void     append_(const uint8_t* src, size_t len);
+  void     submit_block_(unsigned idx);
+  void     complete_block_(unsigned idx, long res);
+  bool     reap_(bool wait);
+  unsigned next_free_block_();
+  void     flush_tail_();
+  int      write_meta_();
+
+  int      open_data_();
+  int      init_io_();
+  void     fini_io_();
+
+  options                     opt_;
+  rte_ring*                   tap_       = nullptr;
+  iq_tap_ctl*                 ctl_       = nullptr;
+  int                         fd_        = -1;
+  bool                        direct_    = false;
+  std::string                 datetime_;
+
+  std::vector<block>          blocks_;
+  unsigned                    cur_        = 0;
+  unsigned                    inflight_   = 0;
+  uint64_t                    file_off_   = 0;   // next write offset (block granular)
+  uint64_t                    data_bytes_ = 0;   // exact payload bytes accepted
+
+  // TSF tracking for SigMF captures
+  std::vector<capture>        captures_;
+  bool                        have_tsf_   = false;
+  uint64_t                    next_tsf_   = 0;
+
+  std::unique_ptr<io_backend> io_;
+
+  std::thread                 worker_;
+  std::atomic<bool>           running_{false};
+  std::atomic<bool>           stop_req_{false};
+
+  std::atomic<uint64_t>       packets_{0};
+  std::atomic<uint64_t>       bytes_{0};
+  std::atomic<uint64_t>       write_errors_{0};
+  std::atomic<uint64_t>       discontinuities_{0};
+};
+
+} // namespace flexsdr
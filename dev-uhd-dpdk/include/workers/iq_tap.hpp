@@ -0,0 +1,87 @@
+// include/workers/iq_tap.hpp
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+struct rte_mbuf;
+struct rte_ring;
+
+namespace flexsdr {
+
+/**
+ * Shared control block of a tap point (lives in a memzone "<tap>_ctl").
+ *
+ * The consumer (recorder, monitor, ...) owns 'active'; producers only clone
+ * mbufs onto the tap ring while it is set, so a stopped consumer never pins
+ * pool memory. Tap ring and control block are never freed once created:
+ * producers in other processes may still hold their pointers.
+ */
+struct alignas(64) iq_tap_ctl {
+  std::atomic<uint32_t> active{0};
+  std::atomic<uint32_t> every{0};     // clone one packet in 'every' (0/1 = all)
+  std::atomic<uint64_t> offered{0};   // packets presented while active
+  std::atomic<uint64_t> drops{0};     // clones rejected by a full tap ring
+};
+
+// ---- consumer side ---------------------------------------------------------
+
+// Create (or look up, if it already exists) the tap ring (MP/SC) and its
+// control block. Returns nullptr on failure.
+rte_ring* iq_tap_open(const std::string& name, unsigned size, iq_tap_ctl** ctl);
+
+// Release every clone still queued on the tap ring; returns how many.
+unsigned iq_tap_drain(rte_ring* tap);
+
+inline void iq_tap_set_active(iq_tap_ctl* ctl, bool on) {
+  if (ctl) ctl->active.store(on ? 1u : 0u, std::memory_order_release);
+}
+
+// Consumers that only need a sample of the traffic (monitors) thin it out at
+// the producer, so skipped packets cost no refcnt traffic at all.
+inline void iq_tap_set_every(iq_tap_ctl* ctl, uint32_t every) {
+  if (ctl) ctl->every.store(every, std::memory_order_relaxed);
+}
+
+// ---- producer side ---------------------------------------------------------
+
+/**
+ * Clone-by-reference: bumps the refcnt of each mbuf (or of every Nth one,
+ * counted across calls, if the consumer set 'every') and enqueues the extra
+ * reference onto 'tap'. The live path keeps its own reference and frees as
+ * usual. Never blocks; clones that do not fit are released again.
+ *
+ * @return number of clones handed to the tap
+ */
+unsigned iq_tap_push(rte_ring* tap, iq_tap_ctl* ctl, rte_mbuf* const* pkts, unsigned n);
+
+/**
+ * Producer handle for a named tap point (e.g. used by the interconnect switch).
+ * The consumer may appear later or run in another process; the handle
+ * re-resolves the name every 'resolve_every' calls until it is found.
+ */
+class IqTapPoint {
+public:
+  explicit IqTapPoint(std::string name, unsigned resolve_every = 4096)
+    : name_(std::move(name)), resolve_every_(resolve_every ? resolve_every : 1) {}
+
+  unsigned push(rte_mbuf* const* pkts, unsigned n) {
+    if (!ring_ && !resolve_()) return 0;
+    return iq_tap_push(ring_, ctl_, pkts, n);
+  }
+
+  const std::string& name() const { return name_; }
+  bool attached() const { return ring_ != nullptr; }
+
+private:
+  bool resolve_();
+
+  std::string  name_;
+  unsigned     resolve_every_;
+  unsigned     calls_ = 0;
+  rte_ring*    ring_  = nullptr;
+  iq_tap_ctl*  ctl_   = nullptr;
+};
+
+} // namespace flexsdr
@@ -0,0 +1,155 @@
+// include/workers/spectrum_monitor.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "workers/batch_fft.hpp"
+#include "workers/iq_tap.hpp"
+
+struct rte_mbuf;
+struct rte_ring;
+
+namespace flexsdr {
+
+/**
+ * Live per-channel power and spectrum from a tap point, for operators who
+ * want to look at the air without attaching a PHY.
+ *
+ * Producers clone only every sample_every-th packet onto the tap (see
+ * iq_tap_set_every), so the switched path pays nothing for the rest. The
+ * monitor thread measures RMS power over every packet it receives and
+ * windows the first fft_size samples of at most max_frames_per_sec of them
+ * per channel into a BatchFft (four frames per transform). avg_frames
+ * power spectra are averaged into one published PSD; a channel that has not
+ * got that far within a second publishes what it has.
+ *
+ * Results are read with get_snapshot() or through DPDK telemetry
+ * (dpdk-telemetry.py, in whichever process runs the monitor):
+ *   /flexsdr/spectrum/list                  monitor names
+ *   /flexsdr/spectrum/power,<name>          counters + RMS per channel
+ *   /flexsdr/spectrum/psd,<name>[,<chan>]   PSD, DC centred, <= psd_bins bins
+ * Telemetry has no floating point type: levels are integers in 0.01 dBFS
+ * (a full-scale complex tone reads 0).
+ *
+ * Packets shorter than fft_size only contribute to the power figures.
+ */
+class SpectrumMonitor {
+public:
+  struct options {
+    std::string name            = "mon0";        // telemetry key
+
+    // Tap point
+    std::string tap_name        = "iq_mon_tap";
+    unsigned    tap_ring_size   = 1024;           // power of two
+    unsigned    sample_every    = 16;             // producers clone 1 packet in N
+
+    // Packet layout (same meaning as IqRecorder::options)
+    size_t      vrt_hdr_bytes   = 32;
+    unsigned    num_channels    = 1;              // interleaved channels per sample
+
+    // Analysis
+    size_t      fft_size        = 1024;           // power of two
+    unsigned    avg_frames      = 64;             // frames per published PSD (multiple of 4)
+    unsigned    max_frames_per_sec = 400;         // per channel; bounds the FFT load
+    unsigned    psd_bins        = 256;            // telemetry resolution (<= 512)
+
+    // Thread
+    unsigned    dequeue_burst   = 32;
+    unsigned    idle_sleep_us   = 1000;           // empty tap ring
+    int         cpu             = -1;             // pin monitor thread (-1 = no pinning)
+    bool        telemetry       = true;
+
+    // Reported alongside the PSD
+    double      sample_rate     = 30.72e6;
+    double      center_freq     = 3.5e9;
+  };
+
+  struct snapshot {
+    uint64_t           seq;          // bumps on every publish of this channel
+    uint64_t           frames;       // frames averaged into psd_dbfs
+    double             rms_dbfs;     // over the packets seen since the last publish
+    std::vector<float> psd_dbfs;     // fft_size bins, DC at fft_size / 2
+  };
+
+  struct stats {
+    uint64_t packets;            // tapped packets received
+    uint64_t frames;             // FFT frames, all channels
+    uint64_t short_packets;      // fewer than fft_size samples
+    uint64_t tap_drops;
+    double   cpu_load;           // monitor thread CPU time / wall time since start()
+  };
+
+  explicit SpectrumMonitor(options opt);
+  ~SpectrumMonitor();
+
+  SpectrumMonitor(const SpectrumMonitor&) = delete;
+  SpectrumMonitor& operator=(const SpectrumMonitor&) = delete;
+
+  // Open the tap point, start the thread, register with telemetry, go active.
+  int  start();
+  // Go inactive, stop the thread, release queued clones.
+  void stop();
+
+  // Data-path entry when the monitor lives in the same process.
+  unsigned tap(rte_mbuf* const* pkts, unsigned n) {
+    return iq_tap_push(tap_, ctl_, pkts, n);
+  }
+
+  const options& opts() const { return opt_; }
+  bool  running() const { return running_.load(std::memory_order_acquire); }
+  stats get_stats() const;
+  // False until channel ch has published once.
+  bool  get_snapshot(size_t ch, snapshot& out) const;
+
+private:
+  struct chan_state {
+    float*              re = nullptr;     // BatchFft lanes being filled
+    float*              im = nullptr;
+    unsigned            lanes = 0;
+    std::vector<float>  acc;              // fft_size * kLanes, |X|^2 by output position
+    unsigned            acc_frames = 0;
+    double              pwr_sum = 0.0;    // sum of I^2 + Q^2
+    uint64_t            pwr_n   = 0;
+    unsigned            budget  = 0;      // frames left this second
+  };
+
+  void worker_loop_();
+  void consume_(rte_mbuf* m);
+  void add_frame_(chan_state& c, const uint32_t* s, size_t stride);
+  void run_batch_(chan_state& c);
+  void publish_(size_t ch, chan_state& c);
+
+  static void register_telemetry_();
+
+  options                  opt_;
+  BatchFft                 fft_;
+  std::vector<float>       window_;
+  double                   win_gain_ = 1.0;   // 1 / (sum(w)^2 * 32768^2)
+
+  rte_ring*                tap_ = nullptr;
+  iq_tap_ctl*              ctl_ = nullptr;
+
+  std::vector<chan_state>  ch_;               // monitor thread only
+  uint64_t                 budget_sec_ = 0;
+
+  mutable std::mutex       snap_mtx_;
+  std::vector<snapshot>    snap_;
+
+  std::thread              worker_;
+  std::atomic<bool>        running_{false};
+  std::atomic<bool>        stop_req_{false};
+  uint64_t                 start_ns_ = 0;
+
+  std::atomic<uint64_t>    packets_{0};
+  std::atomic<uint64_t>    frames_{0};
+  std::atomic<uint64_t>    short_packets_{0};
+};
+
+} // namespace flexsdr
@@ -4,6 +4,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
 
 namespace flexsdr {
 namespace conf {
@@ -37,6 +39,15 @@ static inline std::string as_str(const YAML::Node& n, const std::string& def = {
   }
 }
 
+static inline double as_f64(const YAML::Node& n, double def) {
+  if (!n) return def;
+  try {
+    return n.as<double>();
+  } catch (...) {
+    return def;
+  }
+}
+
 // role <-> string
 static inline Role role_from_string(const std::string& s, Role def) {
   if (s == "primary-ue")  return Role::PrimaryUe;
@@ -46,6 +57,42 @@ static inline Role role_from_string(const std::string& s, Role def) {
   return def;
 }
 
+// bytes per sample (I+Q) on the wire
+static inline unsigned otw_bytes(const std::string& f) {
+  if (f == "sc16" || f == "cs16") return 4;
+  if (f == "sc12" || f == "cs12") return 3;
+  if (f == "sc8"  || f == "cs8")  return 2;
+  if (f == "fc32" || f == "cf32") return 8;
+  return 0;
+}
+
+static inline unsigned pow2_ceil(unsigned v) {
+  unsigned p = 1;
+  while (p < v && p < (1u << 31)) p <<= 1;
+  return p;
+}
+
+// Which derived sizing a pool gets: by 'dir' if given, else by name
+// ("inbound"/"rx" = RX, "outbound"/"tx" = TX), else the larger of both.
+static inline const DerivedSizing* pool_sizing(const YAML::Node& it, const std::string& name,
+                                               const DefaultConfig& defs) {
+  const std::optional<DerivedSizing>& tx = defs.sized_tx;
+  const std::optional<DerivedSizing>& rx = defs.sized_rx;
+  if (!tx && !rx) return nullptr;
+  std::string dir = as_str(it["dir"]);
+  if (dir.empty()) {
+    if (name.find("inbound") != std::string::npos || name.find("_rx") != std::string::npos)
+      dir = "rx";
+    else if (name.find("outbound") != std::string::npos || name.find("_tx") != std::string::npos)
+      dir = "tx";
+  }
+  if (dir == "rx" && rx) return &*rx;
+  if (dir == "tx" && tx) return &*tx;
+  if (tx && rx) return tx->nb_mbuf * uint64_t(tx->elt_size) >= rx->nb_mbuf * uint64_t(rx->elt_size)
+                       ? &*tx : &*rx;
+  return tx ? &*tx : &*rx;
+}
+
 // rings
 static inline std::vector<RingSpec> parse_ring_list(const YAML::Node& n, unsigned def_size) {
   std::vector<RingSpec> out;
@@ -54,6 +101,8 @@ static inline std::vector<RingSpec> parse_ring_list(const YAML::Node& n, unsigne
     RingSpec r{};
     r.name = as_str(it["name"]);
     r.size = as_u32(it["size"], def_size);
+    r.hi_wm = std::min(as_u32(it["hi_wm"], 0), 100u);
+    r.lo_wm = std::min(as_u32(it["lo_wm"], r.hi_wm / 2), r.hi_wm ? r.hi_wm - 1 : 0u);
     if (!r.name.empty())
       out.push_back(r);
   }
@@ -61,22 +110,48 @@ static inline std::vector<RingSpec> parse_ring_list(const YAML::Node& n, unsigne
 }
 
 // pools
-static inline std::vector<PoolSpec> parse_pool_list(const YAML::Node& n, unsigned def_cache) {
+static inline bool known_pool_ops(const std::string& ops) {
+  static const char* const kOps[] = {"ring_mp_mc", "ring_sp_sc", "ring_mp_sc",
+                                     "ring_sp_mc", "stack", "lf_stack"};
+  for (const char* k : kOps) if (ops == k) return true;
+  return false;
+}
+
+static inline std::vector<PoolSpec> parse_pool_list(const YAML::Node& n, const DefaultConfig& defs) {
   std::vector<PoolSpec> out;
   if (!n || !n.IsSequence()) return out;
   for (const auto& it : n) {
     PoolSpec p{};
-    p.name       = as_str(it["name"]);
-    p.size       = as_u32(it["size"],    8192);
-    p.elt_size   = as_u32(it["elt_size"], 2048);
-    // Allow either explicit cache_size or fall back to defaults.mp_cache
-    p.cache_size = as_u32(it["cache_size"], def_cache);
+    p.name = as_str(it["name"]);
+    const DerivedSizing* d = pool_sizing(it, p.name, defs);
+    // Explicit values win; otherwise derived sizing, otherwise the old fixed defaults.
+    const unsigned def_n     = d ? d->nb_mbuf    : 8192;
+    const unsigned def_elt   = d ? d->elt_size   : 2048;
+    const unsigned def_cache = d ? d->cache_size : defs.mp_cache;
+    p.size       = as_u32(it["size"],       as_u32(it["n"], def_n));
+    p.elt_size   = as_u32(it["elt_size"],   def_elt);
+    p.cache_size = as_u32(it["cache_size"], as_u32(it["cache"], def_cache));
+    p.ops        = as_str(it["ops"],        as_str(it["mempool_ops"], ""));
+    if (!p.ops.empty() && !known_pool_ops(p.ops)) {
+      std::fprintf(stderr, "[config] pool %s: unknown ops '%s', using the DPDK default\n",
+                   p.name.c_str(), p.ops.c_str());
+      p.ops.clear();
+    }
     if (!p.name.empty())
       out.push_back(p);
   }
   return out;
 }
 
+// defaults.sizing
+static inline void parse_sizing(const YAML::Node& n, StreamSizing& s) {
+  s.sample_rate = as_f64(n["sample_rate"], s.sample_rate);
+  s.spp         = as_u32(n["spp"],         s.spp);
+  s.otw         = as_str(n["otw"],         s.otw);
+  s.buffer_ms   = as_f64(n["buffer_ms"],   s.buffer_ms);
+  s.hdr_bytes   = as_u32(n["hdr_bytes"],   s.hdr_bytes);
+}
+
 // streams (tx/rx)
 static inline void parse_stream(const YAML::Node& n, unsigned def_ring_size, Stream& s) {
   if (!n || !n.IsMap()) return;
@@ -107,16 +182,16 @@ static inline void parse_role_block(const YAML::Node& n,
 
   if (const auto n_tx = n["tx_stream"]) {
     Stream s = defs.tx_stream;
-    parse_stream(n_tx, defs.ring_size, s);
+    parse_stream(n_tx, defs.sized_tx ? defs.sized_tx->ring_size : defs.ring_size, s);
     rc.tx_stream = std::move(s);
   }
   if (const auto n_rx = n["rx_stream"]) {
     Stream s = defs.rx_stream;
-    parse_stream(n_rx, defs.ring_size, s);
+    parse_stream(n_rx, defs.sized_rx ? defs.sized_rx->ring_size : defs.ring_size, s);
     rc.rx_stream = std::move(s);
   }
   if (const auto n_pools = n["pools"]) {
-    rc.pools = parse_pool_list(n_pools, defs.mp_cache);
+    rc.pools = parse_pool_list(n_pools, defs);
   }
   if (const auto n_ic = n["interconnect"]) {
     InterconnectConfig ic{};
@@ -132,6 +207,63 @@ static inline void parse_role_block(const YAML::Node& n,
 
 // --------------------------- public API -------------------------------------
 
+bool derive_sizing(const StreamSizing& s, unsigned num_channels,
+                   const std::string& default_otw, DerivedSizing& out) {
+  const std::string otw = s.otw.empty() ? default_otw : s.otw;
+  const unsigned bps = otw_bytes(otw);
+  if (s.sample_rate <= 0 || s.spp == 0 || num_channels == 0 || bps == 0 || s.buffer_ms <= 0)
+    return false;
+
+  DerivedSizing d{};
+  d.pkts_per_sec = s.sample_rate / s.spp;
+  const double inflight = d.pkts_per_sec * s.buffer_ms / 1000.0;
+
+  // rte_ring usable capacity is size-1
+  d.ring_size  = std::min(std::max(pow2_ceil(static_cast<unsigned>(inflight) + 2), 64u), 65536u);
+  d.cache_size = std::min(std::max(d.ring_size / 8, 32u), 512u);   // RTE_MEMPOOL_CACHE_MAX_SIZE
+  // Mbufs queued in the ring + what producer/consumer/taps hold + lcore caches.
+  d.nb_mbuf    = pow2_ceil(d.ring_size + d.ring_size / 2 + 2 * d.cache_size) - 1;
+  d.elt_size   = (s.hdr_bytes + s.spp * num_channels * bps + 63u) & ~63u;
+  out = d;
+  return true;
+}
+
+static void apply_sizing(DefaultConfig& defs, bool ring_size_explicit,
+                         bool nb_mbuf_explicit, bool mp_cache_explicit) {
+  const StreamSizing& s = *defs.sizing;
+  DerivedSizing tx{}, rx{};
+  const bool ok_tx = derive_sizing(s, defs.tx_stream.num_channels, defs.data_format, tx);
+  const bool ok_rx = derive_sizing(s, defs.rx_stream.num_channels, defs.data_format, rx);
+  if (!ok_tx && !ok_rx) {
+    std::fprintf(stderr, "[config] sizing: ignored (need sample_rate>0, spp>0, known otw '%s')\n",
+                 (s.otw.empty() ? defs.data_format : s.otw).c_str());
+    return;
+  }
+
+  auto show = [&](const char* dir, const DerivedSizing& d, unsigned nch) {
+    std::fprintf(stderr,
+                 "[config] sizing %s: rate=%.0f ch=%u spp=%u %.1fms -> %.0f pkt/s "
+                 "ring=%u nb_mbuf=%u elt_size=%u cache=%u\n",
+                 dir, s.sample_rate, nch, s.spp, s.buffer_ms, d.pkts_per_sec,
+                 d.ring_size, d.nb_mbuf, d.elt_size, d.cache_size);
+    // rte_mbuf::buf_len is 16 bits and includes the headroom
+    if (d.elt_size + 128u > 65535u)
+      std::fprintf(stderr, "[config] sizing %s: elt_size %u exceeds the mbuf limit; lower spp\n",
+                   dir, d.elt_size);
+  };
+  // An explicit defaults.ring_size still sets the ring depth.
+  if (ring_size_explicit) tx.ring_size = rx.ring_size = defs.ring_size;
+  if (ok_tx) { defs.sized_tx = tx; show("tx", tx, defs.tx_stream.num_channels); }
+  if (ok_rx) { defs.sized_rx = rx; show("rx", rx, defs.rx_stream.num_channels); }
+
+  const DerivedSizing& big = (ok_tx && ok_rx) ? (tx.nb_mbuf >= rx.nb_mbuf ? tx : rx)
+                                              : (ok_tx ? tx : rx);
+  if (!ring_size_explicit) defs.ring_size = std::max(ok_tx ? tx.ring_size : 0u,
+                                                     ok_rx ? rx.ring_size : 0u);
+  if (!nb_mbuf_explicit)   defs.nb_mbuf   = big.nb_mbuf;
+  if (!mp_cache_explicit)  defs.mp_cache  = big.cache_size;
+}
+
 int load_from_yaml(const char* path, PrimaryConfig& out) {
   try {
     YAML::Node root = YAML::LoadFile(path);
@@ -147,6 +279,7 @@ int load_from_yaml(const char* path, PrimaryConfig& out) {
       if (neal["lcores"])       out.eal.lcores       = as_str(neal["lcores"]);
       if (neal["main_lcore"])   out.eal.main_lcore   = static_cast<int>(as_u32(neal["main_lcore"], 0));
       if (neal["socket_limit"]) out.eal.socket_limit = as_str(neal["socket_limit"]);
+      out.eal.preflight    = as_str(neal["preflight"],    out.eal.preflight);
     }
 
     // ---- defaults ----------------------------------------------------------
@@ -164,6 +297,20 @@ int load_from_yaml(const char* path, PrimaryConfig& out) {
       parse_stream(ndef["tx_stream"], out.defaults.ring_size, out.defaults.tx_stream);
       parse_stream(ndef["rx_stream"], out.defaults.ring_size, out.defaults.rx_stream);
 
+      // defaults.sizing: derive from the stream channel counts just parsed, then
+      // re-read the default rings so entries without 'size' get the derived depth.
+      if (const auto nsz = ndef["sizing"]; nsz && nsz.IsMap()) {
+        StreamSizing sz{};
+        parse_sizing(nsz, sz);
+        out.defaults.sizing = sz;
+        apply_sizing(out.defaults, bool(ndef["ring_size"]), bool(ndef["nb_mbuf"]),
+                     bool(ndef["mp_cache"]));
+        if (out.defaults.sized_tx)
+          parse_stream(ndef["tx_stream"], out.defaults.sized_tx->ring_size, out.defaults.tx_stream);
+        if (out.defaults.sized_rx)
+          parse_stream(ndef["rx_stream"], out.defaults.sized_rx->ring_size, out.defaults.rx_stream);
+      }
+
       // defaults.interconnect
       parse_interconnect(ndef["interconnect"], out.defaults.ring_size, out.defaults.interconnect);
     }
@@ -190,6 +337,9 @@ int load_from_yaml(const char* path, PrimaryConfig& out) {
       out.gnb = std::move(rc);
     }
 
+    // ---- tunables (re-read at runtime by TunablesWatcher) -----------------
+    if (int trc = load_tunables(path, out.tunables); trc) return trc;
+
     return 0;
   } catch (const std::exception& e) {
     std::fprintf(stderr, "[config] YAML error: %s\n", e.what());
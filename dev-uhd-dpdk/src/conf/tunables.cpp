@@ -0,0 +1,240 @@
+#include "conf/tunables.hpp"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace flexsdr {
+namespace conf {
+
+// --------------------------- YAML -------------------------------------------
+
+static inline unsigned as_u32(const YAML::Node& n, unsigned def) {
+  if (!n) return def;
+  try {
+    return n.as<unsigned>();
+  } catch (...) {
+    return def;
+  }
+}
+
+int load_tunables(const char* path, Tunables& out) {
+  try {
+    YAML::Node root = YAML::LoadFile(path);
+    const auto nt = root["tunables"];
+    if (!nt || !nt.IsMap()) return 0;
+
+    Tunables t = out;
+    if (const auto ns = nt["switch"]; ns && ns.IsMap()) {
+      t.switch_burst     = std::clamp(as_u32(ns["burst"], t.switch_burst), 1u, 256u);
+      t.switch_idle_us   = as_u32(ns["idle_us"],   t.switch_idle_us);
+      t.switch_log_every = as_u32(ns["log_every"], t.switch_log_every);
+      t.switch_reserve   = as_u32(ns["reserve"],   t.switch_reserve);
+      if (const auto nr = ns["routes"]; nr && nr.IsSequence()) {
+        t.routes.clear();
+        for (const auto& it : nr) {
+          Tunables::Route r{it["src"].as<std::string>(""), it["dst"].as<std::string>("")};
+          if (r.src.empty() || r.dst.empty()) continue;
+          const std::string cls = it["class"].as<std::string>("bulk");
+          if (cls != "bulk" && cls != "control")
+            throw std::runtime_error("route " + r.src + ": class must be bulk or control");
+          r.control    = cls == "control";
+          r.weight     = std::clamp(as_u32(it["weight"], r.weight), 1u, 64u);
+          r.max_age_us = as_u32(it["max_age_us"], r.max_age_us);
+          t.routes.push_back(std::move(r));
+        }
+      }
+    }
+    if (const auto nr = nt["rx"]; nr && nr.IsMap()) {
+      t.rx_tight_polls   = as_u32(nr["tight_polls"],   t.rx_tight_polls);
+      t.rx_poll_sleep_us = as_u32(nr["poll_sleep_us"], t.rx_poll_sleep_us);
+    }
+    out = std::move(t);
+    return 0;
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "[tunables] YAML error: %s\n", e.what());
+    return -1;
+  }
+}
+
+// --------------------------- TunablesStore ----------------------------------
+
+TunablesStore::TunablesStore(const Tunables& initial) {
+  auto* t = new Tunables(initial);
+  t->generation = 1;
+  cur_.store(t, std::memory_order_release);
+}
+
+TunablesStore::~TunablesStore() {
+  // No readers may be running by now.
+  for (auto& r : retired_) delete r.second;
+  delete cur_.load(std::memory_order_acquire);
+}
+
+int TunablesStore::register_reader() {
+  for (unsigned i = 0; i < MAX_READERS; i++) {
+    bool expected = false;
+    if (slots_[i].online.load(std::memory_order_relaxed)) continue;
+    if (!slots_[i].online.compare_exchange_strong(expected, true, std::memory_order_seq_cst))
+      continue;
+    // Until this store the slot shows an older epoch, which only delays
+    // reclaim; the caller's first get() happens after we are online.
+    slots_[i].seen.store(epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    return static_cast<int>(i);
+  }
+  std::fprintf(stderr, "[tunables] no free reader slot (max %u)\n", MAX_READERS);
+  return -1;
+}
+
+void TunablesStore::unregister_reader(int slot) {
+  if (slot >= 0 && slot < static_cast<int>(MAX_READERS))
+    slots_[slot].online.store(false, std::memory_order_release);
+}
+
+void TunablesStore::publish(const Tunables& t) {
+  std::lock_guard<std::mutex> lk(pub_mtx_);
+  auto* next = new Tunables(t);
+  next->generation = get()->generation + 1;
+
+  const Tunables* old = cur_.exchange(next, std::memory_order_seq_cst);
+  // Readers that report an epoch >= this one have dropped 'old'.
+  const uint64_t e = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+  retired_.emplace_back(e, old);
+  reclaim_();
+}
+
+void TunablesStore::reclaim_() {
+  uint64_t min_seen = std::numeric_limits<uint64_t>::max();
+  for (const auto& s : slots_) {
+    if (s.online.load(std::memory_order_seq_cst))
+      min_seen = std::min(min_seen, s.seen.load(std::memory_order_acquire));
+  }
+  auto it = std::remove_if(retired_.begin(), retired_.end(), [&](const auto& r) {
+    if (r.first > min_seen) return false;
+    delete r.second;
+    return true;
+  });
+  retired_.erase(it, retired_.end());
+}
+
+size_t TunablesStore::retired_pending() const {
+  std::lock_guard<std::mutex> lk(pub_mtx_);
+  return retired_.size();
+}
+
+// --------------------------- TunablesWatcher --------------------------------
+
+static std::atomic<uint64_t> g_sighup_count{0};
+
+static void on_sighup(int) {
+  g_sighup_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TunablesWatcher::install_sighup() {
+  struct sigaction sa{};
+  sa.sa_handler = on_sighup;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_flags = SA_RESTART;
+  sigaction(SIGHUP, &sa, nullptr);
+}
+
+TunablesWatcher::TunablesWatcher(std::string yaml_path, TunablesStore& store)
+  : path_(std::move(yaml_path)), store_(store) {
+  const auto slash = path_.find_last_of('/');
+  dir_  = slash == std::string::npos ? "." : path_.substr(0, slash ? slash : 1);
+  base_ = slash == std::string::npos ? path_ : path_.substr(slash + 1);
+}
+
+TunablesWatcher::~TunablesWatcher() { stop(); }
+
+int TunablesWatcher::start() {
+  if (thr_.joinable()) return 0;
+
+  ifd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (ifd_ < 0 ||
+      inotify_add_watch(ifd_, dir_.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+    // SIGHUP still works without inotify
+    std::fprintf(stderr, "[tunables] inotify on %s failed (%s); SIGHUP only\n",
+                 dir_.c_str(), std::strerror(errno));
+    if (ifd_ >= 0) ::close(ifd_);
+    ifd_ = -1;
+  }
+
+  sighup_seen_ = g_sighup_count.load(std::memory_order_relaxed);
+  stop_req_.store(false, std::memory_order_release);
+  thr_ = std::thread(&TunablesWatcher::run_, this);
+  std::fprintf(stderr, "[tunables] watching %s (inotify=%s, SIGHUP)\n",
+               path_.c_str(), ifd_ >= 0 ? "yes" : "no");
+  return 0;
+}
+
+void TunablesWatcher::stop() {
+  stop_req_.store(true, std::memory_order_release);
+  if (thr_.joinable()) thr_.join();
+  if (ifd_ >= 0) ::close(ifd_);
+  ifd_ = -1;
+}
+
+void TunablesWatcher::run_() {
+  alignas(struct inotify_event) char buf[4096];
+
+  while (!stop_req_.load(std::memory_order_acquire)) {
+    bool changed = false;
+
+    if (ifd_ >= 0) {
+      pollfd pfd{ifd_, POLLIN, 0};
+      if (::poll(&pfd, 1, 200) > 0 && (pfd.revents & POLLIN)) {
+        ssize_t len;
+        while ((len = ::read(ifd_, buf, sizeof(buf))) > 0) {
+          for (char* p = buf; p < buf + len;) {
+            const auto* ev = reinterpret_cast<const struct inotify_event*>(p);
+            if (ev->len && base_ == ev->name) changed = true;
+            p += sizeof(struct inotify_event) + ev->len;
+          }
+        }
+      }
+    } else {
+      ::usleep(200 * 1000);
+    }
+
+    const uint64_t hup = g_sighup_count.load(std::memory_order_relaxed);
+    if (hup != sighup_seen_) {
+      sighup_seen_ = hup;
+      reload_("SIGHUP");
+    } else if (changed) {
+      reload_("file changed");
+    }
+  }
+}
+
+void TunablesWatcher::reload_(const char* why) {
+  // Start from built-in defaults so keys removed from the file revert.
+  Tunables t{};
+  if (load_tunables(path_.c_str(), t) != 0) {
+    failures_.fetch_add(1, std::memory_order_relaxed);
+    std::fprintf(stderr, "[tunables] reload (%s) failed; keeping generation %lu\n",
+                 why, static_cast<unsigned long>(store_.generation()));
+    return;
+  }
+  store_.publish(t);
+  reloads_.fetch_add(1, std::memory_order_relaxed);
+  std::fprintf(stderr,
+               "[tunables] reload (%s): gen=%lu switch burst=%u idle_us=%u reserve=%u routes=%zu "
+               "rx tight_polls=%u poll_sleep_us=%u\n",
+               why, static_cast<unsigned long>(store_.generation()),
+               t.switch_burst, t.switch_idle_us, t.switch_reserve, t.routes.size(),
+               t.rx_tight_polls, t.rx_poll_sleep_us);
+}
+
+} // namespace conf
+} // namespace flexsdr
@@ -2,6 +2,7 @@
 #include "device/flexsdr_device.hpp"
 #include "device/flexsdr_rx_streamer.hpp"
 #include "device/flexsdr_tx_streamer.hpp"
+#include "device/rx_correction.hpp"
 
 // DPDK headers only in .cpp
 extern "C" {
@@ -12,8 +13,11 @@ extern "C" {
 #include "transport/flexsdr_secondary.hpp"
 #include "transport/dpdk_common.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <map>
 #include <stdexcept>
 #include <uhd/types/ranges.hpp>
 #include <iostream>
@@ -31,6 +35,24 @@ struct flexsdr_device::Impl {
 
   // Optional: fallback ring from device args (legacy)
   ::rte_ring* arg_rx_ring = nullptr;
+
+  // RX ingress worker shared by the device's RX streamers (rx_ingress=1)
+  std::shared_ptr<RxIngress> ingress;
+
+  // RX front-end corrections: settings per device channel, and the
+  // correctors of open streams (stream channel i = device channel chans[i])
+  struct rx_corr_settings {
+    double               shift_hz = 0.0;
+    bool                 dc       = false;
+    std::array<float, 4> iq{1.f, 0.f, 0.f, 1.f};
+  };
+  struct rx_corr_ref {
+    std::weak_ptr<rx_correction> corr;
+    std::vector<size_t>          chans;
+  };
+  std::mutex                         corr_mtx;
+  std::map<size_t, rx_corr_settings> corr_set;
+  std::vector<rx_corr_ref>           corrs;
 };
 
 // Helpers
@@ -41,6 +63,15 @@ static inline rte_mempool* mp_lookup(const std::string& n) {
   return n.empty() ? nullptr : rte_mempool_lookup(n.c_str());
 }
 
+// Live tunables of the attached secondary (device arg tunables_watch=1 also
+// starts reloading them from its YAML on change/SIGHUP)
+static std::shared_ptr<conf::TunablesStore>
+live_tunables(const std::shared_ptr<DpdkContext>& ctx, const uhd::device_addr_t& args) {
+  if (!ctx || !ctx->secondary) return nullptr;
+  if (args.get("tunables_watch", "0") != "0") ctx->secondary->watch_tunables();
+  return ctx->secondary->tunables();
+}
+
 //==============================
 // Property tree
 //==============================
@@ -79,11 +110,31 @@ flexsdr_device::flexsdr_device(const uhd::device_addr_t& args)
 
   p_->args = args;
 
-  _client = GetClient(_endpoint);
+  _cache_enabled = (args.get("param_cache", "1") != "0");
+  _refresh_ms    = static_cast<unsigned>(std::stoul(args.get("param_refresh_ms", "1000")));
+
+  // Control-plane timing (args: rpc_deadline_ms, rpc_retries, rpc_backoff_ms)
+  FlexSDRClient::rpc_options rpc;
+  rpc.deadline_ms      = static_cast<unsigned>(std::stoul(args.get("rpc_deadline_ms", std::to_string(rpc.deadline_ms))));
+  rpc.retries          = static_cast<unsigned>(std::stoul(args.get("rpc_retries", std::to_string(rpc.retries))));
+  rpc.retry_backoff_ms = static_cast<unsigned>(std::stoul(args.get("rpc_backoff_ms", std::to_string(rpc.retry_backoff_ms))));
+
+  _client = GetClient(_endpoint, rpc);
   _init_tree();
+
+  if (_client && _cache_enabled && _refresh_ms) {
+    _refresher = std::thread(&flexsdr_device::_refresh_loop, this);
+  }
 }
 
-flexsdr_device::~flexsdr_device() = default;
+flexsdr_device::~flexsdr_device() {
+  {
+    std::lock_guard<std::mutex> lk(_refresh_mtx);
+    _refresh_stop = true;
+  }
+  _refresh_cv.notify_all();
+  if (_refresher.joinable()) _refresher.join();
+}
 
 //==============================
 // DPDK context & ingress
@@ -92,6 +143,14 @@ void flexsdr_device::attach_dpdk_context(std::shared_ptr<DpdkContext> ctx, Role
   p_->ctx = std::move(ctx);
   p_->role = role;
   p_->resolved.store(false, std::memory_order_release);
+
+  // Primary liveness (device arg primary_watch_ms, 0 = off): streamers are
+  // quiesced through the secondary's PrimaryLink while the primary is away.
+  const unsigned watch_ms =
+      static_cast<unsigned>(std::stoul(p_->args.get("primary_watch_ms", "100")));
+  if (watch_ms && p_->ctx && p_->ctx->secondary) {
+    p_->ctx->secondary->watch_primary(watch_ms);
+  }
 }
 
 void flexsdr_device::_start_ingress_if_needed() {
@@ -113,6 +172,46 @@ flexsdr_device::get_rx_stream(const uhd::stream_args_t& args)
 {
   _start_ingress_if_needed();
 
+  // channels from args (default 1)
+  std::size_t num_chans = args.channels.empty() ? 1 : args.channels.size();
+
+  // Ring per channel (stream arg or device arg "rx_ring_per_chan=1"):
+  // channel c reads FlexSDRSecondary RX queue args.channels[c], the lanes
+  // aligned by TSF inside the streamer.
+  const bool per_chan =
+      args.args.get("rx_ring_per_chan", p_->args.get("rx_ring_per_chan", "0")) != "0";
+  if (per_chan && num_chans > 1) {
+    if (!p_->ctx || !p_->ctx->secondary) {
+      throw std::runtime_error("RX: rx_ring_per_chan needs a FlexSDRSecondary in the DPDK context");
+    }
+    flexsdr_rx_streamer::options opts;
+    for (std::size_t i = 0; i < num_chans; i++) {
+      const auto q = static_cast<uint16_t>(args.channels[i]);
+      ::rte_ring* r = p_->ctx->secondary->rx_ring_for_queue(q);
+      if (!r) {
+        throw std::runtime_error("RX: no RX ring for queue " + std::to_string(q) +
+                                 " (secondary has " +
+                                 std::to_string(p_->ctx->secondary->num_rx_queues()) + ")");
+      }
+      opts.rings.push_back(r);
+    }
+    opts.num_channels = num_chans;
+    opts.max_samps = 32768;
+    opts.burst_size = 32;
+    opts.parse_tsf = true;
+    opts.tick_rate = get_rx_rate(0);
+    opts.vrt_hdr_bytes = 32;
+    opts.qid = static_cast<uint16_t>(args.channels[0]);
+    opts.tunables = live_tunables(p_->ctx, p_->args);
+    opts.link = p_->ctx->secondary->primary_link();
+    if (args.args.get("resample", p_->args.get("resample", "0")) != "0") {
+      opts.host_rate = _rx_host;
+      opts.resample_taps = args.args.cast<unsigned>("resample_taps", 24);
+    }
+    opts.correction = _make_rx_correction(args.channels);
+    return flexsdr_rx_streamer::make(opts);
+  }
+
   // choose the primary ingress ring by role
   ::rte_ring* rx_ring = nullptr;
   if (p_->ctx) {
@@ -125,9 +224,6 @@ flexsdr_device::get_rx_stream(const uhd::stream_args_t& args)
     throw std::runtime_error("RX: no DPDK ring attached; primary must create UE_in/GNB_in and secondary must attach");
   }
 
-  // channels from args (default 1)
-  std::size_t num_chans = args.channels.empty() ? 1 : args.channels.size();
-
   // Create options for new API
   flexsdr_rx_streamer::options opts;
   opts.ring = rx_ring;
@@ -136,9 +232,60 @@ flexsdr_device::get_rx_stream(const uhd::stream_args_t& args)
   opts.otw_fmt = "sc16";
   opts.max_samps = 32768;
   opts.burst_size = 32;
-  opts.parse_tsf = false;
+  // rx_parse_tsf=1: report packet TSFs (sample ticks at the RX rate)
+  opts.parse_tsf = (args.args.get("rx_parse_tsf", p_->args.get("rx_parse_tsf", "0")) != "0");
+  opts.tick_rate = get_rx_rate(0);
   opts.vrt_hdr_bytes = 32;
   opts.qid = 0;
+  // rx_nt_stores=1: streaming stores in the deinterleave (large recv buffers)
+  opts.nt_stores =
+      args.args.get("rx_nt_stores", p_->args.get("rx_nt_stores", "0")) != "0";
+  // resample=1: deliver the rate the application set even where the radio
+  // runs at another one (clamped, or what the server granted)
+  if (args.args.get("resample", p_->args.get("resample", "0")) != "0") {
+    opts.host_rate = _rx_host;
+    opts.resample_taps = args.args.cast<unsigned>("resample_taps", 24);
+  }
+  {
+    std::vector<size_t> chans(args.channels.begin(), args.channels.end());
+    if (chans.empty()) chans.push_back(0);
+    opts.correction = _make_rx_correction(chans);
+  }
+  opts.tunables = live_tunables(p_->ctx, p_->args);
+  if (p_->ctx && p_->ctx->secondary) {
+    opts.link = p_->ctx->secondary->primary_link();
+    opts.counters = shm_ctl_counters(p_->ctx->secondary->ctl(), rx_ring);
+  }
+
+  // Optional ingress worker (device arg rx_ingress=1): drains the ring on
+  // its own thread (rx_ingress_lcore) into a hugepage FIFO, so a stalled
+  // caller no longer lets the ring overflow. One worker per device.
+  if (p_->args.get("rx_ingress", "0") != "0") {
+    if (!p_->ingress) {
+      RxIngress::options io;
+      io.ring          = rx_ring;
+      io.num_channels  = num_chans;
+      io.vrt_hdr_bytes = opts.vrt_hdr_bytes;
+      io.link          = opts.link;
+      io.counters      = opts.counters;
+      io.parse_tsf     = opts.parse_tsf;
+      io.lcore         = std::stoi(p_->args.get("rx_ingress_lcore", "-1"));
+      io.num_blocks    = std::stoul(p_->args.get("rx_ingress_blocks", std::to_string(io.num_blocks)));
+      io.block_samps   = std::stoul(p_->args.get("rx_ingress_block_samps", std::to_string(io.block_samps)));
+      auto ing = std::make_shared<RxIngress>(io);
+      if (ing->start() == 0) {
+        p_->ingress = std::move(ing);
+      } else {
+        std::cerr << "[flexsdr_device] rx_ingress failed to start; unpacking inline" << std::endl;
+      }
+    }
+    if (p_->ingress) {
+      if (p_->ingress->num_channels() != num_chans) {
+        throw std::runtime_error("RX: rx_ingress already running with a different channel count");
+      }
+      opts.ingress = p_->ingress;
+    }
+  }
 
   return flexsdr_rx_streamer::make(opts);
 }
@@ -146,8 +293,6 @@ flexsdr_device::get_rx_stream(const uhd::stream_args_t& args)
 uhd::tx_streamer::sptr
 flexsdr_device::get_tx_stream(const uhd::stream_args_t& args)
 {
-  (void)args;
-
   // One-time resolve of ring/pool from context (and/or names)
   bool expected = false;
   if (p_->resolved.compare_exchange_strong(expected, true)) {
@@ -174,79 +319,324 @@ flexsdr_device::get_tx_stream(const uhd::stream_args_t& args)
     throw std::runtime_error("TX: no TxBackend available; ensure FlexSDRSecondary is attached to context");
   }
 
-  return std::make_shared<flexsdr_tx_streamer>(backend);
+  // Channels from stream_args (default 1). Several channels go out either
+  // one TX ring per channel (args.channels[i] = TX queue, all-or-nothing)
+  // or packed into a single ring ("tx_interleave=1", stream or device arg).
+  flexsdr_tx_streamer::options opts;
+  opts.num_channels = args.channels.empty() ? 1 : args.channels.size();
+  for (std::size_t i = 0; i < args.channels.size(); i++) opts.chans.push_back(args.channels[i]);
+  const bool interleave =
+      args.args.get("tx_interleave", p_->args.get("tx_interleave", "0")) != "0";
+  if (interleave && opts.num_channels > 1) {
+    opts.mode = flexsdr_tx_streamer::tx_mode::interleaved;
+    opts.chans.assign(1, args.channels.empty() ? 0 : args.channels[0]);
+    opts.chans.resize(opts.num_channels, opts.chans[0]);
+  }
+  opts.spp = args.args.cast<std::size_t>("spp", 1024);
+  opts.tick_rate = get_tx_rate(0);
+  // tx_wait=spin|pause|yield: how send() waits for room within its timeout
+  const std::string wait = args.args.get("tx_wait", p_->args.get("tx_wait", "pause"));
+  if (wait == "spin") {
+    opts.wait = flexsdr_tx_streamer::tx_wait::spin;
+  } else if (wait == "yield") {
+    opts.wait = flexsdr_tx_streamer::tx_wait::yield;
+  } else if (wait != "pause") {
+    std::cerr << "[flexsdr_device] tx_wait=" << wait << " unknown (spin|pause|yield); using pause"
+              << std::endl;
+  }
+  // tx_zero_copy=1: buffers allocated from iq_arena go out without a copy
+  opts.arena_zero_copy =
+      args.args.get("tx_zero_copy", p_->args.get("tx_zero_copy", "0")) != "0";
+  // resample=1: accept the rate the application set, see get_rx_stream()
+  if (args.args.get("resample", p_->args.get("resample", "0")) != "0") {
+    opts.host_rate = _tx_host;
+    opts.resample_taps = args.args.cast<unsigned>("resample_taps", 24);
+  }
+
+  if (auto* sec = p_->ctx ? p_->ctx->secondary : nullptr) {
+    for (std::size_t i = 0; i < opts.num_channels; i++) {
+      const std::size_t q = opts.chans.empty() ? i : opts.chans[i];
+      if (q >= sec->num_tx_queues()) {
+        throw std::runtime_error("TX: no TX ring for queue " + std::to_string(q) +
+                                 " (secondary has " + std::to_string(sec->num_tx_queues()) + ")");
+      }
+    }
+  }
+
+  return std::make_shared<flexsdr_tx_streamer>(backend, opts);
 }
 
 bool flexsdr_device::recv_async_msg(uhd::async_metadata_t&, double) {
   return false;
 }
 
+//==============================
+// Parameter cache
+//==============================
+double flexsdr_device::_fetch_param(radio_param p, size_t chan, bool* ok) const {
+  switch (p) {
+    case radio_param::RX_RATE: return _client->get_rx_rate(chan, ok);
+    case radio_param::TX_RATE: return _client->get_tx_rate(chan, ok);
+    case radio_param::RX_FREQ: return _client->get_rx_freq(chan, ok);
+    case radio_param::TX_FREQ: return _client->get_tx_freq(chan, ok);
+    case radio_param::RX_GAIN: return _client->get_rx_gain(chan, "", ok);
+    case radio_param::TX_GAIN: return _client->get_tx_gain(chan, "", ok);
+    default:
+      *ok = false;
+      return 0.0;
+  }
+}
+
+// Hit: one atomic load. Miss: one RPC, then cached until a setter, the
+// refresher or invalidate_params() changes it. Failed RPCs are not cached.
+double flexsdr_device::_get_param(radio_param p, size_t chan, double fallback) const {
+  if (!_client) return fallback;
+
+  double v;
+  if (_cache_enabled && _params.get(p, chan, v)) return v;
+
+  bool ok = false;
+  v = _fetch_param(p, chan, &ok);
+  if (_cache_enabled && ok) _params.put(p, chan, v);
+  return v;
+}
+
+// A timed change is not in effect yet: drop the slot so the next getter
+// asks the server instead of reporting a value ahead of the sample clock.
+void flexsdr_device::_store_param(radio_param p, size_t chan, double v) {
+  if (_client && _client->has_command_time()) _drop_param(p, chan);
+  else if (chan == ALL_CHANS)                 _params.put_all(p, v);
+  else                                        _params.put(p, chan, v);
+}
+
+void flexsdr_device::_drop_param(radio_param p, size_t chan) {
+  if (chan == ALL_CHANS) _params.invalidate_all(p);
+  else                   _params.invalidate(p, chan);
+}
+
+void flexsdr_device::set_command_time(const uhd::time_spec_t& time) {
+  if (!_client) return;
+  // RX TSF ticks count samples at the channel-0 RX rate.
+  const double rate = get_rx_rate(0) > 0.0 ? get_rx_rate(0) : _rxr;
+  const long long ticks = time.to_ticks(rate);
+  const uint32_t id = _cmd_id.fetch_add(1, std::memory_order_relaxed) + 1;
+  _client->set_command_time(ticks > 0 ? static_cast<uint64_t>(ticks) : 0, id);
+}
+
+void flexsdr_device::clear_command_time() {
+  if (_client) _client->clear_command_time();
+}
+
+void flexsdr_device::_refresh_loop() {
+  std::unique_lock<std::mutex> lk(_refresh_mtx);
+  while (!_refresh_cv.wait_for(lk, std::chrono::milliseconds(_refresh_ms), [this] { return _refresh_stop; })) {
+    lk.unlock();
+    for (size_t pi = 0; pi < static_cast<size_t>(radio_param::COUNT); pi++) {
+      const auto p = static_cast<radio_param>(pi);
+      for (size_t c = 0; c < RadioParamCache::MAX_CHANS; c++) {
+        if (!_params.cached(p, c)) continue;   // only what callers actually read
+        bool ok = false;
+        const double v = _fetch_param(p, c, &ok);
+        if (ok) _params.put(p, c, v);
+      }
+    }
+    lk.lock();
+  }
+}
+
 //==============================
 // UHD parameter surface
 //==============================
 void flexsdr_device::set_rx_rate(double rate, size_t chan) {
-  (void)chan;
+  _rx_host = rate;
   rate = _clamp(rate, 1e3, 100e6);
-  if (_client) _client->set_rx_rate(rate, chan);
   _rxr = rate;
+  if (!_client) return;
+  double actual = rate;
+  if (_client->set_rx_rate(rate, chan, &actual)) _store_param(radio_param::RX_RATE, chan, actual);
+  else                                            _drop_param(radio_param::RX_RATE, chan);
 }
 
 double flexsdr_device::get_rx_rate(size_t chan) const {
-  return _client ? _client->get_rx_rate(chan) : _rxr;
+  return _get_param(radio_param::RX_RATE, chan, _rxr);
 }
 
 void flexsdr_device::set_tx_rate(double rate, size_t chan) {
-  (void)chan;
+  _tx_host = rate;
   rate = _clamp(rate, 1e3, 100e6);
-  if (_client) _client->set_tx_rate(rate, chan);
   _txr = rate;
+  if (!_client) return;
+  double actual = rate;
+  if (_client->set_tx_rate(rate, chan, &actual)) _store_param(radio_param::TX_RATE, chan, actual);
+  else                                            _drop_param(radio_param::TX_RATE, chan);
 }
 
 double flexsdr_device::get_tx_rate(size_t chan) const {
-  return _client ? _client->get_tx_rate(chan) : _txr;
+  return _get_param(radio_param::TX_RATE, chan, _txr);
 }
 
 void flexsdr_device::set_rx_freq(const uhd::tune_request_t& req, size_t chan) {
-  (void)chan;
   _rxf = _clamp(req.target_freq, 1e6, 6e9);
-  if (_client) { (void)_client->set_rx_freq(req, chan); }
-  // Optionally reflect to tree if you add that node
+  if (!_client) return;
+  // The server reports a default (all-zero) tune result on failure.
+  const uhd_tune_result_t res = _client->set_rx_freq(req, chan);
+  if (res.actual_rf_freq != 0.0) _store_param(radio_param::RX_FREQ, chan, _tuned_freq(res));
+  else                           _drop_param(radio_param::RX_FREQ, chan);
+
+  // rx_nco=1: what coarse tuning left over (UHD convention: the stream is
+  // centred on actual_rf - actual_dsp) is shifted out on the host
+  if (res.actual_rf_freq != 0.0 && p_->args.get("rx_nco", "0") != "0") {
+    const double residual = _rxf - (res.actual_rf_freq - res.actual_dsp_freq);
+    set_rx_freq_shift(-residual, chan);
+  }
 }
 
 double flexsdr_device::get_rx_freq(size_t chan) const {
-  return _client ? _client->get_rx_freq(chan) : _rxf;
+  return _get_param(radio_param::RX_FREQ, chan, _rxf);
+}
+
+//==============================
+// RX front-end correction
+//==============================
+std::shared_ptr<rx_correction>
+flexsdr_device::_make_rx_correction(const std::vector<size_t>& chans) {
+  rx_correction::options co;
+  co.num_channels = chans.size();
+  co.sample_rate = get_rx_rate(0);
+  co.dc_bandwidth_hz = std::stod(p_->args.get("rx_dc_bw", "100"));
+  auto corr = std::make_shared<rx_correction>(co);
+
+  // Device arg rx_dc=1 turns the DC notch on for every channel from the start
+  const bool dc_all = p_->args.get("rx_dc", "0") != "0";
+  std::lock_guard<std::mutex> lk(p_->corr_mtx);
+  for (size_t i = 0; i < chans.size(); i++) {
+    // Per-channel settings, else whatever was last set for ALL_CHANS
+    auto it = p_->corr_set.find(chans[i]);
+    if (it == p_->corr_set.end()) it = p_->corr_set.find(ALL_CHANS);
+    const Impl::rx_corr_settings st = it != p_->corr_set.end() ? it->second : Impl::rx_corr_settings{};
+    if (st.shift_hz != 0.0) corr->set_freq_shift(i, st.shift_hz);
+    if (st.dc || dc_all) corr->set_dc_notch(i, true);
+    corr->set_iq_matrix(i, st.iq[0], st.iq[1], st.iq[2], st.iq[3]);
+  }
+  // Drop streams that are gone
+  auto& v = p_->corrs;
+  v.erase(std::remove_if(v.begin(), v.end(), [](const Impl::rx_corr_ref& r) { return r.corr.expired(); }),
+          v.end());
+  v.push_back(Impl::rx_corr_ref{corr, chans});
+  return corr;
+}
+
+template <typename F>
+void flexsdr_device::_for_rx_correction(size_t chan, F&& f) {
+  // corr_mtx held by the caller
+  for (const auto& r : p_->corrs) {
+    auto corr = r.corr.lock();
+    if (!corr) continue;
+    for (size_t i = 0; i < r.chans.size(); i++) {
+      if (chan == ALL_CHANS || r.chans[i] == chan) f(*corr, i);
+    }
+  }
+}
+
+void flexsdr_device::set_rx_dc_offset(bool enb, size_t chan) {
+  std::lock_guard<std::mutex> lk(p_->corr_mtx);
+  if (chan == ALL_CHANS) {
+    p_->corr_set[ALL_CHANS];
+    for (auto& kv : p_->corr_set) kv.second.dc = enb;
+  } else {
+    p_->corr_set[chan].dc = enb;
+  }
+  _for_rx_correction(chan, [enb](rx_correction& c, size_t i) { c.set_dc_notch(i, enb); });
+}
+
+void flexsdr_device::set_rx_iq_correction(float a, float b, float c, float d, size_t chan) {
+  std::lock_guard<std::mutex> lk(p_->corr_mtx);
+  const std::array<float, 4> m{a, b, c, d};
+  if (chan == ALL_CHANS) {
+    p_->corr_set[ALL_CHANS];
+    for (auto& kv : p_->corr_set) kv.second.iq = m;
+  } else {
+    p_->corr_set[chan].iq = m;
+  }
+  _for_rx_correction(chan, [&](rx_correction& k, size_t i) { k.set_iq_matrix(i, a, b, c, d); });
+}
+
+void flexsdr_device::set_rx_freq_shift(double hz, size_t chan) {
+  std::lock_guard<std::mutex> lk(p_->corr_mtx);
+  if (chan == ALL_CHANS) {
+    p_->corr_set[ALL_CHANS];
+    for (auto& kv : p_->corr_set) kv.second.shift_hz = hz;
+  } else {
+    p_->corr_set[chan].shift_hz = hz;
+  }
+  _for_rx_correction(chan, [hz](rx_correction& c, size_t i) { c.set_freq_shift(i, hz); });
 }
 
 void flexsdr_device::set_tx_freq(const uhd::tune_request_t& req, size_t chan) {
-  (void)chan;
   _txf = _clamp(req.target_freq, 1e6, 6e9);
-  if (_client) { (void)_client->set_tx_freq(req, chan); }
+  if (!_client) return;
+  const uhd_tune_result_t res = _client->set_tx_freq(req, chan);
+  if (res.actual_rf_freq != 0.0) _store_param(radio_param::TX_FREQ, chan, _tuned_freq(res));
+  else                           _drop_param(radio_param::TX_FREQ, chan);
 }
 
 double flexsdr_device::get_tx_freq(size_t chan) const {
-  return _client ? _client->get_tx_freq(chan) : _txf;
+  return _get_param(radio_param::TX_FREQ, chan, _txf);
 }
 
 void flexsdr_device::set_rx_gain(double gain, size_t chan) {
-  (void)chan;
   gain = _clamp(gain, 0.0, 70.0);
-  if (_client) _client->set_rx_gain(gain, chan);
   _rxg = gain;
+  if (!_client) return;
+  double actual = gain;
+  if (_client->set_rx_gain(gain, chan, "", &actual)) _store_param(radio_param::RX_GAIN, chan, actual);
+  else                                               _drop_param(radio_param::RX_GAIN, chan);
 }
 
 double flexsdr_device::get_rx_gain(size_t chan) const {
-  return _client ? _client->get_rx_gain(chan) : _rxg;
+  return _get_param(radio_param::RX_GAIN, chan, _rxg);
 }
 
 void flexsdr_device::set_tx_gain(double gain, size_t chan) {
-  (void)chan;
   gain = _clamp(gain, 0.0, 70.0);
-  if (_client) _client->set_tx_gain(gain, chan);
   _txg = gain;
+  if (!_client) return;
+  double actual = gain;
+  if (_client->set_tx_gain(gain, chan, "", &actual)) _store_param(radio_param::TX_GAIN, chan, actual);
+  else                                               _drop_param(radio_param::TX_GAIN, chan);
 }
 
 double flexsdr_device::get_tx_gain(size_t chan) const {
-  return _client ? _client->get_tx_gain(chan) : _txg;
+  return _get_param(radio_param::TX_GAIN, chan, _txg);
+}
+
+bool flexsdr_device::apply_settings(const std::vector<FlexSDRClient::param_change>& changes,
+                                    std::vector<FlexSDRClient::param_result>* results) {
+  if (!_client) return false;
+
+  std::vector<FlexSDRClient::param_result> local;
+  const bool ok = _client->apply_settings(changes, &local);
+
+  for (size_t i = 0; i < changes.size() && i < local.size(); i++) {
+    const auto& c = changes[i];
+    radio_param p;
+    switch (c.kind) {
+      case FlexSDRClient::param_change::RX_GAIN: p = radio_param::RX_GAIN; break;
+      case FlexSDRClient::param_change::TX_GAIN: p = radio_param::TX_GAIN; break;
+      case FlexSDRClient::param_change::RX_RATE: p = radio_param::RX_RATE; break;
+      case FlexSDRClient::param_change::TX_RATE: p = radio_param::TX_RATE; break;
+      case FlexSDRClient::param_change::RX_FREQ: p = radio_param::RX_FREQ; break;
+      case FlexSDRClient::param_change::TX_FREQ: p = radio_param::TX_FREQ; break;
+      default: continue;   // clock rate is not cached
+    }
+    // What the server applied (frequencies: the effective tuned value)
+    const bool timed = c.command_time_ticks || _client->has_command_time();
+    if (local[i].success && !timed) _store_param(p, c.chan, local[i].actual);
+    else                            _drop_param(p, c.chan);
+  }
+
+  if (results) *results = std::move(local);
+  return ok;
 }
 
 void flexsdr_device::set_clock_rate(double rate) {
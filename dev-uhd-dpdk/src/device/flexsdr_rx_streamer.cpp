@@ -1,8 +1,12 @@
 // src/device/flexsdr_rx_streamer.cpp
 #include "device/flexsdr_rx_streamer.hpp"
+#include "device/iq_deinterleave.hpp"
+#include "transport/pkt_header.hpp"
+#include "transport/shm_control.hpp"
 
 #include <cstdio>
 #include <cstring>
+#include <cmath>
 #include <algorithm>
 #include <chrono>
 #include <thread>
@@ -10,23 +14,87 @@
 #include <rte_mbuf.h>
 #include <rte_ring.h>
 #include <rte_errno.h>
+#include <rte_prefetch.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace flexsdr {
 
 flexsdr_rx_streamer::flexsdr_rx_streamer(const options& opt)
   : opt_(opt)
 {
-  if (!opt_.ring) {
+  if (!opt_.rings.empty()) {
+    opt_.num_channels = opt_.rings.size();
+    lanes_.resize(opt_.rings.size());
+    for (size_t i = 0; i < lanes_.size(); i++) {
+      lanes_[i].ring = opt_.rings[i];
+      lanes_[i].pend.resize(opt_.burst_size);
+      if (!opt_.rings[i]) {
+        std::fprintf(stderr, "[flexsdr_rx_streamer] WARNING: ring for channel %zu is nullptr\n", i);
+      }
+    }
+  } else if (opt_.ingress) {
+    opt_.num_channels = opt_.ingress->num_channels();
+  } else if (!opt_.ring) {
     std::fprintf(stderr, "[flexsdr_rx_streamer] WARNING: ring is nullptr\n");
   }
   
+  held_.reserve(opt_.burst_size);
+  ch_buffs_.reserve(get_num_channels());
+  exact_ptrs_.resize(get_num_channels());
+  carry_cap_ = opt_.max_samps;
+  carry_.resize(carry_cap_ * get_num_channels());
+
+  if (opt_.host_rate > 0.0 && std::fabs(opt_.host_rate - opt_.tick_rate) > 1e-9 * opt_.tick_rate) {
+    polyphase_resampler::options ro;
+    ro.in_rate        = opt_.tick_rate;
+    ro.out_rate       = opt_.host_rate;
+    ro.num_channels   = get_num_channels();
+    ro.taps_per_phase = opt_.resample_taps;
+    rs_ = polyphase_resampler::make(ro);
+    if (rs_) {
+      // Radio-rate input behind max_samps outputs, plus the filter length
+      const size_t cap = rs_->input_needed(opt_.max_samps) + 8;
+      rs_in_.assign(get_num_channels(), std::vector<uint32_t>(cap));
+      for (auto& b : rs_in_) rs_in_ptrs_.push_back(b.data());
+    } else {
+      std::fprintf(stderr, "[flexsdr_rx_streamer] WARNING: no resampler, delivering the radio rate\n");
+    }
+  }
+
   std::fprintf(stderr, "[flexsdr_rx_streamer] Created: %zu channels, max_samps=%zu, burst=%u\n",
                opt_.num_channels, opt_.max_samps, opt_.burst_size);
 }
 
+flexsdr_rx_streamer::~flexsdr_rx_streamer() {
+  if (opt_.tunables) opt_.tunables->unregister_reader(tun_slot_);
+  for (rte_mbuf* m : held_) rte_pktmbuf_free(m);
+  for (lane& l : lanes_) {
+    for (size_t i = l.head; i < l.count; i++) rte_pktmbuf_free(l.pend[i]);
+  }
+}
+
+void flexsdr_rx_streamer::poll_policy_(uint64_t& tight_polls, unsigned& sleep_us) {
+  tight_polls = 1000;
+  sleep_us    = 1;
+  if (!opt_.tunables) return;
+  if (!tun_registered_) {
+    tun_slot_ = opt_.tunables->register_reader();
+    tun_registered_ = true;
+  }
+  if (tun_slot_ < 0) return;
+  const conf::Tunables* t = opt_.tunables->get();
+  tight_polls = t->rx_tight_polls;
+  sleep_us    = t->rx_poll_sleep_us;
+  opt_.tunables->quiescent(tun_slot_);
+}
+
 void flexsdr_rx_streamer::issue_stream_cmd(const uhd::stream_cmd_t& cmd) {
   switch (cmd.stream_mode) {
     case uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS:
+      sync_prod_drops_();
       running_.store(true);
       std::fprintf(stderr, "[flexsdr_rx_streamer] Stream started (continuous)\n");
       break;
@@ -37,12 +105,14 @@ void flexsdr_rx_streamer::issue_stream_cmd(const uhd::stream_cmd_t& cmd) {
       break;
       
     case uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE:
+      sync_prod_drops_();
       running_.store(true);
       std::fprintf(stderr, "[flexsdr_rx_streamer] Stream started (num_samps=%zu)\n",
                    cmd.num_samps);
       break;
       
     case uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_MORE:
+      sync_prod_drops_();
       running_.store(true);
       std::fprintf(stderr, "[flexsdr_rx_streamer] Stream started (num_samps=%zu, more)\n",
                    cmd.num_samps);
@@ -61,6 +131,85 @@ size_t flexsdr_rx_streamer::recv(
     const double timeout,
     const bool one_packet)
 {
+  // Convert buffs_type to a plain pointer list (reused, no per-call allocation)
+  ch_buffs_.clear();
+  for (size_t i = 0; i < buffs.size(); i++) {
+    ch_buffs_.push_back(buffs[i]);
+  }
+  if (rs_) {
+    return recv_resampled_(ch_buffs_.data(), ch_buffs_.size(), nsamps_per_buff, metadata,
+                           timeout, one_packet);
+  }
+  return recv_(ch_buffs_.data(), ch_buffs_.size(), nsamps_per_buff, metadata, timeout, one_packet);
+}
+
+size_t flexsdr_rx_streamer::recv_resampled_(
+    void* const* buffs,
+    size_t nbuffs,
+    size_t nsamps,
+    uhd::rx_metadata_t& md,
+    double timeout,
+    bool one_packet)
+{
+  if (nbuffs < rs_->num_channels()) {
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_BAD_PACKET;
+    return 0;
+  }
+  nsamps = std::min(nsamps, opt_.max_samps);
+
+  size_t out = 0;
+  while (out == 0) {
+    const size_t need = std::min(rs_->input_needed(nsamps), rs_in_[0].size());
+    const size_t n = recv_(rs_in_ptrs_.data(), rs_in_ptrs_.size(), need, md, timeout, one_packet);
+    // Samples after a gap or an overflow don't continue the old history
+    if (md.out_of_sequence || md.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW) {
+      rs_->reset();
+      rs_have_t0_ = false;
+    }
+    if (n == 0) return 0;
+    if (!rs_have_t0_ && md.has_time_spec) {
+      rs_t0_ = md.time_spec;
+      rs_out_ = 0;
+      rs_have_t0_ = true;
+    }
+    rs_->push(rs_in_ptrs_.data(), n);
+    out = rs_->pull(buffs, nsamps);
+  }
+
+  // Output m shows the input at m - delay() output samples
+  md.has_time_spec = rs_have_t0_;
+  if (rs_have_t0_) {
+    const double lag = rs_->delay() / rs_->out_rate();
+    md.time_spec = rs_t0_ + uhd::time_spec_t::from_ticks(static_cast<long long>(rs_out_), rs_->out_rate()) -
+                   uhd::time_spec_t(lag);
+  }
+  rs_out_ += out;
+  return out;
+}
+
+size_t flexsdr_rx_streamer::recv_(
+    void* const* buffs,
+    size_t nbuffs,
+    size_t nsamps_per_buff,
+    uhd::rx_metadata_t& metadata,
+    double timeout,
+    bool one_packet)
+{
+  corr_on_ = opt_.correction && opt_.correction->enabled();
+  if (opt_.link && !opt_.link->up()) {
+    // Quiesced until the secondary re-attaches; don't spin the caller
+    const double wait = std::min(timeout, 0.01);
+    if (wait > 0) std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64_t>(wait * 1e6)));
+    metadata.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+    return 0;
+  }
+  if (!lanes_.empty()) {
+    return recv_multi_(buffs, nbuffs, nsamps_per_buff, metadata, timeout, one_packet);
+  }
+  if (opt_.ingress) {
+    return recv_ingress_(buffs, nbuffs, nsamps_per_buff, metadata, timeout, one_packet);
+  }
+
   (void)one_packet;
   
   if (!opt_.ring) {
@@ -76,6 +225,10 @@ size_t flexsdr_rx_streamer::recv(
   // Poll the ring repeatedly until data is available or timeout expires
   void* mbuf_ptrs[opt_.burst_size];
   unsigned n_dequeued = 0;
+
+  // Packets held back at a command boundary go first
+  for (rte_mbuf* m : held_) mbuf_ptrs[n_dequeued++] = m;
+  held_.clear();
   
   // Calculate timeout in microseconds for polling
   const auto timeout_us = static_cast<uint64_t>(timeout * 1e6);
@@ -88,7 +241,9 @@ size_t flexsdr_rx_streamer::recv(
   // 4. Aggressive ring draining with multiple dequeue attempts
   
   uint64_t poll_attempts = 0;
-  const uint64_t TIGHT_POLL_LIMIT = 1000;       // Busy-poll this many times
+  uint64_t TIGHT_POLL_LIMIT;                    // Busy-poll this many times (tunables.rx)
+  unsigned poll_sleep_us;
+  poll_policy_(TIGHT_POLL_LIMIT, poll_sleep_us);
   const uint64_t TIMEOUT_CHECK_INTERVAL = 1000; // Check timeout every N iterations
   const unsigned MAX_DRAIN_ATTEMPTS = 4;        // Try to drain ring this many times
   
@@ -116,6 +271,13 @@ size_t flexsdr_rx_streamer::recv(
     }
     
     if (n_dequeued > 0) {
+      if (opt_.counters) {
+        uint64_t bytes = 0;
+        for (unsigned i = 0; i < n_dequeued; i++)
+          bytes += static_cast<rte_mbuf*>(mbuf_ptrs[i])->data_len;
+        shm_queue_counters::add(opt_.counters->cons.pkts, n_dequeued);
+        shm_queue_counters::add(opt_.counters->cons.bytes, bytes);
+      }
       break;  // Got data!
     }
     
@@ -135,8 +297,8 @@ size_t flexsdr_rx_streamer::recv(
     // Sleep strategy: tight polling initially, then small sleeps
     if (poll_attempts > TIGHT_POLL_LIMIT) {
       // Only sleep after many failed attempts (reduces latency)
-      // Use 1us sleep instead of 10us for better responsiveness
-      std::this_thread::sleep_for(std::chrono::microseconds(1));
+      // Default 1us sleep instead of 10us for better responsiveness
+      if (poll_sleep_us) std::this_thread::sleep_for(std::chrono::microseconds(poll_sleep_us));
     }
     // else: tight busy-poll (no sleep) for fast path
   }
@@ -148,24 +310,64 @@ size_t flexsdr_rx_streamer::recv(
   }
   
   bursts_cons_++;
-  
-  // Convert buffs_type to vector<void*>
-  std::vector<void*> ch_buffs;
-  ch_buffs.reserve(buffs.size());
-  for (size_t i = 0; i < buffs.size(); i++) {
-    ch_buffs.push_back(buffs[i]);
+
+  // Loss on the ring ahead of this burst: the producer found it full, or
+  // the head packet does not continue the last one. Reported once, UHD
+  // style, as a 0-sample OVERFLOW; the packets are delivered next call.
+  if (ring_loss_(static_cast<rte_mbuf*>(mbuf_ptrs[0]))) {
+    overflows_++;
+    held_.assign(reinterpret_cast<rte_mbuf**>(mbuf_ptrs),
+                 reinterpret_cast<rte_mbuf**>(mbuf_ptrs) + n_dequeued);
+    metadata.error_code = uhd::rx_metadata_t::ERROR_CODE_OVERFLOW;
+    metadata.out_of_sequence = true;
+    metadata.has_time_spec = false;
+    metadata.start_of_burst = false;
+    metadata.end_of_burst = false;
+    return 0;
+  }
+
+  // Timed-command boundary: deliver up to (not including) the flagged
+  // packet; if it is first, this call starts the new-setting burst.
+  bool at_boundary = false;
+  if (opt_.split_on_cmd_boundary && opt_.vrt_hdr_bytes >= sizeof(pkt_header)) {
+    for (unsigned i = 0; i < n_dequeued; i++) {
+      rte_mbuf* m = static_cast<rte_mbuf*>(mbuf_ptrs[i]);
+      if (!m || m->data_len < sizeof(pkt_header)) continue;
+      const pkt_header* h = rte_pktmbuf_mtod(m, const pkt_header*);
+      if (!(h->flags & PKT_F_CMD_BOUNDARY)) continue;
+      if (i == 0) {
+        if (held_off_) continue;   // partial packet, reported when it started
+        at_boundary = true;
+        boundary_tsf_.store(h->tsf, std::memory_order_release);
+        boundary_seq_.store(h->cmd_seq, std::memory_order_release);
+        boundaries_++;
+        continue;
+      }
+      for (unsigned k = i; k < n_dequeued; k++) held_.push_back(static_cast<rte_mbuf*>(mbuf_ptrs[k]));
+      n_dequeued = i;
+      break;
+    }
   }
   
+  // The unpacker takes a vector; recv() already filled ch_buffs_
+  std::vector<void*>& ch_buffs = ch_buffs_;
+  if (buffs != ch_buffs.data()) ch_buffs.assign(buffs, buffs + nbuffs);
+  
   // Use custom unpacker if provided, otherwise default
   size_t samples_written;
+  unsigned consumed = n_dequeued;   // mbufs fully used
+  size_t   tail_off = 0;            // samples used from mbufs[consumed]
   if (opt_.iq_unpack) {
-    // Custom SIMD unpacker
+    // Custom SIMD unpacker (consumes the whole burst)
+    held_off_ = 0;
     samples_written = opt_.iq_unpack(
         ch_buffs,
         nsamps_per_buff,
         reinterpret_cast<rte_mbuf**>(mbuf_ptrs),
         n_dequeued,
         metadata);
+    if (metadata.has_time_spec) last_tsf_ = metadata.time_spec.to_ticks(opt_.tick_rate);
+    correct_(ch_buffs.data(), ch_buffs.size(), 0, samples_written);   // separate pass here
   } else {
     // Default unpacker
     samples_written = default_unpack_sc16_interleaved_(
@@ -174,24 +376,75 @@ size_t flexsdr_rx_streamer::recv(
         reinterpret_cast<rte_mbuf**>(mbuf_ptrs),
         n_dequeued,
         metadata);
+    consumed = unpack_done_;
+    tail_off = unpack_off_;
   }
   
-  // Free mbufs back to pool
-  for (unsigned i = 0; i < n_dequeued; i++) {
+  // Free consumed mbufs back to pool
+  for (unsigned i = 0; i < consumed; i++) {
     if (mbuf_ptrs[i]) {
       rte_pktmbuf_free(static_cast<rte_mbuf*>(mbuf_ptrs[i]));
     }
   }
+
+  // Keep the rest (a partly read packet, packets past nsamps or a TSF gap)
+  // in front of anything held at a command boundary
+  bool boundary_next = !held_.empty();
+  if (consumed < n_dequeued) {
+    held_.insert(held_.begin(), reinterpret_cast<rte_mbuf**>(mbuf_ptrs) + consumed,
+                 reinterpret_cast<rte_mbuf**>(mbuf_ptrs) + n_dequeued);
+    boundary_next = false;
+  }
+  held_off_ = tail_off;
   
   samples_out_ += samples_written;
   
   // Set metadata
   metadata.error_code = uhd::rx_metadata_t::ERROR_CODE_NONE;
   metadata.has_time_spec = opt_.parse_tsf;
+  metadata.start_of_burst = at_boundary;
+  metadata.end_of_burst = boundary_next;   // next sample is at a new setting
   
   return samples_written;
 }
 
+void flexsdr_rx_streamer::sync_prod_drops_() {
+  if (opt_.counters) prod_drops_seen_ = opt_.counters->prod.drops.load(std::memory_order_relaxed);
+}
+
+bool flexsdr_rx_streamer::ring_loss_(rte_mbuf* head) {
+  bool loss = false;
+  if (opt_.counters) {
+    const uint64_t d = opt_.counters->prod.drops.load(std::memory_order_relaxed);
+    if (d != prod_drops_seen_) {
+      prod_drops_seen_ = d;
+      loss = true;
+    }
+  }
+  // A gap inside a burst ends the previous call before it, so checking the
+  // head of each call covers them all. Custom unpackers track TSF themselves.
+  if (!opt_.iq_unpack && opt_.parse_tsf && have_tsf_ && held_off_ == 0 && head &&
+      head->data_len >= opt_.vrt_hdr_bytes && extract_tsf_(head) != next_tsf_) {
+    have_tsf_ = false;   // the data that follows is a new run, not a gap
+    loss = true;
+  }
+  return loss;
+}
+
+// --------------------------- default unpacker -------------------------------
+
+namespace {
+
+constexpr unsigned kPrefetchLines = 4;   // payload lines of packet N+1 (header + first samples)
+
+inline void prefetch_payload(const rte_mbuf* m) {
+  const char* p = rte_pktmbuf_mtod(m, const char*);
+  const size_t n = std::min<size_t>(kPrefetchLines, (m->data_len + 63) / 64);
+  for (size_t l = 0; l < n; l++) rte_prefetch0(p + l * 64);
+}
+
+} // namespace
+
 size_t flexsdr_rx_streamer::default_unpack_sc16_interleaved_(
     const std::vector<void*>& ch_buffs,
     size_t nsamps_target,
@@ -200,22 +453,29 @@ size_t flexsdr_rx_streamer::default_unpack_sc16_interleaved_(
     uhd::rx_metadata_t& md)
 {
   const size_t num_ch = get_num_channels();
+  const bool nt = opt_.nt_stores && !corr_on_;   // corrections read the output back
   size_t total_samples = 0;
-  
-  // Extract timestamp from first packet if enabled
-  if (opt_.parse_tsf && count > 0 && mbufs[0]) {
-    uint64_t tsf = extract_tsf_(mbufs[0]);
-    md.time_spec = uhd::time_spec_t::from_ticks(tsf, 1.0); // Placeholder tick rate
-    md.has_time_spec = true;
-  } else {
-    md.has_time_spec = false;
-  }
+  const size_t first_off = held_off_;   // mbufs[0] may be partly read already
+
+  // Format: interleaved [CH0_I, CH0_Q, CH1_I, CH1_Q, ...]
+  const size_t values_per_sample = 2;  // I + Q
+
+  unpack_done_ = count;
+  unpack_off_ = 0;
+  md.has_time_spec = false;
+  md.out_of_sequence = false;
+
+  // Pipeline fill: headers of 0 and 1, payload of 0
+  for (uint16_t k = 0; k < count && k < 2; k++) rte_prefetch0(mbufs[k]);
+  if (count && mbufs[0]) prefetch_payload(mbufs[0]);
   
   // Process each mbuf
-  for (uint16_t i = 0; i < count && total_samples < nsamps_target; i++) {
+  for (uint16_t i = 0; i < count; i++) {
     rte_mbuf* m = mbufs[i];
+    if (i + 2 < count) rte_prefetch0(mbufs[i + 2]);
+    if (i + 1 < count && mbufs[i + 1]) prefetch_payload(mbufs[i + 1]);
     
-    if (!m || !m->buf_addr) {
+    if (!m || !m->buf_addr || m->data_len < opt_.vrt_hdr_bytes) {
       mbuf_errors_++;
       continue;
     }
@@ -225,30 +485,444 @@ size_t flexsdr_rx_streamer::default_unpack_sc16_interleaved_(
     const size_t payload_bytes = m->data_len - opt_.vrt_hdr_bytes;
     
     // Calculate samples in this packet
-    // Format: interleaved [CH0_I, CH0_Q, CH1_I, CH1_Q, ...]
-    const size_t values_per_sample = 2;  // I + Q
     const size_t total_values = payload_bytes / sizeof(int16_t);
     const size_t samps_in_pkt = total_values / (num_ch * values_per_sample);
-    
-    // Copy samples to output buffers (deinterleave if multi-channel)
-    for (size_t s = 0; s < samps_in_pkt && total_samples < nsamps_target; s++) {
-      for (size_t ch = 0; ch < num_ch; ch++) {
-        int16_t* out = static_cast<int16_t*>(ch_buffs[ch]);
-        const size_t src_idx = s * num_ch * values_per_sample + ch * values_per_sample;
-        const size_t dst_idx = total_samples * values_per_sample;
-        
-        // Copy I and Q
-        out[dst_idx] = src[src_idx];         // I
-        out[dst_idx + 1] = src[src_idx + 1]; // Q
+    const size_t start = (i == 0) ? first_off : 0;
+
+    if (opt_.parse_tsf) {
+      const uint64_t tsf = extract_tsf_(m) + start;
+      if (start == 0 && have_tsf_ && tsf != next_tsf_) {
+        // TSF gap: end this call before it; the next call starts there
+        if (total_samples > 0) {
+          unpack_done_ = i;
+          break;
+        }
+        md.out_of_sequence = true;
+      }
+      if (total_samples == 0) {
+        md.time_spec = uhd::time_spec_t::from_ticks(tsf, opt_.tick_rate);
+        md.has_time_spec = true;
+        last_tsf_ = tsf;
       }
-      total_samples++;
+    }
+
+    if (total_samples >= nsamps_target) {
+      // Caller's buffer is full; keep this packet for the next call
+      unpack_done_ = i;
+      unpack_off_ = start;
+      break;
+    }
+
+    const size_t take = std::min(samps_in_pkt - std::min(start, samps_in_pkt),
+                                 nsamps_target - total_samples);
+    
+    // Copy samples to output buffers (deinterleave if multi-channel), then
+    // correct them while they are still in L1
+    deinterleave_sc16(ch_buffs.data(), num_ch, total_samples,
+                      reinterpret_cast<const uint8_t*>(src) + start * num_ch * 4, take, nt);
+    correct_(ch_buffs.data(), num_ch, total_samples, take);
+    total_samples += take;
+
+    if (opt_.parse_tsf) {
+      next_tsf_ = extract_tsf_(m) + start + take;
+      have_tsf_ = true;
+    }
+    if (start + take < samps_in_pkt) {
+      // Stopped inside this packet: carry the rest
+      unpack_done_ = i;
+      unpack_off_ = start + take;
+      break;
     }
   }
   
+#if defined(__SSE2__)
+  if (nt) _mm_sfence();   // streaming stores visible before recv() returns
+#endif
   md.error_code = uhd::rx_metadata_t::ERROR_CODE_NONE;
   return total_samples;
 }
 
+//==============================
+// Exact-size reads
+//==============================
+size_t flexsdr_rx_streamer::recv_exact(void* const* buffs, size_t nchans, size_t nsamps,
+                                       uhd::rx_metadata_t& md, double timeout, uint64_t* tsf)
+{
+  const size_t nch = std::min(nchans, get_num_channels());
+  md.error_code = uhd::rx_metadata_t::ERROR_CODE_NONE;
+  md.out_of_sequence = false;
+  md.start_of_burst = false;
+  md.end_of_burst = false;
+  md.has_time_spec = false;
+  if (nch == 0 || nsamps == 0) return 0;
+
+  const auto deadline = std::chrono::steady_clock::now() +
+      std::chrono::microseconds(static_cast<int64_t>(timeout * 1e6));
+
+  size_t written = 0;
+  uint64_t first_tsf = 0;
+  bool overflow = false;    // sticky: a later full read must not hide it
+  bool timed_out = false;
+
+  // Samples read past a gap last time go first
+  if (carry_n_) {
+    const size_t n = std::min(carry_n_, nsamps);
+    for (size_t c = 0; c < nch; c++) {
+      std::memcpy(buffs[c], &carry_[c * carry_cap_ + carry_off_], n * 4);
+    }
+    first_tsf = carry_tsf_;
+    carry_tsf_ += n;
+    carry_off_ += n;
+    carry_n_ -= n;
+    written = n;
+    md.out_of_sequence = true;
+  }
+
+  // Unused channels still need somewhere to go
+  for (size_t c = nch; c < exact_ptrs_.size(); c++) exact_ptrs_[c] = carry_.data() + c * carry_cap_;
+
+  while (written < nsamps) {
+    // Stopped: nothing will arrive before the deadline, don't spin on it
+    if (!running_.load()) {
+      timed_out = true;
+      break;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+      timed_out = true;
+      break;
+    }
+    const double left = std::chrono::duration<double>(deadline - now).count();
+
+    const size_t want = std::min(nsamps - written, carry_cap_);
+    for (size_t c = 0; c < nch; c++) {
+      exact_ptrs_[c] = static_cast<uint8_t*>(buffs[c]) + written * 4;
+    }
+
+    uhd::rx_metadata_t cmd;
+    const size_t got = recv_(exact_ptrs_.data(), exact_ptrs_.size(), want, cmd, left, false);
+    if (got == 0) {
+      if (cmd.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW) {
+        overflow = true;
+        if (written) break;
+      }
+      continue;
+    }
+
+    const uint64_t chunk_tsf = last_tsf_;
+    if (written && opt_.parse_tsf && chunk_tsf != first_tsf + written) {
+      // Discontinuity: return what is contiguous, keep this chunk
+      for (size_t c = 0; c < nch; c++) {
+        std::memcpy(&carry_[c * carry_cap_], exact_ptrs_[c], got * 4);
+      }
+      carry_n_ = got;
+      carry_off_ = 0;
+      carry_tsf_ = chunk_tsf;
+      md.out_of_sequence = true;
+      break;
+    }
+
+    if (written == 0) {
+      first_tsf = chunk_tsf;
+      md.start_of_burst = cmd.start_of_burst;
+      md.out_of_sequence = md.out_of_sequence || cmd.out_of_sequence;
+    }
+    written += got;
+  }
+
+  if (written && opt_.parse_tsf) {
+    md.has_time_spec = true;
+    md.time_spec = uhd::time_spec_t::from_ticks(first_tsf, opt_.tick_rate);
+    if (tsf) *tsf = first_tsf;
+  }
+  if (overflow)       md.error_code = uhd::rx_metadata_t::ERROR_CODE_OVERFLOW;
+  else if (timed_out) md.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+  return written;
+}
+
+//==============================
+// Multi-queue mode
+//==============================
+size_t flexsdr_rx_streamer::lane_samps_(const rte_mbuf* m) const {
+  if (!m || !m->buf_addr || m->data_len <= opt_.vrt_hdr_bytes) return 0;
+  return (m->data_len - opt_.vrt_hdr_bytes) / (2 * sizeof(int16_t));
+}
+
+void flexsdr_rx_streamer::lane_pop_(lane& l) {
+  rte_pktmbuf_free(l.pend[l.head]);
+  l.head++;
+  l.off = 0;
+}
+
+bool flexsdr_rx_streamer::lane_fill_(lane& l) {
+  for (;;) {
+    while (l.head < l.count && lane_samps_(l.pend[l.head]) == 0) {
+      mbuf_errors_++;
+      lane_pop_(l);
+    }
+    if (l.head < l.count) return true;
+    if (!l.ring) return false;
+    l.count = rte_ring_dequeue_burst(l.ring, reinterpret_cast<void**>(l.pend.data()),
+                                     static_cast<unsigned>(l.pend.size()), nullptr);
+    l.head = 0;
+    if (l.count == 0) return false;
+  }
+}
+
+size_t flexsdr_rx_streamer::recv_multi_(
+    void* const* buffs,
+    size_t nbuffs,
+    size_t nsamps,
+    uhd::rx_metadata_t& md,
+    double timeout,
+    bool one_packet)
+{
+  if (!running_.load()) {
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+    return 0;
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() +
+      std::chrono::microseconds(static_cast<int64_t>(timeout * 1e6));
+  uint64_t TIGHT_POLL_LIMIT;
+  unsigned poll_sleep_us;
+  poll_policy_(TIGHT_POLL_LIMIT, poll_sleep_us);
+  const uint64_t TIMEOUT_CHECK_INTERVAL = 1000;
+  uint64_t poll_attempts = 0;
+
+  // Every lane needs a packet at its head; same polling strategy as recv()
+  auto wait_all = [&]() -> bool {
+    for (;;) {
+      bool all = true;
+      for (lane& l : lanes_) all = lane_fill_(l) && all;
+      if (all) return true;
+      if (!running_.load()) return false;
+      poll_attempts++;
+      if (poll_attempts % TIMEOUT_CHECK_INTERVAL == 0 &&
+          std::chrono::steady_clock::now() >= deadline) {
+        return false;
+      }
+      if (poll_attempts > TIGHT_POLL_LIMIT && poll_sleep_us) {
+        std::this_thread::sleep_for(std::chrono::microseconds(poll_sleep_us));
+      }
+    }
+  };
+
+  if (!wait_all()) {
+    underruns_++;
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+    return 0;
+  }
+
+  // Align: advance every lane to the latest head TSF
+  if (opt_.align_tsf) {
+    for (;;) {
+      uint64_t target = 0;
+      for (lane& l : lanes_) target = std::max(target, lane_tsf_(l));
+
+      bool aligned = true;
+      for (lane& l : lanes_) {
+        const uint64_t t = lane_tsf_(l);
+        if (t >= target) continue;
+        aligned = false;
+        const size_t avail = lane_samps_(l.pend[l.head]) - l.off;
+        const size_t skip = static_cast<size_t>(std::min<uint64_t>(target - t, avail));
+        l.off += skip;
+        align_drops_ += skip;
+        if (l.off >= lane_samps_(l.pend[l.head])) lane_pop_(l);
+      }
+      if (aligned) break;
+      if (!wait_all()) {
+        underruns_++;
+        md.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+        return 0;
+      }
+    }
+  }
+
+  bursts_cons_++;
+  const uint64_t first_tsf = lane_tsf_(lanes_[0]);
+  const size_t nlanes = std::min(lanes_.size(), nbuffs);
+
+  size_t written = 0;
+  while (written < nsamps) {
+    size_t n = nsamps - written;
+    for (lane& l : lanes_) n = std::min(n, lane_samps_(l.pend[l.head]) - l.off);
+
+    for (size_t c = 0; c < nlanes; c++) {
+      lane& l = lanes_[c];
+      const uint8_t* src = rte_pktmbuf_mtod_offset(l.pend[l.head], const uint8_t*,
+                                                   opt_.vrt_hdr_bytes + l.off * 4);
+      std::memcpy(static_cast<uint8_t*>(buffs[c]) + written * 4, src, n * 4);
+    }
+    correct_(buffs, nlanes, written, n);
+    for (lane& l : lanes_) l.off += n;
+    written += n;
+    if (one_packet) break;
+
+    // Next packet on exhausted lanes; stop when one runs dry or jumps in TSF
+    // (the next call re-aligns).
+    bool stop = false;
+    for (lane& l : lanes_) {
+      const size_t samps = lane_samps_(l.pend[l.head]);
+      if (l.off < samps) continue;
+      const uint64_t expected = extract_tsf_(l.pend[l.head]) + samps;
+      lane_pop_(l);
+      if (!lane_fill_(l)) {
+        stop = true;
+      } else if (opt_.align_tsf && lane_tsf_(l) != expected) {
+        realigns_++;
+        stop = true;
+      }
+    }
+    if (stop) break;
+  }
+
+  // Release fully consumed heads now rather than on the next call
+  for (lane& l : lanes_) {
+    if (l.head < l.count && l.off >= lane_samps_(l.pend[l.head])) lane_pop_(l);
+  }
+
+  samples_out_ += written;
+
+  md.error_code = uhd::rx_metadata_t::ERROR_CODE_NONE;
+  md.has_time_spec = opt_.parse_tsf;
+  if (opt_.parse_tsf) {
+    md.time_spec = uhd::time_spec_t::from_ticks(first_tsf, opt_.tick_rate);
+    last_tsf_ = first_tsf;
+  }
+  md.start_of_burst = false;
+  md.end_of_burst = false;
+  return written;
+}
+
+//==============================
+// Ingress-worker mode
+//==============================
+bool flexsdr_rx_streamer::ingress_open_(double timeout) {
+  if (!ing_blk_) {
+    ing_blk_ = opt_.ingress->acquire(timeout);
+    ing_off_ = 0;
+    ing_seen_ = false;
+  }
+  return ing_blk_ != nullptr;
+}
+
+bool flexsdr_rx_streamer::ingress_touch_(uhd::rx_metadata_t& md) {
+  if (ing_seen_) return true;
+  ing_seen_ = true;
+  if (ing_blk_->flags & RxIngress::BLK_F_OVERFLOW) {
+    // Reported once with no samples; the block itself is delivered next call
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_OVERFLOW;
+    return false;
+  }
+  if (ing_blk_->flags & RxIngress::BLK_F_BOUNDARY) {
+    md.start_of_burst = true;
+    boundary_tsf_.store(ing_blk_->tsf, std::memory_order_release);
+    boundary_seq_.store(ing_blk_->cmd_seq, std::memory_order_release);
+    boundaries_++;
+  }
+  return true;
+}
+
+size_t flexsdr_rx_streamer::recv_ingress_(
+    void* const* buffs,
+    size_t nbuffs,
+    size_t nsamps,
+    uhd::rx_metadata_t& md,
+    double timeout,
+    bool one_packet)
+{
+  md.start_of_burst = false;
+  md.end_of_burst = false;
+  md.has_time_spec = false;
+
+  if (!running_.load()) {
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+    return 0;
+  }
+
+  RxIngress& ing = *opt_.ingress;
+  const size_t nch = std::min(nbuffs, ing.num_channels());
+  size_t written = 0;
+
+  while (written < nsamps) {
+    if (!ingress_open_(written ? 0.0 : timeout)) break;
+
+    // A gap, overflow or new setting starts the next recv()
+    if (written && !ing_seen_ &&
+        (ing_blk_->flags & (RxIngress::BLK_F_GAP | RxIngress::BLK_F_BOUNDARY |
+                            RxIngress::BLK_F_OVERFLOW))) {
+      md.end_of_burst = (ing_blk_->flags & RxIngress::BLK_F_BOUNDARY) != 0;
+      break;
+    }
+    if (!ingress_touch_(md)) return 0;
+
+    if (written == 0 && opt_.parse_tsf) {
+      last_tsf_ = ing_blk_->tsf + ing_off_;
+      md.time_spec = uhd::time_spec_t::from_ticks(last_tsf_, opt_.tick_rate);
+      md.has_time_spec = true;
+    }
+
+    const size_t n = std::min(nsamps - written, ing_blk_->nsamps - ing_off_);
+    for (size_t c = 0; c < nch; c++) {
+      std::memcpy(static_cast<uint8_t*>(buffs[c]) + written * 4,
+                  static_cast<const uint8_t*>(ing.chan_data(ing_blk_, c)) + ing_off_ * 4,
+                  n * 4);
+    }
+    correct_(buffs, nch, written, n);
+    written += n;
+    release_samples(n);
+    if (one_packet) break;
+  }
+
+  if (written == 0) {
+    underruns_++;
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+    return 0;
+  }
+  samples_out_ += written;
+  md.error_code = uhd::rx_metadata_t::ERROR_CODE_NONE;
+  return written;
+}
+
+size_t flexsdr_rx_streamer::acquire_samples(const void** ch_ptrs, size_t max,
+                                            uhd::rx_metadata_t& md, double timeout) {
+  md.start_of_burst = false;
+  md.end_of_burst = false;
+  md.has_time_spec = false;
+
+  if (!opt_.ingress || !running_.load() || !ingress_open_(timeout)) {
+    if (opt_.ingress) underruns_++;
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+    return 0;
+  }
+  if (!ingress_touch_(md)) return 0;
+
+  for (size_t c = 0; c < opt_.ingress->num_channels(); c++) {
+    ch_ptrs[c] = static_cast<const uint8_t*>(opt_.ingress->chan_data(ing_blk_, c)) + ing_off_ * 4;
+  }
+  if (opt_.parse_tsf) {
+    last_tsf_ = ing_blk_->tsf + ing_off_;
+    md.time_spec = uhd::time_spec_t::from_ticks(last_tsf_, opt_.tick_rate);
+    md.has_time_spec = true;
+  }
+  const size_t n = std::min<size_t>(max, ing_blk_->nsamps - ing_off_);
+  samples_out_ += n;
+  md.error_code = uhd::rx_metadata_t::ERROR_CODE_NONE;
+  return n;
+}
+
+void flexsdr_rx_streamer::release_samples(size_t n) {
+  if (!ing_blk_) return;
+  ing_off_ += n;
+  if (ing_off_ >= ing_blk_->nsamps) {
+    opt_.ingress->release();
+    ing_blk_ = nullptr;
+    ing_off_ = 0;
+  }
+}
+
 uint64_t flexsdr_rx_streamer::extract_tsf_(rte_mbuf* m) {
   if (!m || !m->buf_addr || m->data_len < opt_.tsf_offset + sizeof(uint64_t)) {
     return 0;
@@ -1,56 +1,479 @@
 #include "device/flexsdr_tx_streamer.hpp"
+#include "device/iq_arena.hpp"
 
+#include <uhd/exception.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
 #include <cstring>
 #include <stdexcept>
+#include <string>
+#include <thread>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace flexsdr {
 
+flexsdr_tx_streamer::flexsdr_tx_streamer(TxBackend* backend, const options& opt)
+  : backend_(backend), mode_(opt.mode), chans_(opt.chans), tick_rate_(opt.tick_rate),
+    on_buffer_done_(opt.on_buffer_done), done_opaque_(opt.done_opaque)
+{
+    num_chans_ = opt.num_channels ? opt.num_channels : 1;
+    if (opt.spp) spp_ = opt.spp;
+    wait_       = opt.wait;
+    wait_tight_ = opt.wait_tight;
+
+    if (chans_.empty()) {
+        for (std::size_t c = 0; c < num_chans_; ++c) chans_.push_back(c);
+    }
+    if (chans_.size() < num_chans_) {
+        throw std::runtime_error("[flexsdr_tx_streamer] fewer backend channels than stream channels");
+    }
+
+    // Never build a packet larger than the backend can hold in one mbuf
+    const std::size_t lanes = (mode_ == tx_mode::interleaved) ? num_chans_ : 1;
+    if (backend_) {
+        const std::size_t room = backend_->max_burst_bytes(chans_[0]);
+        const std::size_t cap = room / (4 * lanes);
+        if (cap && cap < spp_) spp_ = cap;
+    }
+
+    chunk_ptrs_.resize(num_chans_);
+    send_ptrs_.reserve(num_chans_);
+    if (mode_ == tx_mode::interleaved) pack_buf_.resize(spp_ * num_chans_);
+
+    if (opt.host_rate > 0.0 && std::fabs(opt.host_rate - tick_rate_) > 1e-9 * tick_rate_) {
+        polyphase_resampler::options ro;
+        ro.in_rate        = opt.host_rate;
+        ro.out_rate       = tick_rate_;
+        ro.num_channels   = num_chans_;
+        ro.taps_per_phase = opt.resample_taps;
+        rs_ = polyphase_resampler::make(ro);
+        if (!rs_) throw std::runtime_error("[flexsdr_tx_streamer] cannot build the host-rate resampler");
+        host_rate_ = opt.host_rate;
+        // A few packets per round; output room for all of it
+        rs_in_max_ = spp_ * 4;
+        const std::size_t out_cap = rs_in_max_ * rs_->up() / rs_->down() + 2;
+        rs_buf_.assign(num_chans_, std::vector<uint32_t>(out_cap));
+        for (auto& b : rs_buf_) rs_ptrs_.push_back(b.data());
+        rs_in_.resize(num_chans_);
+    }
+
+    if (!rs_ && !on_buffer_done_ && opt.arena_zero_copy && mode_ == tx_mode::per_channel_ring) {
+        on_buffer_done_ = &flexsdr_tx_streamer::arena_unpin_;
+        arena_zc_ = true;
+    }
+
+    // Interleaved packets are packed (copied) anyway; buffers complete at once
+    if (!rs_ && on_buffer_done_ && mode_ == tx_mode::per_channel_ring) {
+        constexpr std::size_t kTokens = 1024;
+        zc_tokens_.resize(kTokens);
+        zc_free_.reserve(kTokens);
+        for (auto& t : zc_tokens_) zc_free_.push_back(&t);
+        zc_cur_.resize(num_chans_);
+        zc_done_.resize(num_chans_);
+    }
+
+    std::fprintf(stderr, "[flexsdr_tx_streamer] Created: %zu channels, mode=%s, spp=%zu%s\n",
+                 num_chans_, mode_ == tx_mode::interleaved ? "interleaved" : "per-channel",
+                 spp_, zc_tokens_.empty() ? "" : arena_zc_ ? ", zero-copy (iq_arena)" : ", zero-copy");
+}
+
 size_t flexsdr_tx_streamer::get_num_channels() const {
     return num_chans_;
 }
 
 
 size_t flexsdr_tx_streamer::get_max_num_samps() const {
-    // keep simple for now; you can compute from spp_ * burst_ if you wish
     return spp_;
 }
 
+void flexsdr_tx_streamer::pack_interleaved_(const void* const* buffs,
+                                            std::size_t nch,
+                                            std::size_t offset,
+                                            std::size_t nsamps) {
+    uint32_t* out = pack_buf_.data();
+    std::size_t s = 0;
+
+#if defined(__SSE2__)
+    // One sc16 sample is one 32-bit lane: 2T/4T pack is a 32/64-bit unpack
+    if (nch == 2) {
+        const auto* a = static_cast<const uint8_t*>(buffs[0]) + offset * 4;
+        const auto* b = static_cast<const uint8_t*>(buffs[1]) + offset * 4;
+        for (; s + 4 <= nsamps; s += 4) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + s * 4));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + s * 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * s),     _mm_unpacklo_epi32(va, vb));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * s + 4), _mm_unpackhi_epi32(va, vb));
+        }
+    } else if (nch == 4) {
+        const uint8_t* p[4];
+        for (int c = 0; c < 4; ++c) p[c] = static_cast<const uint8_t*>(buffs[c]) + offset * 4;
+        for (; s + 4 <= nsamps; s += 4) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p[0] + s * 4));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p[1] + s * 4));
+            const __m128i vc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p[2] + s * 4));
+            const __m128i vd = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p[3] + s * 4));
+            const __m128i ab_lo = _mm_unpacklo_epi32(va, vb);   // a0 b0 a1 b1
+            const __m128i ab_hi = _mm_unpackhi_epi32(va, vb);   // a2 b2 a3 b3
+            const __m128i cd_lo = _mm_unpacklo_epi32(vc, vd);
+            const __m128i cd_hi = _mm_unpackhi_epi32(vc, vd);
+            __m128i* o = reinterpret_cast<__m128i*>(out + 4 * s);
+            _mm_storeu_si128(o + 0, _mm_unpacklo_epi64(ab_lo, cd_lo)); // a0 b0 c0 d0
+            _mm_storeu_si128(o + 1, _mm_unpackhi_epi64(ab_lo, cd_lo));
+            _mm_storeu_si128(o + 2, _mm_unpacklo_epi64(ab_hi, cd_hi));
+            _mm_storeu_si128(o + 3, _mm_unpackhi_epi64(ab_hi, cd_hi));
+        }
+    }
+#endif
+
+    for (; s < nsamps; ++s) {
+        for (std::size_t c = 0; c < nch; ++c) {
+            std::memcpy(&out[s * nch + c],
+                        static_cast<const uint8_t*>(buffs[c]) + (offset + s) * 4, 4);
+        }
+    }
+}
+
+// --------------------------- zero-copy ----------------------------------------
+
+void flexsdr_tx_streamer::zc_packet_done_(const void* /*data*/, void* opaque) {
+  auto* t = static_cast<zc_token*>(opaque);
+  t->self->zc_unref_(t);
+}
+
+void flexsdr_tx_streamer::arena_unpin_(const void* buf, void* /*opaque*/) {
+  iq_arena::instance().unpin(buf);
+}
+
+void flexsdr_tx_streamer::zc_unref_(zc_token* t) {
+  if (--t->refs) return;
+  const void* buf = t->buf;
+  zc_free_.push_back(t);
+  on_buffer_done_(buf, done_opaque_);
+}
+
+void flexsdr_tx_streamer::zc_complete_now_(const void* const* buffs, std::size_t nch) {
+  if (!on_buffer_done_) return;
+  for (std::size_t ch = 0; ch < nch; ++ch) on_buffer_done_(buffs[ch], done_opaque_);
+}
+
+size_t flexsdr_tx_streamer::reap() {
+  return backend_ ? backend_->reap_tx_completions() : 0;
+}
+
 size_t flexsdr_tx_streamer::send(const buffs_type& buffs,
                                  size_t nsamps_per_buff,
                                  const uhd::tx_metadata_t& md,
-                                 const double /*timeout*/) {
+                                 const double timeout) {
+  send_ptrs_.clear();
+  for (size_t ch = 0; ch < buffs.size(); ++ch) send_ptrs_.push_back(buffs[ch]);
+  return send_ptrs(send_ptrs_.data(), send_ptrs_.size(), nsamps_per_buff, md, timeout);
+}
+
+size_t flexsdr_tx_streamer::send_ptrs(const void* const* buffs,
+                                      std::size_t nbuffs,
+                                      std::size_t nsamps_per_buff,
+                                      const uhd::tx_metadata_t& md,
+                                      double timeout) {
   if (!backend_) {
     // Legacy mode not fully implemented - return 0 for now
     // TODO: Implement direct ring/mempool send for backward compatibility
     return 0;
   }
-  
-  const bool sob = md.start_of_burst;
-  const bool eob = md.end_of_burst;
-  const uint64_t tsf = md.has_time_spec ? md.time_spec.to_ticks(1.0) : 0;
+
+  // An interleaved packet carries every channel; packing fewer would send a
+  // frame the receiver de-interleaves with the wrong stride
+  if (mode_ == tx_mode::interleaved && nbuffs != 0 && nbuffs < num_chans_) {
+    throw uhd::value_error("[flexsdr_tx_streamer] interleaved stream has " +
+                           std::to_string(num_chans_) + " channels, send() got " +
+                           std::to_string(nbuffs) + " buffers");
+  }
+  const std::size_t nch = std::min(nbuffs, num_chans_);
+  if (nch == 0) return 0;
+
+  // Bounds every wait in this call (back-pressure, full ring, empty pool)
+  timeout_      = std::max(timeout, 0.0);
+  deadline_set_ = false;
+  last_         = send_report{};
+
+  if (rs_) {
+    // The filter runs every channel in lockstep
+    if (nch < num_chans_) {
+      throw uhd::value_error("[flexsdr_tx_streamer] resampled stream has " +
+                             std::to_string(num_chans_) + " channels, send() got " +
+                             std::to_string(nch) + " buffers");
+    }
+    return send_resampled_(buffs, nch, nsamps_per_buff, md);
+  }
+  return send_(buffs, nch, nsamps_per_buff, md, false);
+}
+
+size_t flexsdr_tx_streamer::send_(const void* const* buffs,
+                                  std::size_t nch,
+                                  std::size_t nsamps_per_buff,
+                                  const uhd::tx_metadata_t& md,
+                                  bool own_bufs) {
+  const uint64_t tsf0 = md.has_time_spec ? md.time_spec.to_ticks(tick_rate_) : 0;
   const uint16_t fmt = 1; // SC16 format
-  const uint32_t spp = static_cast<uint32_t>(nsamps_per_buff);
 
   // Assume SC16 (complex int16): 2 samples (I+Q) * 2 bytes = 4 bytes per complex sample
   const size_t bytes_per_sample = 4;
-  
+
+  // Zero-copy needs one token per buffer; without them this call copies.
+  // In arena mode the pins are the completion: only arena buffers qualify.
+  bool zc = false;
+  bool pinned = !arena_zc_ && !own_bufs;
+  if (arena_zc_ && !own_bufs) {
+    size_t ch = 0;
+    while (ch < nch && iq_arena::instance().pin(buffs[ch])) ++ch;
+    pinned = ch == nch;
+    if (!pinned) while (ch-- > 0) iq_arena::instance().unpin(buffs[ch]);
+  }
+  if (!zc_tokens_.empty() && pinned) {
+    if (zc_free_.size() < nch) backend_->reap_tx_completions();
+    zc = zc_free_.size() >= nch;
+    for (size_t ch = 0; zc && ch < nch; ++ch) {
+      zc_token* t = zc_free_.back();
+      zc_free_.pop_back();
+      *t = zc_token{this, buffs[ch], 1};   // send()'s own reference
+      zc_cur_[ch] = t;
+      zc_done_[ch] = TxBackend::tx_done{&flexsdr_tx_streamer::zc_packet_done_, t};
+    }
+  }
+
+  // Split into packets of at most spp_ samples per channel; SOB rides on
+  // the first packet, EOB on the last. A zero-length EOB still goes out.
   size_t samples_sent = 0;
-  for (size_t ch = 0; ch < buffs.size(); ++ch) {
-    const void* data = buffs[ch];
-    const size_t bytes = nsamps_per_buff * bytes_per_sample;
-    
-    if (!backend_->send_burst(ch, data, bytes, tsf, spp, fmt, sob, eob)) {
-      // Back-pressure or error - stop here
-      if (!allow_partial_ || samples_sent == 0) {
-        return samples_sent;
+  do {
+    const size_t n = std::min(spp_, nsamps_per_buff - samples_sent);
+    const bool sob = md.start_of_burst && samples_sent == 0;
+    const bool eob = md.end_of_burst && samples_sent + n == nsamps_per_buff;
+    const uint64_t tsf = md.has_time_spec ? tsf0 + samples_sent : 0;
+    const uint32_t spp = static_cast<uint32_t>(n);
+    const size_t off = samples_sent * bytes_per_sample;
+
+    // Hold off while a queue is over its watermark; on timeout report what went out
+    if (!wait_backpressure_(nch)) break;
+
+    // Interleaved packets are packed once, however often the send is tried
+    const bool packed = mode_ == tx_mode::interleaved && nch > 1;
+    if (packed) pack_interleaved_(buffs, nch, samples_sent, n);
+
+    using tx_status = TxBackend::tx_status;
+    auto try_send = [&]() -> tx_status {
+      tx_status st;
+      if (packed) {
+        st = backend_->send_burst(chans_[0], pack_buf_.data(), n * nch * bytes_per_sample,
+                                  tsf, spp, fmt, sob, eob);
+      } else if (nch == 1) {
+        const void* p = static_cast<const uint8_t*>(buffs[0]) + off;
+        if (zc) {
+          zc_cur_[0]->refs++;
+          st = backend_->send_burst_zc(chans_[0], p, n * bytes_per_sample,
+                                       tsf, spp, fmt, sob, eob, zc_done_[0]);
+          if (st != tx_status::sent) zc_cur_[0]->refs--;
+        } else {
+          st = backend_->send_burst(chans_[0], p, n * bytes_per_sample, tsf, spp, fmt, sob, eob);
+        }
+      } else {
+        for (size_t ch = 0; ch < nch; ++ch) {
+          chunk_ptrs_[ch] = static_cast<const uint8_t*>(buffs[ch]) + off;
+        }
+        if (zc) {
+          for (size_t ch = 0; ch < nch; ++ch) zc_cur_[ch]->refs++;
+          st = backend_->send_burst_multi_zc(chans_.data(), chunk_ptrs_.data(), nch,
+                                             n * bytes_per_sample, tsf, spp, fmt, sob, eob,
+                                             zc_done_.data());
+          if (st != tx_status::sent) for (size_t ch = 0; ch < nch; ++ch) zc_cur_[ch]->refs--;
+        } else {
+          st = backend_->send_burst_multi(chans_.data(), chunk_ptrs_.data(), nch,
+                                          n * bytes_per_sample, tsf, spp, fmt, sob, eob);
+        }
+      }
+      return st;
+    };
+
+    // A full ring or an empty pool is usually a consumer that is briefly
+    // behind: wait until the backend can take the packet (a side-effect
+    // free probe) and only then build it again, up to the deadline. A
+    // rejected packet was already reported by the backend and never waits.
+    tx_status st = try_send();
+    if (st == tx_status::would_block) {
+      const std::size_t* q = chans_.data();
+      const std::size_t  nq = (packed || nch == 1) ? 1 : nch;
+      uint64_t tries = 0;
+      bool expired = false;
+      while (backend_->tx_ready()) {
+        if (!wait_step_(tries)) {
+          expired = true;
+          break;
+        }
+        if (backend_->tx_would_block(q, nq)) continue;
+        if ((st = try_send()) != tx_status::would_block) break;
       }
-      break;
+      if (tries || expired) end_wait_(tries, expired);
+      if (st == tx_status::would_block) backend_->tx_dropped(q, nq);
     }
-    samples_sent = nsamps_per_buff;
+
+    // Back-pressure or error - report what made it
+    if (st != tx_status::sent) break;
+    samples_sent += n;
+  } while (samples_sent < nsamps_per_buff);
+
+  if (zc) {
+    for (size_t ch = 0; ch < nch; ++ch) zc_unref_(zc_cur_[ch]);
+  } else if (pinned) {
+    zc_complete_now_(buffs, nch);
   }
-  
   return samples_sent;
 }
 
+bool flexsdr_tx_streamer::wait_backpressure_(std::size_t nch) {
+  const std::size_t nq = (mode_ == tx_mode::interleaved || nch == 1) ? 1 : nch;
+  auto held = [&] {
+    for (std::size_t q = 0; q < nq; ++q) {
+      if (backend_->tx_backpressure(chans_[q])) return true;
+    }
+    return false;
+  };
+  if (!held()) return true;
+
+  uint64_t tries = 0;
+  do {
+    if (!wait_step_(tries)) {
+      end_wait_(0, true);
+      return false;
+    }
+  } while (held());
+  end_wait_(0, false);
+  return true;
+}
+
+bool flexsdr_tx_streamer::wait_step_(uint64_t& tries) {
+  using clock = std::chrono::steady_clock;
+
+  // One deadline per send() call, however many packets end up waiting.
+  // spin/pause only look at the clock every 64 tries.
+  if (tries == 0 || wait_ == tx_wait::yield || tries % 64 == 0) {
+    const auto now = clock::now();
+    if (tries == 0) wait_start_ = now;
+    if (!deadline_set_) {
+      deadline_ = now + std::chrono::duration_cast<clock::duration>(
+                            std::chrono::duration<double>(timeout_));
+      deadline_set_ = true;
+    }
+    if (now >= deadline_) return false;
+  }
+  ++tries;
+
+  if (wait_ == tx_wait::yield || tries > wait_tight_) {
+    std::this_thread::yield();
+  } else if (wait_ == tx_wait::pause) {
+#if defined(__SSE2__)
+    _mm_pause();
+#endif
+  }
+  return true;
+}
+
+void flexsdr_tx_streamer::end_wait_(uint64_t retries, bool timed_out) {
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - wait_start_).count();
+  last_.retries    += retries;
+  last_.blocked_ns += static_cast<uint64_t>(ns);
+  retries_.fetch_add(retries, std::memory_order_relaxed);
+  blocked_ns_.fetch_add(static_cast<uint64_t>(ns), std::memory_order_relaxed);
+  if (timed_out && !last_.timed_out) {
+    last_.timed_out = true;
+    timeouts_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+// --------------------------- host-rate conversion ----------------------------
+
+size_t flexsdr_tx_streamer::send_resampled_(const void* const* buffs,
+                                            std::size_t nch,
+                                            std::size_t nsamps,
+                                            const uhd::tx_metadata_t& md) {
+  const uhd::time_spec_t span = uhd::time_spec_t::from_ticks(nsamps, host_rate_);
+
+  // A new burst, a jump in the caller's timeline or an earlier short send
+  // restarts the filter; otherwise its history carries over.
+  const bool jump = md.has_time_spec && rs_active_ && rs_timed_ &&
+                    (md.time_spec - rs_next_).to_ticks(host_rate_) != 0;
+  if (!rs_active_ || md.start_of_burst || jump) {
+    rs_->reset();
+    rs_timed_ = md.has_time_spec;
+    if (rs_timed_) {
+      // Output m shows the input at m - delay(): start that much earlier
+      const long long t = md.time_spec.to_ticks(tick_rate_) - std::llround(rs_->delay());
+      rs_tsf_ = t > 0 ? static_cast<uint64_t>(t) : 0;
+    }
+    rs_active_ = true;
+  }
+  rs_next_ = (md.has_time_spec ? md.time_spec : rs_next_) + span;
+
+  // Flush the filter tail with zeros at end of burst
+  static const uint32_t zeros[256] = {};
+  const std::size_t tail = md.end_of_burst ? static_cast<std::size_t>(std::ceil(rs_->delay())) : 0;
+
+  bool sob = md.start_of_burst;
+  std::size_t in_done = 0;
+  uint64_t out_sent = 0;
+  bool flushed = tail == 0;
+  for (;;) {
+    if (in_done < nsamps) {
+      const std::size_t n = std::min(rs_in_max_, nsamps - in_done);
+      for (std::size_t c = 0; c < nch; ++c) rs_in_[c] = static_cast<const uint8_t*>(buffs[c]) + in_done * 4;
+      rs_->push(rs_in_.data(), n);
+      in_done += n;
+    } else if (!flushed) {
+      const std::size_t need = rs_->input_needed(rs_->output_for(0) + tail);
+      for (std::size_t left = need; left;) {
+        const std::size_t n = std::min<std::size_t>(left, 256);
+        for (std::size_t c = 0; c < nch; ++c) rs_in_[c] = zeros;
+        rs_->push(rs_in_.data(), n);
+        left -= n;
+      }
+      flushed = true;
+    }
+
+    const bool input_done = in_done == nsamps && flushed;
+    for (;;) {
+      const std::size_t out = rs_->pull(rs_ptrs_.data(), rs_buf_[0].size());
+      const bool last = input_done && rs_->output_for(0) == 0;
+      if (!out && !(last && md.end_of_burst)) break;
+
+      uhd::tx_metadata_t m2;
+      m2.start_of_burst = sob;
+      m2.end_of_burst   = last && md.end_of_burst;
+      m2.has_time_spec  = rs_timed_;
+      m2.time_spec      = uhd::time_spec_t::from_ticks(static_cast<long long>(rs_tsf_), tick_rate_);
+      const std::size_t sent = send_(rs_ptrs_.data(), nch, out, m2, true);
+      rs_tsf_ += sent;
+      out_sent += sent;
+      sob = false;
+      if (sent < out) {
+        // Back-pressure: report the host samples whose output made it and
+        // start over on the next call
+        rs_active_ = false;
+        zc_complete_now_(buffs, nch);
+        const auto host = static_cast<std::size_t>(out_sent * rs_->down() / rs_->up());
+        return std::min(host, nsamps);
+      }
+      if (last) break;
+    }
+    if (input_done) break;
+  }
+
+  if (md.end_of_burst) rs_active_ = false;
+  zc_complete_now_(buffs, nch);
+  return nsamps;
+}
 
 } //flexsdr
@@ -2,6 +2,13 @@
 #include <uhd/types/tune_request.hpp>
 #include <uhd/types/tune_result.h>
 
+#include <grpcpp/impl/codegen/async_unary_call.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
 const std::string ALL_GAINS = "";
 const std::string ALL_LOS   = "all";
 
@@ -9,6 +16,54 @@ const std::string ALL_LOS   = "all";
 FlexSDRClient::FlexSDRClient(std::shared_ptr<Channel> channel)
     : stub_(FlexSDRControl::NewStub(channel)) {}
 
+FlexSDRClient::FlexSDRClient(std::shared_ptr<Channel> channel, const rpc_options& opt)
+    : stub_(FlexSDRControl::NewStub(channel)), opt_(opt) {}
+
+// Transient failures worth another attempt; setters are absolute values, so
+// repeating one is harmless.
+static bool retryable(const grpc::Status& st) {
+    return st.error_code() == grpc::StatusCode::UNAVAILABLE ||
+           st.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED;
+}
+
+void FlexSDRClient::arm_(ClientContext& ctx) const {
+    if (opt_.deadline_ms) {
+        ctx.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(opt_.deadline_ms));
+    }
+}
+
+// Copy a command time into a gain/frequency request; false if the
+// generated stubs cannot carry it.
+template <typename Req>
+static bool stamp_command(Req& req, uint64_t ticks, uint32_t id) {
+    if (!ticks) return true;
+#ifdef FLEXSDR_PROTO_HAS_COMMAND_TIME
+    req.set_command_time_ticks(ticks);
+    req.set_command_id(id);
+    return true;
+#else
+    (void)req;
+    (void)id;
+    std::cout << "Timed command rejected: stubs generated without command_time_ticks" << std::endl;
+    return false;
+#endif
+}
+
+template <typename Fn>
+Status FlexSDRClient::invoke_(Fn&& fn) {
+    Status st;
+    for (unsigned attempt = 0; attempt <= opt_.retries; attempt++) {
+        if (attempt) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(opt_.retry_backoff_ms * attempt));
+        }
+        ClientContext ctx;   // contexts are single-use
+        arm_(ctx);
+        st = fn(&ctx);
+        if (st.ok() || !retryable(st)) break;
+    }
+    return st;
+}
+
 bool FlexSDRClient::set_clock_rate(double rate, unit_t unit) {
     // Map unit_t to protobuf UnitType
     flexsdr::UnitType proto_unit;
@@ -32,9 +87,9 @@ bool FlexSDRClient::set_clock_rate(double rate, unit_t unit) {
     request.set_rate(rate);
 
     flexsdr::ClockRateResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->SetClockRate(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->SetClockRate(ctx, request, &reply);
+    });
 
     if (status.ok()) {
         std::cout << "Clock rate set successfully for unit: " << unit << std::endl;
@@ -67,9 +122,9 @@ double FlexSDRClient::get_clock_rate(unit_t unit) {
     request.set_unit(proto_unit);
 
     flexsdr::ClockRateResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->GetClockRate(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->GetClockRate(ctx, request, &reply);
+    });
 
     if (status.ok()) {
         return reply.actual_rate();
@@ -79,19 +134,21 @@ double FlexSDRClient::get_clock_rate(unit_t unit) {
     }
 }
 
-bool FlexSDRClient::set_rx_gain(double gain, size_t chan, const std::string& name) {
+bool FlexSDRClient::set_rx_gain(double gain, size_t chan, const std::string& name, double* actual) {
     flexsdr::GainRequestParams request;
     request.set_gain(gain);
     request.set_name(name);
     request.set_chan(chan);
+    if (!stamp_command(request, cmd_ticks_, cmd_id_)) return false;
 
     flexsdr::GainResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->SetRxGain(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->SetRxGain(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
         std::cout << "RX Gain set successfully: " << reply.actual_gain() << " dB" << std::endl;
+        if (actual) *actual = reply.actual_gain();
         return true;
     } else {
         std::cout << "SetRxGain failed: " << reply.error_message() << std::endl;
@@ -100,37 +157,41 @@ bool FlexSDRClient::set_rx_gain(double gain, size_t chan, const std::string& nam
     return false;
 }
 
-double FlexSDRClient::get_rx_gain(size_t chan, const std::string& name) {
+double FlexSDRClient::get_rx_gain(size_t chan, const std::string& name, bool* ok) {
     flexsdr::GainRequestParams request;
     request.set_name(name);
     request.set_chan(chan);
 
     flexsdr::GainResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->GetRxGain(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->GetRxGain(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
+        if (ok) *ok = true;
         return reply.actual_gain();
     } else {
+        if (ok) *ok = false;
         std::cout << "GetRxGain failed: " << reply.error_message() << std::endl;
         return 0.0;
     }
 }
 
-bool FlexSDRClient::set_tx_gain(double gain, size_t chan, const std::string& name) {
+bool FlexSDRClient::set_tx_gain(double gain, size_t chan, const std::string& name, double* actual) {
     flexsdr::GainRequestParams request;
     request.set_gain(gain);
     request.set_name(name);
     request.set_chan(chan);
+    if (!stamp_command(request, cmd_ticks_, cmd_id_)) return false;
 
     flexsdr::GainResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->SetTxGain(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->SetTxGain(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
         std::cout << "TX Gain set successfully: " << reply.actual_gain() << " dB" << std::endl;
+        if (actual) *actual = reply.actual_gain();
         return true;
     } else {
         std::cout << "SetTxGain failed: " << reply.error_message() << std::endl;
@@ -138,19 +199,21 @@ bool FlexSDRClient::set_tx_gain(double gain, size_t chan, const std::string& nam
     }
 }
 
-double FlexSDRClient::get_tx_gain(size_t chan, const std::string& name) {
+double FlexSDRClient::get_tx_gain(size_t chan, const std::string& name, bool* ok) {
     flexsdr::GainRequestParams request;
     request.set_name(name.empty() ? "" : name); // Handle ALL_GAINS or default
     request.set_chan(chan);
 
     flexsdr::GainResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->GetTxGain(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->GetTxGain(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
+        if (ok) *ok = true;
         return reply.actual_gain();
     } else {
+        if (ok) *ok = false;
         std::cout << "GetTxGain failed: " << reply.error_message() << std::endl;
         return 0.0;
     }
@@ -215,11 +278,12 @@ uhd_tune_result_t FlexSDRClient::set_rx_freq(const uhd::tune_request_t& uhd_requ
         return uhd_tune_result_t(); // Return default struct on failure
     }
     request.mutable_channel_request()->set_chan(chan);
+    if (!stamp_command(request, cmd_ticks_, cmd_id_)) return uhd_tune_result_t();
 
     flexsdr::FrequencyResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->SetRxFreq(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->SetRxFreq(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
         std::cout << "RX Frequency set successfully: " << reply.tune_result().actual_rf_freq()/1e6 << " MHz" << std::endl;
@@ -230,18 +294,20 @@ uhd_tune_result_t FlexSDRClient::set_rx_freq(const uhd::tune_request_t& uhd_requ
     }
 }
 
-double FlexSDRClient::get_rx_freq(size_t chan) {
+double FlexSDRClient::get_rx_freq(size_t chan, bool* ok) {
     flexsdr::ChannelRequest request;
     request.set_chan(chan);
 
     flexsdr::FrequencyValue reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->GetRxFreq(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->GetRxFreq(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
+        if (ok) *ok = true;
         return reply.frequency();
     } else {
+        if (ok) *ok = false;
         std::cout << "GetRxFreq failed: " << reply.error_message() << std::endl;
         return 0.0;
     }
@@ -254,11 +320,12 @@ uhd_tune_result_t FlexSDRClient::set_tx_freq(const uhd::tune_request_t& uhd_requ
         return uhd_tune_result_t(); // Return default struct on failure
     }
     request.mutable_channel_request()->set_chan(chan);
+    if (!stamp_command(request, cmd_ticks_, cmd_id_)) return uhd_tune_result_t();
 
     flexsdr::FrequencyResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->SetTxFreq(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->SetTxFreq(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
         std::cout << "TX Frequency set successfully: " << reply.tune_result().actual_rf_freq()/1e6 << " MHz" << std::endl;
@@ -270,35 +337,38 @@ uhd_tune_result_t FlexSDRClient::set_tx_freq(const uhd::tune_request_t& uhd_requ
 }
 
 
-double FlexSDRClient::get_tx_freq(size_t chan) {
+double FlexSDRClient::get_tx_freq(size_t chan, bool* ok) {
     flexsdr::ChannelRequest request;
     request.set_chan(chan);
 
     flexsdr::FrequencyValue reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->GetTxFreq(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->GetTxFreq(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
+        if (ok) *ok = true;
         return reply.frequency();
     } else {
+        if (ok) *ok = false;
         std::cout << "GetRxFreq failed: " << reply.error_message() << std::endl;
         return 0.0;
     }
 }
 
-bool FlexSDRClient::set_rx_rate(double rate, size_t chan) {
+bool FlexSDRClient::set_rx_rate(double rate, size_t chan, double* actual) {
     flexsdr::RateRequestParams request;
     request.set_rate(rate);
     request.set_chan(chan);
 
     flexsdr::RateResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->SetRxRate(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->SetRxRate(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
         std::cout << "RX Rate set successfully: " << reply.actual_rate() << " dB" << std::endl;
+        if (actual) *actual = reply.actual_rate();
         return true;
     } else {
         std::cout << "SetRxRate failed: " << reply.error_message() << std::endl;
@@ -306,35 +376,38 @@ bool FlexSDRClient::set_rx_rate(double rate, size_t chan) {
     }
 }
 
-double FlexSDRClient::get_rx_rate(size_t chan) {
+double FlexSDRClient::get_rx_rate(size_t chan, bool* ok) {
     flexsdr::RateRequestParams request;
     request.set_chan(chan);
 
     flexsdr::RateResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->GetRxRate(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->GetRxRate(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
+        if (ok) *ok = true;
         return reply.actual_rate();
     } else {
+        if (ok) *ok = false;
         std::cout << "GetRxRate failed: " << reply.error_message() << std::endl;
         return 0.0;
     }
 }
 
-bool FlexSDRClient::set_tx_rate(double rate, size_t chan) {
+bool FlexSDRClient::set_tx_rate(double rate, size_t chan, double* actual) {
     flexsdr::RateRequestParams request;
     request.set_rate(rate);
     request.set_chan(chan);
 
     flexsdr::RateResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->SetTxRate(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->SetTxRate(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
         std::cout << "TX Rate set successfully: " << reply.actual_rate() << " dB" << std::endl;
+        if (actual) *actual = reply.actual_rate();
         return true;
     } else {
         std::cout << "SetTxRate failed: " << reply.error_message() << std::endl;
@@ -342,18 +415,20 @@ bool FlexSDRClient::set_tx_rate(double rate, size_t chan) {
     }
 }
 
-double FlexSDRClient::get_tx_rate(size_t chan) {
+double FlexSDRClient::get_tx_rate(size_t chan, bool* ok) {
     flexsdr::RateRequestParams request;
     request.set_chan(chan);
 
     flexsdr::RateResponseParams reply;
-    grpc::ClientContext context;
-
-    grpc::Status status = stub_->GetTxRate(&context, request, &reply);
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->GetTxRate(ctx, request, &reply);
+    });
 
     if (status.ok() && reply.success()) {
+        if (ok) *ok = true;
         return reply.actual_rate();
     } else {
+        if (ok) *ok = false;
         std::cout << "GetTxRate failed: " << reply.error_message() << std::endl;
         return 0.0;
     }
@@ -362,9 +437,9 @@ double FlexSDRClient::get_tx_rate(size_t chan) {
 DeviceInfoResponse FlexSDRClient::get_device_info() {
     DeviceInfoRequest request;
     DeviceInfoResponse reply;
-    ClientContext context;
-
-    Status status = stub_->GetDeviceInfo(&context, request, &reply);
+    Status status = invoke_([&](ClientContext* ctx) {
+        return stub_->GetDeviceInfo(ctx, request, &reply);
+    });
 
     if (status.ok()) {
         std::cout << "Device: " << reply.device_name() << std::endl;
@@ -380,12 +455,311 @@ DeviceInfoResponse FlexSDRClient::get_device_info() {
     return reply;
 }
 
+//==============================
+// Batched settings
+//==============================
+
+// One in-flight unary RPC on a CompletionQueue; the object is its own tag.
+struct FlexSDRClient::async_call {
+    virtual ~async_call() = default;
+    virtual void start(FlexSDRControl::Stub* stub, grpc::CompletionQueue* cq,
+                       std::chrono::system_clock::time_point deadline) = 0;
+    virtual void harvest(param_result& r) const = 0;
+
+    std::unique_ptr<grpc::ClientContext> ctx;
+    grpc::Status status;
+    size_t       idx      = 0;
+    unsigned     attempts = 0;
+};
+
+namespace {
+
+template <typename Req, typename Resp>
+struct unary_call final : FlexSDRClient::async_call {
+    using reader_t  = grpc::ClientAsyncResponseReader<Resp>;
+    using prepare_t = std::unique_ptr<reader_t> (*)(FlexSDRControl::Stub*, grpc::ClientContext*,
+                                                    const Req&, grpc::CompletionQueue*);
+    using take_t    = void (*)(const Resp&, FlexSDRClient::param_result&);
+
+    unary_call(prepare_t p, take_t t) : prepare(p), take(t) {}
+
+    void start(FlexSDRControl::Stub* stub, grpc::CompletionQueue* cq,
+               std::chrono::system_clock::time_point deadline) override {
+        ctx = std::make_unique<grpc::ClientContext>();
+        if (deadline != std::chrono::system_clock::time_point{}) ctx->set_deadline(deadline);
+        resp.Clear();
+        reader = prepare(stub, ctx.get(), req, cq);
+        reader->StartCall();
+        reader->Finish(&resp, &status, this);
+        attempts++;
+    }
+
+    void harvest(FlexSDRClient::param_result& r) const override {
+        if (!status.ok()) {
+            r.success = false;
+            r.error   = status.error_message();
+            return;
+        }
+        take(resp, r);
+    }
+
+    Req       req;
+    Resp      resp;
+    prepare_t prepare;
+    take_t    take;
+    std::unique_ptr<reader_t> reader;
+};
+
+using gain_call  = unary_call<GainRequestParams, GainResponseParams>;
+using rate_call  = unary_call<RateRequestParams, RateResponseParams>;
+using freq_call  = unary_call<FrequencyRequestParams, FrequencyResponseParams>;
+using clock_call = unary_call<ClockRateRequestParams, ClockRateResponseParams>;
+
+void take_gain(const GainResponseParams& r, FlexSDRClient::param_result& out) {
+    out.success = r.success(); out.actual = r.actual_gain(); out.error = r.error_message();
+}
+void take_rate(const RateResponseParams& r, FlexSDRClient::param_result& out) {
+    out.success = r.success(); out.actual = r.actual_rate(); out.error = r.error_message();
+}
+// Effective tuned frequency (UHD convention: RF LO minus the DSP offset)
+void take_freq(const FrequencyResponseParams& r, FlexSDRClient::param_result& out) {
+    out.success = r.success();
+    out.actual  = r.tune_result().actual_rf_freq() - r.tune_result().actual_dsp_freq();
+    out.error   = r.error_message();
+}
+void take_clock(const ClockRateResponseParams& r, FlexSDRClient::param_result& out) {
+    out.success = r.success(); out.actual = r.actual_rate(); out.error = r.error_message();
+}
+
+std::unique_ptr<FlexSDRClient::async_call> make_call(const FlexSDRClient::param_change& c) {
+    using K = FlexSDRClient::param_change;
+    switch (c.kind) {
+        case K::RX_GAIN:
+        case K::TX_GAIN: {
+            auto call = std::make_unique<gain_call>(
+                c.kind == K::RX_GAIN
+                    ? +[](FlexSDRControl::Stub* s, grpc::ClientContext* x, const GainRequestParams& q, grpc::CompletionQueue* cq) { return s->PrepareAsyncSetRxGain(x, q, cq); }
+                    : +[](FlexSDRControl::Stub* s, grpc::ClientContext* x, const GainRequestParams& q, grpc::CompletionQueue* cq) { return s->PrepareAsyncSetTxGain(x, q, cq); },
+                &take_gain);
+            call->req.set_gain(c.value);
+            call->req.set_chan(c.chan);
+            if (!stamp_command(call->req, c.command_time_ticks, c.command_id)) return nullptr;
+            return call;
+        }
+        case K::RX_RATE:
+        case K::TX_RATE: {
+            auto call = std::make_unique<rate_call>(
+                c.kind == K::RX_RATE
+                    ? +[](FlexSDRControl::Stub* s, grpc::ClientContext* x, const RateRequestParams& q, grpc::CompletionQueue* cq) { return s->PrepareAsyncSetRxRate(x, q, cq); }
+                    : +[](FlexSDRControl::Stub* s, grpc::ClientContext* x, const RateRequestParams& q, grpc::CompletionQueue* cq) { return s->PrepareAsyncSetTxRate(x, q, cq); },
+                &take_rate);
+            call->req.set_rate(c.value);
+            call->req.set_chan(c.chan);
+            return call;
+        }
+        case K::RX_FREQ:
+        case K::TX_FREQ: {
+            auto call = std::make_unique<freq_call>(
+                c.kind == K::RX_FREQ
+                    ? +[](FlexSDRControl::Stub* s, grpc::ClientContext* x, const FrequencyRequestParams& q, grpc::CompletionQueue* cq) { return s->PrepareAsyncSetRxFreq(x, q, cq); }
+                    : +[](FlexSDRControl::Stub* s, grpc::ClientContext* x, const FrequencyRequestParams& q, grpc::CompletionQueue* cq) { return s->PrepareAsyncSetTxFreq(x, q, cq); },
+                &take_freq);
+            call->req.mutable_tune_request()->set_target_freq(c.value);
+            call->req.mutable_tune_request()->set_rf_freq_policy(flexsdr::TuneRequest::POLICY_AUTO);
+            call->req.mutable_tune_request()->set_dsp_freq_policy(flexsdr::TuneRequest::POLICY_AUTO);
+            call->req.mutable_channel_request()->set_chan(c.chan);
+            if (!stamp_command(call->req, c.command_time_ticks, c.command_id)) return nullptr;
+            return call;
+        }
+        case K::CLOCK_RATE: {
+            auto call = std::make_unique<clock_call>(
+                +[](FlexSDRControl::Stub* s, grpc::ClientContext* x, const ClockRateRequestParams& q, grpc::CompletionQueue* cq) { return s->PrepareAsyncSetClockRate(x, q, cq); },
+                &take_clock);
+            call->req.set_unit(flexsdr::UnitType::UNIT_BOTH);
+            call->req.set_rate(c.value);
+            return call;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+bool FlexSDRClient::apply_pipelined_(const std::vector<param_change>& changes,
+                                     std::vector<param_result>& results) {
+    grpc::CompletionQueue cq;
+    std::vector<std::unique_ptr<async_call>> calls;
+    calls.reserve(changes.size());
+
+    const auto deadline = [this] {
+        return opt_.deadline_ms
+            ? std::chrono::system_clock::now() + std::chrono::milliseconds(opt_.deadline_ms)
+            : std::chrono::system_clock::time_point{};
+    };
+
+    size_t pending = 0;
+    const auto when = deadline();
+    for (size_t i = 0; i < changes.size(); i++) {
+        auto call = make_call(changes[i]);
+        if (!call) {
+            results[i].error = "invalid parameter kind or unsupported command time";
+            continue;
+        }
+        call->idx = i;
+        call->start(stub_.get(), &cq, when);
+        calls.push_back(std::move(call));
+        pending++;
+    }
+
+    // Collect completions; transient failures wait out their back-off in
+    // `backlog` and are re-issued on the same queue with a fresh deadline,
+    // so one failing setter never stalls the others' completions.
+    std::vector<std::pair<std::chrono::system_clock::time_point, async_call*>> backlog;
+    void* tag = nullptr;
+    bool  ok  = false;
+    while (pending) {
+        const auto now = std::chrono::system_clock::now();
+        auto wake = std::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < backlog.size();) {
+            if (backlog[i].first <= now) {
+                backlog[i].second->start(stub_.get(), &cq, deadline());
+                backlog[i] = backlog.back();
+                backlog.pop_back();
+                continue;
+            }
+            wake = std::min(wake, backlog[i].first);
+            i++;
+        }
+
+        if (backlog.empty()) {
+            if (!cq.Next(&tag, &ok)) break;
+        } else {
+            const auto st = cq.AsyncNext(&tag, &ok, wake);
+            if (st == grpc::CompletionQueue::SHUTDOWN) break;
+            if (st == grpc::CompletionQueue::TIMEOUT) continue;
+        }
+
+        auto* call = static_cast<async_call*>(tag);
+        if (retryable(call->status) && call->attempts <= opt_.retries) {
+            backlog.emplace_back(std::chrono::system_clock::now() +
+                                     std::chrono::milliseconds(opt_.retry_backoff_ms * call->attempts),
+                                 call);
+            continue;
+        }
+        call->harvest(results[call->idx]);
+        pending--;
+    }
+
+    cq.Shutdown();
+    while (cq.Next(&tag, &ok)) {}
+
+    bool all_ok = true;
+    for (const auto& r : results) all_ok = all_ok && r.success;
+    return all_ok;
+}
+
+#ifdef FLEXSDR_PROTO_HAS_APPLY_SETTINGS
+static flexsdr::ParamChange::Kind to_proto_kind(FlexSDRClient::param_change::kind_t k) {
+    switch (k) {
+        case FlexSDRClient::param_change::RX_GAIN:    return flexsdr::ParamChange::RX_GAIN;
+        case FlexSDRClient::param_change::TX_GAIN:    return flexsdr::ParamChange::TX_GAIN;
+        case FlexSDRClient::param_change::RX_RATE:    return flexsdr::ParamChange::RX_RATE;
+        case FlexSDRClient::param_change::TX_RATE:    return flexsdr::ParamChange::TX_RATE;
+        case FlexSDRClient::param_change::RX_FREQ:    return flexsdr::ParamChange::RX_FREQ;
+        case FlexSDRClient::param_change::TX_FREQ:    return flexsdr::ParamChange::TX_FREQ;
+        case FlexSDRClient::param_change::CLOCK_RATE: return flexsdr::ParamChange::CLOCK_RATE;
+    }
+    return flexsdr::ParamChange::KIND_INVALID;
+}
+#endif
+
+bool FlexSDRClient::apply_batch_(const std::vector<param_change>& changes,
+                                 std::vector<param_result>& results, bool& unsupported) {
+#ifdef FLEXSDR_PROTO_HAS_APPLY_SETTINGS
+    flexsdr::ApplySettingsRequest request;
+    for (const auto& c : changes) {
+        auto* pc = request.add_changes();
+        pc->set_kind(to_proto_kind(c.kind));
+        pc->set_chan(c.chan);
+        pc->set_value(c.value);
+        pc->set_command_time_ticks(c.command_time_ticks);
+        pc->set_command_id(c.command_id);
+    }
+
+    flexsdr::ApplySettingsResponse reply;
+    grpc::Status status = invoke_([&](grpc::ClientContext* ctx) {
+        return stub_->ApplySettings(ctx, request, &reply);
+    });
+
+    if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+        unsupported = true;
+        return false;
+    }
+    if (!status.ok()) {
+        std::cout << "ApplySettings failed: " << status.error_message() << std::endl;
+        for (auto& r : results) r.error = status.error_message();
+        return false;
+    }
+
+    for (size_t i = 0; i < results.size() && i < static_cast<size_t>(reply.results_size()); i++) {
+        results[i].success = reply.results(i).success();
+        results[i].actual  = reply.results(i).actual_value();
+        results[i].error   = reply.results(i).error_message();
+    }
+    return reply.success();
+#else
+    // Stubs generated from an older flexsdr.proto: no batch RPC available.
+    (void)changes;
+    (void)results;
+    unsupported = true;
+    return false;
+#endif
+}
+
+bool FlexSDRClient::apply_settings(const std::vector<param_change>& in,
+                                   std::vector<param_result>* results) {
+    std::vector<param_result> local(in.size());
+    bool ok = true;
+
+    // Entries without their own command time inherit the client's.
+    std::vector<param_change> changes(in);
+    for (auto& c : changes) {
+        const bool timed_kind = c.kind == param_change::RX_GAIN || c.kind == param_change::TX_GAIN ||
+                                c.kind == param_change::RX_FREQ || c.kind == param_change::TX_FREQ;
+        if (!timed_kind) {
+            c.command_time_ticks = 0;
+        } else if (!c.command_time_ticks && cmd_ticks_) {
+            c.command_time_ticks = cmd_ticks_;
+            c.command_id         = cmd_id_;
+        }
+    }
+
+    if (!changes.empty()) {
+        bool unsupported = batch_unsupported_;
+        if (!unsupported) {
+            ok = apply_batch_(changes, local, unsupported);
+        }
+        if (unsupported) {
+            batch_unsupported_ = true;
+            ok = apply_pipelined_(changes, local);
+        }
+    }
+
+    if (results) *results = std::move(local);
+    return ok;
+}
+
 // Function to create and return a FlexSDR client
 std::unique_ptr<FlexSDRClient> GetClient(const std::string& server_address) {
     auto channel = grpc::CreateChannel(server_address, grpc::InsecureChannelCredentials());
     return std::make_unique<FlexSDRClient>(channel);
 }
 
+std::unique_ptr<FlexSDRClient> GetClient(const std::string& server_address, const FlexSDRClient::rpc_options& opt) {
+    auto channel = grpc::CreateChannel(server_address, grpc::InsecureChannelCredentials());
+    return std::make_unique<FlexSDRClient>(channel, opt);
+}
+
 // Helper function to convert string to lowercase
 std::string to_lower(const std::string& str) {
     std::string lower_str = str;
@@ -0,0 +1,185 @@
+#include "device/iq_arena.hpp"
+#include "transport/dpdk_common.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <new>
+
+extern "C" {
+#include <rte_lcore.h>
+#include <rte_malloc.h>
+#include <rte_memory.h>
+}
+
+namespace flexsdr {
+
+static inline std::size_t round_up(std::size_t v, std::size_t a) {
+  return (v + a - 1) & ~(a - 1);
+}
+
+iq_arena& iq_arena::instance() {
+  static iq_arena a;
+  return a;
+}
+
+int iq_arena::configure(const options& opt) {
+  std::lock_guard<std::mutex> lk(mtx_);
+  if (n_chunks_.load(std::memory_order_acquire)) {
+    std::fprintf(stderr, "[iq_arena] configure: blocks already allocated, keeping current classes\n");
+    return -1;
+  }
+  if (opt.align < 64 || (opt.align & (opt.align - 1)) || !opt.blocks_per_chunk ||
+      !std::is_sorted(opt.class_samps.begin(), opt.class_samps.end())) {
+    std::fprintf(stderr, "[iq_arena] configure: invalid options\n");
+    return -1;
+  }
+  opt_ = opt;
+  lists_.clear();
+  return 0;
+}
+
+bool iq_arena::resident(const void* p, std::size_t bytes) {
+  return dpdk_resident(p, bytes);
+}
+
+// --------------------------- allocation -------------------------------------
+
+iq_arena::free_list& iq_arena::list_(int socket_id, int cls, std::size_t block_bytes) {
+  for (auto& fl : lists_) {
+    if (fl.socket_id == socket_id && fl.cls == cls && fl.block_bytes == block_bytes) return fl;
+  }
+  lists_.push_back(free_list{socket_id, cls, block_bytes, 0, {}});
+  return lists_.back();
+}
+
+bool iq_arena::grow_(free_list& fl) {
+  const unsigned n = n_chunks_.load(std::memory_order_relaxed);
+  if (n >= MAX_CHUNKS) {
+    std::fprintf(stderr, "[iq_arena] chunk table full (%u)\n", MAX_CHUNKS);
+    return false;
+  }
+  const unsigned nblocks = fl.cls < 0 ? 1 : opt_.blocks_per_chunk;
+  auto* base = static_cast<uint8_t*>(
+      rte_malloc_socket("flexsdr_iq_arena", fl.block_bytes * nblocks, opt_.align, fl.socket_id));
+  if (!base) {
+    std::fprintf(stderr, "[iq_arena] rte_malloc_socket(%zu B, socket %d) failed\n",
+                 fl.block_bytes * nblocks, fl.socket_id);
+    return false;
+  }
+  auto* st = new (std::nothrow) block_state[nblocks];
+  if (!st) {
+    rte_free(base);
+    return false;
+  }
+
+  chunks_[n] = chunk{base, fl.block_bytes, nblocks, fl.cls, fl.socket_id, st};
+  n_chunks_.store(n + 1, std::memory_order_release);
+
+  for (unsigned i = nblocks; i-- > 0;) fl.free.push_back(base + i * fl.block_bytes);
+  fl.blocks += nblocks;
+  return true;
+}
+
+void* iq_arena::alloc(std::size_t bytes, int socket_id) {
+  if (!bytes) return nullptr;
+  if (socket_id < 0) {
+    const unsigned s = rte_socket_id();
+    socket_id = s == static_cast<unsigned>(SOCKET_ID_ANY) ? SOCKET_ID_ANY : static_cast<int>(s);
+  }
+
+  std::lock_guard<std::mutex> lk(mtx_);
+  int cls = -1;
+  std::size_t block_bytes = round_up(bytes, opt_.align);
+  for (std::size_t i = 0; i < opt_.class_samps.size(); i++) {
+    const std::size_t cb = round_up(opt_.class_samps[i] * 4, opt_.align);
+    if (block_bytes <= cb) {
+      cls = static_cast<int>(i);
+      block_bytes = cb;
+      break;
+    }
+  }
+
+  free_list& fl = list_(socket_id, cls, block_bytes);
+  if (fl.free.empty() && !grow_(fl)) return nullptr;
+  void* p = fl.free.back();
+  fl.free.pop_back();
+  return p;
+}
+
+void iq_arena::recycle_(void* block, const chunk* c) {
+  std::lock_guard<std::mutex> lk(mtx_);
+  list_(c->socket_id, c->cls, c->block_bytes).free.push_back(block);
+}
+
+void iq_arena::free(void* p) {
+  if (!p) return;
+  const chunk* c = nullptr;
+  block_state* st = state_(p, &c);
+  if (!st) {
+    std::fprintf(stderr, "[iq_arena] free(%p): not an arena block\n", p);
+    return;
+  }
+  const std::size_t idx = (static_cast<uint8_t*>(p) - c->base) / c->block_bytes;
+  void* block = c->base + idx * c->block_bytes;
+
+  // Packets may still reference it: the last unpin() recycles it then
+  st->freed.store(true, std::memory_order_release);
+  if (st->pins.load(std::memory_order_acquire) == 0 &&
+      st->freed.exchange(false, std::memory_order_acq_rel)) {
+    recycle_(block, c);
+  }
+}
+
+// --------------------------- lookups / pins ---------------------------------
+
+const iq_arena::chunk* iq_arena::find_(const void* p) const {
+  const auto* b = static_cast<const uint8_t*>(p);
+  const unsigned n = n_chunks_.load(std::memory_order_acquire);
+  for (unsigned i = 0; i < n; i++) {
+    const chunk& c = chunks_[i];
+    if (b >= c.base && b < c.base + c.block_bytes * c.nblocks) return &c;
+  }
+  return nullptr;
+}
+
+iq_arena::block_state* iq_arena::state_(const void* p, const chunk** out) const {
+  const chunk* c = find_(p);
+  if (out) *out = c;
+  if (!c) return nullptr;
+  return &c->state[(static_cast<const uint8_t*>(p) - c->base) / c->block_bytes];
+}
+
+bool iq_arena::pin(const void* p) {
+  block_state* st = state_(p);
+  if (!st) return false;
+  st->pins.fetch_add(1, std::memory_order_acq_rel);
+  return true;
+}
+
+void iq_arena::unpin(const void* p) {
+  const chunk* c = nullptr;
+  block_state* st = state_(p, &c);
+  if (!st) return;
+  if (st->pins.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+      st->freed.exchange(false, std::memory_order_acq_rel)) {
+    const std::size_t idx = (static_cast<const uint8_t*>(p) - c->base) / c->block_bytes;
+    recycle_(c->base + idx * c->block_bytes, c);
+  }
+}
+
+uint32_t iq_arena::pins(const void* p) const {
+  const block_state* st = state_(p);
+  return st ? st->pins.load(std::memory_order_acquire) : 0;
+}
+
+std::vector<iq_arena::class_stats> iq_arena::stats() const {
+  std::lock_guard<std::mutex> lk(mtx_);
+  std::vector<class_stats> out;
+  for (const auto& fl : lists_) {
+    out.push_back(class_stats{fl.socket_id, fl.block_bytes, fl.cls < 0,
+                              fl.blocks, fl.blocks - fl.free.size()});
+  }
+  return out;
+}
+
+} // namespace flexsdr
@@ -0,0 +1,101 @@
+// src/device/iq_deinterleave.cpp
+#include "device/iq_deinterleave.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace flexsdr {
+
+namespace {
+
+#if defined(__SSE2__)
+template <bool NT>
+inline void store128(uint8_t* dst, __m128i v) {
+  if (NT) _mm_stream_si128(reinterpret_cast<__m128i*>(dst), v);
+  else    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+}
+
+// nsamps interleaved sc16 frames of nch (1, 2 or 4) channels -> planar.
+// With NT the destinations must be 16-byte aligned.
+template <bool NT>
+size_t deinterleave_sse2(uint8_t* const* out, size_t nch, const uint8_t* src, size_t nsamps) {
+  size_t s = 0;
+  if (nch == 1) {
+    for (; s + 4 <= nsamps; s += 4) {
+      store128<NT>(out[0] + s * 4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + s * 4)));
+    }
+  } else if (nch == 2) {
+    for (; s + 4 <= nsamps; s += 4) {
+      const auto* p = reinterpret_cast<const __m128i*>(src + s * 8);
+      // a0 b0 a1 b1 | a2 b2 a3 b3 -> a0 a1 b0 b1 | a2 a3 b2 b3
+      const __m128i v0 = _mm_shuffle_epi32(_mm_loadu_si128(p),     _MM_SHUFFLE(3, 1, 2, 0));
+      const __m128i v1 = _mm_shuffle_epi32(_mm_loadu_si128(p + 1), _MM_SHUFFLE(3, 1, 2, 0));
+      store128<NT>(out[0] + s * 4, _mm_unpacklo_epi64(v0, v1));
+      store128<NT>(out[1] + s * 4, _mm_unpackhi_epi64(v0, v1));
+    }
+  } else if (nch == 4) {
+    for (; s + 4 <= nsamps; s += 4) {
+      const auto* p = reinterpret_cast<const __m128i*>(src + s * 16);
+      const __m128i r0 = _mm_loadu_si128(p);       // a0 b0 c0 d0
+      const __m128i r1 = _mm_loadu_si128(p + 1);   // a1 b1 c1 d1
+      const __m128i r2 = _mm_loadu_si128(p + 2);
+      const __m128i r3 = _mm_loadu_si128(p + 3);
+      const __m128i t0 = _mm_unpacklo_epi32(r0, r1);   // a0 a1 b0 b1
+      const __m128i t1 = _mm_unpackhi_epi32(r0, r1);   // c0 c1 d0 d1
+      const __m128i t2 = _mm_unpacklo_epi32(r2, r3);   // a2 a3 b2 b3
+      const __m128i t3 = _mm_unpackhi_epi32(r2, r3);   // c2 c3 d2 d3
+      store128<NT>(out[0] + s * 4, _mm_unpacklo_epi64(t0, t2));
+      store128<NT>(out[1] + s * 4, _mm_unpackhi_epi64(t0, t2));
+      store128<NT>(out[2] + s * 4, _mm_unpacklo_epi64(t1, t3));
+      store128<NT>(out[3] + s * 4, _mm_unpackhi_epi64(t1, t3));
+    }
+  }
+  return s;
+}
+#endif
+
+} // namespace
+
+void deinterleave_sc16(void* const* ch_buffs, size_t nch, size_t dst_samp,
+                       const uint8_t* src, size_t nsamps, bool nt) {
+  size_t s = 0;
+#if defined(__SSE2__)
+  if (nch == 1 || nch == 2 || nch == 4) {
+    uint8_t* out[4];
+    for (size_t c = 0; c < nch; c++) out[c] = static_cast<uint8_t*>(ch_buffs[c]) + dst_samp * 4;
+
+    // Streaming stores need 16-byte alignment: peel samples until channel 0
+    // is aligned; the others must then be too (same-aligned buffers).
+    size_t head = 0;
+    bool aligned = nt;
+    while (head < nsamps && (reinterpret_cast<uintptr_t>(out[0] + head * 4) & 15)) head++;
+    for (size_t c = 1; aligned && c < nch; c++)
+      aligned = (reinterpret_cast<uintptr_t>(out[c] + head * 4) & 15) == 0;
+
+    if (aligned) {
+      for (; s < head; s++)
+        for (size_t c = 0; c < nch; c++) std::memcpy(out[c] + s * 4, src + (s * nch + c) * 4, 4);
+      for (size_t c = 0; c < nch; c++) out[c] += head * 4;
+      s += deinterleave_sse2<true>(out, nch, src + head * nch * 4, nsamps - head);
+    } else if (nch == 1) {
+      std::memcpy(out[0], src, nsamps * 4);
+      return;
+    } else {
+      s = deinterleave_sse2<false>(out, nch, src, nsamps);
+    }
+  }
+#else
+  (void)nt;
+#endif
+  for (; s < nsamps; s++) {
+    for (size_t c = 0; c < nch; c++) {
+      std::memcpy(static_cast<uint8_t*>(ch_buffs[c]) + (dst_samp + s) * 4,
+                  src + (s * nch + c) * 4, 4);
+    }
+  }
+}
+
+} // namespace flexsdr
@@ -0,0 +1,297 @@
+// src/device/polyphase_resampler.cpp
+#include "device/polyphase_resampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace flexsdr {
+
+namespace {
+
+// Modified Bessel function of the first kind, order 0 (series)
+double bessel_i0(double x) {
+  double sum = 1.0, term = 1.0;
+  const double q = x * x / 4.0;
+  for (int k = 1; k < 50; k++) {
+    term *= q / (double(k) * k);
+    sum += term;
+    if (term < sum * 1e-12) break;
+  }
+  return sum;
+}
+
+// Best p/q ~ r with p, q <= max (continued fractions)
+void approx_ratio(double r, unsigned max, unsigned& p, unsigned& q) {
+  uint64_t p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+  double x = r;
+  for (int i = 0; i < 64; i++) {
+    const double a = std::floor(x);
+    const uint64_t p2 = uint64_t(a) * p1 + p0;
+    const uint64_t q2 = uint64_t(a) * q1 + q0;
+    if (p2 > max || q2 > max) break;
+    p0 = p1; q0 = q1; p1 = p2; q1 = q2;
+    if (x - a < 1e-12) break;
+    x = 1.0 / (x - a);
+  }
+  p = unsigned(p1 ? p1 : 1);
+  q = unsigned(q1 ? q1 : 1);
+}
+
+#if !defined(__SSE2__)
+inline uint16_t sat_q15(int64_t v) {
+  v = (v + (1 << 14)) >> 15;
+  return static_cast<uint16_t>(static_cast<int16_t>(std::clamp<int64_t>(v, INT16_MIN, INT16_MAX)));
+}
+#endif
+
+} // namespace
+
+std::unique_ptr<polyphase_resampler> polyphase_resampler::make(const options& opt) {
+  if (!(opt.in_rate > 0.0) || !(opt.out_rate > 0.0) || !opt.num_channels ||
+      !opt.taps_per_phase || !(opt.passband > 0.0 && opt.passband < 1.0) || opt.max_factor < 1) {
+    std::fprintf(stderr, "[resampler] invalid options\n");
+    return nullptr;
+  }
+
+  std::unique_ptr<polyphase_resampler> r(new polyphase_resampler());
+  r->in_rate_ = opt.in_rate;
+  r->nch_ = opt.num_channels;
+
+  // Exact ratio from integer Hz where it fits, else the closest one that does
+  const auto fi = static_cast<uint64_t>(std::llround(opt.in_rate));
+  const auto fo = static_cast<uint64_t>(std::llround(opt.out_rate));
+  uint64_t a = fi, b = fo;
+  while (b) { const uint64_t t = a % b; a = b; b = t; }
+  if (a && fo / a <= opt.max_factor && fi / a <= opt.max_factor) {
+    r->L_ = unsigned(fo / a);
+    r->M_ = unsigned(fi / a);
+  } else {
+    approx_ratio(opt.out_rate / opt.in_rate, opt.max_factor, r->L_, r->M_);
+  }
+  const unsigned L = r->L_, M = r->M_;
+
+  const unsigned K = (opt.taps_per_phase + 7) & ~7u;
+  r->K_ = K;
+
+  // Prototype at the upsampled rate L*fs_in; cutoff below the lower Nyquist
+  const size_t N = size_t(L) * K;
+  const double fc = 0.5 * opt.passband / std::max(L, M);   // cycles/sample at L*fs_in
+  const double mid = (double(N) - 1.0) / 2.0;
+  const double i0b = bessel_i0(opt.kaiser_beta);
+  std::vector<double> h(N);
+  for (size_t n = 0; n < N; n++) {
+    const double t = double(n) - mid;
+    const double sinc = t == 0.0 ? 2.0 * fc : std::sin(2.0 * M_PI * fc * t) / (M_PI * t);
+    const double w = t / (mid > 0 ? mid : 1.0);
+    h[n] = L * sinc * bessel_i0(opt.kaiser_beta * std::sqrt(std::max(0.0, 1.0 - w * w))) / i0b;
+  }
+
+  // Phase p uses h[p + k*L] against x[n-k]; store reversed so that tap j
+  // multiplies window[j] (oldest first).
+  r->taps_.assign(size_t(L) * K, 0);
+  for (unsigned p = 0; p < L; p++) {
+    for (unsigned j = 0; j < K; j++) {
+      const double v = std::round(h[p + size_t(K - 1 - j) * L] * 32768.0);
+      r->taps_[size_t(p) * K + j] = static_cast<int16_t>(std::clamp(v, -32768.0, 32767.0));
+    }
+  }
+
+  r->bi_.resize(r->nch_);
+  r->bq_.resize(r->nch_);
+  r->reset();
+
+  std::fprintf(stderr, "[resampler] %.6f -> %.6f Msps: L=%u M=%u, %u taps/phase, %zu ch\n",
+               opt.in_rate / 1e6, r->out_rate() / 1e6, L, M, K, r->nch_);
+  if (std::fabs(r->out_rate() - opt.out_rate) > 1e-6 * opt.out_rate) {
+    std::fprintf(stderr, "[resampler] WARNING: %.6f Msps requested, ratio capped at %u\n",
+                 opt.out_rate / 1e6, opt.max_factor);
+  }
+  return r;
+}
+
+double polyphase_resampler::delay() const {
+  // Linear-phase prototype: (L*K - 1)/2 at L*fs_in
+  return (double(L_) * K_ - 1.0) / 2.0 / M_;
+}
+
+void polyphase_resampler::reset() {
+  // Prime with K-1 zeros so the first input already yields output
+  for (size_t c = 0; c < nch_; c++) {
+    bi_[c].assign(std::max<size_t>(bi_[c].size(), size_t(K_) * 4), 0);
+    bq_[c].assign(bi_[c].size(), 0);
+  }
+  pos_   = 0;
+  fill_  = K_ - 1;
+  phase_ = 0;
+}
+
+size_t polyphase_resampler::input_needed(size_t nout) const {
+  if (!nout) return 0;
+  // Window of output nout-1 starts at pos_ + (phase_ + (nout-1)*M) / L
+  const size_t last = pos_ + (phase_ + (nout - 1) * size_t(M_)) / L_;
+  const size_t end = last + K_;
+  return end > fill_ ? end - fill_ : 0;
+}
+
+size_t polyphase_resampler::output_for(size_t nin) const {
+  const size_t end = fill_ + nin;
+  if (end < pos_ + K_) return 0;
+  // Outputs m with pos_ + (phase_ + m*M)/L + K <= end
+  const size_t span = end - K_ - pos_;
+  const size_t top = (span + 1) * L_;   // phase_ + m*M < top
+  return top > phase_ ? (top - phase_ - 1) / M_ + 1 : 0;
+}
+
+void polyphase_resampler::compact_() {
+  // Keep the window of the next output; everything before it is spent
+  if (pos_ == 0) return;
+  for (size_t c = 0; c < nch_ && fill_ > pos_; c++) {
+    std::memmove(bi_[c].data(), bi_[c].data() + pos_, (fill_ - pos_) * 2);
+    std::memmove(bq_[c].data(), bq_[c].data() + pos_, (fill_ - pos_) * 2);
+  }
+  fill_ = fill_ > pos_ ? fill_ - pos_ : 0;
+  pos_ = 0;
+}
+
+void polyphase_resampler::push(const void* const* in, size_t nin) {
+  if (!nin) return;
+  compact_();
+  for (size_t c = 0; c < nch_; c++) {
+    if (bi_[c].size() < fill_ + nin) {
+      bi_[c].resize(std::max(fill_ + nin, bi_[c].size() * 2));
+      bq_[c].resize(bi_[c].size());
+    }
+    // Split I and Q once here so the dot products need no shuffles
+    const auto* src = static_cast<const int16_t*>(in[c]);
+    int16_t* di = bi_[c].data() + fill_;
+    int16_t* dq = bq_[c].data() + fill_;
+    size_t s = 0;
+#if defined(__SSE2__)
+    for (; s + 8 <= nin; s += 8) {
+      const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * s));
+      const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * s + 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(di + s),
+                       _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+                                       _mm_srai_epi32(_mm_slli_epi32(b, 16), 16)));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dq + s),
+                       _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16)));
+    }
+#endif
+    for (; s < nin; s++) {
+      di[s] = src[2 * s];
+      dq[s] = src[2 * s + 1];
+    }
+  }
+  fill_ += nin;
+}
+
+// ---------------------------- kernel -----------------------------------------
+
+namespace {
+
+struct walk {
+  size_t   pos;
+  unsigned ph;
+  size_t   adv;    // M = adv*L + rem: no divisions in the loop
+  unsigned rem;
+  unsigned L;
+  void step() {
+    pos += adv;
+    ph  += rem;
+    if (ph >= L) {
+      ph -= L;
+      pos++;
+    }
+  }
+};
+
+#if defined(__SSE2__)
+// Dot products of one output: four partial sums each of I and Q
+inline void dot8(const int16_t* g, const int16_t* xi, const int16_t* xq, unsigned K,
+                 __m128i& ai, __m128i& aq) {
+  ai = _mm_setzero_si128();
+  aq = _mm_setzero_si128();
+  for (unsigned j = 0; j < K; j += 8) {
+    const __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(g + j));
+    ai = _mm_add_epi32(ai, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(xi + j)), t));
+    aq = _mm_add_epi32(aq, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(xq + j)), t));
+  }
+}
+
+// [a0 a1 a2 a3] partial-sum vectors -> [sum(a0) sum(a1) sum(a2) sum(a3)]
+inline __m128i hsum4(__m128i a0, __m128i a1, __m128i a2, __m128i a3) {
+  const __m128i s0 = _mm_add_epi32(_mm_unpacklo_epi32(a0, a1), _mm_unpackhi_epi32(a0, a1));
+  const __m128i s1 = _mm_add_epi32(_mm_unpacklo_epi32(a2, a3), _mm_unpackhi_epi32(a2, a3));
+  return _mm_add_epi32(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+}
+
+inline __m128i q15_round(__m128i v) {
+  return _mm_srai_epi32(_mm_add_epi32(v, _mm_set1_epi32(1 << 14)), 15);
+}
+#endif
+
+// n outputs of one channel; returns the walk state after them
+walk run_channel(const int16_t* taps, unsigned K, const int16_t* bi, const int16_t* bq,
+                 uint32_t* dst, size_t n, walk w) {
+  size_t m = 0;
+#if defined(__SSE2__)
+  // Four outputs per round so the horizontal sums and the store are shared
+  for (; m + 4 <= n; m += 4) {
+    __m128i ai[4], aq[4];
+    for (int k = 0; k < 4; k++, w.step())
+      dot8(taps + size_t(w.ph) * K, bi + w.pos, bq + w.pos, K, ai[k], aq[k]);
+    const __m128i ri = q15_round(hsum4(ai[0], ai[1], ai[2], ai[3]));
+    const __m128i rq = q15_round(hsum4(aq[0], aq[1], aq[2], aq[3]));
+    const __m128i p  = _mm_packs_epi32(ri, rq);                 // I0..I3 Q0..Q3
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + m),
+                     _mm_unpacklo_epi16(p, _mm_srli_si128(p, 8)));
+  }
+  for (; m < n; m++, w.step()) {
+    __m128i ai, aq;
+    dot8(taps + size_t(w.ph) * K, bi + w.pos, bq + w.pos, K, ai, aq);
+    __m128i acc = _mm_add_epi32(_mm_unpacklo_epi32(ai, aq), _mm_unpackhi_epi32(ai, aq));
+    acc = q15_round(_mm_add_epi32(acc, _mm_srli_si128(acc, 8)));   // [I Q . .]
+    dst[m] = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packs_epi32(acc, acc)));
+  }
+#else
+  for (; m < n; m++, w.step()) {
+    const int16_t* g  = taps + size_t(w.ph) * K;
+    const int16_t* xi = bi + w.pos;
+    const int16_t* xq = bq + w.pos;
+    int64_t si = 0, sq = 0;
+    for (unsigned j = 0; j < K; j++) {
+      si += int32_t(xi[j]) * g[j];
+      sq += int32_t(xq[j]) * g[j];
+    }
+    dst[m] = uint32_t(sat_q15(si)) | (uint32_t(sat_q15(sq)) << 16);
+  }
+#endif
+  return w;
+}
+
+} // namespace
+
+size_t polyphase_resampler::pull(void* const* out, size_t max_out) {
+  const size_t n = std::min(max_out, output_for(0));
+  if (!n) return 0;
+
+  // Channel-outer so one channel's planes stay in L1; every channel walks
+  // the same phases.
+  const walk w0{pos_, phase_, M_ / L_, M_ % L_, L_};
+  walk w = w0;
+  for (size_t c = 0; c < nch_; c++) {
+    w = run_channel(taps_.data(), K_, bi_[c].data(), bq_[c].data(),
+                    static_cast<uint32_t*>(out[c]), n, w0);
+  }
+  pos_   = w.pos;
+  phase_ = w.ph;
+  return n;
+}
+
+} // namespace flexsdr
@@ -0,0 +1,174 @@
+// src/device/rx_correction.cpp
+#include "device/rx_correction.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace flexsdr {
+
+namespace {
+
+inline int16_t sat16(float v) {
+  return static_cast<int16_t>(std::lrint(std::clamp(v, -32768.f, 32767.f)));
+}
+
+} // namespace
+
+rx_correction::rx_correction(const options& opt)
+  : rate_(opt.sample_rate > 0.0 ? opt.sample_rate : 1.0),
+    dc_alpha_(std::min(1.0, 2.0 * M_PI * opt.dc_bandwidth_hz / rate_)),
+    ch_(opt.num_channels ? opt.num_channels : 1)
+{
+  if (!(opt.sample_rate > 0.0)) {
+    std::fprintf(stderr, "[rx_correction] WARNING: no sample rate, frequency shifts are in cycles/sample\n");
+  }
+}
+
+template <typename F>
+void rx_correction::update_(size_t ch, F&& f) {
+  if (ch >= ch_.size()) return;
+  std::lock_guard<std::mutex> lk(wr_mtx_);
+  chan& c = ch_[ch];
+  c.seq.fetch_add(1, std::memory_order_acq_rel);       // odd: writing
+  std::atomic_thread_fence(std::memory_order_release);
+  f(c.shared);
+  c.seq.fetch_add(1, std::memory_order_release);       // even: stable
+
+  bool any = false;
+  for (const chan& k : ch_) {
+    any = any || k.shared.active();
+  }
+  enabled_.store(any, std::memory_order_relaxed);
+}
+
+void rx_correction::set_freq_shift(size_t ch, double hz) {
+  update_(ch, [hz](params& p) { p.shift_hz = hz; });
+}
+
+void rx_correction::set_iq_matrix(size_t ch, float a, float b, float c, float d) {
+  update_(ch, [=](params& p) { p.a = a; p.b = b; p.c = c; p.d = d; });
+}
+
+void rx_correction::set_dc_notch(size_t ch, bool on) {
+  update_(ch, [on](params& p) { p.dc = on; });
+}
+
+double rx_correction::freq_shift(size_t ch) const {
+  if (ch >= ch_.size()) return 0.0;
+  std::lock_guard<std::mutex> lk(const_cast<std::mutex&>(wr_mtx_));
+  return ch_[ch].shared.shift_hz;
+}
+
+bool rx_correction::dc_notch(size_t ch) const {
+  if (ch >= ch_.size()) return false;
+  std::lock_guard<std::mutex> lk(const_cast<std::mutex&>(wr_mtx_));
+  return ch_[ch].shared.dc;
+}
+
+void rx_correction::refresh_(chan& c) {
+  const uint32_t s0 = c.seq.load(std::memory_order_acquire);
+  if (s0 == c.seen || (s0 & 1)) return;   // unchanged, or mid-write: next call
+  const params p = c.shared;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (c.seq.load(std::memory_order_relaxed) != s0) return;
+  c.cur    = p;
+  c.seen   = s0;
+  c.active = p.active();
+  if (!p.dc) c.dc_i = c.dc_q = 0.f;
+}
+
+void rx_correction::reset() {
+  for (chan& c : ch_) {
+    c.phase = 0.0;
+    c.dc_i = c.dc_q = 0.f;
+  }
+}
+
+void rx_correction::apply(size_t ch, uint32_t* x, size_t n) {
+  if (ch >= ch_.size() || !n) return;
+  chan& st = ch_[ch];
+  refresh_(st);
+  if (!st.active) return;
+
+  const params& p = st.cur;
+  const float dci = p.dc ? st.dc_i : 0.f;
+  const float dcq = p.dc ? st.dc_q : 0.f;
+  const double f = p.shift_hz / rate_;                  // cycles per sample
+  double sum_i = 0.0, sum_q = 0.0;
+  size_t s = 0;
+
+#if defined(__SSE2__)
+  // Lane k starts at phase + k*f and steps by 4f
+  float cr[4], ci[4];
+  for (int k = 0; k < 4; k++) {
+    const double ph = 2.0 * M_PI * (st.phase + k * f);
+    cr[k] = static_cast<float>(std::cos(ph));
+    ci[k] = static_cast<float>(std::sin(ph));
+  }
+  __m128 rr = _mm_loadu_ps(cr), ri = _mm_loadu_ps(ci);
+  const __m128 wr = _mm_set1_ps(static_cast<float>(std::cos(2.0 * M_PI * 4.0 * f)));
+  const __m128 wi = _mm_set1_ps(static_cast<float>(std::sin(2.0 * M_PI * 4.0 * f)));
+  const __m128 va = _mm_set1_ps(p.a), vb = _mm_set1_ps(p.b);
+  const __m128 vc = _mm_set1_ps(p.c), vd = _mm_set1_ps(p.d);
+  const __m128 vdi = _mm_set1_ps(dci), vdq = _mm_set1_ps(dcq);
+  __m128 acc_i = _mm_setzero_ps(), acc_q = _mm_setzero_ps();
+
+  for (; s + 4 <= n; s += 4) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + s));
+    const __m128 i0 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(v, 16), 16));
+    const __m128 q0 = _mm_cvtepi32_ps(_mm_srai_epi32(v, 16));
+    acc_i = _mm_add_ps(acc_i, i0);
+    acc_q = _mm_add_ps(acc_q, q0);
+
+    const __m128 i1 = _mm_sub_ps(i0, vdi);
+    const __m128 q1 = _mm_sub_ps(q0, vdq);
+    const __m128 i2 = _mm_add_ps(_mm_mul_ps(va, i1), _mm_mul_ps(vb, q1));
+    const __m128 q2 = _mm_add_ps(_mm_mul_ps(vc, i1), _mm_mul_ps(vd, q1));
+    const __m128 yr = _mm_sub_ps(_mm_mul_ps(i2, rr), _mm_mul_ps(q2, ri));
+    const __m128 yi = _mm_add_ps(_mm_mul_ps(i2, ri), _mm_mul_ps(q2, rr));
+
+    const __m128 nr = _mm_sub_ps(_mm_mul_ps(rr, wr), _mm_mul_ps(ri, wi));
+    ri = _mm_add_ps(_mm_mul_ps(rr, wi), _mm_mul_ps(ri, wr));
+    rr = nr;
+
+    // Round, saturate, back to [I Q] pairs
+    const __m128i pk = _mm_packs_epi32(_mm_cvtps_epi32(yr), _mm_cvtps_epi32(yi));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(x + s), _mm_unpacklo_epi16(pk, _mm_srli_si128(pk, 8)));
+  }
+  float li[4], lq[4];
+  _mm_storeu_ps(li, acc_i);
+  _mm_storeu_ps(lq, acc_q);
+  sum_i = double(li[0]) + li[1] + li[2] + li[3];
+  sum_q = double(lq[0]) + lq[1] + lq[2] + lq[3];
+#endif
+
+  for (; s < n; s++) {
+    const float i0 = static_cast<int16_t>(x[s] & 0xffff);
+    const float q0 = static_cast<int16_t>(x[s] >> 16);
+    sum_i += i0;
+    sum_q += q0;
+    const float i1 = i0 - dci, q1 = q0 - dcq;
+    const float i2 = p.a * i1 + p.b * q1;
+    const float q2 = p.c * i1 + p.d * q1;
+    const double ph = 2.0 * M_PI * (st.phase + s * f);
+    const float c = static_cast<float>(std::cos(ph)), sn = static_cast<float>(std::sin(ph));
+    x[s] = uint32_t(uint16_t(sat16(i2 * c - q2 * sn))) |
+           (uint32_t(uint16_t(sat16(i2 * sn + q2 * c))) << 16);
+  }
+
+  st.phase += n * f;
+  st.phase -= std::floor(st.phase);
+  if (p.dc) {
+    // n single-pole steps toward the packet mean
+    const float k = static_cast<float>(-std::expm1(n * std::log1p(-dc_alpha_)));
+    st.dc_i += k * (static_cast<float>(sum_i / n) - st.dc_i);
+    st.dc_q += k * (static_cast<float>(sum_q / n) - st.dc_q);
+  }
+}
+
+} // namespace flexsdr
@@ -0,0 +1,274 @@
+// src/device/rx_ingress.cpp
+#include "device/rx_ingress.hpp"
+#include "transport/pkt_header.hpp"
+#include "transport/shm_control.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+
+extern "C" {
+#include <rte_lcore.h>
+#include <rte_malloc.h>
+#include <rte_mbuf.h>
+#include <rte_pause.h>
+#include <rte_prefetch.h>
+#include <rte_ring.h>
+}
+
+namespace flexsdr {
+
+namespace {
+constexpr unsigned kMaxBurst = 64;
+
+size_t round_up_pow2(size_t v) {
+  size_t p = 1;
+  while (p < v) p <<= 1;
+  return p;
+}
+} // namespace
+
+RxIngress::RxIngress(const options& opt) : opt_(opt) {}
+
+RxIngress::~RxIngress() {
+  stop();
+  if (mem_) rte_free(mem_);
+}
+
+int RxIngress::start() {
+  if (running()) return 0;
+  if (!opt_.ring) {
+    std::fprintf(stderr, "[rx_ingress] ERROR: no ring\n");
+    return -1;
+  }
+  if (opt_.num_channels == 0 || opt_.num_channels > MAX_CHANS) {
+    std::fprintf(stderr, "[rx_ingress] ERROR: num_channels=%zu (max %zu)\n",
+                 opt_.num_channels, MAX_CHANS);
+    return -1;
+  }
+
+  // 16 sc16 samples = one cache line, so every channel plane stays aligned
+  opt_.block_samps = std::max<size_t>(16, (opt_.block_samps + 15) & ~size_t(15));
+  opt_.num_blocks  = round_up_pow2(std::max<size_t>(2, opt_.num_blocks));
+  opt_.burst       = std::min(std::max(opt_.burst, 1u), kMaxBurst);
+
+  chan_stride_  = opt_.block_samps * 4;
+  block_stride_ = hdr_bytes_ + opt_.num_channels * chan_stride_;
+  mask_         = opt_.num_blocks - 1;
+
+  // FIFO next to the CPU that fills it, unless told otherwise
+  if (opt_.socket_id < 0 && opt_.lcore >= 0 &&
+      rte_lcore_is_enabled(static_cast<unsigned>(opt_.lcore))) {
+    opt_.socket_id = rte_lcore_to_socket_id(static_cast<unsigned>(opt_.lcore));
+  }
+
+  if (!mem_) {
+    mem_ = static_cast<uint8_t*>(rte_zmalloc_socket("flexsdr_rx_ingress",
+                                                    opt_.num_blocks * block_stride_,
+                                                    RTE_CACHE_LINE_SIZE, opt_.socket_id));
+    if (!mem_) {
+      std::fprintf(stderr, "[rx_ingress] ERROR: rte_zmalloc_socket(%zu bytes, socket %d) failed\n",
+                   opt_.num_blocks * block_stride_, opt_.socket_id);
+      return -2;
+    }
+  }
+
+  head_.store(0, std::memory_order_relaxed);
+  tail_.store(0, std::memory_order_relaxed);
+  cur_ = nullptr;
+  have_tsf_ = false;
+  pend_flags_ = 0;
+
+  stop_req_.store(false, std::memory_order_relaxed);
+  running_.store(true, std::memory_order_release);
+  worker_ = std::thread(&RxIngress::run_, this);
+
+  if (opt_.lcore >= 0) {
+    // An EAL lcore maps to its CPU; anything else is taken as a CPU id
+    int cpu = opt_.lcore;
+    if (rte_lcore_is_enabled(static_cast<unsigned>(opt_.lcore))) {
+      cpu = rte_lcore_to_cpu_id(opt_.lcore);
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(worker_.native_handle(), sizeof(set), &set) != 0) {
+      std::fprintf(stderr, "[rx_ingress] WARNING: could not pin ingress thread to cpu %d\n", cpu);
+    }
+  }
+
+  std::fprintf(stderr, "[rx_ingress] started: ring=%s ch=%zu blocks=%zux%zu samps (%zu KiB) lcore=%d\n",
+               opt_.ring->name, opt_.num_channels, opt_.num_blocks, opt_.block_samps,
+               opt_.num_blocks * block_stride_ / 1024, opt_.lcore);
+  return 0;
+}
+
+void RxIngress::stop() {
+  stop_req_.store(true, std::memory_order_release);
+  if (worker_.joinable()) worker_.join();
+  running_.store(false, std::memory_order_release);
+}
+
+RxIngress::stats RxIngress::get_stats() const {
+  return stats{
+    packets_.load(std::memory_order_relaxed),
+    samples_.load(std::memory_order_relaxed),
+    blocks_.load(std::memory_order_relaxed),
+    fifo_full_drops_.load(std::memory_order_relaxed),
+    gaps_.load(std::memory_order_relaxed),
+  };
+}
+
+// --------------------------- producer (worker) --------------------------------
+
+bool RxIngress::open_block_() {
+  const uint64_t h = head_.load(std::memory_order_relaxed);
+  if (h - tail_.load(std::memory_order_acquire) > mask_) return false;
+  cur_ = slot_(h);
+  cur_->nsamps = 0;
+  return true;
+}
+
+void RxIngress::publish_() {
+  blocks_.fetch_add(1, std::memory_order_relaxed);
+  head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  cur_ = nullptr;
+}
+
+void RxIngress::run_() {
+  rte_mbuf* pkts[kMaxBurst];
+  const size_t nch   = opt_.num_channels;
+  const size_t frame = nch * 4;
+  const size_t hdr   = opt_.vrt_hdr_bytes;
+
+  while (!stop_req_.load(std::memory_order_acquire)) {
+    if (opt_.link && !opt_.link->up()) {
+      // Primary gone: flush what we have and leave its ring alone
+      if (cur_ && cur_->nsamps) publish_();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      continue;
+    }
+    const unsigned n = rte_ring_dequeue_burst(opt_.ring, reinterpret_cast<void**>(pkts),
+                                              opt_.burst, nullptr);
+    if (n == 0) {
+      // Ring dry: hand over what we have instead of waiting for a full block
+      if (cur_ && cur_->nsamps) publish_();
+      rte_pause();
+      continue;
+    }
+
+    for (unsigned i = 0; i < n; i++) {
+      rte_mbuf* m = pkts[i];
+      if (i + 1 < n) rte_prefetch0(rte_pktmbuf_mtod(pkts[i + 1], void*));
+      packets_.fetch_add(1, std::memory_order_relaxed);
+      if (opt_.counters) {
+        shm_queue_counters::add(opt_.counters->cons.pkts, 1);
+        shm_queue_counters::add(opt_.counters->cons.bytes, m->data_len);
+      }
+
+      if (m->data_len <= hdr) {
+        rte_pktmbuf_free(m);
+        continue;
+      }
+      const uint8_t* base = rte_pktmbuf_mtod(m, const uint8_t*);
+
+      uint16_t pflags = 0;
+      uint16_t cmd_seq = 0;
+      if (hdr >= sizeof(pkt_header)) {
+        const auto* ph = reinterpret_cast<const pkt_header*>(base);
+        pflags = ph->flags;
+        cmd_seq = ph->cmd_seq;
+      }
+      uint64_t tsf = 0;
+      if (opt_.parse_tsf && m->data_len >= opt_.tsf_offset + sizeof(uint64_t)) {
+        std::memcpy(&tsf, base + opt_.tsf_offset, sizeof(tsf));
+      }
+
+      // Close the open block at a TSF jump or a timed-command boundary
+      const bool gap = opt_.parse_tsf && have_tsf_ && tsf != next_tsf_;
+      const bool boundary = (pflags & PKT_F_CMD_BOUNDARY) != 0;
+      if ((gap || boundary) && cur_ && cur_->nsamps) publish_();
+      if (gap) {
+        gaps_.fetch_add(1, std::memory_order_relaxed);
+        pend_flags_ |= BLK_F_GAP;
+      }
+      if (boundary) {
+        pend_flags_ |= BLK_F_BOUNDARY;
+        pend_seq_ = cmd_seq;
+      }
+
+      const size_t samps = (m->data_len - hdr) / frame;
+      const uint8_t* src = base + hdr;
+      size_t s = 0;
+      bool dropped = false;
+      while (s < samps) {
+        if (!cur_ && !open_block_()) {
+          // Consumer is behind: drop here, keep the ring drained
+          fifo_full_drops_.fetch_add(1, std::memory_order_relaxed);
+          if (opt_.counters) shm_queue_counters::add(opt_.counters->cons.drops, 1);
+          pend_flags_ |= BLK_F_OVERFLOW;
+          dropped = true;
+          break;
+        }
+        if (cur_->nsamps == 0) {
+          cur_->tsf = tsf + s;
+          cur_->flags = pend_flags_;
+          cur_->cmd_seq = pend_seq_;
+          pend_flags_ = 0;
+        }
+
+        const size_t take = std::min(samps - s, opt_.block_samps - cur_->nsamps);
+        uint8_t* plane = reinterpret_cast<uint8_t*>(cur_) + hdr_bytes_ + cur_->nsamps * 4;
+        if (nch == 1) {
+          std::memcpy(plane, src + s * 4, take * 4);
+        } else {
+          for (size_t ch = 0; ch < nch; ch++) {
+            uint8_t* dst = plane + ch * chan_stride_;
+            const uint8_t* p = src + s * frame + ch * 4;
+            for (size_t k = 0; k < take; k++) std::memcpy(dst + k * 4, p + k * frame, 4);
+          }
+        }
+        cur_->nsamps += static_cast<uint32_t>(take);
+        s += take;
+        if (cur_->nsamps == opt_.block_samps) publish_();
+      }
+
+      samples_.fetch_add(s, std::memory_order_relaxed);
+      next_tsf_ = tsf + samps;
+      have_tsf_ = !dropped;
+      rte_pktmbuf_free(m);
+    }
+  }
+
+  if (cur_ && cur_->nsamps) publish_();
+}
+
+// --------------------------- consumer -------------------------------------
+
+const RxIngress::block* RxIngress::acquire(double timeout) {
+  const uint64_t t = tail_.load(std::memory_order_relaxed);
+  if (head_.load(std::memory_order_acquire) != t) return slot_(t);
+
+  const auto deadline = std::chrono::steady_clock::now() +
+      std::chrono::microseconds(static_cast<int64_t>(timeout * 1e6));
+  uint64_t spins = 0;
+  while (head_.load(std::memory_order_acquire) == t) {
+    if (!running()) return nullptr;
+    if (++spins % 1000 == 0 && std::chrono::steady_clock::now() >= deadline) return nullptr;
+    if (spins > 1000) {
+      std::this_thread::sleep_for(std::chrono::microseconds(1));
+    } else {
+      rte_pause();
+    }
+  }
+  return slot_(t);
+}
+
+void RxIngress::release() {
+  tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+} // namespace flexsdr
@@ -6,15 +6,19 @@
 #include "flexsdr.grpc.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/channel_interface.h>
-#include <grpcpp/impl/codegen/client_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/method_handler_impl.h>
-#include <grpcpp/impl/codegen/rpc_service_method.h>
-#include <grpcpp/impl/codegen/service_type.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 namespace flexsdr {
 
 static const char* FlexSDRControl_method_names[] = {
@@ -33,348 +37,563 @@ static const char* FlexSDRControl_method_names[] = {
   "/flexsdr.FlexSDRControl/GetRxFreq",
   "/flexsdr.FlexSDRControl/SetTxFreq",
   "/flexsdr.FlexSDRControl/GetTxFreq",
+  "/flexsdr.FlexSDRControl/ApplySettings",
 };
 
 std::unique_ptr< FlexSDRControl::Stub> FlexSDRControl::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
   (void)options;
-  std::unique_ptr< FlexSDRControl::Stub> stub(new FlexSDRControl::Stub(channel));
+  std::unique_ptr< FlexSDRControl::Stub> stub(new FlexSDRControl::Stub(channel, options));
   return stub;
 }
 
-FlexSDRControl::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
-  : channel_(channel), rpcmethod_GetDeviceInfo_(FlexSDRControl_method_names[0], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetClockRate_(FlexSDRControl_method_names[1], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetClockRate_(FlexSDRControl_method_names[2], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetRxGain_(FlexSDRControl_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetRxGain_(FlexSDRControl_method_names[4], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetTxGain_(FlexSDRControl_method_names[5], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetTxGain_(FlexSDRControl_method_names[6], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetRxRate_(FlexSDRControl_method_names[7], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetRxRate_(FlexSDRControl_method_names[8], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetTxRate_(FlexSDRControl_method_names[9], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetTxRate_(FlexSDRControl_method_names[10], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetRxFreq_(FlexSDRControl_method_names[11], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetRxFreq_(FlexSDRControl_method_names[12], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetTxFreq_(FlexSDRControl_method_names[13], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetTxFreq_(FlexSDRControl_method_names[14], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+FlexSDRControl::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_GetDeviceInfo_(FlexSDRControl_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetClockRate_(FlexSDRControl_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetClockRate_(FlexSDRControl_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetRxGain_(FlexSDRControl_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetRxGain_(FlexSDRControl_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetTxGain_(FlexSDRControl_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetTxGain_(FlexSDRControl_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetRxRate_(FlexSDRControl_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetRxRate_(FlexSDRControl_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetTxRate_(FlexSDRControl_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetTxRate_(FlexSDRControl_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetRxFreq_(FlexSDRControl_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetRxFreq_(FlexSDRControl_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetTxFreq_(FlexSDRControl_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetTxFreq_(FlexSDRControl_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ApplySettings_(FlexSDRControl_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status FlexSDRControl::Stub::GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::flexsdr::DeviceInfoResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetDeviceInfo_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetDeviceInfo_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetDeviceInfo_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetDeviceInfo_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::DeviceInfoResponse>* FlexSDRControl::Stub::AsyncGetDeviceInfoRaw(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::DeviceInfoResponse>::Create(channel_.get(), cq, rpcmethod_GetDeviceInfo_, context, request, true);
+void FlexSDRControl::Stub::async::GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetDeviceInfo_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::DeviceInfoResponse>* FlexSDRControl::Stub::PrepareAsyncGetDeviceInfoRaw(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::DeviceInfoResponse>::Create(channel_.get(), cq, rpcmethod_GetDeviceInfo_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::DeviceInfoResponse, ::flexsdr::DeviceInfoRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetDeviceInfo_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::DeviceInfoResponse>* FlexSDRControl::Stub::AsyncGetDeviceInfoRaw(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetDeviceInfoRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::SetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::flexsdr::ClockRateResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetClockRate_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetClockRate_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::SetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetClockRate_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::SetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetClockRate_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::ClockRateResponseParams>* FlexSDRControl::Stub::AsyncSetClockRateRaw(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::ClockRateResponseParams>::Create(channel_.get(), cq, rpcmethod_SetClockRate_, context, request, true);
+void FlexSDRControl::Stub::async::SetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetClockRate_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::ClockRateResponseParams>* FlexSDRControl::Stub::PrepareAsyncSetClockRateRaw(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::ClockRateResponseParams>::Create(channel_.get(), cq, rpcmethod_SetClockRate_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::ClockRateResponseParams, ::flexsdr::ClockRateRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetClockRate_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::ClockRateResponseParams>* FlexSDRControl::Stub::AsyncSetClockRateRaw(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetClockRateRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::GetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::flexsdr::ClockRateResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetClockRate_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetClockRate_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::GetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetClockRate_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::GetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetClockRate_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::ClockRateResponseParams>* FlexSDRControl::Stub::AsyncGetClockRateRaw(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::ClockRateResponseParams>::Create(channel_.get(), cq, rpcmethod_GetClockRate_, context, request, true);
+void FlexSDRControl::Stub::async::GetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetClockRate_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::ClockRateResponseParams>* FlexSDRControl::Stub::PrepareAsyncGetClockRateRaw(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::ClockRateResponseParams>::Create(channel_.get(), cq, rpcmethod_GetClockRate_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::ClockRateResponseParams, ::flexsdr::ClockRateRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetClockRate_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::ClockRateResponseParams>* FlexSDRControl::Stub::AsyncGetClockRateRaw(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetClockRateRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::SetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::flexsdr::GainResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetRxGain_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetRxGain_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::SetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetRxGain_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::SetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetRxGain_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::AsyncSetRxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::GainResponseParams>::Create(channel_.get(), cq, rpcmethod_SetRxGain_, context, request, true);
+void FlexSDRControl::Stub::async::SetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetRxGain_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::PrepareAsyncSetRxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::GainResponseParams>::Create(channel_.get(), cq, rpcmethod_SetRxGain_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::GainResponseParams, ::flexsdr::GainRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetRxGain_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::AsyncSetRxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetRxGainRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::GetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::flexsdr::GainResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetRxGain_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetRxGain_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::GetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetRxGain_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::GetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetRxGain_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::AsyncGetRxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::GainResponseParams>::Create(channel_.get(), cq, rpcmethod_GetRxGain_, context, request, true);
+void FlexSDRControl::Stub::async::GetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetRxGain_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::PrepareAsyncGetRxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::GainResponseParams>::Create(channel_.get(), cq, rpcmethod_GetRxGain_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::GainResponseParams, ::flexsdr::GainRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetRxGain_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::AsyncGetRxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetRxGainRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::SetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::flexsdr::GainResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetTxGain_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetTxGain_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::SetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetTxGain_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::SetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTxGain_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::AsyncSetTxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::GainResponseParams>::Create(channel_.get(), cq, rpcmethod_SetTxGain_, context, request, true);
+void FlexSDRControl::Stub::async::SetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTxGain_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::PrepareAsyncSetTxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::GainResponseParams>::Create(channel_.get(), cq, rpcmethod_SetTxGain_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::GainResponseParams, ::flexsdr::GainRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetTxGain_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::AsyncSetTxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetTxGainRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::GetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::flexsdr::GainResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetTxGain_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetTxGain_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::GetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetTxGain_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::GetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetTxGain_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::AsyncGetTxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::GainResponseParams>::Create(channel_.get(), cq, rpcmethod_GetTxGain_, context, request, true);
+void FlexSDRControl::Stub::async::GetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetTxGain_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::PrepareAsyncGetTxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::GainResponseParams>::Create(channel_.get(), cq, rpcmethod_GetTxGain_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::GainResponseParams, ::flexsdr::GainRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetTxGain_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::GainResponseParams>* FlexSDRControl::Stub::AsyncGetTxGainRaw(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetTxGainRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::SetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::flexsdr::RateResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetRxRate_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetRxRate_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::SetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetRxRate_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::SetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetRxRate_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::AsyncSetRxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::RateResponseParams>::Create(channel_.get(), cq, rpcmethod_SetRxRate_, context, request, true);
+void FlexSDRControl::Stub::async::SetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetRxRate_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::PrepareAsyncSetRxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::RateResponseParams>::Create(channel_.get(), cq, rpcmethod_SetRxRate_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::RateResponseParams, ::flexsdr::RateRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetRxRate_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::AsyncSetRxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetRxRateRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::GetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::flexsdr::RateResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetRxRate_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetRxRate_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::GetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetRxRate_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::GetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetRxRate_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::AsyncGetRxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::RateResponseParams>::Create(channel_.get(), cq, rpcmethod_GetRxRate_, context, request, true);
+void FlexSDRControl::Stub::async::GetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetRxRate_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::PrepareAsyncGetRxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::RateResponseParams>::Create(channel_.get(), cq, rpcmethod_GetRxRate_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::RateResponseParams, ::flexsdr::RateRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetRxRate_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::AsyncGetRxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetRxRateRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::SetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::flexsdr::RateResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetTxRate_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetTxRate_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::SetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetTxRate_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::SetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTxRate_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::AsyncSetTxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::RateResponseParams>::Create(channel_.get(), cq, rpcmethod_SetTxRate_, context, request, true);
+void FlexSDRControl::Stub::async::SetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTxRate_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::PrepareAsyncSetTxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::RateResponseParams>::Create(channel_.get(), cq, rpcmethod_SetTxRate_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::RateResponseParams, ::flexsdr::RateRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetTxRate_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::AsyncSetTxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetTxRateRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::GetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::flexsdr::RateResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetTxRate_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetTxRate_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::GetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetTxRate_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::GetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetTxRate_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::AsyncGetTxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::RateResponseParams>::Create(channel_.get(), cq, rpcmethod_GetTxRate_, context, request, true);
+void FlexSDRControl::Stub::async::GetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetTxRate_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::PrepareAsyncGetTxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::RateResponseParams>::Create(channel_.get(), cq, rpcmethod_GetTxRate_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::RateResponseParams, ::flexsdr::RateRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetTxRate_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::RateResponseParams>* FlexSDRControl::Stub::AsyncGetTxRateRaw(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetTxRateRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::SetRxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::flexsdr::FrequencyResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetRxFreq_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetRxFreq_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::SetRxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetRxFreq_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::SetRxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetRxFreq_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyResponseParams>* FlexSDRControl::Stub::AsyncSetRxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::FrequencyResponseParams>::Create(channel_.get(), cq, rpcmethod_SetRxFreq_, context, request, true);
+void FlexSDRControl::Stub::async::SetRxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetRxFreq_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyResponseParams>* FlexSDRControl::Stub::PrepareAsyncSetRxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::FrequencyResponseParams>::Create(channel_.get(), cq, rpcmethod_SetRxFreq_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::FrequencyResponseParams, ::flexsdr::FrequencyRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetRxFreq_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyResponseParams>* FlexSDRControl::Stub::AsyncSetRxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetRxFreqRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::GetRxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::flexsdr::FrequencyValue* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetRxFreq_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetRxFreq_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::GetRxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetRxFreq_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::GetRxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetRxFreq_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>* FlexSDRControl::Stub::AsyncGetRxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::FrequencyValue>::Create(channel_.get(), cq, rpcmethod_GetRxFreq_, context, request, true);
+void FlexSDRControl::Stub::async::GetRxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetRxFreq_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>* FlexSDRControl::Stub::PrepareAsyncGetRxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::FrequencyValue>::Create(channel_.get(), cq, rpcmethod_GetRxFreq_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::FrequencyValue, ::flexsdr::ChannelRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetRxFreq_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>* FlexSDRControl::Stub::AsyncGetRxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetRxFreqRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::SetTxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::flexsdr::FrequencyResponseParams* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetTxFreq_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetTxFreq_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::SetTxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetTxFreq_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::SetTxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTxFreq_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyResponseParams>* FlexSDRControl::Stub::AsyncSetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::FrequencyResponseParams>::Create(channel_.get(), cq, rpcmethod_SetTxFreq_, context, request, true);
+void FlexSDRControl::Stub::async::SetTxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTxFreq_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyResponseParams>* FlexSDRControl::Stub::PrepareAsyncSetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::FrequencyResponseParams>::Create(channel_.get(), cq, rpcmethod_SetTxFreq_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::FrequencyResponseParams, ::flexsdr::FrequencyRequestParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetTxFreq_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyResponseParams>* FlexSDRControl::Stub::AsyncSetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetTxFreqRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status FlexSDRControl::Stub::GetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::flexsdr::FrequencyValue* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetTxFreq_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetTxFreq_, context, request, response);
 }
 
-void FlexSDRControl::Stub::experimental_async::GetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, std::function<void(::grpc::Status)> f) {
-  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetTxFreq_, context, request, response, std::move(f));
+void FlexSDRControl::Stub::async::GetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetTxFreq_, context, request, response, std::move(f));
 }
 
-::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>* FlexSDRControl::Stub::AsyncGetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::FrequencyValue>::Create(channel_.get(), cq, rpcmethod_GetTxFreq_, context, request, true);
+void FlexSDRControl::Stub::async::GetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetTxFreq_, context, request, response, reactor);
 }
 
 ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>* FlexSDRControl::Stub::PrepareAsyncGetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::flexsdr::FrequencyValue>::Create(channel_.get(), cq, rpcmethod_GetTxFreq_, context, request, false);
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::FrequencyValue, ::flexsdr::ChannelRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetTxFreq_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>* FlexSDRControl::Stub::AsyncGetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetTxFreqRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status FlexSDRControl::Stub::ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::flexsdr::ApplySettingsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::flexsdr::ApplySettingsRequest, ::flexsdr::ApplySettingsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ApplySettings_, context, request, response);
+}
+
+void FlexSDRControl::Stub::async::ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::flexsdr::ApplySettingsRequest, ::flexsdr::ApplySettingsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ApplySettings_, context, request, response, std::move(f));
+}
+
+void FlexSDRControl::Stub::async::ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ApplySettings_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::ApplySettingsResponse>* FlexSDRControl::Stub::PrepareAsyncApplySettingsRaw(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::flexsdr::ApplySettingsResponse, ::flexsdr::ApplySettingsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ApplySettings_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::flexsdr::ApplySettingsResponse>* FlexSDRControl::Stub::AsyncApplySettingsRaw(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncApplySettingsRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 FlexSDRControl::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[0],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse>(
-          std::mem_fn(&FlexSDRControl::Service::GetDeviceInfo), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::DeviceInfoRequest* req,
+             ::flexsdr::DeviceInfoResponse* resp) {
+               return service->GetDeviceInfo(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[1],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::SetClockRate), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::ClockRateRequestParams* req,
+             ::flexsdr::ClockRateResponseParams* resp) {
+               return service->SetClockRate(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[2],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::GetClockRate), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::ClockRateRequestParams* req,
+             ::flexsdr::ClockRateResponseParams* resp) {
+               return service->GetClockRate(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[3],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::SetRxGain), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::GainRequestParams* req,
+             ::flexsdr::GainResponseParams* resp) {
+               return service->SetRxGain(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[4],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::GetRxGain), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::GainRequestParams* req,
+             ::flexsdr::GainResponseParams* resp) {
+               return service->GetRxGain(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[5],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::SetTxGain), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::GainRequestParams* req,
+             ::flexsdr::GainResponseParams* resp) {
+               return service->SetTxGain(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[6],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::GetTxGain), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::GainRequestParams* req,
+             ::flexsdr::GainResponseParams* resp) {
+               return service->GetTxGain(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[7],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::SetRxRate), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::RateRequestParams* req,
+             ::flexsdr::RateResponseParams* resp) {
+               return service->SetRxRate(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[8],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::GetRxRate), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::RateRequestParams* req,
+             ::flexsdr::RateResponseParams* resp) {
+               return service->GetRxRate(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::SetTxRate), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::RateRequestParams* req,
+             ::flexsdr::RateResponseParams* resp) {
+               return service->SetTxRate(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[10],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::GetTxRate), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::RateRequestParams* req,
+             ::flexsdr::RateResponseParams* resp) {
+               return service->GetTxRate(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[11],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::SetRxFreq), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::FrequencyRequestParams* req,
+             ::flexsdr::FrequencyResponseParams* resp) {
+               return service->SetRxFreq(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[12],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>(
-          std::mem_fn(&FlexSDRControl::Service::GetRxFreq), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::ChannelRequest* req,
+             ::flexsdr::FrequencyValue* resp) {
+               return service->GetRxFreq(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[13],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>(
-          std::mem_fn(&FlexSDRControl::Service::SetTxFreq), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::FrequencyRequestParams* req,
+             ::flexsdr::FrequencyResponseParams* resp) {
+               return service->SetTxFreq(ctx, req, resp);
+             }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FlexSDRControl_method_names[14],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>(
-          std::mem_fn(&FlexSDRControl::Service::GetTxFreq), this)));
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::ChannelRequest* req,
+             ::flexsdr::FrequencyValue* resp) {
+               return service->GetTxFreq(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FlexSDRControl_method_names[15],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FlexSDRControl::Service, ::flexsdr::ApplySettingsRequest, ::flexsdr::ApplySettingsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FlexSDRControl::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::flexsdr::ApplySettingsRequest* req,
+             ::flexsdr::ApplySettingsResponse* resp) {
+               return service->ApplySettings(ctx, req, resp);
+             }, this)));
 }
 
 FlexSDRControl::Service::~Service() {
@@ -485,6 +704,13 @@ FlexSDRControl::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status FlexSDRControl::Service::ApplySettings(::grpc::ServerContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace flexsdr
 
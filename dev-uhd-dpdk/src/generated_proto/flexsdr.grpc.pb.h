@@ -7,23 +7,23 @@
 #include "flexsdr.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_generic_service.h>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/method_handler_impl.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
-#include <grpcpp/impl/codegen/rpc_method.h>
-#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
 #include <grpcpp/impl/codegen/status.h>
-#include <grpcpp/impl/codegen/stub_options.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
-
-namespace grpc {
-class CompletionQueue;
-class Channel;
-class ServerCompletionQueue;
-class ServerContext;
-}  // namespace grpc
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace flexsdr {
 
@@ -144,31 +144,59 @@ class FlexSDRControl final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::FrequencyValue>> PrepareAsyncGetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::FrequencyValue>>(PrepareAsyncGetTxFreqRaw(context, request, cq));
     }
-    class experimental_async_interface {
+    // Batch: many parameter changes in one round trip
+    virtual ::grpc::Status ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::flexsdr::ApplySettingsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::ApplySettingsResponse>> AsyncApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::ApplySettingsResponse>>(AsyncApplySettingsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::ApplySettingsResponse>> PrepareAsyncApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::ApplySettingsResponse>>(PrepareAsyncApplySettingsRaw(context, request, cq));
+    }
+    class async_interface {
      public:
-      virtual ~experimental_async_interface() {}
+      virtual ~async_interface() {}
       // Device status
       virtual void GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // Clock rate
       virtual void SetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // Gain control methods
       virtual void SetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // Frequency control methods
       virtual void SetRxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetRxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetRxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetRxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SetTxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetTxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Batch: many parameter changes in one round trip
+      virtual void ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
-    virtual class experimental_async_interface* experimental_async() { return nullptr; }
-  private:
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::DeviceInfoResponse>* AsyncGetDeviceInfoRaw(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::DeviceInfoResponse>* PrepareAsyncGetDeviceInfoRaw(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::ClockRateResponseParams>* AsyncSetClockRateRaw(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::grpc::CompletionQueue* cq) = 0;
@@ -199,10 +227,12 @@ class FlexSDRControl final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::FrequencyResponseParams>* PrepareAsyncSetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::FrequencyValue>* AsyncGetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::FrequencyValue>* PrepareAsyncGetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::ApplySettingsResponse>* AsyncApplySettingsRaw(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::flexsdr::ApplySettingsResponse>* PrepareAsyncApplySettingsRaw(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel);
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
     ::grpc::Status GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::flexsdr::DeviceInfoResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::flexsdr::DeviceInfoResponse>> AsyncGetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::flexsdr::DeviceInfoResponse>>(AsyncGetDeviceInfoRaw(context, request, cq));
@@ -308,35 +338,59 @@ class FlexSDRControl final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>> PrepareAsyncGetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>>(PrepareAsyncGetTxFreqRaw(context, request, cq));
     }
-    class experimental_async final :
-      public StubInterface::experimental_async_interface {
+    ::grpc::Status ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::flexsdr::ApplySettingsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::flexsdr::ApplySettingsResponse>> AsyncApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::flexsdr::ApplySettingsResponse>>(AsyncApplySettingsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::flexsdr::ApplySettingsResponse>> PrepareAsyncApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::flexsdr::ApplySettingsResponse>>(PrepareAsyncApplySettingsRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
      public:
       void GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetDeviceInfo(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void SetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void GetClockRate(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void SetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void GetRxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void SetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void GetTxGain(::grpc::ClientContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void SetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void GetRxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void SetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void GetTxRate(::grpc::ClientContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetRxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void SetRxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetRxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, std::function<void(::grpc::Status)>) override;
+      void GetRxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetTxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, std::function<void(::grpc::Status)>) override;
+      void SetTxFreq(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, std::function<void(::grpc::Status)>) override;
+      void GetTxFreq(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response, std::function<void(::grpc::Status)>) override;
+      void ApplySettings(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
-      explicit experimental_async(Stub* stub): stub_(stub) { }
+      explicit async(Stub* stub): stub_(stub) { }
       Stub* stub() { return stub_; }
       Stub* stub_;
     };
-    class experimental_async_interface* experimental_async() override { return &async_stub_; }
+    class async* async() override { return &async_stub_; }
 
    private:
     std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class experimental_async async_stub_{this};
+    class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::flexsdr::DeviceInfoResponse>* AsyncGetDeviceInfoRaw(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::flexsdr::DeviceInfoResponse>* PrepareAsyncGetDeviceInfoRaw(::grpc::ClientContext* context, const ::flexsdr::DeviceInfoRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::flexsdr::ClockRateResponseParams>* AsyncSetClockRateRaw(::grpc::ClientContext* context, const ::flexsdr::ClockRateRequestParams& request, ::grpc::CompletionQueue* cq) override;
@@ -367,6 +421,8 @@ class FlexSDRControl final {
     ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyResponseParams>* PrepareAsyncSetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::FrequencyRequestParams& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>* AsyncGetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::flexsdr::FrequencyValue>* PrepareAsyncGetTxFreqRaw(::grpc::ClientContext* context, const ::flexsdr::ChannelRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::flexsdr::ApplySettingsResponse>* AsyncApplySettingsRaw(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::flexsdr::ApplySettingsResponse>* PrepareAsyncApplySettingsRaw(::grpc::ClientContext* context, const ::flexsdr::ApplySettingsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetDeviceInfo_;
     const ::grpc::internal::RpcMethod rpcmethod_SetClockRate_;
     const ::grpc::internal::RpcMethod rpcmethod_GetClockRate_;
@@ -382,6 +438,7 @@ class FlexSDRControl final {
     const ::grpc::internal::RpcMethod rpcmethod_GetRxFreq_;
     const ::grpc::internal::RpcMethod rpcmethod_SetTxFreq_;
     const ::grpc::internal::RpcMethod rpcmethod_GetTxFreq_;
+    const ::grpc::internal::RpcMethod rpcmethod_ApplySettings_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -408,11 +465,13 @@ class FlexSDRControl final {
     virtual ::grpc::Status GetRxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response);
     virtual ::grpc::Status SetTxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response);
     virtual ::grpc::Status GetTxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response);
+    // Batch: many parameter changes in one round trip
+    virtual ::grpc::Status ApplySettings(::grpc::ServerContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetDeviceInfo : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetDeviceInfo() {
       ::grpc::Service::MarkMethodAsync(0);
@@ -421,7 +480,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response) override {
+    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* /*context*/, const ::flexsdr::DeviceInfoRequest* /*request*/, ::flexsdr::DeviceInfoResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -432,7 +491,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_SetClockRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SetClockRate() {
       ::grpc::Service::MarkMethodAsync(1);
@@ -441,7 +500,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetClockRate(::grpc::ServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) override {
+    ::grpc::Status SetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -452,7 +511,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_GetClockRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetClockRate() {
       ::grpc::Service::MarkMethodAsync(2);
@@ -461,7 +520,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetClockRate(::grpc::ServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) override {
+    ::grpc::Status GetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -472,7 +531,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_SetRxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SetRxGain() {
       ::grpc::Service::MarkMethodAsync(3);
@@ -481,7 +540,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status SetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -492,7 +551,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_GetRxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetRxGain() {
       ::grpc::Service::MarkMethodAsync(4);
@@ -501,7 +560,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status GetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -512,7 +571,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_SetTxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SetTxGain() {
       ::grpc::Service::MarkMethodAsync(5);
@@ -521,7 +580,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status SetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -532,7 +591,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_GetTxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetTxGain() {
       ::grpc::Service::MarkMethodAsync(6);
@@ -541,7 +600,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status GetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -552,7 +611,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_SetRxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SetRxRate() {
       ::grpc::Service::MarkMethodAsync(7);
@@ -561,7 +620,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status SetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -572,7 +631,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_GetRxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetRxRate() {
       ::grpc::Service::MarkMethodAsync(8);
@@ -581,7 +640,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status GetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -592,7 +651,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_SetTxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SetTxRate() {
       ::grpc::Service::MarkMethodAsync(9);
@@ -601,7 +660,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status SetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -612,7 +671,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_GetTxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetTxRate() {
       ::grpc::Service::MarkMethodAsync(10);
@@ -621,7 +680,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status GetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -632,7 +691,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_SetRxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SetRxFreq() {
       ::grpc::Service::MarkMethodAsync(11);
@@ -641,7 +700,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) override {
+    ::grpc::Status SetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -652,7 +711,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_GetRxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetRxFreq() {
       ::grpc::Service::MarkMethodAsync(12);
@@ -661,7 +720,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) override {
+    ::grpc::Status GetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -672,7 +731,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_SetTxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SetTxFreq() {
       ::grpc::Service::MarkMethodAsync(13);
@@ -681,7 +740,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) override {
+    ::grpc::Status SetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -692,7 +751,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithAsyncMethod_GetTxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetTxFreq() {
       ::grpc::Service::MarkMethodAsync(14);
@@ -701,7 +760,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) override {
+    ::grpc::Status GetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -709,11 +768,465 @@ class FlexSDRControl final {
       ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetDeviceInfo<WithAsyncMethod_SetClockRate<WithAsyncMethod_GetClockRate<WithAsyncMethod_SetRxGain<WithAsyncMethod_GetRxGain<WithAsyncMethod_SetTxGain<WithAsyncMethod_GetTxGain<WithAsyncMethod_SetRxRate<WithAsyncMethod_GetRxRate<WithAsyncMethod_SetTxRate<WithAsyncMethod_GetTxRate<WithAsyncMethod_SetRxFreq<WithAsyncMethod_GetRxFreq<WithAsyncMethod_SetTxFreq<WithAsyncMethod_GetTxFreq<Service > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_ApplySettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ApplySettings() {
+      ::grpc::Service::MarkMethodAsync(15);
+    }
+    ~WithAsyncMethod_ApplySettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplySettings(::grpc::ServerContext* /*context*/, const ::flexsdr::ApplySettingsRequest* /*request*/, ::flexsdr::ApplySettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestApplySettings(::grpc::ServerContext* context, ::flexsdr::ApplySettingsRequest* request, ::grpc::ServerAsyncResponseWriter< ::flexsdr::ApplySettingsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GetDeviceInfo<WithAsyncMethod_SetClockRate<WithAsyncMethod_GetClockRate<WithAsyncMethod_SetRxGain<WithAsyncMethod_GetRxGain<WithAsyncMethod_SetTxGain<WithAsyncMethod_GetTxGain<WithAsyncMethod_SetRxRate<WithAsyncMethod_GetRxRate<WithAsyncMethod_SetTxRate<WithAsyncMethod_GetTxRate<WithAsyncMethod_SetRxFreq<WithAsyncMethod_GetRxFreq<WithAsyncMethod_SetTxFreq<WithAsyncMethod_GetTxFreq<WithAsyncMethod_ApplySettings<Service > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetDeviceInfo : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetDeviceInfo() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response) { return this->GetDeviceInfo(context, request, response); }));}
+    void SetMessageAllocatorFor_GetDeviceInfo(
+        ::grpc::MessageAllocator< ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetDeviceInfo() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* /*context*/, const ::flexsdr::DeviceInfoRequest* /*request*/, ::flexsdr::DeviceInfoResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetDeviceInfo(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::DeviceInfoRequest* /*request*/, ::flexsdr::DeviceInfoResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SetClockRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetClockRate() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) { return this->SetClockRate(context, request, response); }));}
+    void SetMessageAllocatorFor_SetClockRate(
+        ::grpc::MessageAllocator< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetClockRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetClockRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetClockRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetClockRate() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) { return this->GetClockRate(context, request, response); }));}
+    void SetMessageAllocatorFor_GetClockRate(
+        ::grpc::MessageAllocator< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetClockRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetClockRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SetRxGain : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetRxGain() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) { return this->SetRxGain(context, request, response); }));}
+    void SetMessageAllocatorFor_SetRxGain(
+        ::grpc::MessageAllocator< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetRxGain() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetRxGain(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetRxGain : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetRxGain() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) { return this->GetRxGain(context, request, response); }));}
+    void SetMessageAllocatorFor_GetRxGain(
+        ::grpc::MessageAllocator< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetRxGain() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetRxGain(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SetTxGain : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetTxGain() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) { return this->SetTxGain(context, request, response); }));}
+    void SetMessageAllocatorFor_SetTxGain(
+        ::grpc::MessageAllocator< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetTxGain() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetTxGain(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetTxGain : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetTxGain() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) { return this->GetTxGain(context, request, response); }));}
+    void SetMessageAllocatorFor_GetTxGain(
+        ::grpc::MessageAllocator< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetTxGain() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetTxGain(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SetRxRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetRxRate() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) { return this->SetRxRate(context, request, response); }));}
+    void SetMessageAllocatorFor_SetRxRate(
+        ::grpc::MessageAllocator< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetRxRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetRxRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetRxRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetRxRate() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) { return this->GetRxRate(context, request, response); }));}
+    void SetMessageAllocatorFor_GetRxRate(
+        ::grpc::MessageAllocator< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetRxRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetRxRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SetTxRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetTxRate() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) { return this->SetTxRate(context, request, response); }));}
+    void SetMessageAllocatorFor_SetTxRate(
+        ::grpc::MessageAllocator< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetTxRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetTxRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetTxRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetTxRate() {
+      ::grpc::Service::MarkMethodCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) { return this->GetTxRate(context, request, response); }));}
+    void SetMessageAllocatorFor_GetTxRate(
+        ::grpc::MessageAllocator< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetTxRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetTxRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SetRxFreq : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetRxFreq() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) { return this->SetRxFreq(context, request, response); }));}
+    void SetMessageAllocatorFor_SetRxFreq(
+        ::grpc::MessageAllocator< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetRxFreq() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetRxFreq(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetRxFreq : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetRxFreq() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) { return this->GetRxFreq(context, request, response); }));}
+    void SetMessageAllocatorFor_GetRxFreq(
+        ::grpc::MessageAllocator< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetRxFreq() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetRxFreq(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SetTxFreq : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetTxFreq() {
+      ::grpc::Service::MarkMethodCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) { return this->SetTxFreq(context, request, response); }));}
+    void SetMessageAllocatorFor_SetTxFreq(
+        ::grpc::MessageAllocator< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetTxFreq() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetTxFreq(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetTxFreq : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetTxFreq() {
+      ::grpc::Service::MarkMethodCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) { return this->GetTxFreq(context, request, response); }));}
+    void SetMessageAllocatorFor_GetTxFreq(
+        ::grpc::MessageAllocator< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetTxFreq() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetTxFreq(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ApplySettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ApplySettings() {
+      ::grpc::Service::MarkMethodCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::flexsdr::ApplySettingsRequest, ::flexsdr::ApplySettingsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::flexsdr::ApplySettingsRequest* request, ::flexsdr::ApplySettingsResponse* response) { return this->ApplySettings(context, request, response); }));}
+    void SetMessageAllocatorFor_ApplySettings(
+        ::grpc::MessageAllocator< ::flexsdr::ApplySettingsRequest, ::flexsdr::ApplySettingsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::flexsdr::ApplySettingsRequest, ::flexsdr::ApplySettingsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ApplySettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplySettings(::grpc::ServerContext* /*context*/, const ::flexsdr::ApplySettingsRequest* /*request*/, ::flexsdr::ApplySettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ApplySettings(
+      ::grpc::CallbackServerContext* /*context*/, const ::flexsdr::ApplySettingsRequest* /*request*/, ::flexsdr::ApplySettingsResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_GetDeviceInfo<WithCallbackMethod_SetClockRate<WithCallbackMethod_GetClockRate<WithCallbackMethod_SetRxGain<WithCallbackMethod_GetRxGain<WithCallbackMethod_SetTxGain<WithCallbackMethod_GetTxGain<WithCallbackMethod_SetRxRate<WithCallbackMethod_GetRxRate<WithCallbackMethod_SetTxRate<WithCallbackMethod_GetTxRate<WithCallbackMethod_SetRxFreq<WithCallbackMethod_GetRxFreq<WithCallbackMethod_SetTxFreq<WithCallbackMethod_GetTxFreq<WithCallbackMethod_ApplySettings<Service > > > > > > > > > > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetDeviceInfo : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetDeviceInfo() {
       ::grpc::Service::MarkMethodGeneric(0);
@@ -722,7 +1235,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response) override {
+    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* /*context*/, const ::flexsdr::DeviceInfoRequest* /*request*/, ::flexsdr::DeviceInfoResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -730,7 +1243,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_SetClockRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SetClockRate() {
       ::grpc::Service::MarkMethodGeneric(1);
@@ -739,7 +1252,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetClockRate(::grpc::ServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) override {
+    ::grpc::Status SetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -747,7 +1260,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_GetClockRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetClockRate() {
       ::grpc::Service::MarkMethodGeneric(2);
@@ -756,7 +1269,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetClockRate(::grpc::ServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) override {
+    ::grpc::Status GetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -764,7 +1277,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_SetRxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SetRxGain() {
       ::grpc::Service::MarkMethodGeneric(3);
@@ -773,7 +1286,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status SetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -781,7 +1294,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_GetRxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetRxGain() {
       ::grpc::Service::MarkMethodGeneric(4);
@@ -790,7 +1303,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status GetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -798,7 +1311,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_SetTxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SetTxGain() {
       ::grpc::Service::MarkMethodGeneric(5);
@@ -807,7 +1320,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status SetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -815,7 +1328,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_GetTxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetTxGain() {
       ::grpc::Service::MarkMethodGeneric(6);
@@ -824,7 +1337,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status GetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -832,7 +1345,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_SetRxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SetRxRate() {
       ::grpc::Service::MarkMethodGeneric(7);
@@ -841,7 +1354,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status SetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -849,7 +1362,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_GetRxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetRxRate() {
       ::grpc::Service::MarkMethodGeneric(8);
@@ -858,7 +1371,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status GetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -866,7 +1379,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_SetTxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SetTxRate() {
       ::grpc::Service::MarkMethodGeneric(9);
@@ -875,7 +1388,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status SetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -883,7 +1396,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_GetTxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetTxRate() {
       ::grpc::Service::MarkMethodGeneric(10);
@@ -892,7 +1405,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status GetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -900,7 +1413,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_SetRxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SetRxFreq() {
       ::grpc::Service::MarkMethodGeneric(11);
@@ -909,7 +1422,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) override {
+    ::grpc::Status SetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -917,7 +1430,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_GetRxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetRxFreq() {
       ::grpc::Service::MarkMethodGeneric(12);
@@ -926,7 +1439,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) override {
+    ::grpc::Status GetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -934,7 +1447,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_SetTxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_SetTxFreq() {
       ::grpc::Service::MarkMethodGeneric(13);
@@ -943,7 +1456,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) override {
+    ::grpc::Status SetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -951,7 +1464,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithGenericMethod_GetTxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetTxFreq() {
       ::grpc::Service::MarkMethodGeneric(14);
@@ -960,7 +1473,24 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) override {
+    ::grpc::Status GetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ApplySettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ApplySettings() {
+      ::grpc::Service::MarkMethodGeneric(15);
+    }
+    ~WithGenericMethod_ApplySettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplySettings(::grpc::ServerContext* /*context*/, const ::flexsdr::ApplySettingsRequest* /*request*/, ::flexsdr::ApplySettingsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -968,7 +1498,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_GetDeviceInfo : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetDeviceInfo() {
       ::grpc::Service::MarkMethodRaw(0);
@@ -977,7 +1507,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response) override {
+    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* /*context*/, const ::flexsdr::DeviceInfoRequest* /*request*/, ::flexsdr::DeviceInfoResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -988,7 +1518,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_SetClockRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SetClockRate() {
       ::grpc::Service::MarkMethodRaw(1);
@@ -997,7 +1527,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetClockRate(::grpc::ServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) override {
+    ::grpc::Status SetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1008,7 +1538,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_GetClockRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetClockRate() {
       ::grpc::Service::MarkMethodRaw(2);
@@ -1017,7 +1547,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetClockRate(::grpc::ServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) override {
+    ::grpc::Status GetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1028,7 +1558,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_SetRxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SetRxGain() {
       ::grpc::Service::MarkMethodRaw(3);
@@ -1037,7 +1567,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status SetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1048,7 +1578,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_GetRxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetRxGain() {
       ::grpc::Service::MarkMethodRaw(4);
@@ -1057,7 +1587,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status GetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1068,7 +1598,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_SetTxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SetTxGain() {
       ::grpc::Service::MarkMethodRaw(5);
@@ -1077,7 +1607,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status SetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1088,7 +1618,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_GetTxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetTxGain() {
       ::grpc::Service::MarkMethodRaw(6);
@@ -1097,7 +1627,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status GetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1108,7 +1638,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_SetRxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SetRxRate() {
       ::grpc::Service::MarkMethodRaw(7);
@@ -1117,7 +1647,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status SetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1128,7 +1658,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_GetRxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetRxRate() {
       ::grpc::Service::MarkMethodRaw(8);
@@ -1137,7 +1667,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status GetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1148,7 +1678,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_SetTxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SetTxRate() {
       ::grpc::Service::MarkMethodRaw(9);
@@ -1157,7 +1687,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status SetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1168,7 +1698,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_GetTxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetTxRate() {
       ::grpc::Service::MarkMethodRaw(10);
@@ -1177,7 +1707,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status GetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1188,7 +1718,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_SetRxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SetRxFreq() {
       ::grpc::Service::MarkMethodRaw(11);
@@ -1197,7 +1727,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) override {
+    ::grpc::Status SetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1208,7 +1738,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_GetRxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetRxFreq() {
       ::grpc::Service::MarkMethodRaw(12);
@@ -1217,7 +1747,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetRxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) override {
+    ::grpc::Status GetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1228,7 +1758,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_SetTxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SetTxFreq() {
       ::grpc::Service::MarkMethodRaw(13);
@@ -1237,7 +1767,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetTxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) override {
+    ::grpc::Status SetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1248,7 +1778,7 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithRawMethod_GetTxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetTxFreq() {
       ::grpc::Service::MarkMethodRaw(14);
@@ -1257,7 +1787,7 @@ class FlexSDRControl final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetTxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) override {
+    ::grpc::Status GetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1266,19 +1796,398 @@ class FlexSDRControl final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_ApplySettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ApplySettings() {
+      ::grpc::Service::MarkMethodRaw(15);
+    }
+    ~WithRawMethod_ApplySettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplySettings(::grpc::ServerContext* /*context*/, const ::flexsdr::ApplySettingsRequest* /*request*/, ::flexsdr::ApplySettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestApplySettings(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetDeviceInfo : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetDeviceInfo() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetDeviceInfo(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetDeviceInfo() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* /*context*/, const ::flexsdr::DeviceInfoRequest* /*request*/, ::flexsdr::DeviceInfoResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetDeviceInfo(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetClockRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetClockRate() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetClockRate(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetClockRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetClockRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetClockRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetClockRate() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetClockRate(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetClockRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetClockRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetRxGain : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetRxGain() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetRxGain(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetRxGain() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetRxGain(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetRxGain : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetRxGain() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetRxGain(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetRxGain() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetRxGain(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetTxGain : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetTxGain() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetTxGain(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetTxGain() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetTxGain(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetTxGain : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetTxGain() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetTxGain(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetTxGain() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetTxGain(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetRxRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetRxRate() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetRxRate(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetRxRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetRxRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetRxRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetRxRate() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetRxRate(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetRxRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetRxRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetTxRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetTxRate() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetTxRate(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetTxRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetTxRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetTxRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetTxRate() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetTxRate(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetTxRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetTxRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetRxFreq : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetRxFreq() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetRxFreq(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetRxFreq() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetRxFreq(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetRxFreq : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetRxFreq() {
+      ::grpc::Service::MarkMethodRawCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetRxFreq(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetRxFreq() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetRxFreq(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetTxFreq : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetTxFreq() {
+      ::grpc::Service::MarkMethodRawCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetTxFreq(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetTxFreq() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetTxFreq(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetTxFreq : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetTxFreq() {
+      ::grpc::Service::MarkMethodRawCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetTxFreq(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetTxFreq() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetTxFreq(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ApplySettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ApplySettings() {
+      ::grpc::Service::MarkMethodRawCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ApplySettings(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ApplySettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplySettings(::grpc::ServerContext* /*context*/, const ::flexsdr::ApplySettingsRequest* /*request*/, ::flexsdr::ApplySettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ApplySettings(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetDeviceInfo : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetDeviceInfo() {
       ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse>(std::bind(&WithStreamedUnaryMethod_GetDeviceInfo<BaseClass>::StreamedGetDeviceInfo, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::DeviceInfoRequest, ::flexsdr::DeviceInfoResponse>* streamer) {
+                       return this->StreamedGetDeviceInfo(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_GetDeviceInfo() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* context, const ::flexsdr::DeviceInfoRequest* request, ::flexsdr::DeviceInfoResponse* response) override {
+    ::grpc::Status GetDeviceInfo(::grpc::ServerContext* /*context*/, const ::flexsdr::DeviceInfoRequest* /*request*/, ::flexsdr::DeviceInfoResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1288,17 +2197,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_SetClockRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SetClockRate() {
       ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>(std::bind(&WithStreamedUnaryMethod_SetClockRate<BaseClass>::StreamedSetClockRate, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>* streamer) {
+                       return this->StreamedSetClockRate(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_SetClockRate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetClockRate(::grpc::ServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) override {
+    ::grpc::Status SetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1308,17 +2224,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_GetClockRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetClockRate() {
       ::grpc::Service::MarkMethodStreamed(2,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>(std::bind(&WithStreamedUnaryMethod_GetClockRate<BaseClass>::StreamedGetClockRate, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::ClockRateRequestParams, ::flexsdr::ClockRateResponseParams>* streamer) {
+                       return this->StreamedGetClockRate(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_GetClockRate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetClockRate(::grpc::ServerContext* context, const ::flexsdr::ClockRateRequestParams* request, ::flexsdr::ClockRateResponseParams* response) override {
+    ::grpc::Status GetClockRate(::grpc::ServerContext* /*context*/, const ::flexsdr::ClockRateRequestParams* /*request*/, ::flexsdr::ClockRateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1328,17 +2251,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_SetRxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SetRxGain() {
       ::grpc::Service::MarkMethodStreamed(3,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(std::bind(&WithStreamedUnaryMethod_SetRxGain<BaseClass>::StreamedSetRxGain, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>* streamer) {
+                       return this->StreamedSetRxGain(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_SetRxGain() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetRxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status SetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1348,17 +2278,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_GetRxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetRxGain() {
       ::grpc::Service::MarkMethodStreamed(4,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(std::bind(&WithStreamedUnaryMethod_GetRxGain<BaseClass>::StreamedGetRxGain, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>* streamer) {
+                       return this->StreamedGetRxGain(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_GetRxGain() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetRxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status GetRxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1368,17 +2305,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_SetTxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SetTxGain() {
       ::grpc::Service::MarkMethodStreamed(5,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(std::bind(&WithStreamedUnaryMethod_SetTxGain<BaseClass>::StreamedSetTxGain, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>* streamer) {
+                       return this->StreamedSetTxGain(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_SetTxGain() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetTxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status SetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1388,17 +2332,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_GetTxGain : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetTxGain() {
       ::grpc::Service::MarkMethodStreamed(6,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(std::bind(&WithStreamedUnaryMethod_GetTxGain<BaseClass>::StreamedGetTxGain, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::GainRequestParams, ::flexsdr::GainResponseParams>* streamer) {
+                       return this->StreamedGetTxGain(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_GetTxGain() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetTxGain(::grpc::ServerContext* context, const ::flexsdr::GainRequestParams* request, ::flexsdr::GainResponseParams* response) override {
+    ::grpc::Status GetTxGain(::grpc::ServerContext* /*context*/, const ::flexsdr::GainRequestParams* /*request*/, ::flexsdr::GainResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1408,17 +2359,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_SetRxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SetRxRate() {
       ::grpc::Service::MarkMethodStreamed(7,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(std::bind(&WithStreamedUnaryMethod_SetRxRate<BaseClass>::StreamedSetRxRate, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>* streamer) {
+                       return this->StreamedSetRxRate(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_SetRxRate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetRxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status SetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1428,17 +2386,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_GetRxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetRxRate() {
       ::grpc::Service::MarkMethodStreamed(8,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(std::bind(&WithStreamedUnaryMethod_GetRxRate<BaseClass>::StreamedGetRxRate, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>* streamer) {
+                       return this->StreamedGetRxRate(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_GetRxRate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetRxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status GetRxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1448,17 +2413,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_SetTxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SetTxRate() {
       ::grpc::Service::MarkMethodStreamed(9,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(std::bind(&WithStreamedUnaryMethod_SetTxRate<BaseClass>::StreamedSetTxRate, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>* streamer) {
+                       return this->StreamedSetTxRate(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_SetTxRate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetTxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status SetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1468,17 +2440,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_GetTxRate : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetTxRate() {
       ::grpc::Service::MarkMethodStreamed(10,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(std::bind(&WithStreamedUnaryMethod_GetTxRate<BaseClass>::StreamedGetTxRate, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::RateRequestParams, ::flexsdr::RateResponseParams>* streamer) {
+                       return this->StreamedGetTxRate(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_GetTxRate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetTxRate(::grpc::ServerContext* context, const ::flexsdr::RateRequestParams* request, ::flexsdr::RateResponseParams* response) override {
+    ::grpc::Status GetTxRate(::grpc::ServerContext* /*context*/, const ::flexsdr::RateRequestParams* /*request*/, ::flexsdr::RateResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1488,17 +2467,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_SetRxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SetRxFreq() {
       ::grpc::Service::MarkMethodStreamed(11,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>(std::bind(&WithStreamedUnaryMethod_SetRxFreq<BaseClass>::StreamedSetRxFreq, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>* streamer) {
+                       return this->StreamedSetRxFreq(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_SetRxFreq() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetRxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) override {
+    ::grpc::Status SetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1508,17 +2494,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_GetRxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetRxFreq() {
       ::grpc::Service::MarkMethodStreamed(12,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>(std::bind(&WithStreamedUnaryMethod_GetRxFreq<BaseClass>::StreamedGetRxFreq, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>* streamer) {
+                       return this->StreamedGetRxFreq(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_GetRxFreq() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetRxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) override {
+    ::grpc::Status GetRxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1528,17 +2521,24 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_SetTxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SetTxFreq() {
       ::grpc::Service::MarkMethodStreamed(13,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>(std::bind(&WithStreamedUnaryMethod_SetTxFreq<BaseClass>::StreamedSetTxFreq, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::FrequencyRequestParams, ::flexsdr::FrequencyResponseParams>* streamer) {
+                       return this->StreamedSetTxFreq(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_SetTxFreq() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetTxFreq(::grpc::ServerContext* context, const ::flexsdr::FrequencyRequestParams* request, ::flexsdr::FrequencyResponseParams* response) override {
+    ::grpc::Status SetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::FrequencyRequestParams* /*request*/, ::flexsdr::FrequencyResponseParams* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1548,26 +2548,60 @@ class FlexSDRControl final {
   template <class BaseClass>
   class WithStreamedUnaryMethod_GetTxFreq : public BaseClass {
    private:
-    void BaseClassMustBeDerivedFromService(const Service *service) {}
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetTxFreq() {
       ::grpc::Service::MarkMethodStreamed(14,
-        new ::grpc::internal::StreamedUnaryHandler< ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>(std::bind(&WithStreamedUnaryMethod_GetTxFreq<BaseClass>::StreamedGetTxFreq, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::ChannelRequest, ::flexsdr::FrequencyValue>* streamer) {
+                       return this->StreamedGetTxFreq(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_GetTxFreq() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetTxFreq(::grpc::ServerContext* context, const ::flexsdr::ChannelRequest* request, ::flexsdr::FrequencyValue* response) override {
+    ::grpc::Status GetTxFreq(::grpc::ServerContext* /*context*/, const ::flexsdr::ChannelRequest* /*request*/, ::flexsdr::FrequencyValue* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedGetTxFreq(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::flexsdr::ChannelRequest,::flexsdr::FrequencyValue>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_GetDeviceInfo<WithStreamedUnaryMethod_SetClockRate<WithStreamedUnaryMethod_GetClockRate<WithStreamedUnaryMethod_SetRxGain<WithStreamedUnaryMethod_GetRxGain<WithStreamedUnaryMethod_SetTxGain<WithStreamedUnaryMethod_GetTxGain<WithStreamedUnaryMethod_SetRxRate<WithStreamedUnaryMethod_GetRxRate<WithStreamedUnaryMethod_SetTxRate<WithStreamedUnaryMethod_GetTxRate<WithStreamedUnaryMethod_SetRxFreq<WithStreamedUnaryMethod_GetRxFreq<WithStreamedUnaryMethod_SetTxFreq<WithStreamedUnaryMethod_GetTxFreq<Service > > > > > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ApplySettings : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ApplySettings() {
+      ::grpc::Service::MarkMethodStreamed(15,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::flexsdr::ApplySettingsRequest, ::flexsdr::ApplySettingsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::flexsdr::ApplySettingsRequest, ::flexsdr::ApplySettingsResponse>* streamer) {
+                       return this->StreamedApplySettings(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ApplySettings() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ApplySettings(::grpc::ServerContext* /*context*/, const ::flexsdr::ApplySettingsRequest* /*request*/, ::flexsdr::ApplySettingsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedApplySettings(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::flexsdr::ApplySettingsRequest,::flexsdr::ApplySettingsResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_GetDeviceInfo<WithStreamedUnaryMethod_SetClockRate<WithStreamedUnaryMethod_GetClockRate<WithStreamedUnaryMethod_SetRxGain<WithStreamedUnaryMethod_GetRxGain<WithStreamedUnaryMethod_SetTxGain<WithStreamedUnaryMethod_GetTxGain<WithStreamedUnaryMethod_SetRxRate<WithStreamedUnaryMethod_GetRxRate<WithStreamedUnaryMethod_SetTxRate<WithStreamedUnaryMethod_GetTxRate<WithStreamedUnaryMethod_SetRxFreq<WithStreamedUnaryMethod_GetRxFreq<WithStreamedUnaryMethod_SetTxFreq<WithStreamedUnaryMethod_GetTxFreq<WithStreamedUnaryMethod_ApplySettings<Service > > > > > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GetDeviceInfo<WithStreamedUnaryMethod_SetClockRate<WithStreamedUnaryMethod_GetClockRate<WithStreamedUnaryMethod_SetRxGain<WithStreamedUnaryMethod_GetRxGain<WithStreamedUnaryMethod_SetTxGain<WithStreamedUnaryMethod_GetTxGain<WithStreamedUnaryMethod_SetRxRate<WithStreamedUnaryMethod_GetRxRate<WithStreamedUnaryMethod_SetTxRate<WithStreamedUnaryMethod_GetTxRate<WithStreamedUnaryMethod_SetRxFreq<WithStreamedUnaryMethod_GetRxFreq<WithStreamedUnaryMethod_SetTxFreq<WithStreamedUnaryMethod_GetTxFreq<Service > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_GetDeviceInfo<WithStreamedUnaryMethod_SetClockRate<WithStreamedUnaryMethod_GetClockRate<WithStreamedUnaryMethod_SetRxGain<WithStreamedUnaryMethod_GetRxGain<WithStreamedUnaryMethod_SetTxGain<WithStreamedUnaryMethod_GetTxGain<WithStreamedUnaryMethod_SetRxRate<WithStreamedUnaryMethod_GetRxRate<WithStreamedUnaryMethod_SetTxRate<WithStreamedUnaryMethod_GetTxRate<WithStreamedUnaryMethod_SetRxFreq<WithStreamedUnaryMethod_GetRxFreq<WithStreamedUnaryMethod_SetTxFreq<WithStreamedUnaryMethod_GetTxFreq<WithStreamedUnaryMethod_ApplySettings<Service > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace flexsdr
@@ -5,575 +5,616 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace protobuf_flexsdr_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_flexsdr_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_ChannelRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_flexsdr_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_TuneRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_flexsdr_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_TuneResult;
-}  // namespace protobuf_flexsdr_2eproto
-namespace flexsdr {
-class ChannelRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ChannelRequest>
-      _instance;
-} _ChannelRequest_default_instance_;
-class ClockRateRequestParamsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ClockRateRequestParams>
-      _instance;
-} _ClockRateRequestParams_default_instance_;
-class ClockRateResponseParamsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ClockRateResponseParams>
-      _instance;
-} _ClockRateResponseParams_default_instance_;
-class GainRequestParamsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GainRequestParams>
-      _instance;
-} _GainRequestParams_default_instance_;
-class GainResponseParamsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GainResponseParams>
-      _instance;
-} _GainResponseParams_default_instance_;
-class RateRequestParamsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RateRequestParams>
-      _instance;
-} _RateRequestParams_default_instance_;
-class RateResponseParamsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RateResponseParams>
-      _instance;
-} _RateResponseParams_default_instance_;
-class TuneRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<TuneRequest>
-      _instance;
-} _TuneRequest_default_instance_;
-class TuneResultDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<TuneResult>
-      _instance;
-} _TuneResult_default_instance_;
-class FrequencyRequestParamsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<FrequencyRequestParams>
-      _instance;
-} _FrequencyRequestParams_default_instance_;
-class FrequencyResponseParamsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<FrequencyResponseParams>
-      _instance;
-} _FrequencyResponseParams_default_instance_;
-class FrequencyValueDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<FrequencyValue>
-      _instance;
-} _FrequencyValue_default_instance_;
-class DeviceInfoRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<DeviceInfoRequest>
-      _instance;
-} _DeviceInfoRequest_default_instance_;
-class DeviceInfoResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<DeviceInfoResponse>
-      _instance;
-} _DeviceInfoResponse_default_instance_;
-}  // namespace flexsdr
-namespace protobuf_flexsdr_2eproto {
-static void InitDefaultsChannelRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_ChannelRequest_default_instance_;
-    new (ptr) ::flexsdr::ChannelRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::ChannelRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_ChannelRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsChannelRequest}, {}};
-
-static void InitDefaultsClockRateRequestParams() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_ClockRateRequestParams_default_instance_;
-    new (ptr) ::flexsdr::ClockRateRequestParams();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::ClockRateRequestParams::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_ClockRateRequestParams =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsClockRateRequestParams}, {}};
-
-static void InitDefaultsClockRateResponseParams() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_ClockRateResponseParams_default_instance_;
-    new (ptr) ::flexsdr::ClockRateResponseParams();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::ClockRateResponseParams::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_ClockRateResponseParams =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsClockRateResponseParams}, {}};
-
-static void InitDefaultsGainRequestParams() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_GainRequestParams_default_instance_;
-    new (ptr) ::flexsdr::GainRequestParams();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::GainRequestParams::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GainRequestParams =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGainRequestParams}, {}};
-
-static void InitDefaultsGainResponseParams() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_GainResponseParams_default_instance_;
-    new (ptr) ::flexsdr::GainResponseParams();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::GainResponseParams::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GainResponseParams =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGainResponseParams}, {}};
-
-static void InitDefaultsRateRequestParams() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_RateRequestParams_default_instance_;
-    new (ptr) ::flexsdr::RateRequestParams();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::RateRequestParams::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_RateRequestParams =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRateRequestParams}, {}};
-
-static void InitDefaultsRateResponseParams() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_RateResponseParams_default_instance_;
-    new (ptr) ::flexsdr::RateResponseParams();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::RateResponseParams::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_RateResponseParams =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRateResponseParams}, {}};
-
-static void InitDefaultsTuneRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_TuneRequest_default_instance_;
-    new (ptr) ::flexsdr::TuneRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::TuneRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_TuneRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTuneRequest}, {}};
-
-static void InitDefaultsTuneResult() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_TuneResult_default_instance_;
-    new (ptr) ::flexsdr::TuneResult();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::TuneResult::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_TuneResult =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsTuneResult}, {}};
-
-static void InitDefaultsFrequencyRequestParams() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_FrequencyRequestParams_default_instance_;
-    new (ptr) ::flexsdr::FrequencyRequestParams();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::FrequencyRequestParams::InitAsDefaultInstance();
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::google::protobuf::internal::SCCInfo<2> scc_info_FrequencyRequestParams =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsFrequencyRequestParams}, {
-      &protobuf_flexsdr_2eproto::scc_info_TuneRequest.base,
-      &protobuf_flexsdr_2eproto::scc_info_ChannelRequest.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static void InitDefaultsFrequencyResponseParams() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_FrequencyResponseParams_default_instance_;
-    new (ptr) ::flexsdr::FrequencyResponseParams();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::FrequencyResponseParams::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_FrequencyResponseParams =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsFrequencyResponseParams}, {
-      &protobuf_flexsdr_2eproto::scc_info_TuneResult.base,}};
-
-static void InitDefaultsFrequencyValue() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_FrequencyValue_default_instance_;
-    new (ptr) ::flexsdr::FrequencyValue();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::FrequencyValue::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_FrequencyValue =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsFrequencyValue}, {}};
-
-static void InitDefaultsDeviceInfoRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_DeviceInfoRequest_default_instance_;
-    new (ptr) ::flexsdr::DeviceInfoRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::DeviceInfoRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_DeviceInfoRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsDeviceInfoRequest}, {}};
-
-static void InitDefaultsDeviceInfoResponse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::flexsdr::_DeviceInfoResponse_default_instance_;
-    new (ptr) ::flexsdr::DeviceInfoResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::flexsdr::DeviceInfoResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_DeviceInfoResponse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsDeviceInfoResponse}, {}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_ChannelRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ClockRateRequestParams.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ClockRateResponseParams.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GainRequestParams.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GainResponseParams.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RateRequestParams.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RateResponseParams.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_TuneRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_TuneResult.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_FrequencyRequestParams.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_FrequencyResponseParams.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_FrequencyValue.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_DeviceInfoRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_DeviceInfoResponse.base);
-}
-
-::google::protobuf::Metadata file_level_metadata[14];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[2];
+namespace flexsdr {
+PROTOBUF_CONSTEXPR ChannelRequest::ChannelRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.chan_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChannelRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChannelRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChannelRequestDefaultTypeInternal() {}
+  union {
+    ChannelRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChannelRequestDefaultTypeInternal _ChannelRequest_default_instance_;
+PROTOBUF_CONSTEXPR ClockRateRequestParams::ClockRateRequestParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rate_)*/0
+  , /*decltype(_impl_.unit_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClockRateRequestParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClockRateRequestParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClockRateRequestParamsDefaultTypeInternal() {}
+  union {
+    ClockRateRequestParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClockRateRequestParamsDefaultTypeInternal _ClockRateRequestParams_default_instance_;
+PROTOBUF_CONSTEXPR ClockRateResponseParams::ClockRateResponseParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.actual_rate_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClockRateResponseParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClockRateResponseParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClockRateResponseParamsDefaultTypeInternal() {}
+  union {
+    ClockRateResponseParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClockRateResponseParamsDefaultTypeInternal _ClockRateResponseParams_default_instance_;
+PROTOBUF_CONSTEXPR GainRequestParams::GainRequestParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gain_)*/0
+  , /*decltype(_impl_.command_time_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.chan_)*/0u
+  , /*decltype(_impl_.command_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GainRequestParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GainRequestParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GainRequestParamsDefaultTypeInternal() {}
+  union {
+    GainRequestParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GainRequestParamsDefaultTypeInternal _GainRequestParams_default_instance_;
+PROTOBUF_CONSTEXPR GainResponseParams::GainResponseParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.actual_gain_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GainResponseParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GainResponseParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GainResponseParamsDefaultTypeInternal() {}
+  union {
+    GainResponseParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GainResponseParamsDefaultTypeInternal _GainResponseParams_default_instance_;
+PROTOBUF_CONSTEXPR RateRequestParams::RateRequestParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rate_)*/0
+  , /*decltype(_impl_.chan_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RateRequestParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RateRequestParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RateRequestParamsDefaultTypeInternal() {}
+  union {
+    RateRequestParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RateRequestParamsDefaultTypeInternal _RateRequestParams_default_instance_;
+PROTOBUF_CONSTEXPR RateResponseParams::RateResponseParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.actual_rate_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RateResponseParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RateResponseParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RateResponseParamsDefaultTypeInternal() {}
+  union {
+    RateResponseParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RateResponseParamsDefaultTypeInternal _RateResponseParams_default_instance_;
+PROTOBUF_CONSTEXPR TuneRequest::TuneRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.target_freq_)*/0
+  , /*decltype(_impl_.rf_freq_)*/0
+  , /*decltype(_impl_.rf_freq_policy_)*/0
+  , /*decltype(_impl_.dsp_freq_policy_)*/0
+  , /*decltype(_impl_.dsp_freq_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TuneRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TuneRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TuneRequestDefaultTypeInternal() {}
+  union {
+    TuneRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TuneRequestDefaultTypeInternal _TuneRequest_default_instance_;
+PROTOBUF_CONSTEXPR TuneResult::TuneResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.clipped_rf_freq_)*/0
+  , /*decltype(_impl_.target_rf_freq_)*/0
+  , /*decltype(_impl_.actual_rf_freq_)*/0
+  , /*decltype(_impl_.target_dsp_freq_)*/0
+  , /*decltype(_impl_.actual_dsp_freq_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TuneResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TuneResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TuneResultDefaultTypeInternal() {}
+  union {
+    TuneResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TuneResultDefaultTypeInternal _TuneResult_default_instance_;
+PROTOBUF_CONSTEXPR FrequencyRequestParams::FrequencyRequestParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tune_request_)*/nullptr
+  , /*decltype(_impl_.channel_request_)*/nullptr
+  , /*decltype(_impl_.command_time_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.command_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrequencyRequestParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrequencyRequestParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrequencyRequestParamsDefaultTypeInternal() {}
+  union {
+    FrequencyRequestParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrequencyRequestParamsDefaultTypeInternal _FrequencyRequestParams_default_instance_;
+PROTOBUF_CONSTEXPR FrequencyResponseParams::FrequencyResponseParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tune_result_)*/nullptr
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrequencyResponseParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrequencyResponseParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrequencyResponseParamsDefaultTypeInternal() {}
+  union {
+    FrequencyResponseParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrequencyResponseParamsDefaultTypeInternal _FrequencyResponseParams_default_instance_;
+PROTOBUF_CONSTEXPR FrequencyValue::FrequencyValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.frequency_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrequencyValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrequencyValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrequencyValueDefaultTypeInternal() {}
+  union {
+    FrequencyValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrequencyValueDefaultTypeInternal _FrequencyValue_default_instance_;
+PROTOBUF_CONSTEXPR DeviceInfoRequest::DeviceInfoRequest(
+    ::_pbi::ConstantInitialized) {}
+struct DeviceInfoRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeviceInfoRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeviceInfoRequestDefaultTypeInternal() {}
+  union {
+    DeviceInfoRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeviceInfoRequestDefaultTypeInternal _DeviceInfoRequest_default_instance_;
+PROTOBUF_CONSTEXPR DeviceInfoResponse::DeviceInfoResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rx_antennas_)*/{}
+  , /*decltype(_impl_.tx_antennas_)*/{}
+  , /*decltype(_impl_.device_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.serial_number_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.min_rx_gain_)*/0
+  , /*decltype(_impl_.max_rx_gain_)*/0
+  , /*decltype(_impl_.min_tx_gain_)*/0
+  , /*decltype(_impl_.max_tx_gain_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeviceInfoResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeviceInfoResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeviceInfoResponseDefaultTypeInternal() {}
+  union {
+    DeviceInfoResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeviceInfoResponseDefaultTypeInternal _DeviceInfoResponse_default_instance_;
+PROTOBUF_CONSTEXPR ParamChange::ParamChange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.kind_)*/0
+  , /*decltype(_impl_.chan_)*/0u
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.command_time_ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.command_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ParamChangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParamChangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParamChangeDefaultTypeInternal() {}
+  union {
+    ParamChange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParamChangeDefaultTypeInternal _ParamChange_default_instance_;
+PROTOBUF_CONSTEXPR ApplySettingsRequest::ApplySettingsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.changes_)*/{}
+  , /*decltype(_impl_.stop_on_error_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ApplySettingsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ApplySettingsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ApplySettingsRequestDefaultTypeInternal() {}
+  union {
+    ApplySettingsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplySettingsRequestDefaultTypeInternal _ApplySettingsRequest_default_instance_;
+PROTOBUF_CONSTEXPR ParamResult::ParamResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.actual_value_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ParamResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParamResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParamResultDefaultTypeInternal() {}
+  union {
+    ParamResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParamResultDefaultTypeInternal _ParamResult_default_instance_;
+PROTOBUF_CONSTEXPR ApplySettingsResponse::ApplySettingsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ApplySettingsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ApplySettingsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ApplySettingsResponseDefaultTypeInternal() {}
+  union {
+    ApplySettingsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplySettingsResponseDefaultTypeInternal _ApplySettingsResponse_default_instance_;
+}  // namespace flexsdr
+static ::_pb::Metadata file_level_metadata_flexsdr_2eproto[18];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_flexsdr_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_flexsdr_2eproto = nullptr;
 
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_flexsdr_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ChannelRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ChannelRequest, _impl_.chan_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ChannelRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ClockRateRequestParams, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ChannelRequest, chan_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ClockRateRequestParams, _impl_.unit_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ClockRateRequestParams, _impl_.rate_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ClockRateRequestParams, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ClockRateResponseParams, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ClockRateRequestParams, unit_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ClockRateRequestParams, rate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ClockRateResponseParams, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ClockRateResponseParams, _impl_.actual_rate_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ClockRateResponseParams, _impl_.error_message_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ClockRateResponseParams, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainRequestParams, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ClockRateResponseParams, success_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ClockRateResponseParams, actual_rate_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::ClockRateResponseParams, error_message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainRequestParams, _impl_.gain_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainRequestParams, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainRequestParams, _impl_.chan_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainRequestParams, _impl_.command_time_ticks_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainRequestParams, _impl_.command_id_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::GainRequestParams, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainResponseParams, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::GainRequestParams, gain_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::GainRequestParams, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::GainRequestParams, chan_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainResponseParams, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainResponseParams, _impl_.actual_gain_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::GainResponseParams, _impl_.error_message_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::GainResponseParams, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::RateRequestParams, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::GainResponseParams, success_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::GainResponseParams, actual_gain_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::GainResponseParams, error_message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::RateRequestParams, _impl_.rate_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::RateRequestParams, _impl_.chan_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::RateRequestParams, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::RateResponseParams, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::RateRequestParams, rate_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::RateRequestParams, chan_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::RateResponseParams, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::RateResponseParams, _impl_.actual_rate_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::RateResponseParams, _impl_.error_message_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::RateResponseParams, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::RateResponseParams, success_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::RateResponseParams, actual_rate_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::RateResponseParams, error_message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneRequest, _impl_.target_freq_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneRequest, _impl_.rf_freq_policy_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneRequest, _impl_.rf_freq_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneRequest, _impl_.dsp_freq_policy_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneRequest, _impl_.dsp_freq_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneRequest, target_freq_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneRequest, rf_freq_policy_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneRequest, rf_freq_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneRequest, dsp_freq_policy_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneRequest, dsp_freq_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneResult, _impl_.clipped_rf_freq_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneResult, _impl_.target_rf_freq_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneResult, _impl_.actual_rf_freq_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneResult, _impl_.target_dsp_freq_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::TuneResult, _impl_.actual_dsp_freq_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneResult, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyRequestParams, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneResult, clipped_rf_freq_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneResult, target_rf_freq_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneResult, actual_rf_freq_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneResult, target_dsp_freq_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::TuneResult, actual_dsp_freq_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyRequestParams, _impl_.tune_request_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyRequestParams, _impl_.channel_request_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyRequestParams, _impl_.command_time_ticks_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyRequestParams, _impl_.command_id_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyRequestParams, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyResponseParams, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyRequestParams, tune_request_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyRequestParams, channel_request_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyResponseParams, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyResponseParams, _impl_.tune_result_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyResponseParams, _impl_.error_message_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyResponseParams, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyValue, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyResponseParams, success_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyResponseParams, tune_result_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyResponseParams, error_message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyValue, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyValue, _impl_.frequency_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::FrequencyValue, _impl_.error_message_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyValue, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyValue, success_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyValue, frequency_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::FrequencyValue, error_message_),
+  ~0u,  // no _inlined_string_donated_
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _impl_.device_name_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _impl_.serial_number_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _impl_.rx_antennas_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _impl_.tx_antennas_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _impl_.min_rx_gain_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _impl_.max_rx_gain_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _impl_.min_tx_gain_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _impl_.max_tx_gain_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamChange, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, device_name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, serial_number_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, rx_antennas_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, tx_antennas_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, min_rx_gain_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, max_rx_gain_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, min_tx_gain_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::flexsdr::DeviceInfoResponse, max_tx_gain_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamChange, _impl_.kind_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamChange, _impl_.chan_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamChange, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamChange, _impl_.command_time_ticks_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamChange, _impl_.command_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ApplySettingsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ApplySettingsRequest, _impl_.changes_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ApplySettingsRequest, _impl_.stop_on_error_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamResult, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamResult, _impl_.actual_value_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ParamResult, _impl_.error_message_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ApplySettingsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ApplySettingsResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::flexsdr::ApplySettingsResponse, _impl_.results_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::flexsdr::ChannelRequest)},
-  { 6, -1, sizeof(::flexsdr::ClockRateRequestParams)},
-  { 13, -1, sizeof(::flexsdr::ClockRateResponseParams)},
-  { 21, -1, sizeof(::flexsdr::GainRequestParams)},
-  { 29, -1, sizeof(::flexsdr::GainResponseParams)},
-  { 37, -1, sizeof(::flexsdr::RateRequestParams)},
-  { 44, -1, sizeof(::flexsdr::RateResponseParams)},
-  { 52, -1, sizeof(::flexsdr::TuneRequest)},
-  { 62, -1, sizeof(::flexsdr::TuneResult)},
-  { 72, -1, sizeof(::flexsdr::FrequencyRequestParams)},
-  { 79, -1, sizeof(::flexsdr::FrequencyResponseParams)},
-  { 87, -1, sizeof(::flexsdr::FrequencyValue)},
-  { 95, -1, sizeof(::flexsdr::DeviceInfoRequest)},
-  { 100, -1, sizeof(::flexsdr::DeviceInfoResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::flexsdr::ChannelRequest)},
+  { 7, -1, -1, sizeof(::flexsdr::ClockRateRequestParams)},
+  { 15, -1, -1, sizeof(::flexsdr::ClockRateResponseParams)},
+  { 24, -1, -1, sizeof(::flexsdr::GainRequestParams)},
+  { 35, -1, -1, sizeof(::flexsdr::GainResponseParams)},
+  { 44, -1, -1, sizeof(::flexsdr::RateRequestParams)},
+  { 52, -1, -1, sizeof(::flexsdr::RateResponseParams)},
+  { 61, -1, -1, sizeof(::flexsdr::TuneRequest)},
+  { 72, -1, -1, sizeof(::flexsdr::TuneResult)},
+  { 83, -1, -1, sizeof(::flexsdr::FrequencyRequestParams)},
+  { 93, -1, -1, sizeof(::flexsdr::FrequencyResponseParams)},
+  { 102, -1, -1, sizeof(::flexsdr::FrequencyValue)},
+  { 111, -1, -1, sizeof(::flexsdr::DeviceInfoRequest)},
+  { 117, -1, -1, sizeof(::flexsdr::DeviceInfoResponse)},
+  { 131, -1, -1, sizeof(::flexsdr::ParamChange)},
+  { 142, -1, -1, sizeof(::flexsdr::ApplySettingsRequest)},
+  { 150, -1, -1, sizeof(::flexsdr::ParamResult)},
+  { 159, -1, -1, sizeof(::flexsdr::ApplySettingsResponse)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_ChannelRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_ClockRateRequestParams_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_ClockRateResponseParams_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_GainRequestParams_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_GainResponseParams_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_RateRequestParams_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_RateResponseParams_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_TuneRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_TuneResult_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_FrequencyRequestParams_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_FrequencyResponseParams_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_FrequencyValue_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_DeviceInfoRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::flexsdr::_DeviceInfoResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::flexsdr::_ChannelRequest_default_instance_._instance,
+  &::flexsdr::_ClockRateRequestParams_default_instance_._instance,
+  &::flexsdr::_ClockRateResponseParams_default_instance_._instance,
+  &::flexsdr::_GainRequestParams_default_instance_._instance,
+  &::flexsdr::_GainResponseParams_default_instance_._instance,
+  &::flexsdr::_RateRequestParams_default_instance_._instance,
+  &::flexsdr::_RateResponseParams_default_instance_._instance,
+  &::flexsdr::_TuneRequest_default_instance_._instance,
+  &::flexsdr::_TuneResult_default_instance_._instance,
+  &::flexsdr::_FrequencyRequestParams_default_instance_._instance,
+  &::flexsdr::_FrequencyResponseParams_default_instance_._instance,
+  &::flexsdr::_FrequencyValue_default_instance_._instance,
+  &::flexsdr::_DeviceInfoRequest_default_instance_._instance,
+  &::flexsdr::_DeviceInfoResponse_default_instance_._instance,
+  &::flexsdr::_ParamChange_default_instance_._instance,
+  &::flexsdr::_ApplySettingsRequest_default_instance_._instance,
+  &::flexsdr::_ParamResult_default_instance_._instance,
+  &::flexsdr::_ApplySettingsResponse_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "flexsdr.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, file_level_enum_descriptors, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 14);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\rflexsdr.proto\022\007flexsdr\"\036\n\016ChannelReque"
-      "st\022\014\n\004chan\030\001 \001(\r\"G\n\026ClockRateRequestPara"
-      "ms\022\037\n\004unit\030\001 \001(\0162\021.flexsdr.UnitType\022\014\n\004r"
-      "ate\030\002 \001(\001\"V\n\027ClockRateResponseParams\022\017\n\007"
-      "success\030\001 \001(\010\022\023\n\013actual_rate\030\002 \001(\001\022\025\n\rer"
-      "ror_message\030\003 \001(\t\"=\n\021GainRequestParams\022\014"
-      "\n\004gain\030\001 \001(\001\022\014\n\004name\030\002 \001(\t\022\014\n\004chan\030\003 \001(\r"
-      "\"Q\n\022GainResponseParams\022\017\n\007success\030\001 \001(\010\022"
-      "\023\n\013actual_gain\030\002 \001(\001\022\025\n\rerror_message\030\003 "
-      "\001(\t\"/\n\021RateRequestParams\022\014\n\004rate\030\001 \001(\001\022\014"
-      "\n\004chan\030\002 \001(\r\"Q\n\022RateResponseParams\022\017\n\007su"
-      "ccess\030\001 \001(\010\022\023\n\013actual_rate\030\002 \001(\001\022\025\n\rerro"
-      "r_message\030\003 \001(\t\"\357\001\n\013TuneRequest\022\023\n\013targe"
-      "t_freq\030\001 \001(\001\0223\n\016rf_freq_policy\030\002 \001(\0162\033.f"
-      "lexsdr.TuneRequest.Policy\022\017\n\007rf_freq\030\003 \001"
-      "(\001\0224\n\017dsp_freq_policy\030\004 \001(\0162\033.flexsdr.Tu"
-      "neRequest.Policy\022\020\n\010dsp_freq\030\005 \001(\001\"=\n\006Po"
-      "licy\022\017\n\013POLICY_NONE\020\000\022\017\n\013POLICY_AUTO\020\001\022\021"
-      "\n\rPOLICY_MANUAL\020\002\"\207\001\n\nTuneResult\022\027\n\017clip"
-      "ped_rf_freq\030\001 \001(\001\022\026\n\016target_rf_freq\030\002 \001("
-      "\001\022\026\n\016actual_rf_freq\030\003 \001(\001\022\027\n\017target_dsp_"
-      "freq\030\004 \001(\001\022\027\n\017actual_dsp_freq\030\005 \001(\001\"v\n\026F"
-      "requencyRequestParams\022*\n\014tune_request\030\001 "
-      "\001(\0132\024.flexsdr.TuneRequest\0220\n\017channel_req"
-      "uest\030\002 \001(\0132\027.flexsdr.ChannelRequest\"k\n\027F"
-      "requencyResponseParams\022\017\n\007success\030\001 \001(\010\022"
-      "(\n\013tune_result\030\002 \001(\0132\023.flexsdr.TuneResul"
-      "t\022\025\n\rerror_message\030\003 \001(\t\"K\n\016FrequencyVal"
-      "ue\022\017\n\007success\030\001 \001(\010\022\021\n\tfrequency\030\002 \001(\001\022\025"
-      "\n\rerror_message\030\003 \001(\t\"\023\n\021DeviceInfoReque"
-      "st\"\276\001\n\022DeviceInfoResponse\022\023\n\013device_name"
-      "\030\001 \001(\t\022\025\n\rserial_number\030\002 \001(\t\022\023\n\013rx_ante"
-      "nnas\030\003 \003(\t\022\023\n\013tx_antennas\030\004 \003(\t\022\023\n\013min_r"
-      "x_gain\030\005 \001(\001\022\023\n\013max_rx_gain\030\006 \001(\001\022\023\n\013min"
-      "_tx_gain\030\007 \001(\001\022\023\n\013max_tx_gain\030\010 \001(\001*E\n\010U"
-      "nitType\022\020\n\014UNIT_INVALID\020\000\022\013\n\007UNIT_RX\020r\022\013"
-      "\n\007UNIT_TX\020t\022\r\n\tUNIT_BOTH\020b2\354\010\n\016FlexSDRCo"
-      "ntrol\022J\n\rGetDeviceInfo\022\032.flexsdr.DeviceI"
-      "nfoRequest\032\033.flexsdr.DeviceInfoResponse\""
-      "\000\022S\n\014SetClockRate\022\037.flexsdr.ClockRateReq"
-      "uestParams\032 .flexsdr.ClockRateResponsePa"
-      "rams\"\000\022S\n\014GetClockRate\022\037.flexsdr.ClockRa"
-      "teRequestParams\032 .flexsdr.ClockRateRespo"
-      "nseParams\"\000\022F\n\tSetRxGain\022\032.flexsdr.GainR"
-      "equestParams\032\033.flexsdr.GainResponseParam"
-      "s\"\000\022F\n\tGetRxGain\022\032.flexsdr.GainRequestPa"
-      "rams\032\033.flexsdr.GainResponseParams\"\000\022F\n\tS"
-      "etTxGain\022\032.flexsdr.GainRequestParams\032\033.f"
-      "lexsdr.GainResponseParams\"\000\022F\n\tGetTxGain"
-      "\022\032.flexsdr.GainRequestParams\032\033.flexsdr.G"
-      "ainResponseParams\"\000\022F\n\tSetRxRate\022\032.flexs"
-      "dr.RateRequestParams\032\033.flexsdr.RateRespo"
-      "nseParams\"\000\022F\n\tGetRxRate\022\032.flexsdr.RateR"
-      "equestParams\032\033.flexsdr.RateResponseParam"
-      "s\"\000\022F\n\tSetTxRate\022\032.flexsdr.RateRequestPa"
-      "rams\032\033.flexsdr.RateResponseParams\"\000\022F\n\tG"
-      "etTxRate\022\032.flexsdr.RateRequestParams\032\033.f"
-      "lexsdr.RateResponseParams\"\000\022P\n\tSetRxFreq"
-      "\022\037.flexsdr.FrequencyRequestParams\032 .flex"
-      "sdr.FrequencyResponseParams\"\000\022\?\n\tGetRxFr"
-      "eq\022\027.flexsdr.ChannelRequest\032\027.flexsdr.Fr"
-      "equencyValue\"\000\022P\n\tSetTxFreq\022\037.flexsdr.Fr"
-      "equencyRequestParams\032 .flexsdr.Frequency"
-      "ResponseParams\"\000\022\?\n\tGetTxFreq\022\027.flexsdr."
-      "ChannelRequest\032\027.flexsdr.FrequencyValue\""
-      "\000b\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 2609);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "flexsdr.proto", &protobuf_RegisterTypes);
+const char descriptor_table_protodef_flexsdr_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rflexsdr.proto\022\007flexsdr\"\036\n\016ChannelReque"
+  "st\022\014\n\004chan\030\001 \001(\r\"G\n\026ClockRateRequestPara"
+  "ms\022\037\n\004unit\030\001 \001(\0162\021.flexsdr.UnitType\022\014\n\004r"
+  "ate\030\002 \001(\001\"V\n\027ClockRateResponseParams\022\017\n\007"
+  "success\030\001 \001(\010\022\023\n\013actual_rate\030\002 \001(\001\022\025\n\rer"
+  "ror_message\030\003 \001(\t\"m\n\021GainRequestParams\022\014"
+  "\n\004gain\030\001 \001(\001\022\014\n\004name\030\002 \001(\t\022\014\n\004chan\030\003 \001(\r"
+  "\022\032\n\022command_time_ticks\030\004 \001(\004\022\022\n\ncommand_"
+  "id\030\005 \001(\r\"Q\n\022GainResponseParams\022\017\n\007succes"
+  "s\030\001 \001(\010\022\023\n\013actual_gain\030\002 \001(\001\022\025\n\rerror_me"
+  "ssage\030\003 \001(\t\"/\n\021RateRequestParams\022\014\n\004rate"
+  "\030\001 \001(\001\022\014\n\004chan\030\002 \001(\r\"Q\n\022RateResponsePara"
+  "ms\022\017\n\007success\030\001 \001(\010\022\023\n\013actual_rate\030\002 \001(\001"
+  "\022\025\n\rerror_message\030\003 \001(\t\"\357\001\n\013TuneRequest\022"
+  "\023\n\013target_freq\030\001 \001(\001\0223\n\016rf_freq_policy\030\002"
+  " \001(\0162\033.flexsdr.TuneRequest.Policy\022\017\n\007rf_"
+  "freq\030\003 \001(\001\0224\n\017dsp_freq_policy\030\004 \001(\0162\033.fl"
+  "exsdr.TuneRequest.Policy\022\020\n\010dsp_freq\030\005 \001"
+  "(\001\"=\n\006Policy\022\017\n\013POLICY_NONE\020\000\022\017\n\013POLICY_"
+  "AUTO\020\001\022\021\n\rPOLICY_MANUAL\020\002\"\207\001\n\nTuneResult"
+  "\022\027\n\017clipped_rf_freq\030\001 \001(\001\022\026\n\016target_rf_f"
+  "req\030\002 \001(\001\022\026\n\016actual_rf_freq\030\003 \001(\001\022\027\n\017tar"
+  "get_dsp_freq\030\004 \001(\001\022\027\n\017actual_dsp_freq\030\005 "
+  "\001(\001\"\246\001\n\026FrequencyRequestParams\022*\n\014tune_r"
+  "equest\030\001 \001(\0132\024.flexsdr.TuneRequest\0220\n\017ch"
+  "annel_request\030\002 \001(\0132\027.flexsdr.ChannelReq"
+  "uest\022\032\n\022command_time_ticks\030\003 \001(\004\022\022\n\ncomm"
+  "and_id\030\004 \001(\r\"k\n\027FrequencyResponseParams\022"
+  "\017\n\007success\030\001 \001(\010\022(\n\013tune_result\030\002 \001(\0132\023."
+  "flexsdr.TuneResult\022\025\n\rerror_message\030\003 \001("
+  "\t\"K\n\016FrequencyValue\022\017\n\007success\030\001 \001(\010\022\021\n\t"
+  "frequency\030\002 \001(\001\022\025\n\rerror_message\030\003 \001(\t\"\023"
+  "\n\021DeviceInfoRequest\"\276\001\n\022DeviceInfoRespon"
+  "se\022\023\n\013device_name\030\001 \001(\t\022\025\n\rserial_number"
+  "\030\002 \001(\t\022\023\n\013rx_antennas\030\003 \003(\t\022\023\n\013tx_antenn"
+  "as\030\004 \003(\t\022\023\n\013min_rx_gain\030\005 \001(\001\022\023\n\013max_rx_"
+  "gain\030\006 \001(\001\022\023\n\013min_tx_gain\030\007 \001(\001\022\023\n\013max_t"
+  "x_gain\030\010 \001(\001\"\373\001\n\013ParamChange\022\'\n\004kind\030\001 \001"
+  "(\0162\031.flexsdr.ParamChange.Kind\022\014\n\004chan\030\002 "
+  "\001(\r\022\r\n\005value\030\003 \001(\001\022\032\n\022command_time_ticks"
+  "\030\004 \001(\004\022\022\n\ncommand_id\030\005 \001(\r\"v\n\004Kind\022\020\n\014KI"
+  "ND_INVALID\020\000\022\013\n\007RX_GAIN\020\001\022\013\n\007TX_GAIN\020\002\022\013"
+  "\n\007RX_RATE\020\003\022\013\n\007TX_RATE\020\004\022\013\n\007RX_FREQ\020\005\022\013\n"
+  "\007TX_FREQ\020\006\022\016\n\nCLOCK_RATE\020\007\"T\n\024ApplySetti"
+  "ngsRequest\022%\n\007changes\030\001 \003(\0132\024.flexsdr.Pa"
+  "ramChange\022\025\n\rstop_on_error\030\002 \001(\010\"K\n\013Para"
+  "mResult\022\017\n\007success\030\001 \001(\010\022\024\n\014actual_value"
+  "\030\002 \001(\001\022\025\n\rerror_message\030\003 \001(\t\"O\n\025ApplySe"
+  "ttingsResponse\022\017\n\007success\030\001 \001(\010\022%\n\007resul"
+  "ts\030\002 \003(\0132\024.flexsdr.ParamResult*E\n\010UnitTy"
+  "pe\022\020\n\014UNIT_INVALID\020\000\022\013\n\007UNIT_RX\020r\022\013\n\007UNI"
+  "T_TX\020t\022\r\n\tUNIT_BOTH\020b2\276\t\n\016FlexSDRControl"
+  "\022J\n\rGetDeviceInfo\022\032.flexsdr.DeviceInfoRe"
+  "quest\032\033.flexsdr.DeviceInfoResponse\"\000\022S\n\014"
+  "SetClockRate\022\037.flexsdr.ClockRateRequestP"
+  "arams\032 .flexsdr.ClockRateResponseParams\""
+  "\000\022S\n\014GetClockRate\022\037.flexsdr.ClockRateReq"
+  "uestParams\032 .flexsdr.ClockRateResponsePa"
+  "rams\"\000\022F\n\tSetRxGain\022\032.flexsdr.GainReques"
+  "tParams\032\033.flexsdr.GainResponseParams\"\000\022F"
+  "\n\tGetRxGain\022\032.flexsdr.GainRequestParams\032"
+  "\033.flexsdr.GainResponseParams\"\000\022F\n\tSetTxG"
+  "ain\022\032.flexsdr.GainRequestParams\032\033.flexsd"
+  "r.GainResponseParams\"\000\022F\n\tGetTxGain\022\032.fl"
+  "exsdr.GainRequestParams\032\033.flexsdr.GainRe"
+  "sponseParams\"\000\022F\n\tSetRxRate\022\032.flexsdr.Ra"
+  "teRequestParams\032\033.flexsdr.RateResponsePa"
+  "rams\"\000\022F\n\tGetRxRate\022\032.flexsdr.RateReques"
+  "tParams\032\033.flexsdr.RateResponseParams\"\000\022F"
+  "\n\tSetTxRate\022\032.flexsdr.RateRequestParams\032"
+  "\033.flexsdr.RateResponseParams\"\000\022F\n\tGetTxR"
+  "ate\022\032.flexsdr.RateRequestParams\032\033.flexsd"
+  "r.RateResponseParams\"\000\022P\n\tSetRxFreq\022\037.fl"
+  "exsdr.FrequencyRequestParams\032 .flexsdr.F"
+  "requencyResponseParams\"\000\022\?\n\tGetRxFreq\022\027."
+  "flexsdr.ChannelRequest\032\027.flexsdr.Frequen"
+  "cyValue\"\000\022P\n\tSetTxFreq\022\037.flexsdr.Frequen"
+  "cyRequestParams\032 .flexsdr.FrequencyRespo"
+  "nseParams\"\000\022\?\n\tGetTxFreq\022\027.flexsdr.Chann"
+  "elRequest\032\027.flexsdr.FrequencyValue\"\000\022P\n\r"
+  "ApplySettings\022\035.flexsdr.ApplySettingsReq"
+  "uest\032\036.flexsdr.ApplySettingsResponse\"\000b\006"
+  "proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_flexsdr_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_flexsdr_2eproto = {
+    false, false, 3286, descriptor_table_protodef_flexsdr_2eproto,
+    "flexsdr.proto",
+    &descriptor_table_flexsdr_2eproto_once, nullptr, 0, 18,
+    schemas, file_default_instances, TableStruct_flexsdr_2eproto::offsets,
+    file_level_metadata_flexsdr_2eproto, file_level_enum_descriptors_flexsdr_2eproto,
+    file_level_service_descriptors_flexsdr_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_flexsdr_2eproto_getter() {
+  return &descriptor_table_flexsdr_2eproto;
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_flexsdr_2eproto
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_flexsdr_2eproto(&descriptor_table_flexsdr_2eproto);
 namespace flexsdr {
-const ::google::protobuf::EnumDescriptor* TuneRequest_Policy_descriptor() {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_flexsdr_2eproto::file_level_enum_descriptors[0];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TuneRequest_Policy_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_flexsdr_2eproto);
+  return file_level_enum_descriptors_flexsdr_2eproto[0];
 }
 bool TuneRequest_Policy_IsValid(int value) {
   switch (value) {
@@ -586,17 +627,50 @@ bool TuneRequest_Policy_IsValid(int value) {
   }
 }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const TuneRequest_Policy TuneRequest::POLICY_NONE;
-const TuneRequest_Policy TuneRequest::POLICY_AUTO;
-const TuneRequest_Policy TuneRequest::POLICY_MANUAL;
-const TuneRequest_Policy TuneRequest::Policy_MIN;
-const TuneRequest_Policy TuneRequest::Policy_MAX;
-const int TuneRequest::Policy_ARRAYSIZE;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-const ::google::protobuf::EnumDescriptor* UnitType_descriptor() {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_flexsdr_2eproto::file_level_enum_descriptors[1];
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TuneRequest_Policy TuneRequest::POLICY_NONE;
+constexpr TuneRequest_Policy TuneRequest::POLICY_AUTO;
+constexpr TuneRequest_Policy TuneRequest::POLICY_MANUAL;
+constexpr TuneRequest_Policy TuneRequest::Policy_MIN;
+constexpr TuneRequest_Policy TuneRequest::Policy_MAX;
+constexpr int TuneRequest::Policy_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ParamChange_Kind_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_flexsdr_2eproto);
+  return file_level_enum_descriptors_flexsdr_2eproto[1];
+}
+bool ParamChange_Kind_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ParamChange_Kind ParamChange::KIND_INVALID;
+constexpr ParamChange_Kind ParamChange::RX_GAIN;
+constexpr ParamChange_Kind ParamChange::TX_GAIN;
+constexpr ParamChange_Kind ParamChange::RX_RATE;
+constexpr ParamChange_Kind ParamChange::TX_RATE;
+constexpr ParamChange_Kind ParamChange::RX_FREQ;
+constexpr ParamChange_Kind ParamChange::TX_FREQ;
+constexpr ParamChange_Kind ParamChange::CLOCK_RATE;
+constexpr ParamChange_Kind ParamChange::Kind_MIN;
+constexpr ParamChange_Kind ParamChange::Kind_MAX;
+constexpr int ParamChange::Kind_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UnitType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_flexsdr_2eproto);
+  return file_level_enum_descriptors_flexsdr_2eproto[2];
 }
 bool UnitType_IsValid(int value) {
   switch (value) {
@@ -613,140 +687,117 @@ bool UnitType_IsValid(int value) {
 
 // ===================================================================
 
-void ChannelRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ChannelRequest::kChanFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ChannelRequest::_Internal {
+ public:
+};
 
-ChannelRequest::ChannelRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_ChannelRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.ChannelRequest)
+ChannelRequest::ChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.ChannelRequest)
 }
 ChannelRequest::ChannelRequest(const ChannelRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  chan_ = from.chan_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChannelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.chan_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.chan_ = from._impl_.chan_;
   // @@protoc_insertion_point(copy_constructor:flexsdr.ChannelRequest)
 }
 
-void ChannelRequest::SharedCtor() {
-  chan_ = 0u;
+inline void ChannelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.chan_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ChannelRequest::~ChannelRequest() {
   // @@protoc_insertion_point(destructor:flexsdr.ChannelRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ChannelRequest::SharedDtor() {
+inline void ChannelRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void ChannelRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* ChannelRequest::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const ChannelRequest& ChannelRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_ChannelRequest.base);
-  return *internal_default_instance();
-}
-
 
 void ChannelRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.ChannelRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  chan_ = 0u;
-  _internal_metadata_.Clear();
+  _impl_.chan_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool ChannelRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.ChannelRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* ChannelRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 chan = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &chan_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.chan_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.ChannelRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.ChannelRequest)
-  return false;
-#undef DO_
-}
-
-void ChannelRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.ChannelRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 chan = 1;
-  if (this->chan() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->chan(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.ChannelRequest)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* ChannelRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* ChannelRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:flexsdr.ChannelRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 chan = 1;
-  if (this->chan() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->chan(), target);
+  if (this->_internal_chan() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_chan(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.ChannelRequest)
   return target;
@@ -756,55 +807,37 @@ size_t ChannelRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.ChannelRequest)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint32 chan = 1;
-  if (this->chan() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->chan());
+  if (this->_internal_chan() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chan());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ChannelRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.ChannelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ChannelRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ChannelRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.ChannelRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.ChannelRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChannelRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChannelRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChannelRequest::GetClassData() const { return &_class_data_; }
 
-void ChannelRequest::MergeFrom(const ChannelRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ChannelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void ChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChannelRequest*>(&to_msg);
+  auto& from = static_cast<const ChannelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ChannelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.chan() != 0) {
-    set_chan(from.chan());
+  if (from._internal_chan() != 0) {
+    _this->_internal_set_chan(from._internal_chan());
   }
-}
-
-void ChannelRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.ChannelRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ChannelRequest::CopyFrom(const ChannelRequest& from) {
@@ -818,192 +851,157 @@ bool ChannelRequest::IsInitialized() const {
   return true;
 }
 
-void ChannelRequest::Swap(ChannelRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ChannelRequest::InternalSwap(ChannelRequest* other) {
   using std::swap;
-  swap(chan_, other->chan_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.chan_, other->_impl_.chan_);
 }
 
-::google::protobuf::Metadata ChannelRequest::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata ChannelRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void ClockRateRequestParams::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ClockRateRequestParams::kUnitFieldNumber;
-const int ClockRateRequestParams::kRateFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ClockRateRequestParams::_Internal {
+ public:
+};
 
-ClockRateRequestParams::ClockRateRequestParams()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_ClockRateRequestParams.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.ClockRateRequestParams)
+ClockRateRequestParams::ClockRateRequestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.ClockRateRequestParams)
 }
 ClockRateRequestParams::ClockRateRequestParams(const ClockRateRequestParams& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&rate_, &from.rate_,
-    static_cast<size_t>(reinterpret_cast<char*>(&unit_) -
-    reinterpret_cast<char*>(&rate_)) + sizeof(unit_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClockRateRequestParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rate_){}
+    , decltype(_impl_.unit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.rate_, &from._impl_.rate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unit_) -
+    reinterpret_cast<char*>(&_impl_.rate_)) + sizeof(_impl_.unit_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.ClockRateRequestParams)
 }
 
-void ClockRateRequestParams::SharedCtor() {
-  ::memset(&rate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&unit_) -
-      reinterpret_cast<char*>(&rate_)) + sizeof(unit_));
+inline void ClockRateRequestParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rate_){0}
+    , decltype(_impl_.unit_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ClockRateRequestParams::~ClockRateRequestParams() {
   // @@protoc_insertion_point(destructor:flexsdr.ClockRateRequestParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ClockRateRequestParams::SharedDtor() {
+inline void ClockRateRequestParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void ClockRateRequestParams::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* ClockRateRequestParams::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const ClockRateRequestParams& ClockRateRequestParams::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_ClockRateRequestParams.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ClockRateRequestParams::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.ClockRateRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&rate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&unit_) -
-      reinterpret_cast<char*>(&rate_)) + sizeof(unit_));
-  _internal_metadata_.Clear();
-}
-
-bool ClockRateRequestParams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.ClockRateRequestParams)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.rate_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.unit_) -
+      reinterpret_cast<char*>(&_impl_.rate_)) + sizeof(_impl_.unit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClockRateRequestParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .flexsdr.UnitType unit = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_unit(static_cast< ::flexsdr::UnitType >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_unit(static_cast<::flexsdr::UnitType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double rate = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &rate_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.ClockRateRequestParams)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.ClockRateRequestParams)
-  return false;
-#undef DO_
-}
-
-void ClockRateRequestParams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.ClockRateRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .flexsdr.UnitType unit = 1;
-  if (this->unit() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->unit(), output);
-  }
-
-  // double rate = 2;
-  if (this->rate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->rate(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.ClockRateRequestParams)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* ClockRateRequestParams::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* ClockRateRequestParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:flexsdr.ClockRateRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .flexsdr.UnitType unit = 1;
-  if (this->unit() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->unit(), target);
+  if (this->_internal_unit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_unit(), target);
   }
 
   // double rate = 2;
-  if (this->rate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->rate(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate = this->_internal_rate();
+  uint64_t raw_rate;
+  memcpy(&raw_rate, &tmp_rate, sizeof(tmp_rate));
+  if (raw_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_rate(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.ClockRateRequestParams)
   return target;
@@ -1013,62 +1011,54 @@ size_t ClockRateRequestParams::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.ClockRateRequestParams)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // double rate = 2;
-  if (this->rate() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate = this->_internal_rate();
+  uint64_t raw_rate;
+  memcpy(&raw_rate, &tmp_rate, sizeof(tmp_rate));
+  if (raw_rate != 0) {
     total_size += 1 + 8;
   }
 
   // .flexsdr.UnitType unit = 1;
-  if (this->unit() != 0) {
+  if (this->_internal_unit() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->unit());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_unit());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ClockRateRequestParams::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.ClockRateRequestParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ClockRateRequestParams* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ClockRateRequestParams>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.ClockRateRequestParams)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.ClockRateRequestParams)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClockRateRequestParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClockRateRequestParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClockRateRequestParams::GetClassData() const { return &_class_data_; }
 
-void ClockRateRequestParams::MergeFrom(const ClockRateRequestParams& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ClockRateRequestParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void ClockRateRequestParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClockRateRequestParams*>(&to_msg);
+  auto& from = static_cast<const ClockRateRequestParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ClockRateRequestParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.rate() != 0) {
-    set_rate(from.rate());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate = from._internal_rate();
+  uint64_t raw_rate;
+  memcpy(&raw_rate, &tmp_rate, sizeof(tmp_rate));
+  if (raw_rate != 0) {
+    _this->_internal_set_rate(from._internal_rate());
   }
-  if (from.unit() != 0) {
-    set_unit(from.unit());
+  if (from._internal_unit() != 0) {
+    _this->_internal_set_unit(from._internal_unit());
   }
-}
-
-void ClockRateRequestParams::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.ClockRateRequestParams)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ClockRateRequestParams::CopyFrom(const ClockRateRequestParams& from) {
@@ -1082,310 +1072,262 @@ bool ClockRateRequestParams::IsInitialized() const {
   return true;
 }
 
-void ClockRateRequestParams::Swap(ClockRateRequestParams* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ClockRateRequestParams::InternalSwap(ClockRateRequestParams* other) {
   using std::swap;
-  swap(rate_, other->rate_);
-  swap(unit_, other->unit_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClockRateRequestParams, _impl_.unit_)
+      + sizeof(ClockRateRequestParams::_impl_.unit_)
+      - PROTOBUF_FIELD_OFFSET(ClockRateRequestParams, _impl_.rate_)>(
+          reinterpret_cast<char*>(&_impl_.rate_),
+          reinterpret_cast<char*>(&other->_impl_.rate_));
 }
 
-::google::protobuf::Metadata ClockRateRequestParams::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata ClockRateRequestParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void ClockRateResponseParams::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ClockRateResponseParams::kSuccessFieldNumber;
-const int ClockRateResponseParams::kActualRateFieldNumber;
-const int ClockRateResponseParams::kErrorMessageFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ClockRateResponseParams::_Internal {
+ public:
+};
 
-ClockRateResponseParams::ClockRateResponseParams()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_ClockRateResponseParams.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.ClockRateResponseParams)
+ClockRateResponseParams::ClockRateResponseParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.ClockRateResponseParams)
 }
 ClockRateResponseParams::ClockRateResponseParams(const ClockRateResponseParams& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  ::memcpy(&actual_rate_, &from.actual_rate_,
-    static_cast<size_t>(reinterpret_cast<char*>(&success_) -
-    reinterpret_cast<char*>(&actual_rate_)) + sizeof(success_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClockRateResponseParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.actual_rate_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.actual_rate_, &from._impl_.actual_rate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.actual_rate_)) + sizeof(_impl_.success_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.ClockRateResponseParams)
 }
 
-void ClockRateResponseParams::SharedCtor() {
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&actual_rate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&actual_rate_)) + sizeof(success_));
+inline void ClockRateResponseParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.actual_rate_){0}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ClockRateResponseParams::~ClockRateResponseParams() {
   // @@protoc_insertion_point(destructor:flexsdr.ClockRateResponseParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ClockRateResponseParams::SharedDtor() {
-  error_message_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ClockRateResponseParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
 }
 
 void ClockRateResponseParams::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* ClockRateResponseParams::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const ClockRateResponseParams& ClockRateResponseParams::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_ClockRateResponseParams.base);
-  return *internal_default_instance();
-}
-
-
 void ClockRateResponseParams::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.ClockRateResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&actual_rate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&actual_rate_)) + sizeof(success_));
-  _internal_metadata_.Clear();
-}
-
-bool ClockRateResponseParams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.ClockRateResponseParams)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.error_message_.ClearToEmpty();
+  ::memset(&_impl_.actual_rate_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.actual_rate_)) + sizeof(_impl_.success_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClockRateResponseParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double actual_rate = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &actual_rate_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.actual_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string error_message = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.ClockRateResponseParams.error_message"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.ClockRateResponseParams.error_message"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.ClockRateResponseParams)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.ClockRateResponseParams)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ClockRateResponseParams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.ClockRateResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ClockRateResponseParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.ClockRateResponseParams)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // double actual_rate = 2;
-  if (this->actual_rate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->actual_rate(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rate = this->_internal_actual_rate();
+  uint64_t raw_actual_rate;
+  memcpy(&raw_actual_rate, &tmp_actual_rate, sizeof(tmp_actual_rate));
+  if (raw_actual_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_actual_rate(), target);
   }
 
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.ClockRateResponseParams.error_message");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->error_message(), output);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_message(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:flexsdr.ClockRateResponseParams)
-}
-
-::google::protobuf::uint8* ClockRateResponseParams::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.ClockRateResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
-  }
-
-  // double actual_rate = 2;
-  if (this->actual_rate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->actual_rate(), target);
-  }
-
-  // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.ClockRateResponseParams.error_message");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->error_message(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.ClockRateResponseParams)
-  return target;
+  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.ClockRateResponseParams)
+  return target;
 }
 
 size_t ClockRateResponseParams::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.ClockRateResponseParams)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->error_message());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
   }
 
   // double actual_rate = 2;
-  if (this->actual_rate() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rate = this->_internal_actual_rate();
+  uint64_t raw_actual_rate;
+  memcpy(&raw_actual_rate, &tmp_actual_rate, sizeof(tmp_actual_rate));
+  if (raw_actual_rate != 0) {
     total_size += 1 + 8;
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ClockRateResponseParams::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.ClockRateResponseParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ClockRateResponseParams* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ClockRateResponseParams>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.ClockRateResponseParams)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.ClockRateResponseParams)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClockRateResponseParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClockRateResponseParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClockRateResponseParams::GetClassData() const { return &_class_data_; }
 
-void ClockRateResponseParams::MergeFrom(const ClockRateResponseParams& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ClockRateResponseParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.error_message().size() > 0) {
+void ClockRateResponseParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClockRateResponseParams*>(&to_msg);
+  auto& from = static_cast<const ClockRateResponseParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ClockRateResponseParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
   }
-  if (from.actual_rate() != 0) {
-    set_actual_rate(from.actual_rate());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rate = from._internal_actual_rate();
+  uint64_t raw_actual_rate;
+  memcpy(&raw_actual_rate, &tmp_actual_rate, sizeof(tmp_actual_rate));
+  if (raw_actual_rate != 0) {
+    _this->_internal_set_actual_rate(from._internal_actual_rate());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void ClockRateResponseParams::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.ClockRateResponseParams)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ClockRateResponseParams::CopyFrom(const ClockRateResponseParams& from) {
@@ -1399,237 +1341,234 @@ bool ClockRateResponseParams::IsInitialized() const {
   return true;
 }
 
-void ClockRateResponseParams::Swap(ClockRateResponseParams* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ClockRateResponseParams::InternalSwap(ClockRateResponseParams* other) {
   using std::swap;
-  error_message_.Swap(&other->error_message_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(actual_rate_, other->actual_rate_);
-  swap(success_, other->success_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata ClockRateResponseParams::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClockRateResponseParams, _impl_.success_)
+      + sizeof(ClockRateResponseParams::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(ClockRateResponseParams, _impl_.actual_rate_)>(
+          reinterpret_cast<char*>(&_impl_.actual_rate_),
+          reinterpret_cast<char*>(&other->_impl_.actual_rate_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClockRateResponseParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void GainRequestParams::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GainRequestParams::kGainFieldNumber;
-const int GainRequestParams::kNameFieldNumber;
-const int GainRequestParams::kChanFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GainRequestParams::_Internal {
+ public:
+};
 
-GainRequestParams::GainRequestParams()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_GainRequestParams.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.GainRequestParams)
+GainRequestParams::GainRequestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.GainRequestParams)
 }
 GainRequestParams::GainRequestParams(const GainRequestParams& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  ::memcpy(&gain_, &from.gain_,
-    static_cast<size_t>(reinterpret_cast<char*>(&chan_) -
-    reinterpret_cast<char*>(&gain_)) + sizeof(chan_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GainRequestParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.gain_){}
+    , decltype(_impl_.command_time_ticks_){}
+    , decltype(_impl_.chan_){}
+    , decltype(_impl_.command_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.gain_, &from._impl_.gain_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.command_id_) -
+    reinterpret_cast<char*>(&_impl_.gain_)) + sizeof(_impl_.command_id_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.GainRequestParams)
 }
 
-void GainRequestParams::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&gain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&chan_) -
-      reinterpret_cast<char*>(&gain_)) + sizeof(chan_));
+inline void GainRequestParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.gain_){0}
+    , decltype(_impl_.command_time_ticks_){uint64_t{0u}}
+    , decltype(_impl_.chan_){0u}
+    , decltype(_impl_.command_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GainRequestParams::~GainRequestParams() {
   // @@protoc_insertion_point(destructor:flexsdr.GainRequestParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GainRequestParams::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GainRequestParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void GainRequestParams::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* GainRequestParams::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const GainRequestParams& GainRequestParams::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_GainRequestParams.base);
-  return *internal_default_instance();
-}
-
-
 void GainRequestParams::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.GainRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&gain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&chan_) -
-      reinterpret_cast<char*>(&gain_)) + sizeof(chan_));
-  _internal_metadata_.Clear();
-}
-
-bool GainRequestParams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.GainRequestParams)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.gain_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.command_id_) -
+      reinterpret_cast<char*>(&_impl_.gain_)) + sizeof(_impl_.command_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GainRequestParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // double gain = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(9u /* 9 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &gain_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.gain_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string name = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.GainRequestParams.name"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.GainRequestParams.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 chan = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &chan_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.chan_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 command_time_ticks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.command_time_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // uint32 command_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.command_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.GainRequestParams)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.GainRequestParams)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void GainRequestParams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.GainRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* GainRequestParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.GainRequestParams)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // double gain = 1;
-  if (this->gain() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(1, this->gain(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gain = this->_internal_gain();
+  uint64_t raw_gain;
+  memcpy(&raw_gain, &tmp_gain, sizeof(tmp_gain));
+  if (raw_gain != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_gain(), target);
   }
 
   // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.GainRequestParams.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
   }
 
   // uint32 chan = 3;
-  if (this->chan() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->chan(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.GainRequestParams)
-}
-
-::google::protobuf::uint8* GainRequestParams::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.GainRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double gain = 1;
-  if (this->gain() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(1, this->gain(), target);
+  if (this->_internal_chan() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_chan(), target);
   }
 
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.GainRequestParams.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
+  // uint64 command_time_ticks = 4;
+  if (this->_internal_command_time_ticks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_command_time_ticks(), target);
   }
 
-  // uint32 chan = 3;
-  if (this->chan() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->chan(), target);
+  // uint32 command_id = 5;
+  if (this->_internal_command_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_command_id(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.GainRequestParams)
   return target;
@@ -1639,74 +1578,79 @@ size_t GainRequestParams::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.GainRequestParams)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 2;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // double gain = 1;
-  if (this->gain() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gain = this->_internal_gain();
+  uint64_t raw_gain;
+  memcpy(&raw_gain, &tmp_gain, sizeof(tmp_gain));
+  if (raw_gain != 0) {
     total_size += 1 + 8;
   }
 
-  // uint32 chan = 3;
-  if (this->chan() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->chan());
+  // uint64 command_time_ticks = 4;
+  if (this->_internal_command_time_ticks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_command_time_ticks());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint32 chan = 3;
+  if (this->_internal_chan() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chan());
+  }
 
-void GainRequestParams::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.GainRequestParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GainRequestParams* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GainRequestParams>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.GainRequestParams)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.GainRequestParams)
-    MergeFrom(*source);
+  // uint32 command_id = 5;
+  if (this->_internal_command_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_command_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GainRequestParams::MergeFrom(const GainRequestParams& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.GainRequestParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GainRequestParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GainRequestParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GainRequestParams::GetClassData() const { return &_class_data_; }
 
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+void GainRequestParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GainRequestParams*>(&to_msg);
+  auto& from = static_cast<const GainRequestParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.GainRequestParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.gain() != 0) {
-    set_gain(from.gain());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_gain = from._internal_gain();
+  uint64_t raw_gain;
+  memcpy(&raw_gain, &tmp_gain, sizeof(tmp_gain));
+  if (raw_gain != 0) {
+    _this->_internal_set_gain(from._internal_gain());
   }
-  if (from.chan() != 0) {
-    set_chan(from.chan());
+  if (from._internal_command_time_ticks() != 0) {
+    _this->_internal_set_command_time_ticks(from._internal_command_time_ticks());
   }
-}
-
-void GainRequestParams::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.GainRequestParams)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_chan() != 0) {
+    _this->_internal_set_chan(from._internal_chan());
+  }
+  if (from._internal_command_id() != 0) {
+    _this->_internal_set_command_id(from._internal_command_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GainRequestParams::CopyFrom(const GainRequestParams& from) {
@@ -1720,237 +1664,202 @@ bool GainRequestParams::IsInitialized() const {
   return true;
 }
 
-void GainRequestParams::Swap(GainRequestParams* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GainRequestParams::InternalSwap(GainRequestParams* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(gain_, other->gain_);
-  swap(chan_, other->chan_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GainRequestParams, _impl_.command_id_)
+      + sizeof(GainRequestParams::_impl_.command_id_)
+      - PROTOBUF_FIELD_OFFSET(GainRequestParams, _impl_.gain_)>(
+          reinterpret_cast<char*>(&_impl_.gain_),
+          reinterpret_cast<char*>(&other->_impl_.gain_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GainRequestParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[3]);
 }
 
-::google::protobuf::Metadata GainRequestParams::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
 // ===================================================================
 
-void GainResponseParams::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GainResponseParams::kSuccessFieldNumber;
-const int GainResponseParams::kActualGainFieldNumber;
-const int GainResponseParams::kErrorMessageFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GainResponseParams::_Internal {
+ public:
+};
 
-GainResponseParams::GainResponseParams()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_GainResponseParams.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.GainResponseParams)
+GainResponseParams::GainResponseParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.GainResponseParams)
 }
 GainResponseParams::GainResponseParams(const GainResponseParams& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  ::memcpy(&actual_gain_, &from.actual_gain_,
-    static_cast<size_t>(reinterpret_cast<char*>(&success_) -
-    reinterpret_cast<char*>(&actual_gain_)) + sizeof(success_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GainResponseParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.actual_gain_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.actual_gain_, &from._impl_.actual_gain_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.actual_gain_)) + sizeof(_impl_.success_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.GainResponseParams)
 }
 
-void GainResponseParams::SharedCtor() {
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&actual_gain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&actual_gain_)) + sizeof(success_));
+inline void GainResponseParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.actual_gain_){0}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GainResponseParams::~GainResponseParams() {
   // @@protoc_insertion_point(destructor:flexsdr.GainResponseParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GainResponseParams::SharedDtor() {
-  error_message_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GainResponseParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
 }
 
 void GainResponseParams::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* GainResponseParams::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const GainResponseParams& GainResponseParams::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_GainResponseParams.base);
-  return *internal_default_instance();
-}
-
 
 void GainResponseParams::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.GainResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&actual_gain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&actual_gain_)) + sizeof(success_));
-  _internal_metadata_.Clear();
-}
-
-bool GainResponseParams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.GainResponseParams)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.error_message_.ClearToEmpty();
+  ::memset(&_impl_.actual_gain_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.actual_gain_)) + sizeof(_impl_.success_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GainResponseParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double actual_gain = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &actual_gain_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.actual_gain_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string error_message = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.GainResponseParams.error_message"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.GainResponseParams.error_message"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.GainResponseParams)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.GainResponseParams)
-  return false;
-#undef DO_
-}
-
-void GainResponseParams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.GainResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // double actual_gain = 2;
-  if (this->actual_gain() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->actual_gain(), output);
-  }
-
-  // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.GainResponseParams.error_message");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->error_message(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.GainResponseParams)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* GainResponseParams::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* GainResponseParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:flexsdr.GainResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // double actual_gain = 2;
-  if (this->actual_gain() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->actual_gain(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_gain = this->_internal_actual_gain();
+  uint64_t raw_actual_gain;
+  memcpy(&raw_actual_gain, &tmp_actual_gain, sizeof(tmp_actual_gain));
+  if (raw_actual_gain != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_actual_gain(), target);
   }
 
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.GainResponseParams.error_message");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->error_message(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_message(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.GainResponseParams)
   return target;
@@ -1960,72 +1869,63 @@ size_t GainResponseParams::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.GainResponseParams)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->error_message());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
   }
 
   // double actual_gain = 2;
-  if (this->actual_gain() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_gain = this->_internal_actual_gain();
+  uint64_t raw_actual_gain;
+  memcpy(&raw_actual_gain, &tmp_actual_gain, sizeof(tmp_actual_gain));
+  if (raw_actual_gain != 0) {
     total_size += 1 + 8;
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GainResponseParams::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.GainResponseParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GainResponseParams* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GainResponseParams>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.GainResponseParams)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.GainResponseParams)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GainResponseParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GainResponseParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GainResponseParams::GetClassData() const { return &_class_data_; }
 
-void GainResponseParams::MergeFrom(const GainResponseParams& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.GainResponseParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.error_message().size() > 0) {
+void GainResponseParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GainResponseParams*>(&to_msg);
+  auto& from = static_cast<const GainResponseParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.GainResponseParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
   }
-  if (from.actual_gain() != 0) {
-    set_actual_gain(from.actual_gain());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_gain = from._internal_actual_gain();
+  uint64_t raw_actual_gain;
+  memcpy(&raw_actual_gain, &tmp_actual_gain, sizeof(tmp_actual_gain));
+  if (raw_actual_gain != 0) {
+    _this->_internal_set_actual_gain(from._internal_actual_gain());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void GainResponseParams::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.GainResponseParams)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GainResponseParams::CopyFrom(const GainResponseParams& from) {
@@ -2039,192 +1939,166 @@ bool GainResponseParams::IsInitialized() const {
   return true;
 }
 
-void GainResponseParams::Swap(GainResponseParams* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GainResponseParams::InternalSwap(GainResponseParams* other) {
   using std::swap;
-  error_message_.Swap(&other->error_message_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(actual_gain_, other->actual_gain_);
-  swap(success_, other->success_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata GainResponseParams::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GainResponseParams, _impl_.success_)
+      + sizeof(GainResponseParams::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(GainResponseParams, _impl_.actual_gain_)>(
+          reinterpret_cast<char*>(&_impl_.actual_gain_),
+          reinterpret_cast<char*>(&other->_impl_.actual_gain_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GainResponseParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void RateRequestParams::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RateRequestParams::kRateFieldNumber;
-const int RateRequestParams::kChanFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RateRequestParams::_Internal {
+ public:
+};
 
-RateRequestParams::RateRequestParams()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_RateRequestParams.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.RateRequestParams)
+RateRequestParams::RateRequestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.RateRequestParams)
 }
 RateRequestParams::RateRequestParams(const RateRequestParams& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&rate_, &from.rate_,
-    static_cast<size_t>(reinterpret_cast<char*>(&chan_) -
-    reinterpret_cast<char*>(&rate_)) + sizeof(chan_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RateRequestParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rate_){}
+    , decltype(_impl_.chan_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.rate_, &from._impl_.rate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.chan_) -
+    reinterpret_cast<char*>(&_impl_.rate_)) + sizeof(_impl_.chan_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.RateRequestParams)
 }
 
-void RateRequestParams::SharedCtor() {
-  ::memset(&rate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&chan_) -
-      reinterpret_cast<char*>(&rate_)) + sizeof(chan_));
+inline void RateRequestParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rate_){0}
+    , decltype(_impl_.chan_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RateRequestParams::~RateRequestParams() {
   // @@protoc_insertion_point(destructor:flexsdr.RateRequestParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RateRequestParams::SharedDtor() {
+inline void RateRequestParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void RateRequestParams::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* RateRequestParams::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const RateRequestParams& RateRequestParams::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_RateRequestParams.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RateRequestParams::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.RateRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&rate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&chan_) -
-      reinterpret_cast<char*>(&rate_)) + sizeof(chan_));
-  _internal_metadata_.Clear();
-}
-
-bool RateRequestParams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.RateRequestParams)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.rate_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.chan_) -
+      reinterpret_cast<char*>(&_impl_.rate_)) + sizeof(_impl_.chan_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RateRequestParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // double rate = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(9u /* 9 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &rate_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 chan = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &chan_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.chan_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.RateRequestParams)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.RateRequestParams)
-  return false;
-#undef DO_
-}
-
-void RateRequestParams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.RateRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double rate = 1;
-  if (this->rate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(1, this->rate(), output);
-  }
-
-  // uint32 chan = 2;
-  if (this->chan() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->chan(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.RateRequestParams)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* RateRequestParams::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* RateRequestParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:flexsdr.RateRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // double rate = 1;
-  if (this->rate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(1, this->rate(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate = this->_internal_rate();
+  uint64_t raw_rate;
+  memcpy(&raw_rate, &tmp_rate, sizeof(tmp_rate));
+  if (raw_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_rate(), target);
   }
 
   // uint32 chan = 2;
-  if (this->chan() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->chan(), target);
+  if (this->_internal_chan() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_chan(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.RateRequestParams)
   return target;
@@ -2234,63 +2108,53 @@ size_t RateRequestParams::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.RateRequestParams)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // double rate = 1;
-  if (this->rate() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate = this->_internal_rate();
+  uint64_t raw_rate;
+  memcpy(&raw_rate, &tmp_rate, sizeof(tmp_rate));
+  if (raw_rate != 0) {
     total_size += 1 + 8;
   }
 
   // uint32 chan = 2;
-  if (this->chan() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->chan());
+  if (this->_internal_chan() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chan());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RateRequestParams::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.RateRequestParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RateRequestParams* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RateRequestParams>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.RateRequestParams)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.RateRequestParams)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RateRequestParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RateRequestParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RateRequestParams::GetClassData() const { return &_class_data_; }
 
-void RateRequestParams::MergeFrom(const RateRequestParams& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.RateRequestParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void RateRequestParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RateRequestParams*>(&to_msg);
+  auto& from = static_cast<const RateRequestParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.RateRequestParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.rate() != 0) {
-    set_rate(from.rate());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate = from._internal_rate();
+  uint64_t raw_rate;
+  memcpy(&raw_rate, &tmp_rate, sizeof(tmp_rate));
+  if (raw_rate != 0) {
+    _this->_internal_set_rate(from._internal_rate());
   }
-  if (from.chan() != 0) {
-    set_chan(from.chan());
+  if (from._internal_chan() != 0) {
+    _this->_internal_set_chan(from._internal_chan());
   }
-}
-
-void RateRequestParams::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.RateRequestParams)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RateRequestParams::CopyFrom(const RateRequestParams& from) {
@@ -2304,235 +2168,196 @@ bool RateRequestParams::IsInitialized() const {
   return true;
 }
 
-void RateRequestParams::Swap(RateRequestParams* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RateRequestParams::InternalSwap(RateRequestParams* other) {
   using std::swap;
-  swap(rate_, other->rate_);
-  swap(chan_, other->chan_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RateRequestParams, _impl_.chan_)
+      + sizeof(RateRequestParams::_impl_.chan_)
+      - PROTOBUF_FIELD_OFFSET(RateRequestParams, _impl_.rate_)>(
+          reinterpret_cast<char*>(&_impl_.rate_),
+          reinterpret_cast<char*>(&other->_impl_.rate_));
 }
 
-::google::protobuf::Metadata RateRequestParams::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata RateRequestParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void RateResponseParams::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RateResponseParams::kSuccessFieldNumber;
-const int RateResponseParams::kActualRateFieldNumber;
-const int RateResponseParams::kErrorMessageFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RateResponseParams::_Internal {
+ public:
+};
 
-RateResponseParams::RateResponseParams()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_RateResponseParams.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.RateResponseParams)
+RateResponseParams::RateResponseParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.RateResponseParams)
 }
 RateResponseParams::RateResponseParams(const RateResponseParams& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  ::memcpy(&actual_rate_, &from.actual_rate_,
-    static_cast<size_t>(reinterpret_cast<char*>(&success_) -
-    reinterpret_cast<char*>(&actual_rate_)) + sizeof(success_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RateResponseParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.actual_rate_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.actual_rate_, &from._impl_.actual_rate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.actual_rate_)) + sizeof(_impl_.success_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.RateResponseParams)
 }
 
-void RateResponseParams::SharedCtor() {
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&actual_rate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&actual_rate_)) + sizeof(success_));
+inline void RateResponseParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.actual_rate_){0}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RateResponseParams::~RateResponseParams() {
   // @@protoc_insertion_point(destructor:flexsdr.RateResponseParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RateResponseParams::SharedDtor() {
-  error_message_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RateResponseParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
 }
 
 void RateResponseParams::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* RateResponseParams::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const RateResponseParams& RateResponseParams::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_RateResponseParams.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RateResponseParams::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.RateResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&actual_rate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&actual_rate_)) + sizeof(success_));
-  _internal_metadata_.Clear();
-}
-
-bool RateResponseParams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.RateResponseParams)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.error_message_.ClearToEmpty();
+  ::memset(&_impl_.actual_rate_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.actual_rate_)) + sizeof(_impl_.success_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RateResponseParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double actual_rate = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &actual_rate_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.actual_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string error_message = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.RateResponseParams.error_message"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.RateResponseParams.error_message"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.RateResponseParams)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.RateResponseParams)
-  return false;
-#undef DO_
-}
-
-void RateResponseParams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.RateResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // double actual_rate = 2;
-  if (this->actual_rate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->actual_rate(), output);
-  }
-
-  // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.RateResponseParams.error_message");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->error_message(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.RateResponseParams)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* RateResponseParams::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* RateResponseParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:flexsdr.RateResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // double actual_rate = 2;
-  if (this->actual_rate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->actual_rate(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rate = this->_internal_actual_rate();
+  uint64_t raw_actual_rate;
+  memcpy(&raw_actual_rate, &tmp_actual_rate, sizeof(tmp_actual_rate));
+  if (raw_actual_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_actual_rate(), target);
   }
 
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.RateResponseParams.error_message");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->error_message(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_message(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.RateResponseParams)
   return target;
@@ -2542,72 +2367,63 @@ size_t RateResponseParams::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.RateResponseParams)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->error_message());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
   }
 
   // double actual_rate = 2;
-  if (this->actual_rate() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rate = this->_internal_actual_rate();
+  uint64_t raw_actual_rate;
+  memcpy(&raw_actual_rate, &tmp_actual_rate, sizeof(tmp_actual_rate));
+  if (raw_actual_rate != 0) {
     total_size += 1 + 8;
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RateResponseParams::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.RateResponseParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RateResponseParams* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RateResponseParams>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.RateResponseParams)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.RateResponseParams)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RateResponseParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RateResponseParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RateResponseParams::GetClassData() const { return &_class_data_; }
 
-void RateResponseParams::MergeFrom(const RateResponseParams& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.RateResponseParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.error_message().size() > 0) {
+void RateResponseParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RateResponseParams*>(&to_msg);
+  auto& from = static_cast<const RateResponseParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.RateResponseParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
   }
-  if (from.actual_rate() != 0) {
-    set_actual_rate(from.actual_rate());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rate = from._internal_actual_rate();
+  uint64_t raw_actual_rate;
+  memcpy(&raw_actual_rate, &tmp_actual_rate, sizeof(tmp_actual_rate));
+  if (raw_actual_rate != 0) {
+    _this->_internal_set_actual_rate(from._internal_actual_rate());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void RateResponseParams::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.RateResponseParams)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RateResponseParams::CopyFrom(const RateResponseParams& from) {
@@ -2621,363 +2437,324 @@ bool RateResponseParams::IsInitialized() const {
   return true;
 }
 
-void RateResponseParams::Swap(RateResponseParams* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RateResponseParams::InternalSwap(RateResponseParams* other) {
   using std::swap;
-  error_message_.Swap(&other->error_message_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(actual_rate_, other->actual_rate_);
-  swap(success_, other->success_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata RateResponseParams::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RateResponseParams, _impl_.success_)
+      + sizeof(RateResponseParams::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(RateResponseParams, _impl_.actual_rate_)>(
+          reinterpret_cast<char*>(&_impl_.actual_rate_),
+          reinterpret_cast<char*>(&other->_impl_.actual_rate_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RateResponseParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void TuneRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TuneRequest::kTargetFreqFieldNumber;
-const int TuneRequest::kRfFreqPolicyFieldNumber;
-const int TuneRequest::kRfFreqFieldNumber;
-const int TuneRequest::kDspFreqPolicyFieldNumber;
-const int TuneRequest::kDspFreqFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class TuneRequest::_Internal {
+ public:
+};
 
-TuneRequest::TuneRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_TuneRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.TuneRequest)
+TuneRequest::TuneRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.TuneRequest)
 }
 TuneRequest::TuneRequest(const TuneRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&target_freq_, &from.target_freq_,
-    static_cast<size_t>(reinterpret_cast<char*>(&dsp_freq_) -
-    reinterpret_cast<char*>(&target_freq_)) + sizeof(dsp_freq_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TuneRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.target_freq_){}
+    , decltype(_impl_.rf_freq_){}
+    , decltype(_impl_.rf_freq_policy_){}
+    , decltype(_impl_.dsp_freq_policy_){}
+    , decltype(_impl_.dsp_freq_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.target_freq_, &from._impl_.target_freq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dsp_freq_) -
+    reinterpret_cast<char*>(&_impl_.target_freq_)) + sizeof(_impl_.dsp_freq_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.TuneRequest)
 }
 
-void TuneRequest::SharedCtor() {
-  ::memset(&target_freq_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&dsp_freq_) -
-      reinterpret_cast<char*>(&target_freq_)) + sizeof(dsp_freq_));
+inline void TuneRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.target_freq_){0}
+    , decltype(_impl_.rf_freq_){0}
+    , decltype(_impl_.rf_freq_policy_){0}
+    , decltype(_impl_.dsp_freq_policy_){0}
+    , decltype(_impl_.dsp_freq_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 TuneRequest::~TuneRequest() {
   // @@protoc_insertion_point(destructor:flexsdr.TuneRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TuneRequest::SharedDtor() {
+inline void TuneRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void TuneRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* TuneRequest::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const TuneRequest& TuneRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_TuneRequest.base);
-  return *internal_default_instance();
-}
-
-
 void TuneRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.TuneRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&target_freq_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&dsp_freq_) -
-      reinterpret_cast<char*>(&target_freq_)) + sizeof(dsp_freq_));
-  _internal_metadata_.Clear();
-}
-
-bool TuneRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.TuneRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.target_freq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dsp_freq_) -
+      reinterpret_cast<char*>(&_impl_.target_freq_)) + sizeof(_impl_.dsp_freq_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TuneRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // double target_freq = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(9u /* 9 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &target_freq_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.target_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .flexsdr.TuneRequest.Policy rf_freq_policy = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_rf_freq_policy(static_cast< ::flexsdr::TuneRequest_Policy >(value));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_rf_freq_policy(static_cast<::flexsdr::TuneRequest_Policy>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double rf_freq = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(25u /* 25 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &rf_freq_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.rf_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .flexsdr.TuneRequest.Policy dsp_freq_policy = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_dsp_freq_policy(static_cast< ::flexsdr::TuneRequest_Policy >(value));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_dsp_freq_policy(static_cast<::flexsdr::TuneRequest_Policy>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double dsp_freq = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(41u /* 41 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &dsp_freq_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.dsp_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.TuneRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.TuneRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void TuneRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.TuneRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* TuneRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.TuneRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // double target_freq = 1;
-  if (this->target_freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(1, this->target_freq(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_freq = this->_internal_target_freq();
+  uint64_t raw_target_freq;
+  memcpy(&raw_target_freq, &tmp_target_freq, sizeof(tmp_target_freq));
+  if (raw_target_freq != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_target_freq(), target);
   }
 
   // .flexsdr.TuneRequest.Policy rf_freq_policy = 2;
-  if (this->rf_freq_policy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->rf_freq_policy(), output);
+  if (this->_internal_rf_freq_policy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_rf_freq_policy(), target);
   }
 
   // double rf_freq = 3;
-  if (this->rf_freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(3, this->rf_freq(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rf_freq = this->_internal_rf_freq();
+  uint64_t raw_rf_freq;
+  memcpy(&raw_rf_freq, &tmp_rf_freq, sizeof(tmp_rf_freq));
+  if (raw_rf_freq != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_rf_freq(), target);
   }
 
   // .flexsdr.TuneRequest.Policy dsp_freq_policy = 4;
-  if (this->dsp_freq_policy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      4, this->dsp_freq_policy(), output);
+  if (this->_internal_dsp_freq_policy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_dsp_freq_policy(), target);
   }
 
   // double dsp_freq = 5;
-  if (this->dsp_freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(5, this->dsp_freq(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dsp_freq = this->_internal_dsp_freq();
+  uint64_t raw_dsp_freq;
+  memcpy(&raw_dsp_freq, &tmp_dsp_freq, sizeof(tmp_dsp_freq));
+  if (raw_dsp_freq != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_dsp_freq(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:flexsdr.TuneRequest)
-}
-
-::google::protobuf::uint8* TuneRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.TuneRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double target_freq = 1;
-  if (this->target_freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(1, this->target_freq(), target);
-  }
-
-  // .flexsdr.TuneRequest.Policy rf_freq_policy = 2;
-  if (this->rf_freq_policy() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->rf_freq_policy(), target);
-  }
-
-  // double rf_freq = 3;
-  if (this->rf_freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->rf_freq(), target);
-  }
-
-  // .flexsdr.TuneRequest.Policy dsp_freq_policy = 4;
-  if (this->dsp_freq_policy() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      4, this->dsp_freq_policy(), target);
-  }
-
-  // double dsp_freq = 5;
-  if (this->dsp_freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(5, this->dsp_freq(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.TuneRequest)
-  return target;
+  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.TuneRequest)
+  return target;
 }
 
 size_t TuneRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.TuneRequest)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // double target_freq = 1;
-  if (this->target_freq() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_freq = this->_internal_target_freq();
+  uint64_t raw_target_freq;
+  memcpy(&raw_target_freq, &tmp_target_freq, sizeof(tmp_target_freq));
+  if (raw_target_freq != 0) {
     total_size += 1 + 8;
   }
 
   // double rf_freq = 3;
-  if (this->rf_freq() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rf_freq = this->_internal_rf_freq();
+  uint64_t raw_rf_freq;
+  memcpy(&raw_rf_freq, &tmp_rf_freq, sizeof(tmp_rf_freq));
+  if (raw_rf_freq != 0) {
     total_size += 1 + 8;
   }
 
   // .flexsdr.TuneRequest.Policy rf_freq_policy = 2;
-  if (this->rf_freq_policy() != 0) {
+  if (this->_internal_rf_freq_policy() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->rf_freq_policy());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_rf_freq_policy());
   }
 
   // .flexsdr.TuneRequest.Policy dsp_freq_policy = 4;
-  if (this->dsp_freq_policy() != 0) {
+  if (this->_internal_dsp_freq_policy() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->dsp_freq_policy());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_dsp_freq_policy());
   }
 
   // double dsp_freq = 5;
-  if (this->dsp_freq() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dsp_freq = this->_internal_dsp_freq();
+  uint64_t raw_dsp_freq;
+  memcpy(&raw_dsp_freq, &tmp_dsp_freq, sizeof(tmp_dsp_freq));
+  if (raw_dsp_freq != 0) {
     total_size += 1 + 8;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TuneRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.TuneRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TuneRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const TuneRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.TuneRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.TuneRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TuneRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TuneRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TuneRequest::GetClassData() const { return &_class_data_; }
 
-void TuneRequest::MergeFrom(const TuneRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.TuneRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void TuneRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TuneRequest*>(&to_msg);
+  auto& from = static_cast<const TuneRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.TuneRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.target_freq() != 0) {
-    set_target_freq(from.target_freq());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_freq = from._internal_target_freq();
+  uint64_t raw_target_freq;
+  memcpy(&raw_target_freq, &tmp_target_freq, sizeof(tmp_target_freq));
+  if (raw_target_freq != 0) {
+    _this->_internal_set_target_freq(from._internal_target_freq());
   }
-  if (from.rf_freq() != 0) {
-    set_rf_freq(from.rf_freq());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rf_freq = from._internal_rf_freq();
+  uint64_t raw_rf_freq;
+  memcpy(&raw_rf_freq, &tmp_rf_freq, sizeof(tmp_rf_freq));
+  if (raw_rf_freq != 0) {
+    _this->_internal_set_rf_freq(from._internal_rf_freq());
   }
-  if (from.rf_freq_policy() != 0) {
-    set_rf_freq_policy(from.rf_freq_policy());
+  if (from._internal_rf_freq_policy() != 0) {
+    _this->_internal_set_rf_freq_policy(from._internal_rf_freq_policy());
   }
-  if (from.dsp_freq_policy() != 0) {
-    set_dsp_freq_policy(from.dsp_freq_policy());
+  if (from._internal_dsp_freq_policy() != 0) {
+    _this->_internal_set_dsp_freq_policy(from._internal_dsp_freq_policy());
   }
-  if (from.dsp_freq() != 0) {
-    set_dsp_freq(from.dsp_freq());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_dsp_freq = from._internal_dsp_freq();
+  uint64_t raw_dsp_freq;
+  memcpy(&raw_dsp_freq, &tmp_dsp_freq, sizeof(tmp_dsp_freq));
+  if (raw_dsp_freq != 0) {
+    _this->_internal_set_dsp_freq(from._internal_dsp_freq());
   }
-}
-
-void TuneRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.TuneRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TuneRequest::CopyFrom(const TuneRequest& from) {
@@ -2991,268 +2768,224 @@ bool TuneRequest::IsInitialized() const {
   return true;
 }
 
-void TuneRequest::Swap(TuneRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void TuneRequest::InternalSwap(TuneRequest* other) {
   using std::swap;
-  swap(target_freq_, other->target_freq_);
-  swap(rf_freq_, other->rf_freq_);
-  swap(rf_freq_policy_, other->rf_freq_policy_);
-  swap(dsp_freq_policy_, other->dsp_freq_policy_);
-  swap(dsp_freq_, other->dsp_freq_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TuneRequest, _impl_.dsp_freq_)
+      + sizeof(TuneRequest::_impl_.dsp_freq_)
+      - PROTOBUF_FIELD_OFFSET(TuneRequest, _impl_.target_freq_)>(
+          reinterpret_cast<char*>(&_impl_.target_freq_),
+          reinterpret_cast<char*>(&other->_impl_.target_freq_));
 }
 
-::google::protobuf::Metadata TuneRequest::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata TuneRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void TuneResult::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TuneResult::kClippedRfFreqFieldNumber;
-const int TuneResult::kTargetRfFreqFieldNumber;
-const int TuneResult::kActualRfFreqFieldNumber;
-const int TuneResult::kTargetDspFreqFieldNumber;
-const int TuneResult::kActualDspFreqFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class TuneResult::_Internal {
+ public:
+};
 
-TuneResult::TuneResult()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_TuneResult.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.TuneResult)
+TuneResult::TuneResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.TuneResult)
 }
 TuneResult::TuneResult(const TuneResult& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&clipped_rf_freq_, &from.clipped_rf_freq_,
-    static_cast<size_t>(reinterpret_cast<char*>(&actual_dsp_freq_) -
-    reinterpret_cast<char*>(&clipped_rf_freq_)) + sizeof(actual_dsp_freq_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TuneResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.clipped_rf_freq_){}
+    , decltype(_impl_.target_rf_freq_){}
+    , decltype(_impl_.actual_rf_freq_){}
+    , decltype(_impl_.target_dsp_freq_){}
+    , decltype(_impl_.actual_dsp_freq_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.clipped_rf_freq_, &from._impl_.clipped_rf_freq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.actual_dsp_freq_) -
+    reinterpret_cast<char*>(&_impl_.clipped_rf_freq_)) + sizeof(_impl_.actual_dsp_freq_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.TuneResult)
 }
 
-void TuneResult::SharedCtor() {
-  ::memset(&clipped_rf_freq_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&actual_dsp_freq_) -
-      reinterpret_cast<char*>(&clipped_rf_freq_)) + sizeof(actual_dsp_freq_));
+inline void TuneResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.clipped_rf_freq_){0}
+    , decltype(_impl_.target_rf_freq_){0}
+    , decltype(_impl_.actual_rf_freq_){0}
+    , decltype(_impl_.target_dsp_freq_){0}
+    , decltype(_impl_.actual_dsp_freq_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 TuneResult::~TuneResult() {
   // @@protoc_insertion_point(destructor:flexsdr.TuneResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TuneResult::SharedDtor() {
+inline void TuneResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void TuneResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* TuneResult::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const TuneResult& TuneResult::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_TuneResult.base);
-  return *internal_default_instance();
-}
-
-
 void TuneResult::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.TuneResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&clipped_rf_freq_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&actual_dsp_freq_) -
-      reinterpret_cast<char*>(&clipped_rf_freq_)) + sizeof(actual_dsp_freq_));
-  _internal_metadata_.Clear();
-}
-
-bool TuneResult::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.TuneResult)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.clipped_rf_freq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.actual_dsp_freq_) -
+      reinterpret_cast<char*>(&_impl_.clipped_rf_freq_)) + sizeof(_impl_.actual_dsp_freq_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TuneResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // double clipped_rf_freq = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(9u /* 9 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &clipped_rf_freq_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.clipped_rf_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double target_rf_freq = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &target_rf_freq_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.target_rf_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double actual_rf_freq = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(25u /* 25 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &actual_rf_freq_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.actual_rf_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double target_dsp_freq = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(33u /* 33 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &target_dsp_freq_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.target_dsp_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double actual_dsp_freq = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(41u /* 41 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &actual_dsp_freq_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.actual_dsp_freq_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.TuneResult)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.TuneResult)
-  return false;
-#undef DO_
-}
-
-void TuneResult::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.TuneResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double clipped_rf_freq = 1;
-  if (this->clipped_rf_freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(1, this->clipped_rf_freq(), output);
-  }
-
-  // double target_rf_freq = 2;
-  if (this->target_rf_freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->target_rf_freq(), output);
-  }
-
-  // double actual_rf_freq = 3;
-  if (this->actual_rf_freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(3, this->actual_rf_freq(), output);
-  }
-
-  // double target_dsp_freq = 4;
-  if (this->target_dsp_freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(4, this->target_dsp_freq(), output);
-  }
-
-  // double actual_dsp_freq = 5;
-  if (this->actual_dsp_freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(5, this->actual_dsp_freq(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.TuneResult)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* TuneResult::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* TuneResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:flexsdr.TuneResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // double clipped_rf_freq = 1;
-  if (this->clipped_rf_freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(1, this->clipped_rf_freq(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_clipped_rf_freq = this->_internal_clipped_rf_freq();
+  uint64_t raw_clipped_rf_freq;
+  memcpy(&raw_clipped_rf_freq, &tmp_clipped_rf_freq, sizeof(tmp_clipped_rf_freq));
+  if (raw_clipped_rf_freq != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_clipped_rf_freq(), target);
   }
 
   // double target_rf_freq = 2;
-  if (this->target_rf_freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->target_rf_freq(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_rf_freq = this->_internal_target_rf_freq();
+  uint64_t raw_target_rf_freq;
+  memcpy(&raw_target_rf_freq, &tmp_target_rf_freq, sizeof(tmp_target_rf_freq));
+  if (raw_target_rf_freq != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_target_rf_freq(), target);
   }
 
   // double actual_rf_freq = 3;
-  if (this->actual_rf_freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->actual_rf_freq(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rf_freq = this->_internal_actual_rf_freq();
+  uint64_t raw_actual_rf_freq;
+  memcpy(&raw_actual_rf_freq, &tmp_actual_rf_freq, sizeof(tmp_actual_rf_freq));
+  if (raw_actual_rf_freq != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_actual_rf_freq(), target);
   }
 
   // double target_dsp_freq = 4;
-  if (this->target_dsp_freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(4, this->target_dsp_freq(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_dsp_freq = this->_internal_target_dsp_freq();
+  uint64_t raw_target_dsp_freq;
+  memcpy(&raw_target_dsp_freq, &tmp_target_dsp_freq, sizeof(tmp_target_dsp_freq));
+  if (raw_target_dsp_freq != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_target_dsp_freq(), target);
   }
 
   // double actual_dsp_freq = 5;
-  if (this->actual_dsp_freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(5, this->actual_dsp_freq(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_dsp_freq = this->_internal_actual_dsp_freq();
+  uint64_t raw_actual_dsp_freq;
+  memcpy(&raw_actual_dsp_freq, &tmp_actual_dsp_freq, sizeof(tmp_actual_dsp_freq));
+  if (raw_actual_dsp_freq != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_actual_dsp_freq(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.TuneResult)
   return target;
@@ -3262,85 +2995,109 @@ size_t TuneResult::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.TuneResult)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // double clipped_rf_freq = 1;
-  if (this->clipped_rf_freq() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_clipped_rf_freq = this->_internal_clipped_rf_freq();
+  uint64_t raw_clipped_rf_freq;
+  memcpy(&raw_clipped_rf_freq, &tmp_clipped_rf_freq, sizeof(tmp_clipped_rf_freq));
+  if (raw_clipped_rf_freq != 0) {
     total_size += 1 + 8;
   }
 
   // double target_rf_freq = 2;
-  if (this->target_rf_freq() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_rf_freq = this->_internal_target_rf_freq();
+  uint64_t raw_target_rf_freq;
+  memcpy(&raw_target_rf_freq, &tmp_target_rf_freq, sizeof(tmp_target_rf_freq));
+  if (raw_target_rf_freq != 0) {
     total_size += 1 + 8;
   }
 
   // double actual_rf_freq = 3;
-  if (this->actual_rf_freq() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rf_freq = this->_internal_actual_rf_freq();
+  uint64_t raw_actual_rf_freq;
+  memcpy(&raw_actual_rf_freq, &tmp_actual_rf_freq, sizeof(tmp_actual_rf_freq));
+  if (raw_actual_rf_freq != 0) {
     total_size += 1 + 8;
   }
 
   // double target_dsp_freq = 4;
-  if (this->target_dsp_freq() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_dsp_freq = this->_internal_target_dsp_freq();
+  uint64_t raw_target_dsp_freq;
+  memcpy(&raw_target_dsp_freq, &tmp_target_dsp_freq, sizeof(tmp_target_dsp_freq));
+  if (raw_target_dsp_freq != 0) {
     total_size += 1 + 8;
   }
 
   // double actual_dsp_freq = 5;
-  if (this->actual_dsp_freq() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_dsp_freq = this->_internal_actual_dsp_freq();
+  uint64_t raw_actual_dsp_freq;
+  memcpy(&raw_actual_dsp_freq, &tmp_actual_dsp_freq, sizeof(tmp_actual_dsp_freq));
+  if (raw_actual_dsp_freq != 0) {
     total_size += 1 + 8;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TuneResult::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.TuneResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TuneResult* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const TuneResult>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.TuneResult)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.TuneResult)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TuneResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TuneResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TuneResult::GetClassData() const { return &_class_data_; }
 
-void TuneResult::MergeFrom(const TuneResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.TuneResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.clipped_rf_freq() != 0) {
-    set_clipped_rf_freq(from.clipped_rf_freq());
-  }
-  if (from.target_rf_freq() != 0) {
-    set_target_rf_freq(from.target_rf_freq());
-  }
-  if (from.actual_rf_freq() != 0) {
-    set_actual_rf_freq(from.actual_rf_freq());
-  }
-  if (from.target_dsp_freq() != 0) {
-    set_target_dsp_freq(from.target_dsp_freq());
-  }
-  if (from.actual_dsp_freq() != 0) {
-    set_actual_dsp_freq(from.actual_dsp_freq());
-  }
-}
+void TuneResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TuneResult*>(&to_msg);
+  auto& from = static_cast<const TuneResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.TuneResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void TuneResult::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.TuneResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_clipped_rf_freq = from._internal_clipped_rf_freq();
+  uint64_t raw_clipped_rf_freq;
+  memcpy(&raw_clipped_rf_freq, &tmp_clipped_rf_freq, sizeof(tmp_clipped_rf_freq));
+  if (raw_clipped_rf_freq != 0) {
+    _this->_internal_set_clipped_rf_freq(from._internal_clipped_rf_freq());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_rf_freq = from._internal_target_rf_freq();
+  uint64_t raw_target_rf_freq;
+  memcpy(&raw_target_rf_freq, &tmp_target_rf_freq, sizeof(tmp_target_rf_freq));
+  if (raw_target_rf_freq != 0) {
+    _this->_internal_set_target_rf_freq(from._internal_target_rf_freq());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_rf_freq = from._internal_actual_rf_freq();
+  uint64_t raw_actual_rf_freq;
+  memcpy(&raw_actual_rf_freq, &tmp_actual_rf_freq, sizeof(tmp_actual_rf_freq));
+  if (raw_actual_rf_freq != 0) {
+    _this->_internal_set_actual_rf_freq(from._internal_actual_rf_freq());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_target_dsp_freq = from._internal_target_dsp_freq();
+  uint64_t raw_target_dsp_freq;
+  memcpy(&raw_target_dsp_freq, &tmp_target_dsp_freq, sizeof(tmp_target_dsp_freq));
+  if (raw_target_dsp_freq != 0) {
+    _this->_internal_set_target_dsp_freq(from._internal_target_dsp_freq());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_dsp_freq = from._internal_actual_dsp_freq();
+  uint64_t raw_actual_dsp_freq;
+  memcpy(&raw_actual_dsp_freq, &tmp_actual_dsp_freq, sizeof(tmp_actual_dsp_freq));
+  if (raw_actual_dsp_freq != 0) {
+    _this->_internal_set_actual_dsp_freq(from._internal_actual_dsp_freq());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TuneResult::CopyFrom(const TuneResult& from) {
@@ -3354,213 +3111,216 @@ bool TuneResult::IsInitialized() const {
   return true;
 }
 
-void TuneResult::Swap(TuneResult* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void TuneResult::InternalSwap(TuneResult* other) {
   using std::swap;
-  swap(clipped_rf_freq_, other->clipped_rf_freq_);
-  swap(target_rf_freq_, other->target_rf_freq_);
-  swap(actual_rf_freq_, other->actual_rf_freq_);
-  swap(target_dsp_freq_, other->target_dsp_freq_);
-  swap(actual_dsp_freq_, other->actual_dsp_freq_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TuneResult, _impl_.actual_dsp_freq_)
+      + sizeof(TuneResult::_impl_.actual_dsp_freq_)
+      - PROTOBUF_FIELD_OFFSET(TuneResult, _impl_.clipped_rf_freq_)>(
+          reinterpret_cast<char*>(&_impl_.clipped_rf_freq_),
+          reinterpret_cast<char*>(&other->_impl_.clipped_rf_freq_));
 }
 
-::google::protobuf::Metadata TuneResult::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata TuneResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void FrequencyRequestParams::InitAsDefaultInstance() {
-  ::flexsdr::_FrequencyRequestParams_default_instance_._instance.get_mutable()->tune_request_ = const_cast< ::flexsdr::TuneRequest*>(
-      ::flexsdr::TuneRequest::internal_default_instance());
-  ::flexsdr::_FrequencyRequestParams_default_instance_._instance.get_mutable()->channel_request_ = const_cast< ::flexsdr::ChannelRequest*>(
-      ::flexsdr::ChannelRequest::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int FrequencyRequestParams::kTuneRequestFieldNumber;
-const int FrequencyRequestParams::kChannelRequestFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class FrequencyRequestParams::_Internal {
+ public:
+  static const ::flexsdr::TuneRequest& tune_request(const FrequencyRequestParams* msg);
+  static const ::flexsdr::ChannelRequest& channel_request(const FrequencyRequestParams* msg);
+};
 
-FrequencyRequestParams::FrequencyRequestParams()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_FrequencyRequestParams.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.FrequencyRequestParams)
+const ::flexsdr::TuneRequest&
+FrequencyRequestParams::_Internal::tune_request(const FrequencyRequestParams* msg) {
+  return *msg->_impl_.tune_request_;
+}
+const ::flexsdr::ChannelRequest&
+FrequencyRequestParams::_Internal::channel_request(const FrequencyRequestParams* msg) {
+  return *msg->_impl_.channel_request_;
+}
+FrequencyRequestParams::FrequencyRequestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.FrequencyRequestParams)
 }
 FrequencyRequestParams::FrequencyRequestParams(const FrequencyRequestParams& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_tune_request()) {
-    tune_request_ = new ::flexsdr::TuneRequest(*from.tune_request_);
-  } else {
-    tune_request_ = NULL;
-  }
-  if (from.has_channel_request()) {
-    channel_request_ = new ::flexsdr::ChannelRequest(*from.channel_request_);
-  } else {
-    channel_request_ = NULL;
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrequencyRequestParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tune_request_){nullptr}
+    , decltype(_impl_.channel_request_){nullptr}
+    , decltype(_impl_.command_time_ticks_){}
+    , decltype(_impl_.command_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_tune_request()) {
+    _this->_impl_.tune_request_ = new ::flexsdr::TuneRequest(*from._impl_.tune_request_);
+  }
+  if (from._internal_has_channel_request()) {
+    _this->_impl_.channel_request_ = new ::flexsdr::ChannelRequest(*from._impl_.channel_request_);
+  }
+  ::memcpy(&_impl_.command_time_ticks_, &from._impl_.command_time_ticks_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.command_id_) -
+    reinterpret_cast<char*>(&_impl_.command_time_ticks_)) + sizeof(_impl_.command_id_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.FrequencyRequestParams)
 }
 
-void FrequencyRequestParams::SharedCtor() {
-  ::memset(&tune_request_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&channel_request_) -
-      reinterpret_cast<char*>(&tune_request_)) + sizeof(channel_request_));
+inline void FrequencyRequestParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tune_request_){nullptr}
+    , decltype(_impl_.channel_request_){nullptr}
+    , decltype(_impl_.command_time_ticks_){uint64_t{0u}}
+    , decltype(_impl_.command_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 FrequencyRequestParams::~FrequencyRequestParams() {
   // @@protoc_insertion_point(destructor:flexsdr.FrequencyRequestParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void FrequencyRequestParams::SharedDtor() {
-  if (this != internal_default_instance()) delete tune_request_;
-  if (this != internal_default_instance()) delete channel_request_;
+inline void FrequencyRequestParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.tune_request_;
+  if (this != internal_default_instance()) delete _impl_.channel_request_;
 }
 
 void FrequencyRequestParams::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* FrequencyRequestParams::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const FrequencyRequestParams& FrequencyRequestParams::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_FrequencyRequestParams.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void FrequencyRequestParams::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.FrequencyRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && tune_request_ != NULL) {
-    delete tune_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.tune_request_ != nullptr) {
+    delete _impl_.tune_request_;
   }
-  tune_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && channel_request_ != NULL) {
-    delete channel_request_;
+  _impl_.tune_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.channel_request_ != nullptr) {
+    delete _impl_.channel_request_;
   }
-  channel_request_ = NULL;
-  _internal_metadata_.Clear();
+  _impl_.channel_request_ = nullptr;
+  ::memset(&_impl_.command_time_ticks_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.command_id_) -
+      reinterpret_cast<char*>(&_impl_.command_time_ticks_)) + sizeof(_impl_.command_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool FrequencyRequestParams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.FrequencyRequestParams)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* FrequencyRequestParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .flexsdr.TuneRequest tune_request = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_tune_request()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tune_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .flexsdr.ChannelRequest channel_request = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_channel_request()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channel_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 command_time_ticks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.command_time_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 command_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.command_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.FrequencyRequestParams)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.FrequencyRequestParams)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void FrequencyRequestParams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.FrequencyRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* FrequencyRequestParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.FrequencyRequestParams)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .flexsdr.TuneRequest tune_request = 1;
-  if (this->has_tune_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->_internal_tune_request(), output);
+  if (this->_internal_has_tune_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::tune_request(this),
+        _Internal::tune_request(this).GetCachedSize(), target, stream);
   }
 
   // .flexsdr.ChannelRequest channel_request = 2;
-  if (this->has_channel_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_channel_request(), output);
+  if (this->_internal_has_channel_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::channel_request(this),
+        _Internal::channel_request(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.FrequencyRequestParams)
-}
-
-::google::protobuf::uint8* FrequencyRequestParams::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.FrequencyRequestParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .flexsdr.TuneRequest tune_request = 1;
-  if (this->has_tune_request()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->_internal_tune_request(), deterministic, target);
+  // uint64 command_time_ticks = 3;
+  if (this->_internal_command_time_ticks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_command_time_ticks(), target);
   }
 
-  // .flexsdr.ChannelRequest channel_request = 2;
-  if (this->has_channel_request()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_channel_request(), deterministic, target);
+  // uint32 command_id = 4;
+  if (this->_internal_command_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_command_id(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.FrequencyRequestParams)
   return target;
@@ -3570,65 +3330,67 @@ size_t FrequencyRequestParams::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.FrequencyRequestParams)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // .flexsdr.TuneRequest tune_request = 1;
-  if (this->has_tune_request()) {
+  if (this->_internal_has_tune_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *tune_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.tune_request_);
   }
 
   // .flexsdr.ChannelRequest channel_request = 2;
-  if (this->has_channel_request()) {
+  if (this->_internal_has_channel_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *channel_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.channel_request_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint64 command_time_ticks = 3;
+  if (this->_internal_command_time_ticks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_command_time_ticks());
+  }
 
-void FrequencyRequestParams::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.FrequencyRequestParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  const FrequencyRequestParams* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const FrequencyRequestParams>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.FrequencyRequestParams)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.FrequencyRequestParams)
-    MergeFrom(*source);
+  // uint32 command_id = 4;
+  if (this->_internal_command_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_command_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void FrequencyRequestParams::MergeFrom(const FrequencyRequestParams& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.FrequencyRequestParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrequencyRequestParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrequencyRequestParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrequencyRequestParams::GetClassData() const { return &_class_data_; }
+
+
+void FrequencyRequestParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrequencyRequestParams*>(&to_msg);
+  auto& from = static_cast<const FrequencyRequestParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.FrequencyRequestParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_tune_request()) {
-    mutable_tune_request()->::flexsdr::TuneRequest::MergeFrom(from.tune_request());
+  if (from._internal_has_tune_request()) {
+    _this->_internal_mutable_tune_request()->::flexsdr::TuneRequest::MergeFrom(
+        from._internal_tune_request());
   }
-  if (from.has_channel_request()) {
-    mutable_channel_request()->::flexsdr::ChannelRequest::MergeFrom(from.channel_request());
+  if (from._internal_has_channel_request()) {
+    _this->_internal_mutable_channel_request()->::flexsdr::ChannelRequest::MergeFrom(
+        from._internal_channel_request());
   }
-}
-
-void FrequencyRequestParams::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.FrequencyRequestParams)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_command_time_ticks() != 0) {
+    _this->_internal_set_command_time_ticks(from._internal_command_time_ticks());
+  }
+  if (from._internal_command_id() != 0) {
+    _this->_internal_set_command_id(from._internal_command_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FrequencyRequestParams::CopyFrom(const FrequencyRequestParams& from) {
@@ -3642,244 +3404,202 @@ bool FrequencyRequestParams::IsInitialized() const {
   return true;
 }
 
-void FrequencyRequestParams::Swap(FrequencyRequestParams* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void FrequencyRequestParams::InternalSwap(FrequencyRequestParams* other) {
   using std::swap;
-  swap(tune_request_, other->tune_request_);
-  swap(channel_request_, other->channel_request_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrequencyRequestParams, _impl_.command_id_)
+      + sizeof(FrequencyRequestParams::_impl_.command_id_)
+      - PROTOBUF_FIELD_OFFSET(FrequencyRequestParams, _impl_.tune_request_)>(
+          reinterpret_cast<char*>(&_impl_.tune_request_),
+          reinterpret_cast<char*>(&other->_impl_.tune_request_));
 }
 
-::google::protobuf::Metadata FrequencyRequestParams::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata FrequencyRequestParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void FrequencyResponseParams::InitAsDefaultInstance() {
-  ::flexsdr::_FrequencyResponseParams_default_instance_._instance.get_mutable()->tune_result_ = const_cast< ::flexsdr::TuneResult*>(
-      ::flexsdr::TuneResult::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int FrequencyResponseParams::kSuccessFieldNumber;
-const int FrequencyResponseParams::kTuneResultFieldNumber;
-const int FrequencyResponseParams::kErrorMessageFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class FrequencyResponseParams::_Internal {
+ public:
+  static const ::flexsdr::TuneResult& tune_result(const FrequencyResponseParams* msg);
+};
 
-FrequencyResponseParams::FrequencyResponseParams()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_FrequencyResponseParams.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.FrequencyResponseParams)
+const ::flexsdr::TuneResult&
+FrequencyResponseParams::_Internal::tune_result(const FrequencyResponseParams* msg) {
+  return *msg->_impl_.tune_result_;
+}
+FrequencyResponseParams::FrequencyResponseParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.FrequencyResponseParams)
 }
 FrequencyResponseParams::FrequencyResponseParams(const FrequencyResponseParams& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  if (from.has_tune_result()) {
-    tune_result_ = new ::flexsdr::TuneResult(*from.tune_result_);
-  } else {
-    tune_result_ = NULL;
-  }
-  success_ = from.success_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrequencyResponseParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.tune_result_){nullptr}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_tune_result()) {
+    _this->_impl_.tune_result_ = new ::flexsdr::TuneResult(*from._impl_.tune_result_);
+  }
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:flexsdr.FrequencyResponseParams)
 }
 
-void FrequencyResponseParams::SharedCtor() {
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&tune_result_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&tune_result_)) + sizeof(success_));
+inline void FrequencyResponseParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.tune_result_){nullptr}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 FrequencyResponseParams::~FrequencyResponseParams() {
   // @@protoc_insertion_point(destructor:flexsdr.FrequencyResponseParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void FrequencyResponseParams::SharedDtor() {
-  error_message_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete tune_result_;
+inline void FrequencyResponseParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.tune_result_;
 }
 
 void FrequencyResponseParams::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* FrequencyResponseParams::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const FrequencyResponseParams& FrequencyResponseParams::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_FrequencyResponseParams.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void FrequencyResponseParams::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.FrequencyResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && tune_result_ != NULL) {
-    delete tune_result_;
-  }
-  tune_result_ = NULL;
-  success_ = false;
-  _internal_metadata_.Clear();
-}
-
-bool FrequencyResponseParams::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.FrequencyResponseParams)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.error_message_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.tune_result_ != nullptr) {
+    delete _impl_.tune_result_;
+  }
+  _impl_.tune_result_ = nullptr;
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FrequencyResponseParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .flexsdr.TuneResult tune_result = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_tune_result()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tune_result(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string error_message = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.FrequencyResponseParams.error_message"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.FrequencyResponseParams.error_message"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.FrequencyResponseParams)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.FrequencyResponseParams)
-  return false;
-#undef DO_
-}
-
-void FrequencyResponseParams::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.FrequencyResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // .flexsdr.TuneResult tune_result = 2;
-  if (this->has_tune_result()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_tune_result(), output);
-  }
-
-  // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.FrequencyResponseParams.error_message");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->error_message(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.FrequencyResponseParams)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* FrequencyResponseParams::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* FrequencyResponseParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:flexsdr.FrequencyResponseParams)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // .flexsdr.TuneResult tune_result = 2;
-  if (this->has_tune_result()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_tune_result(), deterministic, target);
+  if (this->_internal_has_tune_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::tune_result(this),
+        _Internal::tune_result(this).GetCachedSize(), target, stream);
   }
 
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.FrequencyResponseParams.error_message");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->error_message(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_message(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.FrequencyResponseParams)
   return target;
@@ -3889,74 +3609,58 @@ size_t FrequencyResponseParams::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.FrequencyResponseParams)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->error_message());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
   }
 
   // .flexsdr.TuneResult tune_result = 2;
-  if (this->has_tune_result()) {
+  if (this->_internal_has_tune_result()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *tune_result_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.tune_result_);
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void FrequencyResponseParams::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.FrequencyResponseParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  const FrequencyResponseParams* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const FrequencyResponseParams>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.FrequencyResponseParams)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.FrequencyResponseParams)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrequencyResponseParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrequencyResponseParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrequencyResponseParams::GetClassData() const { return &_class_data_; }
 
-void FrequencyResponseParams::MergeFrom(const FrequencyResponseParams& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.FrequencyResponseParams)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.error_message().size() > 0) {
+void FrequencyResponseParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrequencyResponseParams*>(&to_msg);
+  auto& from = static_cast<const FrequencyResponseParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.FrequencyResponseParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
   }
-  if (from.has_tune_result()) {
-    mutable_tune_result()->::flexsdr::TuneResult::MergeFrom(from.tune_result());
+  if (from._internal_has_tune_result()) {
+    _this->_internal_mutable_tune_result()->::flexsdr::TuneResult::MergeFrom(
+        from._internal_tune_result());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void FrequencyResponseParams::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.FrequencyResponseParams)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FrequencyResponseParams::CopyFrom(const FrequencyResponseParams& from) {
@@ -3970,237 +3674,202 @@ bool FrequencyResponseParams::IsInitialized() const {
   return true;
 }
 
-void FrequencyResponseParams::Swap(FrequencyResponseParams* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void FrequencyResponseParams::InternalSwap(FrequencyResponseParams* other) {
   using std::swap;
-  error_message_.Swap(&other->error_message_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(tune_result_, other->tune_result_);
-  swap(success_, other->success_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata FrequencyResponseParams::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrequencyResponseParams, _impl_.success_)
+      + sizeof(FrequencyResponseParams::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(FrequencyResponseParams, _impl_.tune_result_)>(
+          reinterpret_cast<char*>(&_impl_.tune_result_),
+          reinterpret_cast<char*>(&other->_impl_.tune_result_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FrequencyResponseParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void FrequencyValue::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int FrequencyValue::kSuccessFieldNumber;
-const int FrequencyValue::kFrequencyFieldNumber;
-const int FrequencyValue::kErrorMessageFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class FrequencyValue::_Internal {
+ public:
+};
 
-FrequencyValue::FrequencyValue()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_FrequencyValue.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.FrequencyValue)
+FrequencyValue::FrequencyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.FrequencyValue)
 }
 FrequencyValue::FrequencyValue(const FrequencyValue& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  ::memcpy(&frequency_, &from.frequency_,
-    static_cast<size_t>(reinterpret_cast<char*>(&success_) -
-    reinterpret_cast<char*>(&frequency_)) + sizeof(success_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrequencyValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.frequency_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.frequency_, &from._impl_.frequency_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.frequency_)) + sizeof(_impl_.success_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.FrequencyValue)
 }
 
-void FrequencyValue::SharedCtor() {
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&frequency_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&frequency_)) + sizeof(success_));
+inline void FrequencyValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.frequency_){0}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 FrequencyValue::~FrequencyValue() {
   // @@protoc_insertion_point(destructor:flexsdr.FrequencyValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void FrequencyValue::SharedDtor() {
-  error_message_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void FrequencyValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
 }
 
 void FrequencyValue::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* FrequencyValue::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const FrequencyValue& FrequencyValue::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_FrequencyValue.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void FrequencyValue::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.FrequencyValue)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&frequency_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&frequency_)) + sizeof(success_));
-  _internal_metadata_.Clear();
-}
-
-bool FrequencyValue::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.FrequencyValue)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.error_message_.ClearToEmpty();
+  ::memset(&_impl_.frequency_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.frequency_)) + sizeof(_impl_.success_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FrequencyValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double frequency = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &frequency_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.frequency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string error_message = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.FrequencyValue.error_message"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.FrequencyValue.error_message"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.FrequencyValue)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.FrequencyValue)
-  return false;
-#undef DO_
-}
-
-void FrequencyValue::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.FrequencyValue)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // double frequency = 2;
-  if (this->frequency() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->frequency(), output);
-  }
-
-  // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.FrequencyValue.error_message");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->error_message(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.FrequencyValue)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* FrequencyValue::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* FrequencyValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:flexsdr.FrequencyValue)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // double frequency = 2;
-  if (this->frequency() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->frequency(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_frequency = this->_internal_frequency();
+  uint64_t raw_frequency;
+  memcpy(&raw_frequency, &tmp_frequency, sizeof(tmp_frequency));
+  if (raw_frequency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_frequency(), target);
   }
 
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.FrequencyValue.error_message");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->error_message(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_message(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:flexsdr.FrequencyValue)
   return target;
@@ -4210,72 +3879,63 @@ size_t FrequencyValue::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:flexsdr.FrequencyValue)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string error_message = 3;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->error_message());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
   }
 
   // double frequency = 2;
-  if (this->frequency() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_frequency = this->_internal_frequency();
+  uint64_t raw_frequency;
+  memcpy(&raw_frequency, &tmp_frequency, sizeof(tmp_frequency));
+  if (raw_frequency != 0) {
     total_size += 1 + 8;
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void FrequencyValue::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.FrequencyValue)
-  GOOGLE_DCHECK_NE(&from, this);
-  const FrequencyValue* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const FrequencyValue>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.FrequencyValue)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.FrequencyValue)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrequencyValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrequencyValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrequencyValue::GetClassData() const { return &_class_data_; }
 
-void FrequencyValue::MergeFrom(const FrequencyValue& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.FrequencyValue)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.error_message().size() > 0) {
+void FrequencyValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrequencyValue*>(&to_msg);
+  auto& from = static_cast<const FrequencyValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.FrequencyValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
   }
-  if (from.frequency() != 0) {
-    set_frequency(from.frequency());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_frequency = from._internal_frequency();
+  uint64_t raw_frequency;
+  memcpy(&raw_frequency, &tmp_frequency, sizeof(tmp_frequency));
+  if (raw_frequency != 0) {
+    _this->_internal_set_frequency(from._internal_frequency());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void FrequencyValue::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.FrequencyValue)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FrequencyValue::CopyFrom(const FrequencyValue& from) {
@@ -4289,796 +3949,1629 @@ bool FrequencyValue::IsInitialized() const {
   return true;
 }
 
-void FrequencyValue::Swap(FrequencyValue* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void FrequencyValue::InternalSwap(FrequencyValue* other) {
   using std::swap;
-  error_message_.Swap(&other->error_message_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(frequency_, other->frequency_);
-  swap(success_, other->success_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata FrequencyValue::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrequencyValue, _impl_.success_)
+      + sizeof(FrequencyValue::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(FrequencyValue, _impl_.frequency_)>(
+          reinterpret_cast<char*>(&_impl_.frequency_),
+          reinterpret_cast<char*>(&other->_impl_.frequency_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FrequencyValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[11]);
 }
 
-
 // ===================================================================
 
-void DeviceInfoRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class DeviceInfoRequest::_Internal {
+ public:
+};
 
-DeviceInfoRequest::DeviceInfoRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_DeviceInfoRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.DeviceInfoRequest)
+DeviceInfoRequest::DeviceInfoRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:flexsdr.DeviceInfoRequest)
 }
 DeviceInfoRequest::DeviceInfoRequest(const DeviceInfoRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  DeviceInfoRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:flexsdr.DeviceInfoRequest)
 }
 
-void DeviceInfoRequest::SharedCtor() {
-}
 
-DeviceInfoRequest::~DeviceInfoRequest() {
-  // @@protoc_insertion_point(destructor:flexsdr.DeviceInfoRequest)
-  SharedDtor();
-}
 
-void DeviceInfoRequest::SharedDtor() {
-}
 
-void DeviceInfoRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* DeviceInfoRequest::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
 
-const DeviceInfoRequest& DeviceInfoRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_DeviceInfoRequest.base);
-  return *internal_default_instance();
-}
-
-
-void DeviceInfoRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:flexsdr.DeviceInfoRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _internal_metadata_.Clear();
-}
-
-bool DeviceInfoRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.DeviceInfoRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, _internal_metadata_.mutable_unknown_fields()));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.DeviceInfoRequest)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.DeviceInfoRequest)
-  return false;
-#undef DO_
-}
-
-void DeviceInfoRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.DeviceInfoRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:flexsdr.DeviceInfoRequest)
-}
-
-::google::protobuf::uint8* DeviceInfoRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.DeviceInfoRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.DeviceInfoRequest)
-  return target;
-}
-
-size_t DeviceInfoRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:flexsdr.DeviceInfoRequest)
-  size_t total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeviceInfoRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeviceInfoRequest::GetClassData() const { return &_class_data_; }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void DeviceInfoRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.DeviceInfoRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DeviceInfoRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const DeviceInfoRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.DeviceInfoRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.DeviceInfoRequest)
-    MergeFrom(*source);
-  }
-}
-
-void DeviceInfoRequest::MergeFrom(const DeviceInfoRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.DeviceInfoRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-}
 
-void DeviceInfoRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.DeviceInfoRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void DeviceInfoRequest::CopyFrom(const DeviceInfoRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:flexsdr.DeviceInfoRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool DeviceInfoRequest::IsInitialized() const {
-  return true;
-}
 
-void DeviceInfoRequest::Swap(DeviceInfoRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void DeviceInfoRequest::InternalSwap(DeviceInfoRequest* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
 
-::google::protobuf::Metadata DeviceInfoRequest::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata DeviceInfoRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void DeviceInfoResponse::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DeviceInfoResponse::kDeviceNameFieldNumber;
-const int DeviceInfoResponse::kSerialNumberFieldNumber;
-const int DeviceInfoResponse::kRxAntennasFieldNumber;
-const int DeviceInfoResponse::kTxAntennasFieldNumber;
-const int DeviceInfoResponse::kMinRxGainFieldNumber;
-const int DeviceInfoResponse::kMaxRxGainFieldNumber;
-const int DeviceInfoResponse::kMinTxGainFieldNumber;
-const int DeviceInfoResponse::kMaxTxGainFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-DeviceInfoResponse::DeviceInfoResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_flexsdr_2eproto::scc_info_DeviceInfoResponse.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:flexsdr.DeviceInfoResponse)
+class DeviceInfoResponse::_Internal {
+ public:
+};
+
+DeviceInfoResponse::DeviceInfoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.DeviceInfoResponse)
 }
 DeviceInfoResponse::DeviceInfoResponse(const DeviceInfoResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      rx_antennas_(from.rx_antennas_),
-      tx_antennas_(from.tx_antennas_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  device_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.device_name().size() > 0) {
-    device_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.device_name_);
-  }
-  serial_number_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.serial_number().size() > 0) {
-    serial_number_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.serial_number_);
-  }
-  ::memcpy(&min_rx_gain_, &from.min_rx_gain_,
-    static_cast<size_t>(reinterpret_cast<char*>(&max_tx_gain_) -
-    reinterpret_cast<char*>(&min_rx_gain_)) + sizeof(max_tx_gain_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeviceInfoResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rx_antennas_){from._impl_.rx_antennas_}
+    , decltype(_impl_.tx_antennas_){from._impl_.tx_antennas_}
+    , decltype(_impl_.device_name_){}
+    , decltype(_impl_.serial_number_){}
+    , decltype(_impl_.min_rx_gain_){}
+    , decltype(_impl_.max_rx_gain_){}
+    , decltype(_impl_.min_tx_gain_){}
+    , decltype(_impl_.max_tx_gain_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.device_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.device_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_device_name().empty()) {
+    _this->_impl_.device_name_.Set(from._internal_device_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.serial_number_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.serial_number_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_serial_number().empty()) {
+    _this->_impl_.serial_number_.Set(from._internal_serial_number(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.min_rx_gain_, &from._impl_.min_rx_gain_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_tx_gain_) -
+    reinterpret_cast<char*>(&_impl_.min_rx_gain_)) + sizeof(_impl_.max_tx_gain_));
   // @@protoc_insertion_point(copy_constructor:flexsdr.DeviceInfoResponse)
 }
 
-void DeviceInfoResponse::SharedCtor() {
-  device_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  serial_number_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&min_rx_gain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&max_tx_gain_) -
-      reinterpret_cast<char*>(&min_rx_gain_)) + sizeof(max_tx_gain_));
+inline void DeviceInfoResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rx_antennas_){arena}
+    , decltype(_impl_.tx_antennas_){arena}
+    , decltype(_impl_.device_name_){}
+    , decltype(_impl_.serial_number_){}
+    , decltype(_impl_.min_rx_gain_){0}
+    , decltype(_impl_.max_rx_gain_){0}
+    , decltype(_impl_.min_tx_gain_){0}
+    , decltype(_impl_.max_tx_gain_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.device_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.device_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.serial_number_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.serial_number_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DeviceInfoResponse::~DeviceInfoResponse() {
   // @@protoc_insertion_point(destructor:flexsdr.DeviceInfoResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DeviceInfoResponse::SharedDtor() {
-  device_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  serial_number_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void DeviceInfoResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rx_antennas_.~RepeatedPtrField();
+  _impl_.tx_antennas_.~RepeatedPtrField();
+  _impl_.device_name_.Destroy();
+  _impl_.serial_number_.Destroy();
 }
 
 void DeviceInfoResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* DeviceInfoResponse::descriptor() {
-  ::protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const DeviceInfoResponse& DeviceInfoResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_flexsdr_2eproto::scc_info_DeviceInfoResponse.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void DeviceInfoResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:flexsdr.DeviceInfoResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rx_antennas_.Clear();
-  tx_antennas_.Clear();
-  device_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  serial_number_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&min_rx_gain_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&max_tx_gain_) -
-      reinterpret_cast<char*>(&min_rx_gain_)) + sizeof(max_tx_gain_));
-  _internal_metadata_.Clear();
-}
-
-bool DeviceInfoResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:flexsdr.DeviceInfoResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.rx_antennas_.Clear();
+  _impl_.tx_antennas_.Clear();
+  _impl_.device_name_.ClearToEmpty();
+  _impl_.serial_number_.ClearToEmpty();
+  ::memset(&_impl_.min_rx_gain_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_tx_gain_) -
+      reinterpret_cast<char*>(&_impl_.min_rx_gain_)) + sizeof(_impl_.max_tx_gain_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeviceInfoResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string device_name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_device_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->device_name().data(), static_cast<int>(this->device_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.DeviceInfoResponse.device_name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_device_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.DeviceInfoResponse.device_name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string serial_number = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_serial_number()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->serial_number().data(), static_cast<int>(this->serial_number().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.DeviceInfoResponse.serial_number"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_serial_number();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.DeviceInfoResponse.serial_number"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated string rx_antennas = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_rx_antennas()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->rx_antennas(this->rx_antennas_size() - 1).data(),
-            static_cast<int>(this->rx_antennas(this->rx_antennas_size() - 1).length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.DeviceInfoResponse.rx_antennas"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_rx_antennas();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "flexsdr.DeviceInfoResponse.rx_antennas"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated string tx_antennas = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_tx_antennas()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->tx_antennas(this->tx_antennas_size() - 1).data(),
-            static_cast<int>(this->tx_antennas(this->tx_antennas_size() - 1).length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "flexsdr.DeviceInfoResponse.tx_antennas"));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_tx_antennas();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "flexsdr.DeviceInfoResponse.tx_antennas"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double min_rx_gain = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(41u /* 41 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &min_rx_gain_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.min_rx_gain_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double max_rx_gain = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(49u /* 49 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &max_rx_gain_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.max_rx_gain_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double min_tx_gain = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(57u /* 57 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &min_tx_gain_)));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.min_tx_gain_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double max_tx_gain = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(65u /* 65 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &max_tx_gain_)));
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.max_tx_gain_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:flexsdr.DeviceInfoResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:flexsdr.DeviceInfoResponse)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void DeviceInfoResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:flexsdr.DeviceInfoResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* DeviceInfoResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.DeviceInfoResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string device_name = 1;
-  if (this->device_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->device_name().data(), static_cast<int>(this->device_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_device_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_device_name().data(), static_cast<int>(this->_internal_device_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.DeviceInfoResponse.device_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->device_name(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_device_name(), target);
   }
 
   // string serial_number = 2;
-  if (this->serial_number().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->serial_number().data(), static_cast<int>(this->serial_number().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_serial_number().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_serial_number().data(), static_cast<int>(this->_internal_serial_number().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.DeviceInfoResponse.serial_number");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->serial_number(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_serial_number(), target);
   }
 
   // repeated string rx_antennas = 3;
-  for (int i = 0, n = this->rx_antennas_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->rx_antennas(i).data(), static_cast<int>(this->rx_antennas(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_rx_antennas_size(); i < n; i++) {
+    const auto& s = this->_internal_rx_antennas(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.DeviceInfoResponse.rx_antennas");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->rx_antennas(i), output);
+    target = stream->WriteString(3, s, target);
   }
 
   // repeated string tx_antennas = 4;
-  for (int i = 0, n = this->tx_antennas_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->tx_antennas(i).data(), static_cast<int>(this->tx_antennas(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_tx_antennas_size(); i < n; i++) {
+    const auto& s = this->_internal_tx_antennas(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "flexsdr.DeviceInfoResponse.tx_antennas");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      4, this->tx_antennas(i), output);
+    target = stream->WriteString(4, s, target);
   }
 
   // double min_rx_gain = 5;
-  if (this->min_rx_gain() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(5, this->min_rx_gain(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_rx_gain = this->_internal_min_rx_gain();
+  uint64_t raw_min_rx_gain;
+  memcpy(&raw_min_rx_gain, &tmp_min_rx_gain, sizeof(tmp_min_rx_gain));
+  if (raw_min_rx_gain != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_min_rx_gain(), target);
   }
 
   // double max_rx_gain = 6;
-  if (this->max_rx_gain() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(6, this->max_rx_gain(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_rx_gain = this->_internal_max_rx_gain();
+  uint64_t raw_max_rx_gain;
+  memcpy(&raw_max_rx_gain, &tmp_max_rx_gain, sizeof(tmp_max_rx_gain));
+  if (raw_max_rx_gain != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_max_rx_gain(), target);
   }
 
   // double min_tx_gain = 7;
-  if (this->min_tx_gain() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(7, this->min_tx_gain(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_tx_gain = this->_internal_min_tx_gain();
+  uint64_t raw_min_tx_gain;
+  memcpy(&raw_min_tx_gain, &tmp_min_tx_gain, sizeof(tmp_min_tx_gain));
+  if (raw_min_tx_gain != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_min_tx_gain(), target);
   }
 
   // double max_tx_gain = 8;
-  if (this->max_tx_gain() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(8, this->max_tx_gain(), output);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_tx_gain = this->_internal_max_tx_gain();
+  uint64_t raw_max_tx_gain;
+  memcpy(&raw_max_tx_gain, &tmp_max_tx_gain, sizeof(tmp_max_tx_gain));
+  if (raw_max_tx_gain != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_max_tx_gain(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:flexsdr.DeviceInfoResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.DeviceInfoResponse)
+  return target;
 }
 
-::google::protobuf::uint8* DeviceInfoResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.DeviceInfoResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t DeviceInfoResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:flexsdr.DeviceInfoResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string device_name = 1;
-  if (this->device_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->device_name().data(), static_cast<int>(this->device_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.DeviceInfoResponse.device_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->device_name(), target);
+  // repeated string rx_antennas = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.rx_antennas_.size());
+  for (int i = 0, n = _impl_.rx_antennas_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.rx_antennas_.Get(i));
   }
 
-  // string serial_number = 2;
-  if (this->serial_number().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->serial_number().data(), static_cast<int>(this->serial_number().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.DeviceInfoResponse.serial_number");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->serial_number(), target);
+  // repeated string tx_antennas = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.tx_antennas_.size());
+  for (int i = 0, n = _impl_.tx_antennas_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.tx_antennas_.Get(i));
   }
 
-  // repeated string rx_antennas = 3;
-  for (int i = 0, n = this->rx_antennas_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->rx_antennas(i).data(), static_cast<int>(this->rx_antennas(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.DeviceInfoResponse.rx_antennas");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(3, this->rx_antennas(i), target);
+  // string device_name = 1;
+  if (!this->_internal_device_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_device_name());
   }
 
-  // repeated string tx_antennas = 4;
-  for (int i = 0, n = this->tx_antennas_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->tx_antennas(i).data(), static_cast<int>(this->tx_antennas(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "flexsdr.DeviceInfoResponse.tx_antennas");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(4, this->tx_antennas(i), target);
+  // string serial_number = 2;
+  if (!this->_internal_serial_number().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_serial_number());
   }
 
   // double min_rx_gain = 5;
-  if (this->min_rx_gain() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(5, this->min_rx_gain(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_rx_gain = this->_internal_min_rx_gain();
+  uint64_t raw_min_rx_gain;
+  memcpy(&raw_min_rx_gain, &tmp_min_rx_gain, sizeof(tmp_min_rx_gain));
+  if (raw_min_rx_gain != 0) {
+    total_size += 1 + 8;
   }
 
   // double max_rx_gain = 6;
-  if (this->max_rx_gain() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(6, this->max_rx_gain(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_rx_gain = this->_internal_max_rx_gain();
+  uint64_t raw_max_rx_gain;
+  memcpy(&raw_max_rx_gain, &tmp_max_rx_gain, sizeof(tmp_max_rx_gain));
+  if (raw_max_rx_gain != 0) {
+    total_size += 1 + 8;
   }
 
   // double min_tx_gain = 7;
-  if (this->min_tx_gain() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(7, this->min_tx_gain(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_tx_gain = this->_internal_min_tx_gain();
+  uint64_t raw_min_tx_gain;
+  memcpy(&raw_min_tx_gain, &tmp_min_tx_gain, sizeof(tmp_min_tx_gain));
+  if (raw_min_tx_gain != 0) {
+    total_size += 1 + 8;
   }
 
   // double max_tx_gain = 8;
-  if (this->max_tx_gain() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(8, this->max_tx_gain(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_tx_gain = this->_internal_max_tx_gain();
+  uint64_t raw_max_tx_gain;
+  memcpy(&raw_max_tx_gain, &tmp_max_tx_gain, sizeof(tmp_max_tx_gain));
+  if (raw_max_tx_gain != 0) {
+    total_size += 1 + 8;
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeviceInfoResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeviceInfoResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeviceInfoResponse::GetClassData() const { return &_class_data_; }
+
+
+void DeviceInfoResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeviceInfoResponse*>(&to_msg);
+  auto& from = static_cast<const DeviceInfoResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.DeviceInfoResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rx_antennas_.MergeFrom(from._impl_.rx_antennas_);
+  _this->_impl_.tx_antennas_.MergeFrom(from._impl_.tx_antennas_);
+  if (!from._internal_device_name().empty()) {
+    _this->_internal_set_device_name(from._internal_device_name());
+  }
+  if (!from._internal_serial_number().empty()) {
+    _this->_internal_set_serial_number(from._internal_serial_number());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_rx_gain = from._internal_min_rx_gain();
+  uint64_t raw_min_rx_gain;
+  memcpy(&raw_min_rx_gain, &tmp_min_rx_gain, sizeof(tmp_min_rx_gain));
+  if (raw_min_rx_gain != 0) {
+    _this->_internal_set_min_rx_gain(from._internal_min_rx_gain());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_rx_gain = from._internal_max_rx_gain();
+  uint64_t raw_max_rx_gain;
+  memcpy(&raw_max_rx_gain, &tmp_max_rx_gain, sizeof(tmp_max_rx_gain));
+  if (raw_max_rx_gain != 0) {
+    _this->_internal_set_max_rx_gain(from._internal_max_rx_gain());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_tx_gain = from._internal_min_tx_gain();
+  uint64_t raw_min_tx_gain;
+  memcpy(&raw_min_tx_gain, &tmp_min_tx_gain, sizeof(tmp_min_tx_gain));
+  if (raw_min_tx_gain != 0) {
+    _this->_internal_set_min_tx_gain(from._internal_min_tx_gain());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_tx_gain = from._internal_max_tx_gain();
+  uint64_t raw_max_tx_gain;
+  memcpy(&raw_max_tx_gain, &tmp_max_tx_gain, sizeof(tmp_max_tx_gain));
+  if (raw_max_tx_gain != 0) {
+    _this->_internal_set_max_tx_gain(from._internal_max_tx_gain());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeviceInfoResponse::CopyFrom(const DeviceInfoResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:flexsdr.DeviceInfoResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeviceInfoResponse::IsInitialized() const {
+  return true;
+}
+
+void DeviceInfoResponse::InternalSwap(DeviceInfoResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rx_antennas_.InternalSwap(&other->_impl_.rx_antennas_);
+  _impl_.tx_antennas_.InternalSwap(&other->_impl_.tx_antennas_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.device_name_, lhs_arena,
+      &other->_impl_.device_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.serial_number_, lhs_arena,
+      &other->_impl_.serial_number_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DeviceInfoResponse, _impl_.max_tx_gain_)
+      + sizeof(DeviceInfoResponse::_impl_.max_tx_gain_)
+      - PROTOBUF_FIELD_OFFSET(DeviceInfoResponse, _impl_.min_rx_gain_)>(
+          reinterpret_cast<char*>(&_impl_.min_rx_gain_),
+          reinterpret_cast<char*>(&other->_impl_.min_rx_gain_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeviceInfoResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[13]);
+}
+
+// ===================================================================
+
+class ParamChange::_Internal {
+ public:
+};
+
+ParamChange::ParamChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.ParamChange)
+}
+ParamChange::ParamChange(const ParamChange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ParamChange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kind_){}
+    , decltype(_impl_.chan_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.command_time_ticks_){}
+    , decltype(_impl_.command_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.kind_, &from._impl_.kind_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.command_id_) -
+    reinterpret_cast<char*>(&_impl_.kind_)) + sizeof(_impl_.command_id_));
+  // @@protoc_insertion_point(copy_constructor:flexsdr.ParamChange)
+}
+
+inline void ParamChange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kind_){0}
+    , decltype(_impl_.chan_){0u}
+    , decltype(_impl_.value_){0}
+    , decltype(_impl_.command_time_ticks_){uint64_t{0u}}
+    , decltype(_impl_.command_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ParamChange::~ParamChange() {
+  // @@protoc_insertion_point(destructor:flexsdr.ParamChange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.DeviceInfoResponse)
-  return target;
+  SharedDtor();
 }
 
-size_t DeviceInfoResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:flexsdr.DeviceInfoResponse)
-  size_t total_size = 0;
+inline void ParamChange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+void ParamChange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ParamChange::Clear() {
+// @@protoc_insertion_point(message_clear_start:flexsdr.ParamChange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.kind_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.command_id_) -
+      reinterpret_cast<char*>(&_impl_.kind_)) + sizeof(_impl_.command_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ParamChange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .flexsdr.ParamChange.Kind kind = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_kind(static_cast<::flexsdr::ParamChange_Kind>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chan = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.chan_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 command_time_ticks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.command_time_ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 command_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.command_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ParamChange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.ParamChange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .flexsdr.ParamChange.Kind kind = 1;
+  if (this->_internal_kind() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_kind(), target);
   }
-  // repeated string rx_antennas = 3;
-  total_size += 1 *
-      ::google::protobuf::internal::FromIntSize(this->rx_antennas_size());
-  for (int i = 0, n = this->rx_antennas_size(); i < n; i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->rx_antennas(i));
+
+  // uint32 chan = 2;
+  if (this->_internal_chan() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_chan(), target);
   }
 
-  // repeated string tx_antennas = 4;
-  total_size += 1 *
-      ::google::protobuf::internal::FromIntSize(this->tx_antennas_size());
-  for (int i = 0, n = this->tx_antennas_size(); i < n; i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->tx_antennas(i));
+  // double value = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_value(), target);
   }
 
-  // string device_name = 1;
-  if (this->device_name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->device_name());
+  // uint64 command_time_ticks = 4;
+  if (this->_internal_command_time_ticks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_command_time_ticks(), target);
   }
 
-  // string serial_number = 2;
-  if (this->serial_number().size() > 0) {
+  // uint32 command_id = 5;
+  if (this->_internal_command_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_command_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.ParamChange)
+  return target;
+}
+
+size_t ParamChange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:flexsdr.ParamChange)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .flexsdr.ParamChange.Kind kind = 1;
+  if (this->_internal_kind() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->serial_number());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_kind());
   }
 
-  // double min_rx_gain = 5;
-  if (this->min_rx_gain() != 0) {
-    total_size += 1 + 8;
+  // uint32 chan = 2;
+  if (this->_internal_chan() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chan());
   }
 
-  // double max_rx_gain = 6;
-  if (this->max_rx_gain() != 0) {
+  // double value = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
     total_size += 1 + 8;
   }
 
-  // double min_tx_gain = 7;
-  if (this->min_tx_gain() != 0) {
-    total_size += 1 + 8;
+  // uint64 command_time_ticks = 4;
+  if (this->_internal_command_time_ticks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_command_time_ticks());
   }
 
-  // double max_tx_gain = 8;
-  if (this->max_tx_gain() != 0) {
-    total_size += 1 + 8;
+  // uint32 command_id = 5;
+  if (this->_internal_command_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_command_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DeviceInfoResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:flexsdr.DeviceInfoResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DeviceInfoResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const DeviceInfoResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:flexsdr.DeviceInfoResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:flexsdr.DeviceInfoResponse)
-    MergeFrom(*source);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParamChange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ParamChange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParamChange::GetClassData() const { return &_class_data_; }
+
+
+void ParamChange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ParamChange*>(&to_msg);
+  auto& from = static_cast<const ParamChange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ParamChange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_kind() != 0) {
+    _this->_internal_set_kind(from._internal_kind());
+  }
+  if (from._internal_chan() != 0) {
+    _this->_internal_set_chan(from._internal_chan());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = from._internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_command_time_ticks() != 0) {
+    _this->_internal_set_command_time_ticks(from._internal_command_time_ticks());
   }
+  if (from._internal_command_id() != 0) {
+    _this->_internal_set_command_id(from._internal_command_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ParamChange::CopyFrom(const ParamChange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:flexsdr.ParamChange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-void DeviceInfoResponse::MergeFrom(const DeviceInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.DeviceInfoResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+bool ParamChange::IsInitialized() const {
+  return true;
+}
+
+void ParamChange::InternalSwap(ParamChange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ParamChange, _impl_.command_id_)
+      + sizeof(ParamChange::_impl_.command_id_)
+      - PROTOBUF_FIELD_OFFSET(ParamChange, _impl_.kind_)>(
+          reinterpret_cast<char*>(&_impl_.kind_),
+          reinterpret_cast<char*>(&other->_impl_.kind_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ParamChange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[14]);
+}
+
+// ===================================================================
+
+class ApplySettingsRequest::_Internal {
+ public:
+};
+
+ApplySettingsRequest::ApplySettingsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.ApplySettingsRequest)
+}
+ApplySettingsRequest::ApplySettingsRequest(const ApplySettingsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ApplySettingsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changes_){from._impl_.changes_}
+    , decltype(_impl_.stop_on_error_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.stop_on_error_ = from._impl_.stop_on_error_;
+  // @@protoc_insertion_point(copy_constructor:flexsdr.ApplySettingsRequest)
+}
+
+inline void ApplySettingsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changes_){arena}
+    , decltype(_impl_.stop_on_error_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ApplySettingsRequest::~ApplySettingsRequest() {
+  // @@protoc_insertion_point(destructor:flexsdr.ApplySettingsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ApplySettingsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.changes_.~RepeatedPtrField();
+}
+
+void ApplySettingsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ApplySettingsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:flexsdr.ApplySettingsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rx_antennas_.MergeFrom(from.rx_antennas_);
-  tx_antennas_.MergeFrom(from.tx_antennas_);
-  if (from.device_name().size() > 0) {
+  _impl_.changes_.Clear();
+  _impl_.stop_on_error_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ApplySettingsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .flexsdr.ParamChange changes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_changes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool stop_on_error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.stop_on_error_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-    device_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.device_name_);
+uint8_t* ApplySettingsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.ApplySettingsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .flexsdr.ParamChange changes = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_changes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_changes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
-  if (from.serial_number().size() > 0) {
 
-    serial_number_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.serial_number_);
+  // bool stop_on_error = 2;
+  if (this->_internal_stop_on_error() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_stop_on_error(), target);
   }
-  if (from.min_rx_gain() != 0) {
-    set_min_rx_gain(from.min_rx_gain());
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  if (from.max_rx_gain() != 0) {
-    set_max_rx_gain(from.max_rx_gain());
+  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.ApplySettingsRequest)
+  return target;
+}
+
+size_t ApplySettingsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:flexsdr.ApplySettingsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .flexsdr.ParamChange changes = 1;
+  total_size += 1UL * this->_internal_changes_size();
+  for (const auto& msg : this->_impl_.changes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  if (from.min_tx_gain() != 0) {
-    set_min_tx_gain(from.min_tx_gain());
+
+  // bool stop_on_error = 2;
+  if (this->_internal_stop_on_error() != 0) {
+    total_size += 1 + 1;
   }
-  if (from.max_tx_gain() != 0) {
-    set_max_tx_gain(from.max_tx_gain());
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ApplySettingsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ApplySettingsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ApplySettingsRequest::GetClassData() const { return &_class_data_; }
+
+
+void ApplySettingsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ApplySettingsRequest*>(&to_msg);
+  auto& from = static_cast<const ApplySettingsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ApplySettingsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.changes_.MergeFrom(from._impl_.changes_);
+  if (from._internal_stop_on_error() != 0) {
+    _this->_internal_set_stop_on_error(from._internal_stop_on_error());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DeviceInfoResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:flexsdr.DeviceInfoResponse)
+void ApplySettingsRequest::CopyFrom(const ApplySettingsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:flexsdr.ApplySettingsRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void DeviceInfoResponse::CopyFrom(const DeviceInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:flexsdr.DeviceInfoResponse)
+bool ApplySettingsRequest::IsInitialized() const {
+  return true;
+}
+
+void ApplySettingsRequest::InternalSwap(ApplySettingsRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.changes_.InternalSwap(&other->_impl_.changes_);
+  swap(_impl_.stop_on_error_, other->_impl_.stop_on_error_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ApplySettingsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[15]);
+}
+
+// ===================================================================
+
+class ParamResult::_Internal {
+ public:
+};
+
+ParamResult::ParamResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.ParamResult)
+}
+ParamResult::ParamResult(const ParamResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ParamResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.actual_value_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.actual_value_, &from._impl_.actual_value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.actual_value_)) + sizeof(_impl_.success_));
+  // @@protoc_insertion_point(copy_constructor:flexsdr.ParamResult)
+}
+
+inline void ParamResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.actual_value_){0}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ParamResult::~ParamResult() {
+  // @@protoc_insertion_point(destructor:flexsdr.ParamResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ParamResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
+}
+
+void ParamResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ParamResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:flexsdr.ParamResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_message_.ClearToEmpty();
+  ::memset(&_impl_.actual_value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.actual_value_)) + sizeof(_impl_.success_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ParamResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double actual_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.actual_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "flexsdr.ParamResult.error_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ParamResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.ParamResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // double actual_value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_value = this->_internal_actual_value();
+  uint64_t raw_actual_value;
+  memcpy(&raw_actual_value, &tmp_actual_value, sizeof(tmp_actual_value));
+  if (raw_actual_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_actual_value(), target);
+  }
+
+  // string error_message = 3;
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "flexsdr.ParamResult.error_message");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.ParamResult)
+  return target;
+}
+
+size_t ParamResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:flexsdr.ParamResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string error_message = 3;
+  if (!this->_internal_error_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
+  }
+
+  // double actual_value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_value = this->_internal_actual_value();
+  uint64_t raw_actual_value;
+  memcpy(&raw_actual_value, &tmp_actual_value, sizeof(tmp_actual_value));
+  if (raw_actual_value != 0) {
+    total_size += 1 + 8;
+  }
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParamResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ParamResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParamResult::GetClassData() const { return &_class_data_; }
+
+
+void ParamResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ParamResult*>(&to_msg);
+  auto& from = static_cast<const ParamResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ParamResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_actual_value = from._internal_actual_value();
+  uint64_t raw_actual_value;
+  memcpy(&raw_actual_value, &tmp_actual_value, sizeof(tmp_actual_value));
+  if (raw_actual_value != 0) {
+    _this->_internal_set_actual_value(from._internal_actual_value());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ParamResult::CopyFrom(const ParamResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:flexsdr.ParamResult)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DeviceInfoResponse::IsInitialized() const {
+bool ParamResult::IsInitialized() const {
   return true;
 }
 
-void DeviceInfoResponse::Swap(DeviceInfoResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void DeviceInfoResponse::InternalSwap(DeviceInfoResponse* other) {
+void ParamResult::InternalSwap(ParamResult* other) {
   using std::swap;
-  rx_antennas_.InternalSwap(CastToBase(&other->rx_antennas_));
-  tx_antennas_.InternalSwap(CastToBase(&other->tx_antennas_));
-  device_name_.Swap(&other->device_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  serial_number_.Swap(&other->serial_number_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(min_rx_gain_, other->min_rx_gain_);
-  swap(max_rx_gain_, other->max_rx_gain_);
-  swap(min_tx_gain_, other->min_tx_gain_);
-  swap(max_tx_gain_, other->max_tx_gain_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ParamResult, _impl_.success_)
+      + sizeof(ParamResult::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(ParamResult, _impl_.actual_value_)>(
+          reinterpret_cast<char*>(&_impl_.actual_value_),
+          reinterpret_cast<char*>(&other->_impl_.actual_value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ParamResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[16]);
 }
 
-::google::protobuf::Metadata DeviceInfoResponse::GetMetadata() const {
-  protobuf_flexsdr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_flexsdr_2eproto::file_level_metadata[kIndexInFileMessages];
+// ===================================================================
+
+class ApplySettingsResponse::_Internal {
+ public:
+};
+
+ApplySettingsResponse::ApplySettingsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:flexsdr.ApplySettingsResponse)
+}
+ApplySettingsResponse::ApplySettingsResponse(const ApplySettingsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ApplySettingsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.success_ = from._impl_.success_;
+  // @@protoc_insertion_point(copy_constructor:flexsdr.ApplySettingsResponse)
+}
+
+inline void ApplySettingsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ApplySettingsResponse::~ApplySettingsResponse() {
+  // @@protoc_insertion_point(destructor:flexsdr.ApplySettingsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ApplySettingsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+}
+
+void ApplySettingsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
+void ApplySettingsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:flexsdr.ApplySettingsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ApplySettingsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .flexsdr.ParamResult results = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ApplySettingsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:flexsdr.ApplySettingsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // repeated .flexsdr.ParamResult results = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:flexsdr.ApplySettingsResponse)
+  return target;
+}
+
+size_t ApplySettingsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:flexsdr.ApplySettingsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .flexsdr.ParamResult results = 2;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ApplySettingsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ApplySettingsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ApplySettingsResponse::GetClassData() const { return &_class_data_; }
+
+
+void ApplySettingsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ApplySettingsResponse*>(&to_msg);
+  auto& from = static_cast<const ApplySettingsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:flexsdr.ApplySettingsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ApplySettingsResponse::CopyFrom(const ApplySettingsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:flexsdr.ApplySettingsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ApplySettingsResponse::IsInitialized() const {
+  return true;
+}
+
+void ApplySettingsResponse::InternalSwap(ApplySettingsResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  swap(_impl_.success_, other->_impl_.success_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ApplySettingsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_flexsdr_2eproto_getter, &descriptor_table_flexsdr_2eproto_once,
+      file_level_metadata_flexsdr_2eproto[17]);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace flexsdr
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::ChannelRequest* Arena::CreateMaybeMessage< ::flexsdr::ChannelRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::ChannelRequest >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::flexsdr::ChannelRequest*
+Arena::CreateMaybeMessage< ::flexsdr::ChannelRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::ChannelRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::flexsdr::ClockRateRequestParams*
+Arena::CreateMaybeMessage< ::flexsdr::ClockRateRequestParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::ClockRateRequestParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::flexsdr::ClockRateResponseParams*
+Arena::CreateMaybeMessage< ::flexsdr::ClockRateResponseParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::ClockRateResponseParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::flexsdr::GainRequestParams*
+Arena::CreateMaybeMessage< ::flexsdr::GainRequestParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::GainRequestParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::flexsdr::GainResponseParams*
+Arena::CreateMaybeMessage< ::flexsdr::GainResponseParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::GainResponseParams >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::ClockRateRequestParams* Arena::CreateMaybeMessage< ::flexsdr::ClockRateRequestParams >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::ClockRateRequestParams >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::RateRequestParams*
+Arena::CreateMaybeMessage< ::flexsdr::RateRequestParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::RateRequestParams >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::ClockRateResponseParams* Arena::CreateMaybeMessage< ::flexsdr::ClockRateResponseParams >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::ClockRateResponseParams >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::RateResponseParams*
+Arena::CreateMaybeMessage< ::flexsdr::RateResponseParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::RateResponseParams >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::GainRequestParams* Arena::CreateMaybeMessage< ::flexsdr::GainRequestParams >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::GainRequestParams >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::TuneRequest*
+Arena::CreateMaybeMessage< ::flexsdr::TuneRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::TuneRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::GainResponseParams* Arena::CreateMaybeMessage< ::flexsdr::GainResponseParams >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::GainResponseParams >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::TuneResult*
+Arena::CreateMaybeMessage< ::flexsdr::TuneResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::TuneResult >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::RateRequestParams* Arena::CreateMaybeMessage< ::flexsdr::RateRequestParams >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::RateRequestParams >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::FrequencyRequestParams*
+Arena::CreateMaybeMessage< ::flexsdr::FrequencyRequestParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::FrequencyRequestParams >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::RateResponseParams* Arena::CreateMaybeMessage< ::flexsdr::RateResponseParams >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::RateResponseParams >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::FrequencyResponseParams*
+Arena::CreateMaybeMessage< ::flexsdr::FrequencyResponseParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::FrequencyResponseParams >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::TuneRequest* Arena::CreateMaybeMessage< ::flexsdr::TuneRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::TuneRequest >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::FrequencyValue*
+Arena::CreateMaybeMessage< ::flexsdr::FrequencyValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::FrequencyValue >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::TuneResult* Arena::CreateMaybeMessage< ::flexsdr::TuneResult >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::TuneResult >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::DeviceInfoRequest*
+Arena::CreateMaybeMessage< ::flexsdr::DeviceInfoRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::DeviceInfoRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::FrequencyRequestParams* Arena::CreateMaybeMessage< ::flexsdr::FrequencyRequestParams >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::FrequencyRequestParams >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::DeviceInfoResponse*
+Arena::CreateMaybeMessage< ::flexsdr::DeviceInfoResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::DeviceInfoResponse >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::FrequencyResponseParams* Arena::CreateMaybeMessage< ::flexsdr::FrequencyResponseParams >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::FrequencyResponseParams >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::ParamChange*
+Arena::CreateMaybeMessage< ::flexsdr::ParamChange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::ParamChange >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::FrequencyValue* Arena::CreateMaybeMessage< ::flexsdr::FrequencyValue >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::FrequencyValue >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::ApplySettingsRequest*
+Arena::CreateMaybeMessage< ::flexsdr::ApplySettingsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::ApplySettingsRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::DeviceInfoRequest* Arena::CreateMaybeMessage< ::flexsdr::DeviceInfoRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::DeviceInfoRequest >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::ParamResult*
+Arena::CreateMaybeMessage< ::flexsdr::ParamResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::ParamResult >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::flexsdr::DeviceInfoResponse* Arena::CreateMaybeMessage< ::flexsdr::DeviceInfoResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::flexsdr::DeviceInfoResponse >(arena);
+template<> PROTOBUF_NOINLINE ::flexsdr::ApplySettingsResponse*
+Arena::CreateMaybeMessage< ::flexsdr::ApplySettingsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::flexsdr::ApplySettingsResponse >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
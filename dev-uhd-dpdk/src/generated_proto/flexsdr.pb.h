@@ -1,97 +1,110 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: flexsdr.proto
 
-#ifndef PROTOBUF_INCLUDED_flexsdr_2eproto
-#define PROTOBUF_INCLUDED_flexsdr_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_flexsdr_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_flexsdr_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_flexsdr_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_flexsdr_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_flexsdr_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[14];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_flexsdr_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_flexsdr_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_flexsdr_2eproto;
 namespace flexsdr {
+class ApplySettingsRequest;
+struct ApplySettingsRequestDefaultTypeInternal;
+extern ApplySettingsRequestDefaultTypeInternal _ApplySettingsRequest_default_instance_;
+class ApplySettingsResponse;
+struct ApplySettingsResponseDefaultTypeInternal;
+extern ApplySettingsResponseDefaultTypeInternal _ApplySettingsResponse_default_instance_;
 class ChannelRequest;
-class ChannelRequestDefaultTypeInternal;
+struct ChannelRequestDefaultTypeInternal;
 extern ChannelRequestDefaultTypeInternal _ChannelRequest_default_instance_;
 class ClockRateRequestParams;
-class ClockRateRequestParamsDefaultTypeInternal;
+struct ClockRateRequestParamsDefaultTypeInternal;
 extern ClockRateRequestParamsDefaultTypeInternal _ClockRateRequestParams_default_instance_;
 class ClockRateResponseParams;
-class ClockRateResponseParamsDefaultTypeInternal;
+struct ClockRateResponseParamsDefaultTypeInternal;
 extern ClockRateResponseParamsDefaultTypeInternal _ClockRateResponseParams_default_instance_;
 class DeviceInfoRequest;
-class DeviceInfoRequestDefaultTypeInternal;
+struct DeviceInfoRequestDefaultTypeInternal;
 extern DeviceInfoRequestDefaultTypeInternal _DeviceInfoRequest_default_instance_;
 class DeviceInfoResponse;
-class DeviceInfoResponseDefaultTypeInternal;
+struct DeviceInfoResponseDefaultTypeInternal;
 extern DeviceInfoResponseDefaultTypeInternal _DeviceInfoResponse_default_instance_;
 class FrequencyRequestParams;
-class FrequencyRequestParamsDefaultTypeInternal;
+struct FrequencyRequestParamsDefaultTypeInternal;
 extern FrequencyRequestParamsDefaultTypeInternal _FrequencyRequestParams_default_instance_;
 class FrequencyResponseParams;
-class FrequencyResponseParamsDefaultTypeInternal;
+struct FrequencyResponseParamsDefaultTypeInternal;
 extern FrequencyResponseParamsDefaultTypeInternal _FrequencyResponseParams_default_instance_;
 class FrequencyValue;
-class FrequencyValueDefaultTypeInternal;
+struct FrequencyValueDefaultTypeInternal;
 extern FrequencyValueDefaultTypeInternal _FrequencyValue_default_instance_;
 class GainRequestParams;
-class GainRequestParamsDefaultTypeInternal;
+struct GainRequestParamsDefaultTypeInternal;
 extern GainRequestParamsDefaultTypeInternal _GainRequestParams_default_instance_;
 class GainResponseParams;
-class GainResponseParamsDefaultTypeInternal;
+struct GainResponseParamsDefaultTypeInternal;
 extern GainResponseParamsDefaultTypeInternal _GainResponseParams_default_instance_;
+class ParamChange;
+struct ParamChangeDefaultTypeInternal;
+extern ParamChangeDefaultTypeInternal _ParamChange_default_instance_;
+class ParamResult;
+struct ParamResultDefaultTypeInternal;
+extern ParamResultDefaultTypeInternal _ParamResult_default_instance_;
 class RateRequestParams;
-class RateRequestParamsDefaultTypeInternal;
+struct RateRequestParamsDefaultTypeInternal;
 extern RateRequestParamsDefaultTypeInternal _RateRequestParams_default_instance_;
 class RateResponseParams;
-class RateResponseParamsDefaultTypeInternal;
+struct RateResponseParamsDefaultTypeInternal;
 extern RateResponseParamsDefaultTypeInternal _RateResponseParams_default_instance_;
 class TuneRequest;
-class TuneRequestDefaultTypeInternal;
+struct TuneRequestDefaultTypeInternal;
 extern TuneRequestDefaultTypeInternal _TuneRequest_default_instance_;
 class TuneResult;
-class TuneResultDefaultTypeInternal;
+struct TuneResultDefaultTypeInternal;
 extern TuneResultDefaultTypeInternal _TuneResult_default_instance_;
 }  // namespace flexsdr
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::flexsdr::ApplySettingsRequest* Arena::CreateMaybeMessage<::flexsdr::ApplySettingsRequest>(Arena*);
+template<> ::flexsdr::ApplySettingsResponse* Arena::CreateMaybeMessage<::flexsdr::ApplySettingsResponse>(Arena*);
 template<> ::flexsdr::ChannelRequest* Arena::CreateMaybeMessage<::flexsdr::ChannelRequest>(Arena*);
 template<> ::flexsdr::ClockRateRequestParams* Arena::CreateMaybeMessage<::flexsdr::ClockRateRequestParams>(Arena*);
 template<> ::flexsdr::ClockRateResponseParams* Arena::CreateMaybeMessage<::flexsdr::ClockRateResponseParams>(Arena*);
@@ -102,91 +115,144 @@ template<> ::flexsdr::FrequencyResponseParams* Arena::CreateMaybeMessage<::flexs
 template<> ::flexsdr::FrequencyValue* Arena::CreateMaybeMessage<::flexsdr::FrequencyValue>(Arena*);
 template<> ::flexsdr::GainRequestParams* Arena::CreateMaybeMessage<::flexsdr::GainRequestParams>(Arena*);
 template<> ::flexsdr::GainResponseParams* Arena::CreateMaybeMessage<::flexsdr::GainResponseParams>(Arena*);
+template<> ::flexsdr::ParamChange* Arena::CreateMaybeMessage<::flexsdr::ParamChange>(Arena*);
+template<> ::flexsdr::ParamResult* Arena::CreateMaybeMessage<::flexsdr::ParamResult>(Arena*);
 template<> ::flexsdr::RateRequestParams* Arena::CreateMaybeMessage<::flexsdr::RateRequestParams>(Arena*);
 template<> ::flexsdr::RateResponseParams* Arena::CreateMaybeMessage<::flexsdr::RateResponseParams>(Arena*);
 template<> ::flexsdr::TuneRequest* Arena::CreateMaybeMessage<::flexsdr::TuneRequest>(Arena*);
 template<> ::flexsdr::TuneResult* Arena::CreateMaybeMessage<::flexsdr::TuneResult>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace flexsdr {
 
-enum TuneRequest_Policy {
+enum TuneRequest_Policy : int {
   TuneRequest_Policy_POLICY_NONE = 0,
   TuneRequest_Policy_POLICY_AUTO = 1,
   TuneRequest_Policy_POLICY_MANUAL = 2,
-  TuneRequest_Policy_TuneRequest_Policy_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  TuneRequest_Policy_TuneRequest_Policy_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  TuneRequest_Policy_TuneRequest_Policy_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TuneRequest_Policy_TuneRequest_Policy_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool TuneRequest_Policy_IsValid(int value);
-const TuneRequest_Policy TuneRequest_Policy_Policy_MIN = TuneRequest_Policy_POLICY_NONE;
-const TuneRequest_Policy TuneRequest_Policy_Policy_MAX = TuneRequest_Policy_POLICY_MANUAL;
-const int TuneRequest_Policy_Policy_ARRAYSIZE = TuneRequest_Policy_Policy_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* TuneRequest_Policy_descriptor();
-inline const ::std::string& TuneRequest_Policy_Name(TuneRequest_Policy value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    TuneRequest_Policy_descriptor(), value);
+constexpr TuneRequest_Policy TuneRequest_Policy_Policy_MIN = TuneRequest_Policy_POLICY_NONE;
+constexpr TuneRequest_Policy TuneRequest_Policy_Policy_MAX = TuneRequest_Policy_POLICY_MANUAL;
+constexpr int TuneRequest_Policy_Policy_ARRAYSIZE = TuneRequest_Policy_Policy_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TuneRequest_Policy_descriptor();
+template<typename T>
+inline const std::string& TuneRequest_Policy_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TuneRequest_Policy>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TuneRequest_Policy_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TuneRequest_Policy_descriptor(), enum_t_value);
 }
 inline bool TuneRequest_Policy_Parse(
-    const ::std::string& name, TuneRequest_Policy* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<TuneRequest_Policy>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TuneRequest_Policy* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TuneRequest_Policy>(
     TuneRequest_Policy_descriptor(), name, value);
 }
-enum UnitType {
+enum ParamChange_Kind : int {
+  ParamChange_Kind_KIND_INVALID = 0,
+  ParamChange_Kind_RX_GAIN = 1,
+  ParamChange_Kind_TX_GAIN = 2,
+  ParamChange_Kind_RX_RATE = 3,
+  ParamChange_Kind_TX_RATE = 4,
+  ParamChange_Kind_RX_FREQ = 5,
+  ParamChange_Kind_TX_FREQ = 6,
+  ParamChange_Kind_CLOCK_RATE = 7,
+  ParamChange_Kind_ParamChange_Kind_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ParamChange_Kind_ParamChange_Kind_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ParamChange_Kind_IsValid(int value);
+constexpr ParamChange_Kind ParamChange_Kind_Kind_MIN = ParamChange_Kind_KIND_INVALID;
+constexpr ParamChange_Kind ParamChange_Kind_Kind_MAX = ParamChange_Kind_CLOCK_RATE;
+constexpr int ParamChange_Kind_Kind_ARRAYSIZE = ParamChange_Kind_Kind_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ParamChange_Kind_descriptor();
+template<typename T>
+inline const std::string& ParamChange_Kind_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ParamChange_Kind>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ParamChange_Kind_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ParamChange_Kind_descriptor(), enum_t_value);
+}
+inline bool ParamChange_Kind_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ParamChange_Kind* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ParamChange_Kind>(
+    ParamChange_Kind_descriptor(), name, value);
+}
+enum UnitType : int {
   UNIT_INVALID = 0,
   UNIT_RX = 114,
   UNIT_TX = 116,
   UNIT_BOTH = 98,
-  UnitType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  UnitType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  UnitType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UnitType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool UnitType_IsValid(int value);
-const UnitType UnitType_MIN = UNIT_INVALID;
-const UnitType UnitType_MAX = UNIT_TX;
-const int UnitType_ARRAYSIZE = UnitType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* UnitType_descriptor();
-inline const ::std::string& UnitType_Name(UnitType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    UnitType_descriptor(), value);
+constexpr UnitType UnitType_MIN = UNIT_INVALID;
+constexpr UnitType UnitType_MAX = UNIT_TX;
+constexpr int UnitType_ARRAYSIZE = UnitType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UnitType_descriptor();
+template<typename T>
+inline const std::string& UnitType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, UnitType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function UnitType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    UnitType_descriptor(), enum_t_value);
 }
 inline bool UnitType_Parse(
-    const ::std::string& name, UnitType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<UnitType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UnitType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UnitType>(
     UnitType_descriptor(), name, value);
 }
 // ===================================================================
 
-class ChannelRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.ChannelRequest) */ {
+class ChannelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.ChannelRequest) */ {
  public:
-  ChannelRequest();
-  virtual ~ChannelRequest();
+  inline ChannelRequest() : ChannelRequest(nullptr) {}
+  ~ChannelRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChannelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ChannelRequest(const ChannelRequest& from);
-
-  inline ChannelRequest& operator=(const ChannelRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ChannelRequest(ChannelRequest&& from) noexcept
     : ChannelRequest() {
     *this = ::std::move(from);
   }
 
+  inline ChannelRequest& operator=(const ChannelRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ChannelRequest& operator=(ChannelRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ChannelRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ChannelRequest* internal_default_instance() {
     return reinterpret_cast<const ChannelRequest*>(
                &_ChannelRequest_default_instance_);
@@ -194,102 +260,147 @@ class ChannelRequest : public ::google::protobuf::Message /* @@protoc_insertion_
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(ChannelRequest* other);
   friend void swap(ChannelRequest& a, ChannelRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(ChannelRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ChannelRequest* New() const final {
-    return CreateMaybeMessage<ChannelRequest>(NULL);
-  }
-
-  ChannelRequest* New(::google::protobuf::Arena* arena) const final {
+  ChannelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ChannelRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ChannelRequest& from);
-  void MergeFrom(const ChannelRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelRequest& from) {
+    ChannelRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ChannelRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.ChannelRequest";
   }
+  protected:
+  explicit ChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kChanFieldNumber = 1,
+  };
   // uint32 chan = 1;
   void clear_chan();
-  static const int kChanFieldNumber = 1;
-  ::google::protobuf::uint32 chan() const;
-  void set_chan(::google::protobuf::uint32 value);
+  uint32_t chan() const;
+  void set_chan(uint32_t value);
+  private:
+  uint32_t _internal_chan() const;
+  void _internal_set_chan(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.ChannelRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 chan_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t chan_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClockRateRequestParams : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.ClockRateRequestParams) */ {
+class ClockRateRequestParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.ClockRateRequestParams) */ {
  public:
-  ClockRateRequestParams();
-  virtual ~ClockRateRequestParams();
+  inline ClockRateRequestParams() : ClockRateRequestParams(nullptr) {}
+  ~ClockRateRequestParams() override;
+  explicit PROTOBUF_CONSTEXPR ClockRateRequestParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClockRateRequestParams(const ClockRateRequestParams& from);
-
-  inline ClockRateRequestParams& operator=(const ClockRateRequestParams& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ClockRateRequestParams(ClockRateRequestParams&& from) noexcept
     : ClockRateRequestParams() {
     *this = ::std::move(from);
   }
 
+  inline ClockRateRequestParams& operator=(const ClockRateRequestParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ClockRateRequestParams& operator=(ClockRateRequestParams&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ClockRateRequestParams& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClockRateRequestParams& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ClockRateRequestParams* internal_default_instance() {
     return reinterpret_cast<const ClockRateRequestParams*>(
                &_ClockRateRequestParams_default_instance_);
@@ -297,109 +408,158 @@ class ClockRateRequestParams : public ::google::protobuf::Message /* @@protoc_in
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(ClockRateRequestParams* other);
   friend void swap(ClockRateRequestParams& a, ClockRateRequestParams& b) {
     a.Swap(&b);
   }
+  inline void Swap(ClockRateRequestParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClockRateRequestParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ClockRateRequestParams* New() const final {
-    return CreateMaybeMessage<ClockRateRequestParams>(NULL);
-  }
-
-  ClockRateRequestParams* New(::google::protobuf::Arena* arena) const final {
+  ClockRateRequestParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ClockRateRequestParams>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ClockRateRequestParams& from);
-  void MergeFrom(const ClockRateRequestParams& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClockRateRequestParams& from) {
+    ClockRateRequestParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ClockRateRequestParams* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.ClockRateRequestParams";
   }
+  protected:
+  explicit ClockRateRequestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRateFieldNumber = 2,
+    kUnitFieldNumber = 1,
+  };
   // double rate = 2;
   void clear_rate();
-  static const int kRateFieldNumber = 2;
   double rate() const;
   void set_rate(double value);
+  private:
+  double _internal_rate() const;
+  void _internal_set_rate(double value);
+  public:
 
   // .flexsdr.UnitType unit = 1;
   void clear_unit();
-  static const int kUnitFieldNumber = 1;
   ::flexsdr::UnitType unit() const;
   void set_unit(::flexsdr::UnitType value);
+  private:
+  ::flexsdr::UnitType _internal_unit() const;
+  void _internal_set_unit(::flexsdr::UnitType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.ClockRateRequestParams)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  double rate_;
-  int unit_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double rate_;
+    int unit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClockRateResponseParams : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.ClockRateResponseParams) */ {
+class ClockRateResponseParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.ClockRateResponseParams) */ {
  public:
-  ClockRateResponseParams();
-  virtual ~ClockRateResponseParams();
+  inline ClockRateResponseParams() : ClockRateResponseParams(nullptr) {}
+  ~ClockRateResponseParams() override;
+  explicit PROTOBUF_CONSTEXPR ClockRateResponseParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClockRateResponseParams(const ClockRateResponseParams& from);
-
-  inline ClockRateResponseParams& operator=(const ClockRateResponseParams& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ClockRateResponseParams(ClockRateResponseParams&& from) noexcept
     : ClockRateResponseParams() {
     *this = ::std::move(from);
   }
 
+  inline ClockRateResponseParams& operator=(const ClockRateResponseParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ClockRateResponseParams& operator=(ClockRateResponseParams&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ClockRateResponseParams& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClockRateResponseParams& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ClockRateResponseParams* internal_default_instance() {
     return reinterpret_cast<const ClockRateResponseParams*>(
                &_ClockRateResponseParams_default_instance_);
@@ -407,124 +567,174 @@ class ClockRateResponseParams : public ::google::protobuf::Message /* @@protoc_i
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(ClockRateResponseParams* other);
   friend void swap(ClockRateResponseParams& a, ClockRateResponseParams& b) {
     a.Swap(&b);
   }
+  inline void Swap(ClockRateResponseParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClockRateResponseParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ClockRateResponseParams* New() const final {
-    return CreateMaybeMessage<ClockRateResponseParams>(NULL);
-  }
-
-  ClockRateResponseParams* New(::google::protobuf::Arena* arena) const final {
+  ClockRateResponseParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ClockRateResponseParams>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ClockRateResponseParams& from);
-  void MergeFrom(const ClockRateResponseParams& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClockRateResponseParams& from) {
+    ClockRateResponseParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ClockRateResponseParams* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.ClockRateResponseParams";
   }
+  protected:
+  explicit ClockRateResponseParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 3,
+    kActualRateFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
   // string error_message = 3;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 3;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
 
   // double actual_rate = 2;
   void clear_actual_rate();
-  static const int kActualRateFieldNumber = 2;
   double actual_rate() const;
   void set_actual_rate(double value);
+  private:
+  double _internal_actual_rate() const;
+  void _internal_set_actual_rate(double value);
+  public:
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.ClockRateResponseParams)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  double actual_rate_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    double actual_rate_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GainRequestParams : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.GainRequestParams) */ {
+class GainRequestParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.GainRequestParams) */ {
  public:
-  GainRequestParams();
-  virtual ~GainRequestParams();
+  inline GainRequestParams() : GainRequestParams(nullptr) {}
+  ~GainRequestParams() override;
+  explicit PROTOBUF_CONSTEXPR GainRequestParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GainRequestParams(const GainRequestParams& from);
-
-  inline GainRequestParams& operator=(const GainRequestParams& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GainRequestParams(GainRequestParams&& from) noexcept
     : GainRequestParams() {
     *this = ::std::move(from);
   }
 
+  inline GainRequestParams& operator=(const GainRequestParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GainRequestParams& operator=(GainRequestParams&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GainRequestParams& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GainRequestParams& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GainRequestParams* internal_default_instance() {
     return reinterpret_cast<const GainRequestParams*>(
                &_GainRequestParams_default_instance_);
@@ -532,124 +742,196 @@ class GainRequestParams : public ::google::protobuf::Message /* @@protoc_inserti
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(GainRequestParams* other);
   friend void swap(GainRequestParams& a, GainRequestParams& b) {
     a.Swap(&b);
   }
+  inline void Swap(GainRequestParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GainRequestParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GainRequestParams* New() const final {
-    return CreateMaybeMessage<GainRequestParams>(NULL);
-  }
-
-  GainRequestParams* New(::google::protobuf::Arena* arena) const final {
+  GainRequestParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GainRequestParams>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GainRequestParams& from);
-  void MergeFrom(const GainRequestParams& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GainRequestParams& from) {
+    GainRequestParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GainRequestParams* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.GainRequestParams";
   }
+  protected:
+  explicit GainRequestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 2,
+    kGainFieldNumber = 1,
+    kCommandTimeTicksFieldNumber = 4,
+    kChanFieldNumber = 3,
+    kCommandIdFieldNumber = 5,
+  };
   // string name = 2;
   void clear_name();
-  static const int kNameFieldNumber = 2;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // double gain = 1;
   void clear_gain();
-  static const int kGainFieldNumber = 1;
   double gain() const;
   void set_gain(double value);
+  private:
+  double _internal_gain() const;
+  void _internal_set_gain(double value);
+  public:
+
+  // uint64 command_time_ticks = 4;
+  void clear_command_time_ticks();
+  uint64_t command_time_ticks() const;
+  void set_command_time_ticks(uint64_t value);
+  private:
+  uint64_t _internal_command_time_ticks() const;
+  void _internal_set_command_time_ticks(uint64_t value);
+  public:
 
   // uint32 chan = 3;
   void clear_chan();
-  static const int kChanFieldNumber = 3;
-  ::google::protobuf::uint32 chan() const;
-  void set_chan(::google::protobuf::uint32 value);
+  uint32_t chan() const;
+  void set_chan(uint32_t value);
+  private:
+  uint32_t _internal_chan() const;
+  void _internal_set_chan(uint32_t value);
+  public:
+
+  // uint32 command_id = 5;
+  void clear_command_id();
+  uint32_t command_id() const;
+  void set_command_id(uint32_t value);
+  private:
+  uint32_t _internal_command_id() const;
+  void _internal_set_command_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.GainRequestParams)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  double gain_;
-  ::google::protobuf::uint32 chan_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    double gain_;
+    uint64_t command_time_ticks_;
+    uint32_t chan_;
+    uint32_t command_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GainResponseParams : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.GainResponseParams) */ {
+class GainResponseParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.GainResponseParams) */ {
  public:
-  GainResponseParams();
-  virtual ~GainResponseParams();
+  inline GainResponseParams() : GainResponseParams(nullptr) {}
+  ~GainResponseParams() override;
+  explicit PROTOBUF_CONSTEXPR GainResponseParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GainResponseParams(const GainResponseParams& from);
-
-  inline GainResponseParams& operator=(const GainResponseParams& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GainResponseParams(GainResponseParams&& from) noexcept
     : GainResponseParams() {
     *this = ::std::move(from);
   }
 
+  inline GainResponseParams& operator=(const GainResponseParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GainResponseParams& operator=(GainResponseParams&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GainResponseParams& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GainResponseParams& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GainResponseParams* internal_default_instance() {
     return reinterpret_cast<const GainResponseParams*>(
                &_GainResponseParams_default_instance_);
@@ -657,124 +939,174 @@ class GainResponseParams : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(GainResponseParams* other);
   friend void swap(GainResponseParams& a, GainResponseParams& b) {
     a.Swap(&b);
   }
+  inline void Swap(GainResponseParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GainResponseParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GainResponseParams* New() const final {
-    return CreateMaybeMessage<GainResponseParams>(NULL);
-  }
-
-  GainResponseParams* New(::google::protobuf::Arena* arena) const final {
+  GainResponseParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GainResponseParams>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GainResponseParams& from);
-  void MergeFrom(const GainResponseParams& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GainResponseParams& from) {
+    GainResponseParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GainResponseParams* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.GainResponseParams";
   }
+  protected:
+  explicit GainResponseParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 3,
+    kActualGainFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
   // string error_message = 3;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 3;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
 
   // double actual_gain = 2;
   void clear_actual_gain();
-  static const int kActualGainFieldNumber = 2;
   double actual_gain() const;
   void set_actual_gain(double value);
+  private:
+  double _internal_actual_gain() const;
+  void _internal_set_actual_gain(double value);
+  public:
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.GainResponseParams)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  double actual_gain_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    double actual_gain_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RateRequestParams : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.RateRequestParams) */ {
+class RateRequestParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.RateRequestParams) */ {
  public:
-  RateRequestParams();
-  virtual ~RateRequestParams();
+  inline RateRequestParams() : RateRequestParams(nullptr) {}
+  ~RateRequestParams() override;
+  explicit PROTOBUF_CONSTEXPR RateRequestParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RateRequestParams(const RateRequestParams& from);
-
-  inline RateRequestParams& operator=(const RateRequestParams& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RateRequestParams(RateRequestParams&& from) noexcept
     : RateRequestParams() {
     *this = ::std::move(from);
   }
 
+  inline RateRequestParams& operator=(const RateRequestParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RateRequestParams& operator=(RateRequestParams&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RateRequestParams& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RateRequestParams& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RateRequestParams* internal_default_instance() {
     return reinterpret_cast<const RateRequestParams*>(
                &_RateRequestParams_default_instance_);
@@ -782,109 +1114,158 @@ class RateRequestParams : public ::google::protobuf::Message /* @@protoc_inserti
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(RateRequestParams* other);
   friend void swap(RateRequestParams& a, RateRequestParams& b) {
     a.Swap(&b);
   }
+  inline void Swap(RateRequestParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RateRequestParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RateRequestParams* New() const final {
-    return CreateMaybeMessage<RateRequestParams>(NULL);
-  }
-
-  RateRequestParams* New(::google::protobuf::Arena* arena) const final {
+  RateRequestParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RateRequestParams>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RateRequestParams& from);
-  void MergeFrom(const RateRequestParams& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RateRequestParams& from) {
+    RateRequestParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RateRequestParams* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.RateRequestParams";
   }
+  protected:
+  explicit RateRequestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRateFieldNumber = 1,
+    kChanFieldNumber = 2,
+  };
   // double rate = 1;
   void clear_rate();
-  static const int kRateFieldNumber = 1;
   double rate() const;
   void set_rate(double value);
+  private:
+  double _internal_rate() const;
+  void _internal_set_rate(double value);
+  public:
 
   // uint32 chan = 2;
   void clear_chan();
-  static const int kChanFieldNumber = 2;
-  ::google::protobuf::uint32 chan() const;
-  void set_chan(::google::protobuf::uint32 value);
+  uint32_t chan() const;
+  void set_chan(uint32_t value);
+  private:
+  uint32_t _internal_chan() const;
+  void _internal_set_chan(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.RateRequestParams)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  double rate_;
-  ::google::protobuf::uint32 chan_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double rate_;
+    uint32_t chan_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RateResponseParams : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.RateResponseParams) */ {
+class RateResponseParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.RateResponseParams) */ {
  public:
-  RateResponseParams();
-  virtual ~RateResponseParams();
+  inline RateResponseParams() : RateResponseParams(nullptr) {}
+  ~RateResponseParams() override;
+  explicit PROTOBUF_CONSTEXPR RateResponseParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RateResponseParams(const RateResponseParams& from);
-
-  inline RateResponseParams& operator=(const RateResponseParams& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RateResponseParams(RateResponseParams&& from) noexcept
     : RateResponseParams() {
     *this = ::std::move(from);
   }
 
+  inline RateResponseParams& operator=(const RateResponseParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RateResponseParams& operator=(RateResponseParams&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RateResponseParams& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RateResponseParams& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RateResponseParams* internal_default_instance() {
     return reinterpret_cast<const RateResponseParams*>(
                &_RateResponseParams_default_instance_);
@@ -892,124 +1273,174 @@ class RateResponseParams : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(RateResponseParams* other);
   friend void swap(RateResponseParams& a, RateResponseParams& b) {
     a.Swap(&b);
   }
+  inline void Swap(RateResponseParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RateResponseParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RateResponseParams* New() const final {
-    return CreateMaybeMessage<RateResponseParams>(NULL);
-  }
-
-  RateResponseParams* New(::google::protobuf::Arena* arena) const final {
+  RateResponseParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RateResponseParams>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RateResponseParams& from);
-  void MergeFrom(const RateResponseParams& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RateResponseParams& from) {
+    RateResponseParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RateResponseParams* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.RateResponseParams";
   }
+  protected:
+  explicit RateResponseParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 3,
+    kActualRateFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
   // string error_message = 3;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 3;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
 
   // double actual_rate = 2;
   void clear_actual_rate();
-  static const int kActualRateFieldNumber = 2;
   double actual_rate() const;
   void set_actual_rate(double value);
+  private:
+  double _internal_actual_rate() const;
+  void _internal_set_actual_rate(double value);
+  public:
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.RateResponseParams)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  double actual_rate_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    double actual_rate_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TuneRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.TuneRequest) */ {
+class TuneRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.TuneRequest) */ {
  public:
-  TuneRequest();
-  virtual ~TuneRequest();
+  inline TuneRequest() : TuneRequest(nullptr) {}
+  ~TuneRequest() override;
+  explicit PROTOBUF_CONSTEXPR TuneRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TuneRequest(const TuneRequest& from);
-
-  inline TuneRequest& operator=(const TuneRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   TuneRequest(TuneRequest&& from) noexcept
     : TuneRequest() {
     *this = ::std::move(from);
   }
 
+  inline TuneRequest& operator=(const TuneRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline TuneRequest& operator=(TuneRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TuneRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TuneRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const TuneRequest* internal_default_instance() {
     return reinterpret_cast<const TuneRequest*>(
                &_TuneRequest_default_instance_);
@@ -1017,158 +1448,223 @@ class TuneRequest : public ::google::protobuf::Message /* @@protoc_insertion_poi
   static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(TuneRequest* other);
   friend void swap(TuneRequest& a, TuneRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(TuneRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TuneRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TuneRequest* New() const final {
-    return CreateMaybeMessage<TuneRequest>(NULL);
-  }
-
-  TuneRequest* New(::google::protobuf::Arena* arena) const final {
+  TuneRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TuneRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TuneRequest& from);
-  void MergeFrom(const TuneRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TuneRequest& from) {
+    TuneRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TuneRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.TuneRequest";
   }
+  protected:
+  explicit TuneRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef TuneRequest_Policy Policy;
-  static const Policy POLICY_NONE =
+  static constexpr Policy POLICY_NONE =
     TuneRequest_Policy_POLICY_NONE;
-  static const Policy POLICY_AUTO =
+  static constexpr Policy POLICY_AUTO =
     TuneRequest_Policy_POLICY_AUTO;
-  static const Policy POLICY_MANUAL =
+  static constexpr Policy POLICY_MANUAL =
     TuneRequest_Policy_POLICY_MANUAL;
   static inline bool Policy_IsValid(int value) {
     return TuneRequest_Policy_IsValid(value);
   }
-  static const Policy Policy_MIN =
+  static constexpr Policy Policy_MIN =
     TuneRequest_Policy_Policy_MIN;
-  static const Policy Policy_MAX =
+  static constexpr Policy Policy_MAX =
     TuneRequest_Policy_Policy_MAX;
-  static const int Policy_ARRAYSIZE =
+  static constexpr int Policy_ARRAYSIZE =
     TuneRequest_Policy_Policy_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   Policy_descriptor() {
     return TuneRequest_Policy_descriptor();
   }
-  static inline const ::std::string& Policy_Name(Policy value) {
-    return TuneRequest_Policy_Name(value);
+  template<typename T>
+  static inline const std::string& Policy_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Policy>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Policy_Name.");
+    return TuneRequest_Policy_Name(enum_t_value);
   }
-  static inline bool Policy_Parse(const ::std::string& name,
+  static inline bool Policy_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Policy* value) {
     return TuneRequest_Policy_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTargetFreqFieldNumber = 1,
+    kRfFreqFieldNumber = 3,
+    kRfFreqPolicyFieldNumber = 2,
+    kDspFreqPolicyFieldNumber = 4,
+    kDspFreqFieldNumber = 5,
+  };
   // double target_freq = 1;
   void clear_target_freq();
-  static const int kTargetFreqFieldNumber = 1;
   double target_freq() const;
   void set_target_freq(double value);
+  private:
+  double _internal_target_freq() const;
+  void _internal_set_target_freq(double value);
+  public:
 
   // double rf_freq = 3;
   void clear_rf_freq();
-  static const int kRfFreqFieldNumber = 3;
   double rf_freq() const;
   void set_rf_freq(double value);
+  private:
+  double _internal_rf_freq() const;
+  void _internal_set_rf_freq(double value);
+  public:
 
   // .flexsdr.TuneRequest.Policy rf_freq_policy = 2;
   void clear_rf_freq_policy();
-  static const int kRfFreqPolicyFieldNumber = 2;
   ::flexsdr::TuneRequest_Policy rf_freq_policy() const;
   void set_rf_freq_policy(::flexsdr::TuneRequest_Policy value);
-
+  private:
+  ::flexsdr::TuneRequest_Policy _internal_rf_freq_policy() const;
+  void _internal_set_rf_freq_policy(::flexsdr::TuneRequest_Policy value);
+  public:
+
   // .flexsdr.TuneRequest.Policy dsp_freq_policy = 4;
   void clear_dsp_freq_policy();
-  static const int kDspFreqPolicyFieldNumber = 4;
   ::flexsdr::TuneRequest_Policy dsp_freq_policy() const;
   void set_dsp_freq_policy(::flexsdr::TuneRequest_Policy value);
+  private:
+  ::flexsdr::TuneRequest_Policy _internal_dsp_freq_policy() const;
+  void _internal_set_dsp_freq_policy(::flexsdr::TuneRequest_Policy value);
+  public:
 
   // double dsp_freq = 5;
   void clear_dsp_freq();
-  static const int kDspFreqFieldNumber = 5;
   double dsp_freq() const;
   void set_dsp_freq(double value);
+  private:
+  double _internal_dsp_freq() const;
+  void _internal_set_dsp_freq(double value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.TuneRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  double target_freq_;
-  double rf_freq_;
-  int rf_freq_policy_;
-  int dsp_freq_policy_;
-  double dsp_freq_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double target_freq_;
+    double rf_freq_;
+    int rf_freq_policy_;
+    int dsp_freq_policy_;
+    double dsp_freq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TuneResult : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.TuneResult) */ {
+class TuneResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.TuneResult) */ {
  public:
-  TuneResult();
-  virtual ~TuneResult();
+  inline TuneResult() : TuneResult(nullptr) {}
+  ~TuneResult() override;
+  explicit PROTOBUF_CONSTEXPR TuneResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TuneResult(const TuneResult& from);
-
-  inline TuneResult& operator=(const TuneResult& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   TuneResult(TuneResult&& from) noexcept
     : TuneResult() {
     *this = ::std::move(from);
   }
 
+  inline TuneResult& operator=(const TuneResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline TuneResult& operator=(TuneResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TuneResult& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TuneResult& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const TuneResult* internal_default_instance() {
     return reinterpret_cast<const TuneResult*>(
                &_TuneResult_default_instance_);
@@ -1176,130 +1672,191 @@ class TuneResult : public ::google::protobuf::Message /* @@protoc_insertion_poin
   static constexpr int kIndexInFileMessages =
     8;
 
-  void Swap(TuneResult* other);
   friend void swap(TuneResult& a, TuneResult& b) {
     a.Swap(&b);
   }
+  inline void Swap(TuneResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TuneResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TuneResult* New() const final {
-    return CreateMaybeMessage<TuneResult>(NULL);
-  }
-
-  TuneResult* New(::google::protobuf::Arena* arena) const final {
+  TuneResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TuneResult>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TuneResult& from);
-  void MergeFrom(const TuneResult& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TuneResult& from) {
+    TuneResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TuneResult* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.TuneResult";
   }
+  protected:
+  explicit TuneResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kClippedRfFreqFieldNumber = 1,
+    kTargetRfFreqFieldNumber = 2,
+    kActualRfFreqFieldNumber = 3,
+    kTargetDspFreqFieldNumber = 4,
+    kActualDspFreqFieldNumber = 5,
+  };
   // double clipped_rf_freq = 1;
   void clear_clipped_rf_freq();
-  static const int kClippedRfFreqFieldNumber = 1;
   double clipped_rf_freq() const;
   void set_clipped_rf_freq(double value);
+  private:
+  double _internal_clipped_rf_freq() const;
+  void _internal_set_clipped_rf_freq(double value);
+  public:
 
   // double target_rf_freq = 2;
   void clear_target_rf_freq();
-  static const int kTargetRfFreqFieldNumber = 2;
   double target_rf_freq() const;
   void set_target_rf_freq(double value);
+  private:
+  double _internal_target_rf_freq() const;
+  void _internal_set_target_rf_freq(double value);
+  public:
 
   // double actual_rf_freq = 3;
   void clear_actual_rf_freq();
-  static const int kActualRfFreqFieldNumber = 3;
   double actual_rf_freq() const;
   void set_actual_rf_freq(double value);
+  private:
+  double _internal_actual_rf_freq() const;
+  void _internal_set_actual_rf_freq(double value);
+  public:
 
   // double target_dsp_freq = 4;
   void clear_target_dsp_freq();
-  static const int kTargetDspFreqFieldNumber = 4;
   double target_dsp_freq() const;
   void set_target_dsp_freq(double value);
+  private:
+  double _internal_target_dsp_freq() const;
+  void _internal_set_target_dsp_freq(double value);
+  public:
 
   // double actual_dsp_freq = 5;
   void clear_actual_dsp_freq();
-  static const int kActualDspFreqFieldNumber = 5;
   double actual_dsp_freq() const;
   void set_actual_dsp_freq(double value);
+  private:
+  double _internal_actual_dsp_freq() const;
+  void _internal_set_actual_dsp_freq(double value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.TuneResult)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  double clipped_rf_freq_;
-  double target_rf_freq_;
-  double actual_rf_freq_;
-  double target_dsp_freq_;
-  double actual_dsp_freq_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double clipped_rf_freq_;
+    double target_rf_freq_;
+    double actual_rf_freq_;
+    double target_dsp_freq_;
+    double actual_dsp_freq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FrequencyRequestParams : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.FrequencyRequestParams) */ {
+class FrequencyRequestParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.FrequencyRequestParams) */ {
  public:
-  FrequencyRequestParams();
-  virtual ~FrequencyRequestParams();
+  inline FrequencyRequestParams() : FrequencyRequestParams(nullptr) {}
+  ~FrequencyRequestParams() override;
+  explicit PROTOBUF_CONSTEXPR FrequencyRequestParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FrequencyRequestParams(const FrequencyRequestParams& from);
-
-  inline FrequencyRequestParams& operator=(const FrequencyRequestParams& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   FrequencyRequestParams(FrequencyRequestParams&& from) noexcept
     : FrequencyRequestParams() {
     *this = ::std::move(from);
   }
 
+  inline FrequencyRequestParams& operator=(const FrequencyRequestParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline FrequencyRequestParams& operator=(FrequencyRequestParams&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const FrequencyRequestParams& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FrequencyRequestParams& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const FrequencyRequestParams* internal_default_instance() {
     return reinterpret_cast<const FrequencyRequestParams*>(
                &_FrequencyRequestParams_default_instance_);
@@ -1307,121 +1864,198 @@ class FrequencyRequestParams : public ::google::protobuf::Message /* @@protoc_in
   static constexpr int kIndexInFileMessages =
     9;
 
-  void Swap(FrequencyRequestParams* other);
   friend void swap(FrequencyRequestParams& a, FrequencyRequestParams& b) {
     a.Swap(&b);
   }
+  inline void Swap(FrequencyRequestParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrequencyRequestParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline FrequencyRequestParams* New() const final {
-    return CreateMaybeMessage<FrequencyRequestParams>(NULL);
-  }
-
-  FrequencyRequestParams* New(::google::protobuf::Arena* arena) const final {
+  FrequencyRequestParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FrequencyRequestParams>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const FrequencyRequestParams& from);
-  void MergeFrom(const FrequencyRequestParams& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrequencyRequestParams& from) {
+    FrequencyRequestParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(FrequencyRequestParams* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.FrequencyRequestParams";
   }
+  protected:
+  explicit FrequencyRequestParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTuneRequestFieldNumber = 1,
+    kChannelRequestFieldNumber = 2,
+    kCommandTimeTicksFieldNumber = 3,
+    kCommandIdFieldNumber = 4,
+  };
   // .flexsdr.TuneRequest tune_request = 1;
   bool has_tune_request() const;
-  void clear_tune_request();
-  static const int kTuneRequestFieldNumber = 1;
   private:
-  const ::flexsdr::TuneRequest& _internal_tune_request() const;
+  bool _internal_has_tune_request() const;
   public:
+  void clear_tune_request();
   const ::flexsdr::TuneRequest& tune_request() const;
-  ::flexsdr::TuneRequest* release_tune_request();
+  PROTOBUF_NODISCARD ::flexsdr::TuneRequest* release_tune_request();
   ::flexsdr::TuneRequest* mutable_tune_request();
   void set_allocated_tune_request(::flexsdr::TuneRequest* tune_request);
+  private:
+  const ::flexsdr::TuneRequest& _internal_tune_request() const;
+  ::flexsdr::TuneRequest* _internal_mutable_tune_request();
+  public:
+  void unsafe_arena_set_allocated_tune_request(
+      ::flexsdr::TuneRequest* tune_request);
+  ::flexsdr::TuneRequest* unsafe_arena_release_tune_request();
 
   // .flexsdr.ChannelRequest channel_request = 2;
   bool has_channel_request() const;
-  void clear_channel_request();
-  static const int kChannelRequestFieldNumber = 2;
   private:
-  const ::flexsdr::ChannelRequest& _internal_channel_request() const;
+  bool _internal_has_channel_request() const;
   public:
+  void clear_channel_request();
   const ::flexsdr::ChannelRequest& channel_request() const;
-  ::flexsdr::ChannelRequest* release_channel_request();
+  PROTOBUF_NODISCARD ::flexsdr::ChannelRequest* release_channel_request();
   ::flexsdr::ChannelRequest* mutable_channel_request();
   void set_allocated_channel_request(::flexsdr::ChannelRequest* channel_request);
+  private:
+  const ::flexsdr::ChannelRequest& _internal_channel_request() const;
+  ::flexsdr::ChannelRequest* _internal_mutable_channel_request();
+  public:
+  void unsafe_arena_set_allocated_channel_request(
+      ::flexsdr::ChannelRequest* channel_request);
+  ::flexsdr::ChannelRequest* unsafe_arena_release_channel_request();
+
+  // uint64 command_time_ticks = 3;
+  void clear_command_time_ticks();
+  uint64_t command_time_ticks() const;
+  void set_command_time_ticks(uint64_t value);
+  private:
+  uint64_t _internal_command_time_ticks() const;
+  void _internal_set_command_time_ticks(uint64_t value);
+  public:
+
+  // uint32 command_id = 4;
+  void clear_command_id();
+  uint32_t command_id() const;
+  void set_command_id(uint32_t value);
+  private:
+  uint32_t _internal_command_id() const;
+  void _internal_set_command_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.FrequencyRequestParams)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::flexsdr::TuneRequest* tune_request_;
-  ::flexsdr::ChannelRequest* channel_request_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::flexsdr::TuneRequest* tune_request_;
+    ::flexsdr::ChannelRequest* channel_request_;
+    uint64_t command_time_ticks_;
+    uint32_t command_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FrequencyResponseParams : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.FrequencyResponseParams) */ {
+class FrequencyResponseParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.FrequencyResponseParams) */ {
  public:
-  FrequencyResponseParams();
-  virtual ~FrequencyResponseParams();
+  inline FrequencyResponseParams() : FrequencyResponseParams(nullptr) {}
+  ~FrequencyResponseParams() override;
+  explicit PROTOBUF_CONSTEXPR FrequencyResponseParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FrequencyResponseParams(const FrequencyResponseParams& from);
-
-  inline FrequencyResponseParams& operator=(const FrequencyResponseParams& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   FrequencyResponseParams(FrequencyResponseParams&& from) noexcept
     : FrequencyResponseParams() {
     *this = ::std::move(from);
   }
 
+  inline FrequencyResponseParams& operator=(const FrequencyResponseParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline FrequencyResponseParams& operator=(FrequencyResponseParams&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const FrequencyResponseParams& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FrequencyResponseParams& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const FrequencyResponseParams* internal_default_instance() {
     return reinterpret_cast<const FrequencyResponseParams*>(
                &_FrequencyResponseParams_default_instance_);
@@ -1429,130 +2063,183 @@ class FrequencyResponseParams : public ::google::protobuf::Message /* @@protoc_i
   static constexpr int kIndexInFileMessages =
     10;
 
-  void Swap(FrequencyResponseParams* other);
   friend void swap(FrequencyResponseParams& a, FrequencyResponseParams& b) {
     a.Swap(&b);
   }
+  inline void Swap(FrequencyResponseParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrequencyResponseParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline FrequencyResponseParams* New() const final {
-    return CreateMaybeMessage<FrequencyResponseParams>(NULL);
-  }
-
-  FrequencyResponseParams* New(::google::protobuf::Arena* arena) const final {
+  FrequencyResponseParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FrequencyResponseParams>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const FrequencyResponseParams& from);
-  void MergeFrom(const FrequencyResponseParams& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrequencyResponseParams& from) {
+    FrequencyResponseParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(FrequencyResponseParams* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.FrequencyResponseParams";
   }
+  protected:
+  explicit FrequencyResponseParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 3,
+    kTuneResultFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
   // string error_message = 3;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 3;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
 
   // .flexsdr.TuneResult tune_result = 2;
   bool has_tune_result() const;
-  void clear_tune_result();
-  static const int kTuneResultFieldNumber = 2;
   private:
-  const ::flexsdr::TuneResult& _internal_tune_result() const;
+  bool _internal_has_tune_result() const;
   public:
+  void clear_tune_result();
   const ::flexsdr::TuneResult& tune_result() const;
-  ::flexsdr::TuneResult* release_tune_result();
+  PROTOBUF_NODISCARD ::flexsdr::TuneResult* release_tune_result();
   ::flexsdr::TuneResult* mutable_tune_result();
   void set_allocated_tune_result(::flexsdr::TuneResult* tune_result);
+  private:
+  const ::flexsdr::TuneResult& _internal_tune_result() const;
+  ::flexsdr::TuneResult* _internal_mutable_tune_result();
+  public:
+  void unsafe_arena_set_allocated_tune_result(
+      ::flexsdr::TuneResult* tune_result);
+  ::flexsdr::TuneResult* unsafe_arena_release_tune_result();
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.FrequencyResponseParams)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  ::flexsdr::TuneResult* tune_result_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    ::flexsdr::TuneResult* tune_result_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FrequencyValue : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.FrequencyValue) */ {
+class FrequencyValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.FrequencyValue) */ {
  public:
-  FrequencyValue();
-  virtual ~FrequencyValue();
+  inline FrequencyValue() : FrequencyValue(nullptr) {}
+  ~FrequencyValue() override;
+  explicit PROTOBUF_CONSTEXPR FrequencyValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FrequencyValue(const FrequencyValue& from);
-
-  inline FrequencyValue& operator=(const FrequencyValue& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   FrequencyValue(FrequencyValue&& from) noexcept
     : FrequencyValue() {
     *this = ::std::move(from);
   }
 
+  inline FrequencyValue& operator=(const FrequencyValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline FrequencyValue& operator=(FrequencyValue&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const FrequencyValue& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FrequencyValue& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const FrequencyValue* internal_default_instance() {
     return reinterpret_cast<const FrequencyValue*>(
                &_FrequencyValue_default_instance_);
@@ -1560,124 +2247,173 @@ class FrequencyValue : public ::google::protobuf::Message /* @@protoc_insertion_
   static constexpr int kIndexInFileMessages =
     11;
 
-  void Swap(FrequencyValue* other);
   friend void swap(FrequencyValue& a, FrequencyValue& b) {
     a.Swap(&b);
   }
+  inline void Swap(FrequencyValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrequencyValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline FrequencyValue* New() const final {
-    return CreateMaybeMessage<FrequencyValue>(NULL);
-  }
-
-  FrequencyValue* New(::google::protobuf::Arena* arena) const final {
+  FrequencyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FrequencyValue>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const FrequencyValue& from);
-  void MergeFrom(const FrequencyValue& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrequencyValue& from) {
+    FrequencyValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(FrequencyValue* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.FrequencyValue";
   }
+  protected:
+  explicit FrequencyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 3,
+    kFrequencyFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
   // string error_message = 3;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 3;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
 
   // double frequency = 2;
   void clear_frequency();
-  static const int kFrequencyFieldNumber = 2;
   double frequency() const;
   void set_frequency(double value);
+  private:
+  double _internal_frequency() const;
+  void _internal_set_frequency(double value);
+  public:
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.FrequencyValue)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  double frequency_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    double frequency_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeviceInfoRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.DeviceInfoRequest) */ {
+class DeviceInfoRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:flexsdr.DeviceInfoRequest) */ {
  public:
-  DeviceInfoRequest();
-  virtual ~DeviceInfoRequest();
+  inline DeviceInfoRequest() : DeviceInfoRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR DeviceInfoRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeviceInfoRequest(const DeviceInfoRequest& from);
-
-  inline DeviceInfoRequest& operator=(const DeviceInfoRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   DeviceInfoRequest(DeviceInfoRequest&& from) noexcept
     : DeviceInfoRequest() {
     *this = ::std::move(from);
   }
 
+  inline DeviceInfoRequest& operator=(const DeviceInfoRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline DeviceInfoRequest& operator=(DeviceInfoRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DeviceInfoRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeviceInfoRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const DeviceInfoRequest* internal_default_instance() {
     return reinterpret_cast<const DeviceInfoRequest*>(
                &_DeviceInfoRequest_default_instance_);
@@ -1685,51 +2421,57 @@ class DeviceInfoRequest : public ::google::protobuf::Message /* @@protoc_inserti
   static constexpr int kIndexInFileMessages =
     12;
 
-  void Swap(DeviceInfoRequest* other);
   friend void swap(DeviceInfoRequest& a, DeviceInfoRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(DeviceInfoRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeviceInfoRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DeviceInfoRequest* New() const final {
-    return CreateMaybeMessage<DeviceInfoRequest>(NULL);
-  }
-
-  DeviceInfoRequest* New(::google::protobuf::Arena* arena) const final {
+  DeviceInfoRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeviceInfoRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const DeviceInfoRequest& from);
-  void MergeFrom(const DeviceInfoRequest& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const DeviceInfoRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const DeviceInfoRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
   private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(DeviceInfoRequest* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.DeviceInfoRequest";
   }
+  protected:
+  explicit DeviceInfoRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1737,43 +2479,60 @@ class DeviceInfoRequest : public ::google::protobuf::Message /* @@protoc_inserti
 
   // @@protoc_insertion_point(class_scope:flexsdr.DeviceInfoRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeviceInfoResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:flexsdr.DeviceInfoResponse) */ {
+class DeviceInfoResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.DeviceInfoResponse) */ {
  public:
-  DeviceInfoResponse();
-  virtual ~DeviceInfoResponse();
+  inline DeviceInfoResponse() : DeviceInfoResponse(nullptr) {}
+  ~DeviceInfoResponse() override;
+  explicit PROTOBUF_CONSTEXPR DeviceInfoResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeviceInfoResponse(const DeviceInfoResponse& from);
-
-  inline DeviceInfoResponse& operator=(const DeviceInfoResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   DeviceInfoResponse(DeviceInfoResponse&& from) noexcept
     : DeviceInfoResponse() {
     *this = ::std::move(from);
   }
 
+  inline DeviceInfoResponse& operator=(const DeviceInfoResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline DeviceInfoResponse& operator=(DeviceInfoResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DeviceInfoResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeviceInfoResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const DeviceInfoResponse* internal_default_instance() {
     return reinterpret_cast<const DeviceInfoResponse*>(
                &_DeviceInfoResponse_default_instance_);
@@ -1781,189 +2540,992 @@ class DeviceInfoResponse : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     13;
 
-  void Swap(DeviceInfoResponse* other);
   friend void swap(DeviceInfoResponse& a, DeviceInfoResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(DeviceInfoResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeviceInfoResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DeviceInfoResponse* New() const final {
-    return CreateMaybeMessage<DeviceInfoResponse>(NULL);
-  }
-
-  DeviceInfoResponse* New(::google::protobuf::Arena* arena) const final {
+  DeviceInfoResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeviceInfoResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeviceInfoResponse& from);
-  void MergeFrom(const DeviceInfoResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeviceInfoResponse& from) {
+    DeviceInfoResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeviceInfoResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.DeviceInfoResponse";
   }
+  protected:
+  explicit DeviceInfoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRxAntennasFieldNumber = 3,
+    kTxAntennasFieldNumber = 4,
+    kDeviceNameFieldNumber = 1,
+    kSerialNumberFieldNumber = 2,
+    kMinRxGainFieldNumber = 5,
+    kMaxRxGainFieldNumber = 6,
+    kMinTxGainFieldNumber = 7,
+    kMaxTxGainFieldNumber = 8,
+  };
   // repeated string rx_antennas = 3;
   int rx_antennas_size() const;
+  private:
+  int _internal_rx_antennas_size() const;
+  public:
   void clear_rx_antennas();
-  static const int kRxAntennasFieldNumber = 3;
-  const ::std::string& rx_antennas(int index) const;
-  ::std::string* mutable_rx_antennas(int index);
-  void set_rx_antennas(int index, const ::std::string& value);
-  #if LANG_CXX11
-  void set_rx_antennas(int index, ::std::string&& value);
-  #endif
+  const std::string& rx_antennas(int index) const;
+  std::string* mutable_rx_antennas(int index);
+  void set_rx_antennas(int index, const std::string& value);
+  void set_rx_antennas(int index, std::string&& value);
   void set_rx_antennas(int index, const char* value);
   void set_rx_antennas(int index, const char* value, size_t size);
-  ::std::string* add_rx_antennas();
-  void add_rx_antennas(const ::std::string& value);
-  #if LANG_CXX11
-  void add_rx_antennas(::std::string&& value);
-  #endif
+  std::string* add_rx_antennas();
+  void add_rx_antennas(const std::string& value);
+  void add_rx_antennas(std::string&& value);
   void add_rx_antennas(const char* value);
   void add_rx_antennas(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& rx_antennas() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_rx_antennas();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rx_antennas() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rx_antennas();
+  private:
+  const std::string& _internal_rx_antennas(int index) const;
+  std::string* _internal_add_rx_antennas();
+  public:
 
   // repeated string tx_antennas = 4;
   int tx_antennas_size() const;
+  private:
+  int _internal_tx_antennas_size() const;
+  public:
   void clear_tx_antennas();
-  static const int kTxAntennasFieldNumber = 4;
-  const ::std::string& tx_antennas(int index) const;
-  ::std::string* mutable_tx_antennas(int index);
-  void set_tx_antennas(int index, const ::std::string& value);
-  #if LANG_CXX11
-  void set_tx_antennas(int index, ::std::string&& value);
-  #endif
+  const std::string& tx_antennas(int index) const;
+  std::string* mutable_tx_antennas(int index);
+  void set_tx_antennas(int index, const std::string& value);
+  void set_tx_antennas(int index, std::string&& value);
   void set_tx_antennas(int index, const char* value);
   void set_tx_antennas(int index, const char* value, size_t size);
-  ::std::string* add_tx_antennas();
-  void add_tx_antennas(const ::std::string& value);
-  #if LANG_CXX11
-  void add_tx_antennas(::std::string&& value);
-  #endif
+  std::string* add_tx_antennas();
+  void add_tx_antennas(const std::string& value);
+  void add_tx_antennas(std::string&& value);
   void add_tx_antennas(const char* value);
   void add_tx_antennas(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& tx_antennas() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_tx_antennas();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& tx_antennas() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_tx_antennas();
+  private:
+  const std::string& _internal_tx_antennas(int index) const;
+  std::string* _internal_add_tx_antennas();
+  public:
 
   // string device_name = 1;
   void clear_device_name();
-  static const int kDeviceNameFieldNumber = 1;
-  const ::std::string& device_name() const;
-  void set_device_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_device_name(::std::string&& value);
-  #endif
-  void set_device_name(const char* value);
-  void set_device_name(const char* value, size_t size);
-  ::std::string* mutable_device_name();
-  ::std::string* release_device_name();
-  void set_allocated_device_name(::std::string* device_name);
+  const std::string& device_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_device_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_device_name();
+  PROTOBUF_NODISCARD std::string* release_device_name();
+  void set_allocated_device_name(std::string* device_name);
+  private:
+  const std::string& _internal_device_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_device_name(const std::string& value);
+  std::string* _internal_mutable_device_name();
+  public:
 
   // string serial_number = 2;
   void clear_serial_number();
-  static const int kSerialNumberFieldNumber = 2;
-  const ::std::string& serial_number() const;
-  void set_serial_number(const ::std::string& value);
-  #if LANG_CXX11
-  void set_serial_number(::std::string&& value);
-  #endif
-  void set_serial_number(const char* value);
-  void set_serial_number(const char* value, size_t size);
-  ::std::string* mutable_serial_number();
-  ::std::string* release_serial_number();
-  void set_allocated_serial_number(::std::string* serial_number);
+  const std::string& serial_number() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_serial_number(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_serial_number();
+  PROTOBUF_NODISCARD std::string* release_serial_number();
+  void set_allocated_serial_number(std::string* serial_number);
+  private:
+  const std::string& _internal_serial_number() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_serial_number(const std::string& value);
+  std::string* _internal_mutable_serial_number();
+  public:
 
   // double min_rx_gain = 5;
   void clear_min_rx_gain();
-  static const int kMinRxGainFieldNumber = 5;
   double min_rx_gain() const;
   void set_min_rx_gain(double value);
+  private:
+  double _internal_min_rx_gain() const;
+  void _internal_set_min_rx_gain(double value);
+  public:
 
   // double max_rx_gain = 6;
   void clear_max_rx_gain();
-  static const int kMaxRxGainFieldNumber = 6;
   double max_rx_gain() const;
   void set_max_rx_gain(double value);
+  private:
+  double _internal_max_rx_gain() const;
+  void _internal_set_max_rx_gain(double value);
+  public:
 
   // double min_tx_gain = 7;
   void clear_min_tx_gain();
-  static const int kMinTxGainFieldNumber = 7;
   double min_tx_gain() const;
   void set_min_tx_gain(double value);
+  private:
+  double _internal_min_tx_gain() const;
+  void _internal_set_min_tx_gain(double value);
+  public:
 
   // double max_tx_gain = 8;
   void clear_max_tx_gain();
-  static const int kMaxTxGainFieldNumber = 8;
   double max_tx_gain() const;
   void set_max_tx_gain(double value);
+  private:
+  double _internal_max_tx_gain() const;
+  void _internal_set_max_tx_gain(double value);
+  public:
 
   // @@protoc_insertion_point(class_scope:flexsdr.DeviceInfoResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> rx_antennas_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> tx_antennas_;
-  ::google::protobuf::internal::ArenaStringPtr device_name_;
-  ::google::protobuf::internal::ArenaStringPtr serial_number_;
-  double min_rx_gain_;
-  double max_rx_gain_;
-  double min_tx_gain_;
-  double max_tx_gain_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_flexsdr_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rx_antennas_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> tx_antennas_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr device_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr serial_number_;
+    double min_rx_gain_;
+    double max_rx_gain_;
+    double min_tx_gain_;
+    double max_tx_gain_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class ParamChange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.ParamChange) */ {
+ public:
+  inline ParamChange() : ParamChange(nullptr) {}
+  ~ParamChange() override;
+  explicit PROTOBUF_CONSTEXPR ParamChange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  ParamChange(const ParamChange& from);
+  ParamChange(ParamChange&& from) noexcept
+    : ParamChange() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// ChannelRequest
+  inline ParamChange& operator=(const ParamChange& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ParamChange& operator=(ParamChange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// uint32 chan = 1;
-inline void ChannelRequest::clear_chan() {
-  chan_ = 0u;
-}
-inline ::google::protobuf::uint32 ChannelRequest::chan() const {
-  // @@protoc_insertion_point(field_get:flexsdr.ChannelRequest.chan)
-  return chan_;
-}
-inline void ChannelRequest::set_chan(::google::protobuf::uint32 value) {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ParamChange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ParamChange* internal_default_instance() {
+    return reinterpret_cast<const ParamChange*>(
+               &_ParamChange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ParamChange& a, ParamChange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ParamChange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ParamChange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ParamChange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ParamChange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ParamChange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ParamChange& from) {
+    ParamChange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ParamChange* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.ParamChange";
+  }
+  protected:
+  explicit ParamChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ParamChange_Kind Kind;
+  static constexpr Kind KIND_INVALID =
+    ParamChange_Kind_KIND_INVALID;
+  static constexpr Kind RX_GAIN =
+    ParamChange_Kind_RX_GAIN;
+  static constexpr Kind TX_GAIN =
+    ParamChange_Kind_TX_GAIN;
+  static constexpr Kind RX_RATE =
+    ParamChange_Kind_RX_RATE;
+  static constexpr Kind TX_RATE =
+    ParamChange_Kind_TX_RATE;
+  static constexpr Kind RX_FREQ =
+    ParamChange_Kind_RX_FREQ;
+  static constexpr Kind TX_FREQ =
+    ParamChange_Kind_TX_FREQ;
+  static constexpr Kind CLOCK_RATE =
+    ParamChange_Kind_CLOCK_RATE;
+  static inline bool Kind_IsValid(int value) {
+    return ParamChange_Kind_IsValid(value);
+  }
+  static constexpr Kind Kind_MIN =
+    ParamChange_Kind_Kind_MIN;
+  static constexpr Kind Kind_MAX =
+    ParamChange_Kind_Kind_MAX;
+  static constexpr int Kind_ARRAYSIZE =
+    ParamChange_Kind_Kind_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Kind_descriptor() {
+    return ParamChange_Kind_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Kind_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Kind>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Kind_Name.");
+    return ParamChange_Kind_Name(enum_t_value);
+  }
+  static inline bool Kind_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Kind* value) {
+    return ParamChange_Kind_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKindFieldNumber = 1,
+    kChanFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kCommandTimeTicksFieldNumber = 4,
+    kCommandIdFieldNumber = 5,
+  };
+  // .flexsdr.ParamChange.Kind kind = 1;
+  void clear_kind();
+  ::flexsdr::ParamChange_Kind kind() const;
+  void set_kind(::flexsdr::ParamChange_Kind value);
+  private:
+  ::flexsdr::ParamChange_Kind _internal_kind() const;
+  void _internal_set_kind(::flexsdr::ParamChange_Kind value);
+  public:
+
+  // uint32 chan = 2;
+  void clear_chan();
+  uint32_t chan() const;
+  void set_chan(uint32_t value);
+  private:
+  uint32_t _internal_chan() const;
+  void _internal_set_chan(uint32_t value);
+  public:
+
+  // double value = 3;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // uint64 command_time_ticks = 4;
+  void clear_command_time_ticks();
+  uint64_t command_time_ticks() const;
+  void set_command_time_ticks(uint64_t value);
+  private:
+  uint64_t _internal_command_time_ticks() const;
+  void _internal_set_command_time_ticks(uint64_t value);
+  public:
+
+  // uint32 command_id = 5;
+  void clear_command_id();
+  uint32_t command_id() const;
+  void set_command_id(uint32_t value);
+  private:
+  uint32_t _internal_command_id() const;
+  void _internal_set_command_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:flexsdr.ParamChange)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int kind_;
+    uint32_t chan_;
+    double value_;
+    uint64_t command_time_ticks_;
+    uint32_t command_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ApplySettingsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.ApplySettingsRequest) */ {
+ public:
+  inline ApplySettingsRequest() : ApplySettingsRequest(nullptr) {}
+  ~ApplySettingsRequest() override;
+  explicit PROTOBUF_CONSTEXPR ApplySettingsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ApplySettingsRequest(const ApplySettingsRequest& from);
+  ApplySettingsRequest(ApplySettingsRequest&& from) noexcept
+    : ApplySettingsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ApplySettingsRequest& operator=(const ApplySettingsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ApplySettingsRequest& operator=(ApplySettingsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ApplySettingsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ApplySettingsRequest* internal_default_instance() {
+    return reinterpret_cast<const ApplySettingsRequest*>(
+               &_ApplySettingsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ApplySettingsRequest& a, ApplySettingsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ApplySettingsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ApplySettingsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ApplySettingsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ApplySettingsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ApplySettingsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ApplySettingsRequest& from) {
+    ApplySettingsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ApplySettingsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.ApplySettingsRequest";
+  }
+  protected:
+  explicit ApplySettingsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChangesFieldNumber = 1,
+    kStopOnErrorFieldNumber = 2,
+  };
+  // repeated .flexsdr.ParamChange changes = 1;
+  int changes_size() const;
+  private:
+  int _internal_changes_size() const;
+  public:
+  void clear_changes();
+  ::flexsdr::ParamChange* mutable_changes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamChange >*
+      mutable_changes();
+  private:
+  const ::flexsdr::ParamChange& _internal_changes(int index) const;
+  ::flexsdr::ParamChange* _internal_add_changes();
+  public:
+  const ::flexsdr::ParamChange& changes(int index) const;
+  ::flexsdr::ParamChange* add_changes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamChange >&
+      changes() const;
+
+  // bool stop_on_error = 2;
+  void clear_stop_on_error();
+  bool stop_on_error() const;
+  void set_stop_on_error(bool value);
+  private:
+  bool _internal_stop_on_error() const;
+  void _internal_set_stop_on_error(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:flexsdr.ApplySettingsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamChange > changes_;
+    bool stop_on_error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ParamResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.ParamResult) */ {
+ public:
+  inline ParamResult() : ParamResult(nullptr) {}
+  ~ParamResult() override;
+  explicit PROTOBUF_CONSTEXPR ParamResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ParamResult(const ParamResult& from);
+  ParamResult(ParamResult&& from) noexcept
+    : ParamResult() {
+    *this = ::std::move(from);
+  }
+
+  inline ParamResult& operator=(const ParamResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ParamResult& operator=(ParamResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ParamResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ParamResult* internal_default_instance() {
+    return reinterpret_cast<const ParamResult*>(
+               &_ParamResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(ParamResult& a, ParamResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ParamResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ParamResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ParamResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ParamResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ParamResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ParamResult& from) {
+    ParamResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ParamResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.ParamResult";
+  }
+  protected:
+  explicit ParamResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorMessageFieldNumber = 3,
+    kActualValueFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string error_message = 3;
+  void clear_error_message();
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
+
+  // double actual_value = 2;
+  void clear_actual_value();
+  double actual_value() const;
+  void set_actual_value(double value);
+  private:
+  double _internal_actual_value() const;
+  void _internal_set_actual_value(double value);
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:flexsdr.ParamResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    double actual_value_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ApplySettingsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:flexsdr.ApplySettingsResponse) */ {
+ public:
+  inline ApplySettingsResponse() : ApplySettingsResponse(nullptr) {}
+  ~ApplySettingsResponse() override;
+  explicit PROTOBUF_CONSTEXPR ApplySettingsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ApplySettingsResponse(const ApplySettingsResponse& from);
+  ApplySettingsResponse(ApplySettingsResponse&& from) noexcept
+    : ApplySettingsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ApplySettingsResponse& operator=(const ApplySettingsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ApplySettingsResponse& operator=(ApplySettingsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ApplySettingsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ApplySettingsResponse* internal_default_instance() {
+    return reinterpret_cast<const ApplySettingsResponse*>(
+               &_ApplySettingsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(ApplySettingsResponse& a, ApplySettingsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ApplySettingsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ApplySettingsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ApplySettingsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ApplySettingsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ApplySettingsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ApplySettingsResponse& from) {
+    ApplySettingsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ApplySettingsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "flexsdr.ApplySettingsResponse";
+  }
+  protected:
+  explicit ApplySettingsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // repeated .flexsdr.ParamResult results = 2;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::flexsdr::ParamResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamResult >*
+      mutable_results();
+  private:
+  const ::flexsdr::ParamResult& _internal_results(int index) const;
+  ::flexsdr::ParamResult* _internal_add_results();
+  public:
+  const ::flexsdr::ParamResult& results(int index) const;
+  ::flexsdr::ParamResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamResult >&
+      results() const;
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:flexsdr.ApplySettingsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamResult > results_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_flexsdr_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ChannelRequest
+
+// uint32 chan = 1;
+inline void ChannelRequest::clear_chan() {
+  _impl_.chan_ = 0u;
+}
+inline uint32_t ChannelRequest::_internal_chan() const {
+  return _impl_.chan_;
+}
+inline uint32_t ChannelRequest::chan() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ChannelRequest.chan)
+  return _internal_chan();
+}
+inline void ChannelRequest::_internal_set_chan(uint32_t value) {
   
-  chan_ = value;
+  _impl_.chan_ = value;
+}
+inline void ChannelRequest::set_chan(uint32_t value) {
+  _internal_set_chan(value);
   // @@protoc_insertion_point(field_set:flexsdr.ChannelRequest.chan)
 }
 
@@ -1973,29 +3535,41 @@ inline void ChannelRequest::set_chan(::google::protobuf::uint32 value) {
 
 // .flexsdr.UnitType unit = 1;
 inline void ClockRateRequestParams::clear_unit() {
-  unit_ = 0;
+  _impl_.unit_ = 0;
+}
+inline ::flexsdr::UnitType ClockRateRequestParams::_internal_unit() const {
+  return static_cast< ::flexsdr::UnitType >(_impl_.unit_);
 }
 inline ::flexsdr::UnitType ClockRateRequestParams::unit() const {
   // @@protoc_insertion_point(field_get:flexsdr.ClockRateRequestParams.unit)
-  return static_cast< ::flexsdr::UnitType >(unit_);
+  return _internal_unit();
 }
-inline void ClockRateRequestParams::set_unit(::flexsdr::UnitType value) {
+inline void ClockRateRequestParams::_internal_set_unit(::flexsdr::UnitType value) {
   
-  unit_ = value;
+  _impl_.unit_ = value;
+}
+inline void ClockRateRequestParams::set_unit(::flexsdr::UnitType value) {
+  _internal_set_unit(value);
   // @@protoc_insertion_point(field_set:flexsdr.ClockRateRequestParams.unit)
 }
 
 // double rate = 2;
 inline void ClockRateRequestParams::clear_rate() {
-  rate_ = 0;
+  _impl_.rate_ = 0;
+}
+inline double ClockRateRequestParams::_internal_rate() const {
+  return _impl_.rate_;
 }
 inline double ClockRateRequestParams::rate() const {
   // @@protoc_insertion_point(field_get:flexsdr.ClockRateRequestParams.rate)
-  return rate_;
+  return _internal_rate();
 }
-inline void ClockRateRequestParams::set_rate(double value) {
+inline void ClockRateRequestParams::_internal_set_rate(double value) {
   
-  rate_ = value;
+  _impl_.rate_ = value;
+}
+inline void ClockRateRequestParams::set_rate(double value) {
+  _internal_set_rate(value);
   // @@protoc_insertion_point(field_set:flexsdr.ClockRateRequestParams.rate)
 }
 
@@ -2005,82 +3579,91 @@ inline void ClockRateRequestParams::set_rate(double value) {
 
 // bool success = 1;
 inline void ClockRateResponseParams::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool ClockRateResponseParams::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool ClockRateResponseParams::success() const {
   // @@protoc_insertion_point(field_get:flexsdr.ClockRateResponseParams.success)
-  return success_;
+  return _internal_success();
 }
-inline void ClockRateResponseParams::set_success(bool value) {
+inline void ClockRateResponseParams::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void ClockRateResponseParams::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:flexsdr.ClockRateResponseParams.success)
 }
 
 // double actual_rate = 2;
 inline void ClockRateResponseParams::clear_actual_rate() {
-  actual_rate_ = 0;
+  _impl_.actual_rate_ = 0;
+}
+inline double ClockRateResponseParams::_internal_actual_rate() const {
+  return _impl_.actual_rate_;
 }
 inline double ClockRateResponseParams::actual_rate() const {
   // @@protoc_insertion_point(field_get:flexsdr.ClockRateResponseParams.actual_rate)
-  return actual_rate_;
+  return _internal_actual_rate();
 }
-inline void ClockRateResponseParams::set_actual_rate(double value) {
+inline void ClockRateResponseParams::_internal_set_actual_rate(double value) {
   
-  actual_rate_ = value;
+  _impl_.actual_rate_ = value;
+}
+inline void ClockRateResponseParams::set_actual_rate(double value) {
+  _internal_set_actual_rate(value);
   // @@protoc_insertion_point(field_set:flexsdr.ClockRateResponseParams.actual_rate)
 }
 
 // string error_message = 3;
 inline void ClockRateResponseParams::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.ClearToEmpty();
 }
-inline const ::std::string& ClockRateResponseParams::error_message() const {
+inline const std::string& ClockRateResponseParams::error_message() const {
   // @@protoc_insertion_point(field_get:flexsdr.ClockRateResponseParams.error_message)
-  return error_message_.GetNoArena();
+  return _internal_error_message();
 }
-inline void ClockRateResponseParams::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClockRateResponseParams::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:flexsdr.ClockRateResponseParams.error_message)
 }
-#if LANG_CXX11
-inline void ClockRateResponseParams::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:flexsdr.ClockRateResponseParams.error_message)
+inline std::string* ClockRateResponseParams::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:flexsdr.ClockRateResponseParams.error_message)
+  return _s;
 }
-#endif
-inline void ClockRateResponseParams::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:flexsdr.ClockRateResponseParams.error_message)
+inline const std::string& ClockRateResponseParams::_internal_error_message() const {
+  return _impl_.error_message_.Get();
 }
-inline void ClockRateResponseParams::set_error_message(const char* value, size_t size) {
+inline void ClockRateResponseParams::_internal_set_error_message(const std::string& value) {
   
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:flexsdr.ClockRateResponseParams.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ClockRateResponseParams::mutable_error_message() {
+inline std::string* ClockRateResponseParams::_internal_mutable_error_message() {
   
-  // @@protoc_insertion_point(field_mutable:flexsdr.ClockRateResponseParams.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ClockRateResponseParams::release_error_message() {
+inline std::string* ClockRateResponseParams::release_error_message() {
   // @@protoc_insertion_point(field_release:flexsdr.ClockRateResponseParams.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Release();
 }
-inline void ClockRateResponseParams::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
+inline void ClockRateResponseParams::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:flexsdr.ClockRateResponseParams.error_message)
 }
 
@@ -2090,167 +3673,225 @@ inline void ClockRateResponseParams::set_allocated_error_message(::std::string*
 
 // double gain = 1;
 inline void GainRequestParams::clear_gain() {
-  gain_ = 0;
+  _impl_.gain_ = 0;
+}
+inline double GainRequestParams::_internal_gain() const {
+  return _impl_.gain_;
 }
 inline double GainRequestParams::gain() const {
   // @@protoc_insertion_point(field_get:flexsdr.GainRequestParams.gain)
-  return gain_;
+  return _internal_gain();
 }
-inline void GainRequestParams::set_gain(double value) {
+inline void GainRequestParams::_internal_set_gain(double value) {
   
-  gain_ = value;
+  _impl_.gain_ = value;
+}
+inline void GainRequestParams::set_gain(double value) {
+  _internal_set_gain(value);
   // @@protoc_insertion_point(field_set:flexsdr.GainRequestParams.gain)
 }
 
 // string name = 2;
 inline void GainRequestParams::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& GainRequestParams::name() const {
+inline const std::string& GainRequestParams::name() const {
   // @@protoc_insertion_point(field_get:flexsdr.GainRequestParams.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void GainRequestParams::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GainRequestParams::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:flexsdr.GainRequestParams.name)
 }
-#if LANG_CXX11
-inline void GainRequestParams::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:flexsdr.GainRequestParams.name)
+inline std::string* GainRequestParams::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:flexsdr.GainRequestParams.name)
+  return _s;
 }
-#endif
-inline void GainRequestParams::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:flexsdr.GainRequestParams.name)
+inline const std::string& GainRequestParams::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void GainRequestParams::set_name(const char* value, size_t size) {
+inline void GainRequestParams::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:flexsdr.GainRequestParams.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GainRequestParams::mutable_name() {
+inline std::string* GainRequestParams::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:flexsdr.GainRequestParams.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* GainRequestParams::release_name() {
+inline std::string* GainRequestParams::release_name() {
   // @@protoc_insertion_point(field_release:flexsdr.GainRequestParams.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void GainRequestParams::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void GainRequestParams::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:flexsdr.GainRequestParams.name)
 }
 
 // uint32 chan = 3;
 inline void GainRequestParams::clear_chan() {
-  chan_ = 0u;
+  _impl_.chan_ = 0u;
+}
+inline uint32_t GainRequestParams::_internal_chan() const {
+  return _impl_.chan_;
 }
-inline ::google::protobuf::uint32 GainRequestParams::chan() const {
+inline uint32_t GainRequestParams::chan() const {
   // @@protoc_insertion_point(field_get:flexsdr.GainRequestParams.chan)
-  return chan_;
+  return _internal_chan();
 }
-inline void GainRequestParams::set_chan(::google::protobuf::uint32 value) {
+inline void GainRequestParams::_internal_set_chan(uint32_t value) {
   
-  chan_ = value;
+  _impl_.chan_ = value;
+}
+inline void GainRequestParams::set_chan(uint32_t value) {
+  _internal_set_chan(value);
   // @@protoc_insertion_point(field_set:flexsdr.GainRequestParams.chan)
 }
 
+// uint64 command_time_ticks = 4;
+inline void GainRequestParams::clear_command_time_ticks() {
+  _impl_.command_time_ticks_ = uint64_t{0u};
+}
+inline uint64_t GainRequestParams::_internal_command_time_ticks() const {
+  return _impl_.command_time_ticks_;
+}
+inline uint64_t GainRequestParams::command_time_ticks() const {
+  // @@protoc_insertion_point(field_get:flexsdr.GainRequestParams.command_time_ticks)
+  return _internal_command_time_ticks();
+}
+inline void GainRequestParams::_internal_set_command_time_ticks(uint64_t value) {
+  
+  _impl_.command_time_ticks_ = value;
+}
+inline void GainRequestParams::set_command_time_ticks(uint64_t value) {
+  _internal_set_command_time_ticks(value);
+  // @@protoc_insertion_point(field_set:flexsdr.GainRequestParams.command_time_ticks)
+}
+
+// uint32 command_id = 5;
+inline void GainRequestParams::clear_command_id() {
+  _impl_.command_id_ = 0u;
+}
+inline uint32_t GainRequestParams::_internal_command_id() const {
+  return _impl_.command_id_;
+}
+inline uint32_t GainRequestParams::command_id() const {
+  // @@protoc_insertion_point(field_get:flexsdr.GainRequestParams.command_id)
+  return _internal_command_id();
+}
+inline void GainRequestParams::_internal_set_command_id(uint32_t value) {
+  
+  _impl_.command_id_ = value;
+}
+inline void GainRequestParams::set_command_id(uint32_t value) {
+  _internal_set_command_id(value);
+  // @@protoc_insertion_point(field_set:flexsdr.GainRequestParams.command_id)
+}
+
 // -------------------------------------------------------------------
 
 // GainResponseParams
 
 // bool success = 1;
 inline void GainResponseParams::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool GainResponseParams::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool GainResponseParams::success() const {
   // @@protoc_insertion_point(field_get:flexsdr.GainResponseParams.success)
-  return success_;
+  return _internal_success();
 }
-inline void GainResponseParams::set_success(bool value) {
+inline void GainResponseParams::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void GainResponseParams::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:flexsdr.GainResponseParams.success)
 }
 
 // double actual_gain = 2;
 inline void GainResponseParams::clear_actual_gain() {
-  actual_gain_ = 0;
+  _impl_.actual_gain_ = 0;
+}
+inline double GainResponseParams::_internal_actual_gain() const {
+  return _impl_.actual_gain_;
 }
 inline double GainResponseParams::actual_gain() const {
   // @@protoc_insertion_point(field_get:flexsdr.GainResponseParams.actual_gain)
-  return actual_gain_;
+  return _internal_actual_gain();
 }
-inline void GainResponseParams::set_actual_gain(double value) {
+inline void GainResponseParams::_internal_set_actual_gain(double value) {
   
-  actual_gain_ = value;
+  _impl_.actual_gain_ = value;
+}
+inline void GainResponseParams::set_actual_gain(double value) {
+  _internal_set_actual_gain(value);
   // @@protoc_insertion_point(field_set:flexsdr.GainResponseParams.actual_gain)
 }
 
 // string error_message = 3;
 inline void GainResponseParams::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.ClearToEmpty();
 }
-inline const ::std::string& GainResponseParams::error_message() const {
+inline const std::string& GainResponseParams::error_message() const {
   // @@protoc_insertion_point(field_get:flexsdr.GainResponseParams.error_message)
-  return error_message_.GetNoArena();
+  return _internal_error_message();
 }
-inline void GainResponseParams::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GainResponseParams::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:flexsdr.GainResponseParams.error_message)
 }
-#if LANG_CXX11
-inline void GainResponseParams::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:flexsdr.GainResponseParams.error_message)
+inline std::string* GainResponseParams::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:flexsdr.GainResponseParams.error_message)
+  return _s;
 }
-#endif
-inline void GainResponseParams::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:flexsdr.GainResponseParams.error_message)
+inline const std::string& GainResponseParams::_internal_error_message() const {
+  return _impl_.error_message_.Get();
 }
-inline void GainResponseParams::set_error_message(const char* value, size_t size) {
+inline void GainResponseParams::_internal_set_error_message(const std::string& value) {
   
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:flexsdr.GainResponseParams.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GainResponseParams::mutable_error_message() {
+inline std::string* GainResponseParams::_internal_mutable_error_message() {
   
-  // @@protoc_insertion_point(field_mutable:flexsdr.GainResponseParams.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* GainResponseParams::release_error_message() {
+inline std::string* GainResponseParams::release_error_message() {
   // @@protoc_insertion_point(field_release:flexsdr.GainResponseParams.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Release();
 }
-inline void GainResponseParams::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
+inline void GainResponseParams::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:flexsdr.GainResponseParams.error_message)
 }
 
@@ -2260,29 +3901,41 @@ inline void GainResponseParams::set_allocated_error_message(::std::string* error
 
 // double rate = 1;
 inline void RateRequestParams::clear_rate() {
-  rate_ = 0;
+  _impl_.rate_ = 0;
+}
+inline double RateRequestParams::_internal_rate() const {
+  return _impl_.rate_;
 }
 inline double RateRequestParams::rate() const {
   // @@protoc_insertion_point(field_get:flexsdr.RateRequestParams.rate)
-  return rate_;
+  return _internal_rate();
 }
-inline void RateRequestParams::set_rate(double value) {
+inline void RateRequestParams::_internal_set_rate(double value) {
   
-  rate_ = value;
+  _impl_.rate_ = value;
+}
+inline void RateRequestParams::set_rate(double value) {
+  _internal_set_rate(value);
   // @@protoc_insertion_point(field_set:flexsdr.RateRequestParams.rate)
 }
 
 // uint32 chan = 2;
 inline void RateRequestParams::clear_chan() {
-  chan_ = 0u;
+  _impl_.chan_ = 0u;
+}
+inline uint32_t RateRequestParams::_internal_chan() const {
+  return _impl_.chan_;
 }
-inline ::google::protobuf::uint32 RateRequestParams::chan() const {
+inline uint32_t RateRequestParams::chan() const {
   // @@protoc_insertion_point(field_get:flexsdr.RateRequestParams.chan)
-  return chan_;
+  return _internal_chan();
 }
-inline void RateRequestParams::set_chan(::google::protobuf::uint32 value) {
+inline void RateRequestParams::_internal_set_chan(uint32_t value) {
   
-  chan_ = value;
+  _impl_.chan_ = value;
+}
+inline void RateRequestParams::set_chan(uint32_t value) {
+  _internal_set_chan(value);
   // @@protoc_insertion_point(field_set:flexsdr.RateRequestParams.chan)
 }
 
@@ -2292,82 +3945,91 @@ inline void RateRequestParams::set_chan(::google::protobuf::uint32 value) {
 
 // bool success = 1;
 inline void RateResponseParams::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool RateResponseParams::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool RateResponseParams::success() const {
   // @@protoc_insertion_point(field_get:flexsdr.RateResponseParams.success)
-  return success_;
+  return _internal_success();
 }
-inline void RateResponseParams::set_success(bool value) {
+inline void RateResponseParams::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void RateResponseParams::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:flexsdr.RateResponseParams.success)
 }
 
 // double actual_rate = 2;
 inline void RateResponseParams::clear_actual_rate() {
-  actual_rate_ = 0;
+  _impl_.actual_rate_ = 0;
+}
+inline double RateResponseParams::_internal_actual_rate() const {
+  return _impl_.actual_rate_;
 }
 inline double RateResponseParams::actual_rate() const {
   // @@protoc_insertion_point(field_get:flexsdr.RateResponseParams.actual_rate)
-  return actual_rate_;
+  return _internal_actual_rate();
 }
-inline void RateResponseParams::set_actual_rate(double value) {
+inline void RateResponseParams::_internal_set_actual_rate(double value) {
   
-  actual_rate_ = value;
+  _impl_.actual_rate_ = value;
+}
+inline void RateResponseParams::set_actual_rate(double value) {
+  _internal_set_actual_rate(value);
   // @@protoc_insertion_point(field_set:flexsdr.RateResponseParams.actual_rate)
 }
 
 // string error_message = 3;
 inline void RateResponseParams::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.ClearToEmpty();
 }
-inline const ::std::string& RateResponseParams::error_message() const {
+inline const std::string& RateResponseParams::error_message() const {
   // @@protoc_insertion_point(field_get:flexsdr.RateResponseParams.error_message)
-  return error_message_.GetNoArena();
+  return _internal_error_message();
 }
-inline void RateResponseParams::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RateResponseParams::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:flexsdr.RateResponseParams.error_message)
 }
-#if LANG_CXX11
-inline void RateResponseParams::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:flexsdr.RateResponseParams.error_message)
+inline std::string* RateResponseParams::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:flexsdr.RateResponseParams.error_message)
+  return _s;
 }
-#endif
-inline void RateResponseParams::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:flexsdr.RateResponseParams.error_message)
+inline const std::string& RateResponseParams::_internal_error_message() const {
+  return _impl_.error_message_.Get();
 }
-inline void RateResponseParams::set_error_message(const char* value, size_t size) {
+inline void RateResponseParams::_internal_set_error_message(const std::string& value) {
   
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:flexsdr.RateResponseParams.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RateResponseParams::mutable_error_message() {
+inline std::string* RateResponseParams::_internal_mutable_error_message() {
   
-  // @@protoc_insertion_point(field_mutable:flexsdr.RateResponseParams.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RateResponseParams::release_error_message() {
+inline std::string* RateResponseParams::release_error_message() {
   // @@protoc_insertion_point(field_release:flexsdr.RateResponseParams.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Release();
 }
-inline void RateResponseParams::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
+inline void RateResponseParams::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:flexsdr.RateResponseParams.error_message)
 }
 
@@ -2377,71 +4039,101 @@ inline void RateResponseParams::set_allocated_error_message(::std::string* error
 
 // double target_freq = 1;
 inline void TuneRequest::clear_target_freq() {
-  target_freq_ = 0;
+  _impl_.target_freq_ = 0;
+}
+inline double TuneRequest::_internal_target_freq() const {
+  return _impl_.target_freq_;
 }
 inline double TuneRequest::target_freq() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneRequest.target_freq)
-  return target_freq_;
+  return _internal_target_freq();
 }
-inline void TuneRequest::set_target_freq(double value) {
+inline void TuneRequest::_internal_set_target_freq(double value) {
   
-  target_freq_ = value;
+  _impl_.target_freq_ = value;
+}
+inline void TuneRequest::set_target_freq(double value) {
+  _internal_set_target_freq(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneRequest.target_freq)
 }
 
 // .flexsdr.TuneRequest.Policy rf_freq_policy = 2;
 inline void TuneRequest::clear_rf_freq_policy() {
-  rf_freq_policy_ = 0;
+  _impl_.rf_freq_policy_ = 0;
+}
+inline ::flexsdr::TuneRequest_Policy TuneRequest::_internal_rf_freq_policy() const {
+  return static_cast< ::flexsdr::TuneRequest_Policy >(_impl_.rf_freq_policy_);
 }
 inline ::flexsdr::TuneRequest_Policy TuneRequest::rf_freq_policy() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneRequest.rf_freq_policy)
-  return static_cast< ::flexsdr::TuneRequest_Policy >(rf_freq_policy_);
+  return _internal_rf_freq_policy();
 }
-inline void TuneRequest::set_rf_freq_policy(::flexsdr::TuneRequest_Policy value) {
+inline void TuneRequest::_internal_set_rf_freq_policy(::flexsdr::TuneRequest_Policy value) {
   
-  rf_freq_policy_ = value;
+  _impl_.rf_freq_policy_ = value;
+}
+inline void TuneRequest::set_rf_freq_policy(::flexsdr::TuneRequest_Policy value) {
+  _internal_set_rf_freq_policy(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneRequest.rf_freq_policy)
 }
 
 // double rf_freq = 3;
 inline void TuneRequest::clear_rf_freq() {
-  rf_freq_ = 0;
+  _impl_.rf_freq_ = 0;
+}
+inline double TuneRequest::_internal_rf_freq() const {
+  return _impl_.rf_freq_;
 }
 inline double TuneRequest::rf_freq() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneRequest.rf_freq)
-  return rf_freq_;
+  return _internal_rf_freq();
 }
-inline void TuneRequest::set_rf_freq(double value) {
+inline void TuneRequest::_internal_set_rf_freq(double value) {
   
-  rf_freq_ = value;
+  _impl_.rf_freq_ = value;
+}
+inline void TuneRequest::set_rf_freq(double value) {
+  _internal_set_rf_freq(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneRequest.rf_freq)
 }
 
 // .flexsdr.TuneRequest.Policy dsp_freq_policy = 4;
 inline void TuneRequest::clear_dsp_freq_policy() {
-  dsp_freq_policy_ = 0;
+  _impl_.dsp_freq_policy_ = 0;
+}
+inline ::flexsdr::TuneRequest_Policy TuneRequest::_internal_dsp_freq_policy() const {
+  return static_cast< ::flexsdr::TuneRequest_Policy >(_impl_.dsp_freq_policy_);
 }
 inline ::flexsdr::TuneRequest_Policy TuneRequest::dsp_freq_policy() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneRequest.dsp_freq_policy)
-  return static_cast< ::flexsdr::TuneRequest_Policy >(dsp_freq_policy_);
+  return _internal_dsp_freq_policy();
 }
-inline void TuneRequest::set_dsp_freq_policy(::flexsdr::TuneRequest_Policy value) {
+inline void TuneRequest::_internal_set_dsp_freq_policy(::flexsdr::TuneRequest_Policy value) {
   
-  dsp_freq_policy_ = value;
+  _impl_.dsp_freq_policy_ = value;
+}
+inline void TuneRequest::set_dsp_freq_policy(::flexsdr::TuneRequest_Policy value) {
+  _internal_set_dsp_freq_policy(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneRequest.dsp_freq_policy)
 }
 
 // double dsp_freq = 5;
 inline void TuneRequest::clear_dsp_freq() {
-  dsp_freq_ = 0;
+  _impl_.dsp_freq_ = 0;
+}
+inline double TuneRequest::_internal_dsp_freq() const {
+  return _impl_.dsp_freq_;
 }
 inline double TuneRequest::dsp_freq() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneRequest.dsp_freq)
-  return dsp_freq_;
+  return _internal_dsp_freq();
 }
-inline void TuneRequest::set_dsp_freq(double value) {
+inline void TuneRequest::_internal_set_dsp_freq(double value) {
   
-  dsp_freq_ = value;
+  _impl_.dsp_freq_ = value;
+}
+inline void TuneRequest::set_dsp_freq(double value) {
+  _internal_set_dsp_freq(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneRequest.dsp_freq)
 }
 
@@ -2451,71 +4143,101 @@ inline void TuneRequest::set_dsp_freq(double value) {
 
 // double clipped_rf_freq = 1;
 inline void TuneResult::clear_clipped_rf_freq() {
-  clipped_rf_freq_ = 0;
+  _impl_.clipped_rf_freq_ = 0;
+}
+inline double TuneResult::_internal_clipped_rf_freq() const {
+  return _impl_.clipped_rf_freq_;
 }
 inline double TuneResult::clipped_rf_freq() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneResult.clipped_rf_freq)
-  return clipped_rf_freq_;
+  return _internal_clipped_rf_freq();
 }
-inline void TuneResult::set_clipped_rf_freq(double value) {
+inline void TuneResult::_internal_set_clipped_rf_freq(double value) {
   
-  clipped_rf_freq_ = value;
+  _impl_.clipped_rf_freq_ = value;
+}
+inline void TuneResult::set_clipped_rf_freq(double value) {
+  _internal_set_clipped_rf_freq(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneResult.clipped_rf_freq)
 }
 
 // double target_rf_freq = 2;
 inline void TuneResult::clear_target_rf_freq() {
-  target_rf_freq_ = 0;
+  _impl_.target_rf_freq_ = 0;
+}
+inline double TuneResult::_internal_target_rf_freq() const {
+  return _impl_.target_rf_freq_;
 }
 inline double TuneResult::target_rf_freq() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneResult.target_rf_freq)
-  return target_rf_freq_;
+  return _internal_target_rf_freq();
 }
-inline void TuneResult::set_target_rf_freq(double value) {
+inline void TuneResult::_internal_set_target_rf_freq(double value) {
   
-  target_rf_freq_ = value;
+  _impl_.target_rf_freq_ = value;
+}
+inline void TuneResult::set_target_rf_freq(double value) {
+  _internal_set_target_rf_freq(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneResult.target_rf_freq)
 }
 
 // double actual_rf_freq = 3;
 inline void TuneResult::clear_actual_rf_freq() {
-  actual_rf_freq_ = 0;
+  _impl_.actual_rf_freq_ = 0;
+}
+inline double TuneResult::_internal_actual_rf_freq() const {
+  return _impl_.actual_rf_freq_;
 }
 inline double TuneResult::actual_rf_freq() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneResult.actual_rf_freq)
-  return actual_rf_freq_;
+  return _internal_actual_rf_freq();
 }
-inline void TuneResult::set_actual_rf_freq(double value) {
+inline void TuneResult::_internal_set_actual_rf_freq(double value) {
   
-  actual_rf_freq_ = value;
+  _impl_.actual_rf_freq_ = value;
+}
+inline void TuneResult::set_actual_rf_freq(double value) {
+  _internal_set_actual_rf_freq(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneResult.actual_rf_freq)
 }
 
 // double target_dsp_freq = 4;
 inline void TuneResult::clear_target_dsp_freq() {
-  target_dsp_freq_ = 0;
+  _impl_.target_dsp_freq_ = 0;
+}
+inline double TuneResult::_internal_target_dsp_freq() const {
+  return _impl_.target_dsp_freq_;
 }
 inline double TuneResult::target_dsp_freq() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneResult.target_dsp_freq)
-  return target_dsp_freq_;
+  return _internal_target_dsp_freq();
 }
-inline void TuneResult::set_target_dsp_freq(double value) {
+inline void TuneResult::_internal_set_target_dsp_freq(double value) {
   
-  target_dsp_freq_ = value;
+  _impl_.target_dsp_freq_ = value;
+}
+inline void TuneResult::set_target_dsp_freq(double value) {
+  _internal_set_target_dsp_freq(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneResult.target_dsp_freq)
 }
 
 // double actual_dsp_freq = 5;
 inline void TuneResult::clear_actual_dsp_freq() {
-  actual_dsp_freq_ = 0;
+  _impl_.actual_dsp_freq_ = 0;
+}
+inline double TuneResult::_internal_actual_dsp_freq() const {
+  return _impl_.actual_dsp_freq_;
 }
 inline double TuneResult::actual_dsp_freq() const {
   // @@protoc_insertion_point(field_get:flexsdr.TuneResult.actual_dsp_freq)
-  return actual_dsp_freq_;
+  return _internal_actual_dsp_freq();
 }
-inline void TuneResult::set_actual_dsp_freq(double value) {
+inline void TuneResult::_internal_set_actual_dsp_freq(double value) {
   
-  actual_dsp_freq_ = value;
+  _impl_.actual_dsp_freq_ = value;
+}
+inline void TuneResult::set_actual_dsp_freq(double value) {
+  _internal_set_actual_dsp_freq(value);
   // @@protoc_insertion_point(field_set:flexsdr.TuneResult.actual_dsp_freq)
 }
 
@@ -2524,235 +4246,386 @@ inline void TuneResult::set_actual_dsp_freq(double value) {
 // FrequencyRequestParams
 
 // .flexsdr.TuneRequest tune_request = 1;
+inline bool FrequencyRequestParams::_internal_has_tune_request() const {
+  return this != internal_default_instance() && _impl_.tune_request_ != nullptr;
+}
 inline bool FrequencyRequestParams::has_tune_request() const {
-  return this != internal_default_instance() && tune_request_ != NULL;
+  return _internal_has_tune_request();
 }
 inline void FrequencyRequestParams::clear_tune_request() {
-  if (GetArenaNoVirtual() == NULL && tune_request_ != NULL) {
-    delete tune_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.tune_request_ != nullptr) {
+    delete _impl_.tune_request_;
+  }
+  _impl_.tune_request_ = nullptr;
+}
+inline const ::flexsdr::TuneRequest& FrequencyRequestParams::_internal_tune_request() const {
+  const ::flexsdr::TuneRequest* p = _impl_.tune_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::flexsdr::TuneRequest&>(
+      ::flexsdr::_TuneRequest_default_instance_);
+}
+inline const ::flexsdr::TuneRequest& FrequencyRequestParams::tune_request() const {
+  // @@protoc_insertion_point(field_get:flexsdr.FrequencyRequestParams.tune_request)
+  return _internal_tune_request();
+}
+inline void FrequencyRequestParams::unsafe_arena_set_allocated_tune_request(
+    ::flexsdr::TuneRequest* tune_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.tune_request_);
+  }
+  _impl_.tune_request_ = tune_request;
+  if (tune_request) {
+    
+  } else {
+    
   }
-  tune_request_ = NULL;
-}
-inline const ::flexsdr::TuneRequest& FrequencyRequestParams::_internal_tune_request() const {
-  return *tune_request_;
-}
-inline const ::flexsdr::TuneRequest& FrequencyRequestParams::tune_request() const {
-  const ::flexsdr::TuneRequest* p = tune_request_;
-  // @@protoc_insertion_point(field_get:flexsdr.FrequencyRequestParams.tune_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::flexsdr::TuneRequest*>(
-      &::flexsdr::_TuneRequest_default_instance_);
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:flexsdr.FrequencyRequestParams.tune_request)
 }
 inline ::flexsdr::TuneRequest* FrequencyRequestParams::release_tune_request() {
+  
+  ::flexsdr::TuneRequest* temp = _impl_.tune_request_;
+  _impl_.tune_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::flexsdr::TuneRequest* FrequencyRequestParams::unsafe_arena_release_tune_request() {
   // @@protoc_insertion_point(field_release:flexsdr.FrequencyRequestParams.tune_request)
   
-  ::flexsdr::TuneRequest* temp = tune_request_;
-  tune_request_ = NULL;
+  ::flexsdr::TuneRequest* temp = _impl_.tune_request_;
+  _impl_.tune_request_ = nullptr;
   return temp;
 }
-inline ::flexsdr::TuneRequest* FrequencyRequestParams::mutable_tune_request() {
+inline ::flexsdr::TuneRequest* FrequencyRequestParams::_internal_mutable_tune_request() {
   
-  if (tune_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::flexsdr::TuneRequest>(GetArenaNoVirtual());
-    tune_request_ = p;
+  if (_impl_.tune_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::flexsdr::TuneRequest>(GetArenaForAllocation());
+    _impl_.tune_request_ = p;
   }
+  return _impl_.tune_request_;
+}
+inline ::flexsdr::TuneRequest* FrequencyRequestParams::mutable_tune_request() {
+  ::flexsdr::TuneRequest* _msg = _internal_mutable_tune_request();
   // @@protoc_insertion_point(field_mutable:flexsdr.FrequencyRequestParams.tune_request)
-  return tune_request_;
+  return _msg;
 }
 inline void FrequencyRequestParams::set_allocated_tune_request(::flexsdr::TuneRequest* tune_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete tune_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.tune_request_;
   }
   if (tune_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(tune_request);
     if (message_arena != submessage_arena) {
-      tune_request = ::google::protobuf::internal::GetOwnedMessage(
+      tune_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, tune_request, submessage_arena);
     }
     
   } else {
     
   }
-  tune_request_ = tune_request;
+  _impl_.tune_request_ = tune_request;
   // @@protoc_insertion_point(field_set_allocated:flexsdr.FrequencyRequestParams.tune_request)
 }
 
 // .flexsdr.ChannelRequest channel_request = 2;
+inline bool FrequencyRequestParams::_internal_has_channel_request() const {
+  return this != internal_default_instance() && _impl_.channel_request_ != nullptr;
+}
 inline bool FrequencyRequestParams::has_channel_request() const {
-  return this != internal_default_instance() && channel_request_ != NULL;
+  return _internal_has_channel_request();
 }
 inline void FrequencyRequestParams::clear_channel_request() {
-  if (GetArenaNoVirtual() == NULL && channel_request_ != NULL) {
-    delete channel_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.channel_request_ != nullptr) {
+    delete _impl_.channel_request_;
   }
-  channel_request_ = NULL;
+  _impl_.channel_request_ = nullptr;
 }
 inline const ::flexsdr::ChannelRequest& FrequencyRequestParams::_internal_channel_request() const {
-  return *channel_request_;
+  const ::flexsdr::ChannelRequest* p = _impl_.channel_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::flexsdr::ChannelRequest&>(
+      ::flexsdr::_ChannelRequest_default_instance_);
 }
 inline const ::flexsdr::ChannelRequest& FrequencyRequestParams::channel_request() const {
-  const ::flexsdr::ChannelRequest* p = channel_request_;
   // @@protoc_insertion_point(field_get:flexsdr.FrequencyRequestParams.channel_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::flexsdr::ChannelRequest*>(
-      &::flexsdr::_ChannelRequest_default_instance_);
+  return _internal_channel_request();
+}
+inline void FrequencyRequestParams::unsafe_arena_set_allocated_channel_request(
+    ::flexsdr::ChannelRequest* channel_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channel_request_);
+  }
+  _impl_.channel_request_ = channel_request;
+  if (channel_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:flexsdr.FrequencyRequestParams.channel_request)
 }
 inline ::flexsdr::ChannelRequest* FrequencyRequestParams::release_channel_request() {
+  
+  ::flexsdr::ChannelRequest* temp = _impl_.channel_request_;
+  _impl_.channel_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::flexsdr::ChannelRequest* FrequencyRequestParams::unsafe_arena_release_channel_request() {
   // @@protoc_insertion_point(field_release:flexsdr.FrequencyRequestParams.channel_request)
   
-  ::flexsdr::ChannelRequest* temp = channel_request_;
-  channel_request_ = NULL;
+  ::flexsdr::ChannelRequest* temp = _impl_.channel_request_;
+  _impl_.channel_request_ = nullptr;
   return temp;
 }
-inline ::flexsdr::ChannelRequest* FrequencyRequestParams::mutable_channel_request() {
+inline ::flexsdr::ChannelRequest* FrequencyRequestParams::_internal_mutable_channel_request() {
   
-  if (channel_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::flexsdr::ChannelRequest>(GetArenaNoVirtual());
-    channel_request_ = p;
+  if (_impl_.channel_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::flexsdr::ChannelRequest>(GetArenaForAllocation());
+    _impl_.channel_request_ = p;
   }
+  return _impl_.channel_request_;
+}
+inline ::flexsdr::ChannelRequest* FrequencyRequestParams::mutable_channel_request() {
+  ::flexsdr::ChannelRequest* _msg = _internal_mutable_channel_request();
   // @@protoc_insertion_point(field_mutable:flexsdr.FrequencyRequestParams.channel_request)
-  return channel_request_;
+  return _msg;
 }
 inline void FrequencyRequestParams::set_allocated_channel_request(::flexsdr::ChannelRequest* channel_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete channel_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channel_request_;
   }
   if (channel_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channel_request);
     if (message_arena != submessage_arena) {
-      channel_request = ::google::protobuf::internal::GetOwnedMessage(
+      channel_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, channel_request, submessage_arena);
     }
     
   } else {
     
   }
-  channel_request_ = channel_request;
+  _impl_.channel_request_ = channel_request;
   // @@protoc_insertion_point(field_set_allocated:flexsdr.FrequencyRequestParams.channel_request)
 }
 
+// uint64 command_time_ticks = 3;
+inline void FrequencyRequestParams::clear_command_time_ticks() {
+  _impl_.command_time_ticks_ = uint64_t{0u};
+}
+inline uint64_t FrequencyRequestParams::_internal_command_time_ticks() const {
+  return _impl_.command_time_ticks_;
+}
+inline uint64_t FrequencyRequestParams::command_time_ticks() const {
+  // @@protoc_insertion_point(field_get:flexsdr.FrequencyRequestParams.command_time_ticks)
+  return _internal_command_time_ticks();
+}
+inline void FrequencyRequestParams::_internal_set_command_time_ticks(uint64_t value) {
+  
+  _impl_.command_time_ticks_ = value;
+}
+inline void FrequencyRequestParams::set_command_time_ticks(uint64_t value) {
+  _internal_set_command_time_ticks(value);
+  // @@protoc_insertion_point(field_set:flexsdr.FrequencyRequestParams.command_time_ticks)
+}
+
+// uint32 command_id = 4;
+inline void FrequencyRequestParams::clear_command_id() {
+  _impl_.command_id_ = 0u;
+}
+inline uint32_t FrequencyRequestParams::_internal_command_id() const {
+  return _impl_.command_id_;
+}
+inline uint32_t FrequencyRequestParams::command_id() const {
+  // @@protoc_insertion_point(field_get:flexsdr.FrequencyRequestParams.command_id)
+  return _internal_command_id();
+}
+inline void FrequencyRequestParams::_internal_set_command_id(uint32_t value) {
+  
+  _impl_.command_id_ = value;
+}
+inline void FrequencyRequestParams::set_command_id(uint32_t value) {
+  _internal_set_command_id(value);
+  // @@protoc_insertion_point(field_set:flexsdr.FrequencyRequestParams.command_id)
+}
+
 // -------------------------------------------------------------------
 
 // FrequencyResponseParams
 
 // bool success = 1;
 inline void FrequencyResponseParams::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool FrequencyResponseParams::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool FrequencyResponseParams::success() const {
   // @@protoc_insertion_point(field_get:flexsdr.FrequencyResponseParams.success)
-  return success_;
+  return _internal_success();
 }
-inline void FrequencyResponseParams::set_success(bool value) {
+inline void FrequencyResponseParams::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void FrequencyResponseParams::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:flexsdr.FrequencyResponseParams.success)
 }
 
 // .flexsdr.TuneResult tune_result = 2;
+inline bool FrequencyResponseParams::_internal_has_tune_result() const {
+  return this != internal_default_instance() && _impl_.tune_result_ != nullptr;
+}
 inline bool FrequencyResponseParams::has_tune_result() const {
-  return this != internal_default_instance() && tune_result_ != NULL;
+  return _internal_has_tune_result();
 }
 inline void FrequencyResponseParams::clear_tune_result() {
-  if (GetArenaNoVirtual() == NULL && tune_result_ != NULL) {
-    delete tune_result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.tune_result_ != nullptr) {
+    delete _impl_.tune_result_;
   }
-  tune_result_ = NULL;
+  _impl_.tune_result_ = nullptr;
 }
 inline const ::flexsdr::TuneResult& FrequencyResponseParams::_internal_tune_result() const {
-  return *tune_result_;
+  const ::flexsdr::TuneResult* p = _impl_.tune_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::flexsdr::TuneResult&>(
+      ::flexsdr::_TuneResult_default_instance_);
 }
 inline const ::flexsdr::TuneResult& FrequencyResponseParams::tune_result() const {
-  const ::flexsdr::TuneResult* p = tune_result_;
   // @@protoc_insertion_point(field_get:flexsdr.FrequencyResponseParams.tune_result)
-  return p != NULL ? *p : *reinterpret_cast<const ::flexsdr::TuneResult*>(
-      &::flexsdr::_TuneResult_default_instance_);
+  return _internal_tune_result();
+}
+inline void FrequencyResponseParams::unsafe_arena_set_allocated_tune_result(
+    ::flexsdr::TuneResult* tune_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.tune_result_);
+  }
+  _impl_.tune_result_ = tune_result;
+  if (tune_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:flexsdr.FrequencyResponseParams.tune_result)
 }
 inline ::flexsdr::TuneResult* FrequencyResponseParams::release_tune_result() {
+  
+  ::flexsdr::TuneResult* temp = _impl_.tune_result_;
+  _impl_.tune_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::flexsdr::TuneResult* FrequencyResponseParams::unsafe_arena_release_tune_result() {
   // @@protoc_insertion_point(field_release:flexsdr.FrequencyResponseParams.tune_result)
   
-  ::flexsdr::TuneResult* temp = tune_result_;
-  tune_result_ = NULL;
+  ::flexsdr::TuneResult* temp = _impl_.tune_result_;
+  _impl_.tune_result_ = nullptr;
   return temp;
 }
-inline ::flexsdr::TuneResult* FrequencyResponseParams::mutable_tune_result() {
+inline ::flexsdr::TuneResult* FrequencyResponseParams::_internal_mutable_tune_result() {
   
-  if (tune_result_ == NULL) {
-    auto* p = CreateMaybeMessage<::flexsdr::TuneResult>(GetArenaNoVirtual());
-    tune_result_ = p;
+  if (_impl_.tune_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::flexsdr::TuneResult>(GetArenaForAllocation());
+    _impl_.tune_result_ = p;
   }
+  return _impl_.tune_result_;
+}
+inline ::flexsdr::TuneResult* FrequencyResponseParams::mutable_tune_result() {
+  ::flexsdr::TuneResult* _msg = _internal_mutable_tune_result();
   // @@protoc_insertion_point(field_mutable:flexsdr.FrequencyResponseParams.tune_result)
-  return tune_result_;
+  return _msg;
 }
 inline void FrequencyResponseParams::set_allocated_tune_result(::flexsdr::TuneResult* tune_result) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete tune_result_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.tune_result_;
   }
   if (tune_result) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(tune_result);
     if (message_arena != submessage_arena) {
-      tune_result = ::google::protobuf::internal::GetOwnedMessage(
+      tune_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, tune_result, submessage_arena);
     }
     
   } else {
     
   }
-  tune_result_ = tune_result;
+  _impl_.tune_result_ = tune_result;
   // @@protoc_insertion_point(field_set_allocated:flexsdr.FrequencyResponseParams.tune_result)
 }
 
 // string error_message = 3;
 inline void FrequencyResponseParams::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.ClearToEmpty();
 }
-inline const ::std::string& FrequencyResponseParams::error_message() const {
+inline const std::string& FrequencyResponseParams::error_message() const {
   // @@protoc_insertion_point(field_get:flexsdr.FrequencyResponseParams.error_message)
-  return error_message_.GetNoArena();
+  return _internal_error_message();
 }
-inline void FrequencyResponseParams::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FrequencyResponseParams::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:flexsdr.FrequencyResponseParams.error_message)
 }
-#if LANG_CXX11
-inline void FrequencyResponseParams::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:flexsdr.FrequencyResponseParams.error_message)
+inline std::string* FrequencyResponseParams::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:flexsdr.FrequencyResponseParams.error_message)
+  return _s;
 }
-#endif
-inline void FrequencyResponseParams::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:flexsdr.FrequencyResponseParams.error_message)
+inline const std::string& FrequencyResponseParams::_internal_error_message() const {
+  return _impl_.error_message_.Get();
 }
-inline void FrequencyResponseParams::set_error_message(const char* value, size_t size) {
+inline void FrequencyResponseParams::_internal_set_error_message(const std::string& value) {
   
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:flexsdr.FrequencyResponseParams.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* FrequencyResponseParams::mutable_error_message() {
+inline std::string* FrequencyResponseParams::_internal_mutable_error_message() {
   
-  // @@protoc_insertion_point(field_mutable:flexsdr.FrequencyResponseParams.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* FrequencyResponseParams::release_error_message() {
+inline std::string* FrequencyResponseParams::release_error_message() {
   // @@protoc_insertion_point(field_release:flexsdr.FrequencyResponseParams.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Release();
 }
-inline void FrequencyResponseParams::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
+inline void FrequencyResponseParams::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:flexsdr.FrequencyResponseParams.error_message)
 }
 
@@ -2762,82 +4635,91 @@ inline void FrequencyResponseParams::set_allocated_error_message(::std::string*
 
 // bool success = 1;
 inline void FrequencyValue::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool FrequencyValue::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool FrequencyValue::success() const {
   // @@protoc_insertion_point(field_get:flexsdr.FrequencyValue.success)
-  return success_;
+  return _internal_success();
 }
-inline void FrequencyValue::set_success(bool value) {
+inline void FrequencyValue::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void FrequencyValue::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:flexsdr.FrequencyValue.success)
 }
 
 // double frequency = 2;
 inline void FrequencyValue::clear_frequency() {
-  frequency_ = 0;
+  _impl_.frequency_ = 0;
+}
+inline double FrequencyValue::_internal_frequency() const {
+  return _impl_.frequency_;
 }
 inline double FrequencyValue::frequency() const {
   // @@protoc_insertion_point(field_get:flexsdr.FrequencyValue.frequency)
-  return frequency_;
+  return _internal_frequency();
 }
-inline void FrequencyValue::set_frequency(double value) {
+inline void FrequencyValue::_internal_set_frequency(double value) {
   
-  frequency_ = value;
+  _impl_.frequency_ = value;
+}
+inline void FrequencyValue::set_frequency(double value) {
+  _internal_set_frequency(value);
   // @@protoc_insertion_point(field_set:flexsdr.FrequencyValue.frequency)
 }
 
 // string error_message = 3;
 inline void FrequencyValue::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.ClearToEmpty();
 }
-inline const ::std::string& FrequencyValue::error_message() const {
+inline const std::string& FrequencyValue::error_message() const {
   // @@protoc_insertion_point(field_get:flexsdr.FrequencyValue.error_message)
-  return error_message_.GetNoArena();
+  return _internal_error_message();
 }
-inline void FrequencyValue::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FrequencyValue::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:flexsdr.FrequencyValue.error_message)
 }
-#if LANG_CXX11
-inline void FrequencyValue::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:flexsdr.FrequencyValue.error_message)
+inline std::string* FrequencyValue::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:flexsdr.FrequencyValue.error_message)
+  return _s;
 }
-#endif
-inline void FrequencyValue::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:flexsdr.FrequencyValue.error_message)
+inline const std::string& FrequencyValue::_internal_error_message() const {
+  return _impl_.error_message_.Get();
 }
-inline void FrequencyValue::set_error_message(const char* value, size_t size) {
+inline void FrequencyValue::_internal_set_error_message(const std::string& value) {
   
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:flexsdr.FrequencyValue.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* FrequencyValue::mutable_error_message() {
+inline std::string* FrequencyValue::_internal_mutable_error_message() {
   
-  // @@protoc_insertion_point(field_mutable:flexsdr.FrequencyValue.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* FrequencyValue::release_error_message() {
+inline std::string* FrequencyValue::release_error_message() {
   // @@protoc_insertion_point(field_release:flexsdr.FrequencyValue.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Release();
 }
-inline void FrequencyValue::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
+inline void FrequencyValue::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:flexsdr.FrequencyValue.error_message)
 }
 
@@ -2851,304 +4733,660 @@ inline void FrequencyValue::set_allocated_error_message(::std::string* error_mes
 
 // string device_name = 1;
 inline void DeviceInfoResponse::clear_device_name() {
-  device_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.device_name_.ClearToEmpty();
 }
-inline const ::std::string& DeviceInfoResponse::device_name() const {
+inline const std::string& DeviceInfoResponse::device_name() const {
   // @@protoc_insertion_point(field_get:flexsdr.DeviceInfoResponse.device_name)
-  return device_name_.GetNoArena();
+  return _internal_device_name();
 }
-inline void DeviceInfoResponse::set_device_name(const ::std::string& value) {
-  
-  device_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeviceInfoResponse::set_device_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.device_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.device_name)
 }
-#if LANG_CXX11
-inline void DeviceInfoResponse::set_device_name(::std::string&& value) {
-  
-  device_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:flexsdr.DeviceInfoResponse.device_name)
+inline std::string* DeviceInfoResponse::mutable_device_name() {
+  std::string* _s = _internal_mutable_device_name();
+  // @@protoc_insertion_point(field_mutable:flexsdr.DeviceInfoResponse.device_name)
+  return _s;
 }
-#endif
-inline void DeviceInfoResponse::set_device_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  device_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:flexsdr.DeviceInfoResponse.device_name)
+inline const std::string& DeviceInfoResponse::_internal_device_name() const {
+  return _impl_.device_name_.Get();
 }
-inline void DeviceInfoResponse::set_device_name(const char* value, size_t size) {
+inline void DeviceInfoResponse::_internal_set_device_name(const std::string& value) {
   
-  device_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:flexsdr.DeviceInfoResponse.device_name)
+  _impl_.device_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* DeviceInfoResponse::mutable_device_name() {
+inline std::string* DeviceInfoResponse::_internal_mutable_device_name() {
   
-  // @@protoc_insertion_point(field_mutable:flexsdr.DeviceInfoResponse.device_name)
-  return device_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.device_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* DeviceInfoResponse::release_device_name() {
+inline std::string* DeviceInfoResponse::release_device_name() {
   // @@protoc_insertion_point(field_release:flexsdr.DeviceInfoResponse.device_name)
-  
-  return device_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.device_name_.Release();
 }
-inline void DeviceInfoResponse::set_allocated_device_name(::std::string* device_name) {
-  if (device_name != NULL) {
+inline void DeviceInfoResponse::set_allocated_device_name(std::string* device_name) {
+  if (device_name != nullptr) {
     
   } else {
     
   }
-  device_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), device_name);
+  _impl_.device_name_.SetAllocated(device_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.device_name_.IsDefault()) {
+    _impl_.device_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:flexsdr.DeviceInfoResponse.device_name)
 }
 
 // string serial_number = 2;
 inline void DeviceInfoResponse::clear_serial_number() {
-  serial_number_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.serial_number_.ClearToEmpty();
 }
-inline const ::std::string& DeviceInfoResponse::serial_number() const {
+inline const std::string& DeviceInfoResponse::serial_number() const {
   // @@protoc_insertion_point(field_get:flexsdr.DeviceInfoResponse.serial_number)
-  return serial_number_.GetNoArena();
+  return _internal_serial_number();
 }
-inline void DeviceInfoResponse::set_serial_number(const ::std::string& value) {
-  
-  serial_number_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeviceInfoResponse::set_serial_number(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.serial_number_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.serial_number)
 }
-#if LANG_CXX11
-inline void DeviceInfoResponse::set_serial_number(::std::string&& value) {
-  
-  serial_number_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:flexsdr.DeviceInfoResponse.serial_number)
+inline std::string* DeviceInfoResponse::mutable_serial_number() {
+  std::string* _s = _internal_mutable_serial_number();
+  // @@protoc_insertion_point(field_mutable:flexsdr.DeviceInfoResponse.serial_number)
+  return _s;
 }
-#endif
-inline void DeviceInfoResponse::set_serial_number(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  serial_number_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:flexsdr.DeviceInfoResponse.serial_number)
+inline const std::string& DeviceInfoResponse::_internal_serial_number() const {
+  return _impl_.serial_number_.Get();
 }
-inline void DeviceInfoResponse::set_serial_number(const char* value, size_t size) {
+inline void DeviceInfoResponse::_internal_set_serial_number(const std::string& value) {
   
-  serial_number_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:flexsdr.DeviceInfoResponse.serial_number)
+  _impl_.serial_number_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* DeviceInfoResponse::mutable_serial_number() {
+inline std::string* DeviceInfoResponse::_internal_mutable_serial_number() {
   
-  // @@protoc_insertion_point(field_mutable:flexsdr.DeviceInfoResponse.serial_number)
-  return serial_number_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.serial_number_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* DeviceInfoResponse::release_serial_number() {
+inline std::string* DeviceInfoResponse::release_serial_number() {
   // @@protoc_insertion_point(field_release:flexsdr.DeviceInfoResponse.serial_number)
-  
-  return serial_number_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.serial_number_.Release();
 }
-inline void DeviceInfoResponse::set_allocated_serial_number(::std::string* serial_number) {
-  if (serial_number != NULL) {
+inline void DeviceInfoResponse::set_allocated_serial_number(std::string* serial_number) {
+  if (serial_number != nullptr) {
     
   } else {
     
   }
-  serial_number_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), serial_number);
+  _impl_.serial_number_.SetAllocated(serial_number, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.serial_number_.IsDefault()) {
+    _impl_.serial_number_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:flexsdr.DeviceInfoResponse.serial_number)
 }
 
 // repeated string rx_antennas = 3;
+inline int DeviceInfoResponse::_internal_rx_antennas_size() const {
+  return _impl_.rx_antennas_.size();
+}
 inline int DeviceInfoResponse::rx_antennas_size() const {
-  return rx_antennas_.size();
+  return _internal_rx_antennas_size();
 }
 inline void DeviceInfoResponse::clear_rx_antennas() {
-  rx_antennas_.Clear();
+  _impl_.rx_antennas_.Clear();
+}
+inline std::string* DeviceInfoResponse::add_rx_antennas() {
+  std::string* _s = _internal_add_rx_antennas();
+  // @@protoc_insertion_point(field_add_mutable:flexsdr.DeviceInfoResponse.rx_antennas)
+  return _s;
+}
+inline const std::string& DeviceInfoResponse::_internal_rx_antennas(int index) const {
+  return _impl_.rx_antennas_.Get(index);
 }
-inline const ::std::string& DeviceInfoResponse::rx_antennas(int index) const {
+inline const std::string& DeviceInfoResponse::rx_antennas(int index) const {
   // @@protoc_insertion_point(field_get:flexsdr.DeviceInfoResponse.rx_antennas)
-  return rx_antennas_.Get(index);
+  return _internal_rx_antennas(index);
 }
-inline ::std::string* DeviceInfoResponse::mutable_rx_antennas(int index) {
+inline std::string* DeviceInfoResponse::mutable_rx_antennas(int index) {
   // @@protoc_insertion_point(field_mutable:flexsdr.DeviceInfoResponse.rx_antennas)
-  return rx_antennas_.Mutable(index);
+  return _impl_.rx_antennas_.Mutable(index);
 }
-inline void DeviceInfoResponse::set_rx_antennas(int index, const ::std::string& value) {
+inline void DeviceInfoResponse::set_rx_antennas(int index, const std::string& value) {
+  _impl_.rx_antennas_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.rx_antennas)
-  rx_antennas_.Mutable(index)->assign(value);
 }
-#if LANG_CXX11
-inline void DeviceInfoResponse::set_rx_antennas(int index, ::std::string&& value) {
+inline void DeviceInfoResponse::set_rx_antennas(int index, std::string&& value) {
+  _impl_.rx_antennas_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.rx_antennas)
-  rx_antennas_.Mutable(index)->assign(std::move(value));
 }
-#endif
 inline void DeviceInfoResponse::set_rx_antennas(int index, const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  rx_antennas_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.rx_antennas_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:flexsdr.DeviceInfoResponse.rx_antennas)
 }
 inline void DeviceInfoResponse::set_rx_antennas(int index, const char* value, size_t size) {
-  rx_antennas_.Mutable(index)->assign(
+  _impl_.rx_antennas_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:flexsdr.DeviceInfoResponse.rx_antennas)
 }
-inline ::std::string* DeviceInfoResponse::add_rx_antennas() {
-  // @@protoc_insertion_point(field_add_mutable:flexsdr.DeviceInfoResponse.rx_antennas)
-  return rx_antennas_.Add();
+inline std::string* DeviceInfoResponse::_internal_add_rx_antennas() {
+  return _impl_.rx_antennas_.Add();
 }
-inline void DeviceInfoResponse::add_rx_antennas(const ::std::string& value) {
-  rx_antennas_.Add()->assign(value);
+inline void DeviceInfoResponse::add_rx_antennas(const std::string& value) {
+  _impl_.rx_antennas_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:flexsdr.DeviceInfoResponse.rx_antennas)
 }
-#if LANG_CXX11
-inline void DeviceInfoResponse::add_rx_antennas(::std::string&& value) {
-  rx_antennas_.Add(std::move(value));
+inline void DeviceInfoResponse::add_rx_antennas(std::string&& value) {
+  _impl_.rx_antennas_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:flexsdr.DeviceInfoResponse.rx_antennas)
 }
-#endif
 inline void DeviceInfoResponse::add_rx_antennas(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  rx_antennas_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.rx_antennas_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:flexsdr.DeviceInfoResponse.rx_antennas)
 }
 inline void DeviceInfoResponse::add_rx_antennas(const char* value, size_t size) {
-  rx_antennas_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.rx_antennas_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:flexsdr.DeviceInfoResponse.rx_antennas)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 DeviceInfoResponse::rx_antennas() const {
   // @@protoc_insertion_point(field_list:flexsdr.DeviceInfoResponse.rx_antennas)
-  return rx_antennas_;
+  return _impl_.rx_antennas_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 DeviceInfoResponse::mutable_rx_antennas() {
   // @@protoc_insertion_point(field_mutable_list:flexsdr.DeviceInfoResponse.rx_antennas)
-  return &rx_antennas_;
+  return &_impl_.rx_antennas_;
 }
 
 // repeated string tx_antennas = 4;
+inline int DeviceInfoResponse::_internal_tx_antennas_size() const {
+  return _impl_.tx_antennas_.size();
+}
 inline int DeviceInfoResponse::tx_antennas_size() const {
-  return tx_antennas_.size();
+  return _internal_tx_antennas_size();
 }
 inline void DeviceInfoResponse::clear_tx_antennas() {
-  tx_antennas_.Clear();
+  _impl_.tx_antennas_.Clear();
+}
+inline std::string* DeviceInfoResponse::add_tx_antennas() {
+  std::string* _s = _internal_add_tx_antennas();
+  // @@protoc_insertion_point(field_add_mutable:flexsdr.DeviceInfoResponse.tx_antennas)
+  return _s;
 }
-inline const ::std::string& DeviceInfoResponse::tx_antennas(int index) const {
+inline const std::string& DeviceInfoResponse::_internal_tx_antennas(int index) const {
+  return _impl_.tx_antennas_.Get(index);
+}
+inline const std::string& DeviceInfoResponse::tx_antennas(int index) const {
   // @@protoc_insertion_point(field_get:flexsdr.DeviceInfoResponse.tx_antennas)
-  return tx_antennas_.Get(index);
+  return _internal_tx_antennas(index);
 }
-inline ::std::string* DeviceInfoResponse::mutable_tx_antennas(int index) {
+inline std::string* DeviceInfoResponse::mutable_tx_antennas(int index) {
   // @@protoc_insertion_point(field_mutable:flexsdr.DeviceInfoResponse.tx_antennas)
-  return tx_antennas_.Mutable(index);
+  return _impl_.tx_antennas_.Mutable(index);
 }
-inline void DeviceInfoResponse::set_tx_antennas(int index, const ::std::string& value) {
+inline void DeviceInfoResponse::set_tx_antennas(int index, const std::string& value) {
+  _impl_.tx_antennas_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.tx_antennas)
-  tx_antennas_.Mutable(index)->assign(value);
 }
-#if LANG_CXX11
-inline void DeviceInfoResponse::set_tx_antennas(int index, ::std::string&& value) {
+inline void DeviceInfoResponse::set_tx_antennas(int index, std::string&& value) {
+  _impl_.tx_antennas_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.tx_antennas)
-  tx_antennas_.Mutable(index)->assign(std::move(value));
 }
-#endif
 inline void DeviceInfoResponse::set_tx_antennas(int index, const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  tx_antennas_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.tx_antennas_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:flexsdr.DeviceInfoResponse.tx_antennas)
 }
 inline void DeviceInfoResponse::set_tx_antennas(int index, const char* value, size_t size) {
-  tx_antennas_.Mutable(index)->assign(
+  _impl_.tx_antennas_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:flexsdr.DeviceInfoResponse.tx_antennas)
 }
-inline ::std::string* DeviceInfoResponse::add_tx_antennas() {
-  // @@protoc_insertion_point(field_add_mutable:flexsdr.DeviceInfoResponse.tx_antennas)
-  return tx_antennas_.Add();
+inline std::string* DeviceInfoResponse::_internal_add_tx_antennas() {
+  return _impl_.tx_antennas_.Add();
 }
-inline void DeviceInfoResponse::add_tx_antennas(const ::std::string& value) {
-  tx_antennas_.Add()->assign(value);
+inline void DeviceInfoResponse::add_tx_antennas(const std::string& value) {
+  _impl_.tx_antennas_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:flexsdr.DeviceInfoResponse.tx_antennas)
 }
-#if LANG_CXX11
-inline void DeviceInfoResponse::add_tx_antennas(::std::string&& value) {
-  tx_antennas_.Add(std::move(value));
+inline void DeviceInfoResponse::add_tx_antennas(std::string&& value) {
+  _impl_.tx_antennas_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:flexsdr.DeviceInfoResponse.tx_antennas)
 }
-#endif
 inline void DeviceInfoResponse::add_tx_antennas(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  tx_antennas_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.tx_antennas_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:flexsdr.DeviceInfoResponse.tx_antennas)
 }
 inline void DeviceInfoResponse::add_tx_antennas(const char* value, size_t size) {
-  tx_antennas_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.tx_antennas_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:flexsdr.DeviceInfoResponse.tx_antennas)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 DeviceInfoResponse::tx_antennas() const {
   // @@protoc_insertion_point(field_list:flexsdr.DeviceInfoResponse.tx_antennas)
-  return tx_antennas_;
+  return _impl_.tx_antennas_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 DeviceInfoResponse::mutable_tx_antennas() {
   // @@protoc_insertion_point(field_mutable_list:flexsdr.DeviceInfoResponse.tx_antennas)
-  return &tx_antennas_;
+  return &_impl_.tx_antennas_;
 }
 
 // double min_rx_gain = 5;
 inline void DeviceInfoResponse::clear_min_rx_gain() {
-  min_rx_gain_ = 0;
+  _impl_.min_rx_gain_ = 0;
+}
+inline double DeviceInfoResponse::_internal_min_rx_gain() const {
+  return _impl_.min_rx_gain_;
 }
 inline double DeviceInfoResponse::min_rx_gain() const {
   // @@protoc_insertion_point(field_get:flexsdr.DeviceInfoResponse.min_rx_gain)
-  return min_rx_gain_;
+  return _internal_min_rx_gain();
 }
-inline void DeviceInfoResponse::set_min_rx_gain(double value) {
+inline void DeviceInfoResponse::_internal_set_min_rx_gain(double value) {
   
-  min_rx_gain_ = value;
+  _impl_.min_rx_gain_ = value;
+}
+inline void DeviceInfoResponse::set_min_rx_gain(double value) {
+  _internal_set_min_rx_gain(value);
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.min_rx_gain)
 }
 
 // double max_rx_gain = 6;
 inline void DeviceInfoResponse::clear_max_rx_gain() {
-  max_rx_gain_ = 0;
+  _impl_.max_rx_gain_ = 0;
+}
+inline double DeviceInfoResponse::_internal_max_rx_gain() const {
+  return _impl_.max_rx_gain_;
 }
 inline double DeviceInfoResponse::max_rx_gain() const {
   // @@protoc_insertion_point(field_get:flexsdr.DeviceInfoResponse.max_rx_gain)
-  return max_rx_gain_;
+  return _internal_max_rx_gain();
 }
-inline void DeviceInfoResponse::set_max_rx_gain(double value) {
+inline void DeviceInfoResponse::_internal_set_max_rx_gain(double value) {
   
-  max_rx_gain_ = value;
+  _impl_.max_rx_gain_ = value;
+}
+inline void DeviceInfoResponse::set_max_rx_gain(double value) {
+  _internal_set_max_rx_gain(value);
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.max_rx_gain)
 }
 
 // double min_tx_gain = 7;
 inline void DeviceInfoResponse::clear_min_tx_gain() {
-  min_tx_gain_ = 0;
+  _impl_.min_tx_gain_ = 0;
+}
+inline double DeviceInfoResponse::_internal_min_tx_gain() const {
+  return _impl_.min_tx_gain_;
 }
 inline double DeviceInfoResponse::min_tx_gain() const {
   // @@protoc_insertion_point(field_get:flexsdr.DeviceInfoResponse.min_tx_gain)
-  return min_tx_gain_;
+  return _internal_min_tx_gain();
 }
-inline void DeviceInfoResponse::set_min_tx_gain(double value) {
+inline void DeviceInfoResponse::_internal_set_min_tx_gain(double value) {
   
-  min_tx_gain_ = value;
+  _impl_.min_tx_gain_ = value;
+}
+inline void DeviceInfoResponse::set_min_tx_gain(double value) {
+  _internal_set_min_tx_gain(value);
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.min_tx_gain)
 }
 
 // double max_tx_gain = 8;
 inline void DeviceInfoResponse::clear_max_tx_gain() {
-  max_tx_gain_ = 0;
+  _impl_.max_tx_gain_ = 0;
+}
+inline double DeviceInfoResponse::_internal_max_tx_gain() const {
+  return _impl_.max_tx_gain_;
 }
 inline double DeviceInfoResponse::max_tx_gain() const {
   // @@protoc_insertion_point(field_get:flexsdr.DeviceInfoResponse.max_tx_gain)
-  return max_tx_gain_;
+  return _internal_max_tx_gain();
 }
-inline void DeviceInfoResponse::set_max_tx_gain(double value) {
+inline void DeviceInfoResponse::_internal_set_max_tx_gain(double value) {
   
-  max_tx_gain_ = value;
+  _impl_.max_tx_gain_ = value;
+}
+inline void DeviceInfoResponse::set_max_tx_gain(double value) {
+  _internal_set_max_tx_gain(value);
   // @@protoc_insertion_point(field_set:flexsdr.DeviceInfoResponse.max_tx_gain)
 }
 
+// -------------------------------------------------------------------
+
+// ParamChange
+
+// .flexsdr.ParamChange.Kind kind = 1;
+inline void ParamChange::clear_kind() {
+  _impl_.kind_ = 0;
+}
+inline ::flexsdr::ParamChange_Kind ParamChange::_internal_kind() const {
+  return static_cast< ::flexsdr::ParamChange_Kind >(_impl_.kind_);
+}
+inline ::flexsdr::ParamChange_Kind ParamChange::kind() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ParamChange.kind)
+  return _internal_kind();
+}
+inline void ParamChange::_internal_set_kind(::flexsdr::ParamChange_Kind value) {
+  
+  _impl_.kind_ = value;
+}
+inline void ParamChange::set_kind(::flexsdr::ParamChange_Kind value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ParamChange.kind)
+}
+
+// uint32 chan = 2;
+inline void ParamChange::clear_chan() {
+  _impl_.chan_ = 0u;
+}
+inline uint32_t ParamChange::_internal_chan() const {
+  return _impl_.chan_;
+}
+inline uint32_t ParamChange::chan() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ParamChange.chan)
+  return _internal_chan();
+}
+inline void ParamChange::_internal_set_chan(uint32_t value) {
+  
+  _impl_.chan_ = value;
+}
+inline void ParamChange::set_chan(uint32_t value) {
+  _internal_set_chan(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ParamChange.chan)
+}
+
+// double value = 3;
+inline void ParamChange::clear_value() {
+  _impl_.value_ = 0;
+}
+inline double ParamChange::_internal_value() const {
+  return _impl_.value_;
+}
+inline double ParamChange::value() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ParamChange.value)
+  return _internal_value();
+}
+inline void ParamChange::_internal_set_value(double value) {
+  
+  _impl_.value_ = value;
+}
+inline void ParamChange::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ParamChange.value)
+}
+
+// uint64 command_time_ticks = 4;
+inline void ParamChange::clear_command_time_ticks() {
+  _impl_.command_time_ticks_ = uint64_t{0u};
+}
+inline uint64_t ParamChange::_internal_command_time_ticks() const {
+  return _impl_.command_time_ticks_;
+}
+inline uint64_t ParamChange::command_time_ticks() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ParamChange.command_time_ticks)
+  return _internal_command_time_ticks();
+}
+inline void ParamChange::_internal_set_command_time_ticks(uint64_t value) {
+  
+  _impl_.command_time_ticks_ = value;
+}
+inline void ParamChange::set_command_time_ticks(uint64_t value) {
+  _internal_set_command_time_ticks(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ParamChange.command_time_ticks)
+}
+
+// uint32 command_id = 5;
+inline void ParamChange::clear_command_id() {
+  _impl_.command_id_ = 0u;
+}
+inline uint32_t ParamChange::_internal_command_id() const {
+  return _impl_.command_id_;
+}
+inline uint32_t ParamChange::command_id() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ParamChange.command_id)
+  return _internal_command_id();
+}
+inline void ParamChange::_internal_set_command_id(uint32_t value) {
+  
+  _impl_.command_id_ = value;
+}
+inline void ParamChange::set_command_id(uint32_t value) {
+  _internal_set_command_id(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ParamChange.command_id)
+}
+
+// -------------------------------------------------------------------
+
+// ApplySettingsRequest
+
+// repeated .flexsdr.ParamChange changes = 1;
+inline int ApplySettingsRequest::_internal_changes_size() const {
+  return _impl_.changes_.size();
+}
+inline int ApplySettingsRequest::changes_size() const {
+  return _internal_changes_size();
+}
+inline void ApplySettingsRequest::clear_changes() {
+  _impl_.changes_.Clear();
+}
+inline ::flexsdr::ParamChange* ApplySettingsRequest::mutable_changes(int index) {
+  // @@protoc_insertion_point(field_mutable:flexsdr.ApplySettingsRequest.changes)
+  return _impl_.changes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamChange >*
+ApplySettingsRequest::mutable_changes() {
+  // @@protoc_insertion_point(field_mutable_list:flexsdr.ApplySettingsRequest.changes)
+  return &_impl_.changes_;
+}
+inline const ::flexsdr::ParamChange& ApplySettingsRequest::_internal_changes(int index) const {
+  return _impl_.changes_.Get(index);
+}
+inline const ::flexsdr::ParamChange& ApplySettingsRequest::changes(int index) const {
+  // @@protoc_insertion_point(field_get:flexsdr.ApplySettingsRequest.changes)
+  return _internal_changes(index);
+}
+inline ::flexsdr::ParamChange* ApplySettingsRequest::_internal_add_changes() {
+  return _impl_.changes_.Add();
+}
+inline ::flexsdr::ParamChange* ApplySettingsRequest::add_changes() {
+  ::flexsdr::ParamChange* _add = _internal_add_changes();
+  // @@protoc_insertion_point(field_add:flexsdr.ApplySettingsRequest.changes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamChange >&
+ApplySettingsRequest::changes() const {
+  // @@protoc_insertion_point(field_list:flexsdr.ApplySettingsRequest.changes)
+  return _impl_.changes_;
+}
+
+// bool stop_on_error = 2;
+inline void ApplySettingsRequest::clear_stop_on_error() {
+  _impl_.stop_on_error_ = false;
+}
+inline bool ApplySettingsRequest::_internal_stop_on_error() const {
+  return _impl_.stop_on_error_;
+}
+inline bool ApplySettingsRequest::stop_on_error() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ApplySettingsRequest.stop_on_error)
+  return _internal_stop_on_error();
+}
+inline void ApplySettingsRequest::_internal_set_stop_on_error(bool value) {
+  
+  _impl_.stop_on_error_ = value;
+}
+inline void ApplySettingsRequest::set_stop_on_error(bool value) {
+  _internal_set_stop_on_error(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ApplySettingsRequest.stop_on_error)
+}
+
+// -------------------------------------------------------------------
+
+// ParamResult
+
+// bool success = 1;
+inline void ParamResult::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool ParamResult::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool ParamResult::success() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ParamResult.success)
+  return _internal_success();
+}
+inline void ParamResult::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void ParamResult::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ParamResult.success)
+}
+
+// double actual_value = 2;
+inline void ParamResult::clear_actual_value() {
+  _impl_.actual_value_ = 0;
+}
+inline double ParamResult::_internal_actual_value() const {
+  return _impl_.actual_value_;
+}
+inline double ParamResult::actual_value() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ParamResult.actual_value)
+  return _internal_actual_value();
+}
+inline void ParamResult::_internal_set_actual_value(double value) {
+  
+  _impl_.actual_value_ = value;
+}
+inline void ParamResult::set_actual_value(double value) {
+  _internal_set_actual_value(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ParamResult.actual_value)
+}
+
+// string error_message = 3;
+inline void ParamResult::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
+}
+inline const std::string& ParamResult::error_message() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ParamResult.error_message)
+  return _internal_error_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ParamResult::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:flexsdr.ParamResult.error_message)
+}
+inline std::string* ParamResult::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:flexsdr.ParamResult.error_message)
+  return _s;
+}
+inline const std::string& ParamResult::_internal_error_message() const {
+  return _impl_.error_message_.Get();
+}
+inline void ParamResult::_internal_set_error_message(const std::string& value) {
+  
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ParamResult::_internal_mutable_error_message() {
+  
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ParamResult::release_error_message() {
+  // @@protoc_insertion_point(field_release:flexsdr.ParamResult.error_message)
+  return _impl_.error_message_.Release();
+}
+inline void ParamResult::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:flexsdr.ParamResult.error_message)
+}
+
+// -------------------------------------------------------------------
+
+// ApplySettingsResponse
+
+// bool success = 1;
+inline void ApplySettingsResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool ApplySettingsResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool ApplySettingsResponse::success() const {
+  // @@protoc_insertion_point(field_get:flexsdr.ApplySettingsResponse.success)
+  return _internal_success();
+}
+inline void ApplySettingsResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void ApplySettingsResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:flexsdr.ApplySettingsResponse.success)
+}
+
+// repeated .flexsdr.ParamResult results = 2;
+inline int ApplySettingsResponse::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int ApplySettingsResponse::results_size() const {
+  return _internal_results_size();
+}
+inline void ApplySettingsResponse::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::flexsdr::ParamResult* ApplySettingsResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:flexsdr.ApplySettingsResponse.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamResult >*
+ApplySettingsResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:flexsdr.ApplySettingsResponse.results)
+  return &_impl_.results_;
+}
+inline const ::flexsdr::ParamResult& ApplySettingsResponse::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::flexsdr::ParamResult& ApplySettingsResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:flexsdr.ApplySettingsResponse.results)
+  return _internal_results(index);
+}
+inline ::flexsdr::ParamResult* ApplySettingsResponse::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::flexsdr::ParamResult* ApplySettingsResponse::add_results() {
+  ::flexsdr::ParamResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:flexsdr.ApplySettingsResponse.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::flexsdr::ParamResult >&
+ApplySettingsResponse::results() const {
+  // @@protoc_insertion_point(field_list:flexsdr.ApplySettingsResponse.results)
+  return _impl_.results_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -3178,28 +5416,40 @@ inline void DeviceInfoResponse::set_max_tx_gain(double value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace flexsdr
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::flexsdr::TuneRequest_Policy> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::flexsdr::TuneRequest_Policy>() {
   return ::flexsdr::TuneRequest_Policy_descriptor();
 }
+template <> struct is_proto_enum< ::flexsdr::ParamChange_Kind> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::flexsdr::ParamChange_Kind>() {
+  return ::flexsdr::ParamChange_Kind_descriptor();
+}
 template <> struct is_proto_enum< ::flexsdr::UnitType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::flexsdr::UnitType>() {
   return ::flexsdr::UnitType_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_flexsdr_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_flexsdr_2eproto
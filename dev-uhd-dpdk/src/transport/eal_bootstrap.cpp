@@ -2,13 +2,123 @@
 
 #include <cstdio>
 #include <cstring>
+#include <cstdlib>
+#include <cctype>
 #include <sstream>
+#include <fstream>
 #include <algorithm>
 
+#include <dirent.h>
+#include <sched.h>
+#include <sys/stat.h>
+
 #include <rte_errno.h>
+#include <rte_mbuf.h>
 
 namespace flexsdr {
 
+// --------------------------- preflight helpers ------------------------------
+
+namespace {
+
+constexpr const char* kSysNode = "/sys/devices/system/node";
+constexpr const char* kSysCpu  = "/sys/devices/system/cpu";
+
+std::string read_line(const std::string& path) {
+  std::ifstream f(path);
+  std::string line;
+  if (f) std::getline(f, line);
+  return line;
+}
+
+uint64_t read_u64(const std::string& path) {
+  const std::string s = read_line(path);
+  return s.empty() ? 0 : std::strtoull(s.c_str(), nullptr, 10);
+}
+
+// Kernel cpulist format: "0-3,8,10-11" (also accepts surrounding parens).
+std::vector<unsigned> parse_cpulist(const std::string& in) {
+  std::vector<unsigned> out;
+  std::string s;
+  for (char c : in) if (c != '(' && c != ')' && c != ' ' && c != '\n') s += c;
+  std::stringstream ss(s);
+  std::string tok;
+  while (std::getline(ss, tok, ',')) {
+    if (tok.empty()) continue;
+    char* end = nullptr;
+    unsigned lo = static_cast<unsigned>(std::strtoul(tok.c_str(), &end, 10));
+    unsigned hi = lo;
+    if (end && *end == '-') hi = static_cast<unsigned>(std::strtoul(end + 1, nullptr, 10));
+    for (unsigned c = lo; c <= hi && c < 4096; ++c) out.push_back(c);
+  }
+  std::sort(out.begin(), out.end());
+  out.erase(std::unique(out.begin(), out.end()), out.end());
+  return out;
+}
+
+// DPDK --lcores syntax: "0-3,5", "1@2", "(0-2)@(4-6)", "7@(8,9)".
+// Returns the physical CPUs the lcores will be pinned to.
+std::vector<unsigned> parse_lcores_cpus(const std::string& in) {
+  std::vector<unsigned> out;
+  std::string elem;
+  int depth = 0;
+  auto flush = [&]() {
+    if (elem.empty()) return;
+    const auto at = elem.find('@');
+    const auto cpus = parse_cpulist(at == std::string::npos ? elem : elem.substr(at + 1));
+    out.insert(out.end(), cpus.begin(), cpus.end());
+    elem.clear();
+  };
+  for (char c : in) {
+    if (c == '(') ++depth;
+    if (c == ')') --depth;
+    if (c == ',' && depth == 0) { flush(); continue; }
+    elem += c;
+  }
+  flush();
+  std::sort(out.begin(), out.end());
+  out.erase(std::unique(out.begin(), out.end()), out.end());
+  return out;
+}
+
+// "512,512" (MB per socket) -> bytes per socket
+std::vector<uint64_t> parse_socket_mem(const std::string& s) {
+  std::vector<uint64_t> out;
+  std::stringstream ss(s);
+  std::string tok;
+  while (std::getline(ss, tok, ','))
+    out.push_back(std::strtoull(tok.c_str(), nullptr, 10) << 20);
+  return out;
+}
+
+bool contains(const std::vector<unsigned>& v, unsigned x) {
+  return std::binary_search(v.begin(), v.end(), x);
+}
+
+std::string mb(uint64_t bytes) {
+  return std::to_string(bytes >> 20) + "MB";
+}
+
+std::string join(const std::vector<unsigned>& v) {
+  std::string s;
+  for (size_t i = 0; i < v.size(); ++i) {
+    if (i) s += ',';
+    s += std::to_string(v[i]);
+  }
+  return s.empty() ? "-" : s;
+}
+
+// Footprint of one rte_pktmbuf_pool_create'd pool as FlexSDRPrimary sizes it:
+// mempool object header + struct rte_mbuf + headroom + data room, plus the
+// backing ring of object pointers.
+uint64_t pool_bytes(unsigned n, unsigned elt_size) {
+  const uint64_t obj = RTE_CACHE_LINE_SIZE + sizeof(struct rte_mbuf) +
+                       RTE_PKTMBUF_HEADROOM + elt_size;
+  return uint64_t(n) * (obj + sizeof(void*));
+}
+
+} // namespace
+
 EalBootstrap::EalBootstrap(const conf::PrimaryConfig& cfg, std::string prog)
   : cfg_(cfg), prog_(std::move(prog)) {}
 
@@ -67,9 +177,8 @@ void EalBootstrap::build_args(const std::vector<std::string>& extra_flags) {
   if (cfg_.eal.socket_limit && !cfg_.eal.socket_limit->empty())
     push_flag_kv("--socket-limit", *cfg_.eal.socket_limit);
 
-  // NOTE: cfg_.eal.numa and cfg_.eal.isolcpus are informational here.
-  // - NUMA is generally enabled by default if hugepages are per-socket.
-  // - isolcpus is a kernel cmdline setting; we just log that it exists.
+  // NOTE: NUMA placement and isolcpus/nohz_full are host settings; they are
+  // not passed to EAL but checked against lcores/socket_mem by preflight().
 
   // ---- Append any extra flags the caller provided ----
   for (const auto& f : extra_flags) {
@@ -81,6 +190,19 @@ void EalBootstrap::build_args(const std::vector<std::string>& extra_flags) {
 }
 
 int EalBootstrap::init() {
+  const std::string& mode = cfg_.eal.preflight;
+  if (mode != "off") {
+    const EalPreflight rep = preflight();
+    std::fprintf(stderr, "%s", rep.to_string().c_str());
+    if (mode == "strict" && !rep.clean()) {
+      std::fprintf(stderr, "[eal] preflight: refusing to start (%zu errors, %zu warnings; "
+                           "set eal.preflight: warn to override)\n",
+                   rep.count(EalPreflight::Severity::Error),
+                   rep.count(EalPreflight::Severity::Warn));
+      return -1;
+    }
+  }
+
   rebuild_ptrs();
   int argc = static_cast<int>(argv_ptrs_.size());
   char** argv = argv_ptrs_.data();
@@ -94,6 +216,169 @@ int EalBootstrap::init() {
   return consumed;
 }
 
+EalPreflight EalBootstrap::preflight() const {
+  using Sev = EalPreflight::Severity;
+  EalPreflight rep;
+  auto add = [&](Sev sev, std::string what) { rep.findings.push_back({sev, std::move(what)}); };
+
+  // Process type from the configured role; an explicit --proc-type in the
+  // built args (build_args() may not have run yet) takes precedence
+  bool secondary = (cfg_.defaults.role == conf::Role::Ue || cfg_.defaults.role == conf::Role::Gnb);
+  for (size_t i = 0; i < args_str_storage_.size(); ++i) {
+    const auto& a = args_str_storage_[i];
+    std::string type;
+    if (a.rfind("--proc-type=", 0) == 0)
+      type = a.substr(12);
+    else if (a == "--proc-type" && i + 1 < args_str_storage_.size())
+      type = args_str_storage_[i + 1];
+    if (type == "primary" || type == "secondary") secondary = (type == "secondary");   // not "auto"
+  }
+
+  // ---- Hugepages per NUMA node --------------------------------------------
+  const auto socket_mem = parse_socket_mem(cfg_.eal.socket_mem);
+  if (DIR* d = ::opendir(kSysNode)) {
+    while (dirent* e = ::readdir(d)) {
+      if (std::strncmp(e->d_name, "node", 4) != 0 || !std::isdigit((unsigned char)e->d_name[4]))
+        continue;
+      EalPreflight::NumaNode nn;
+      nn.node = std::atoi(e->d_name + 4);
+      const std::string base = std::string(kSysNode) + "/" + e->d_name;
+      nn.cpus = parse_cpulist(read_line(base + "/cpulist"));
+      if (DIR* hd = ::opendir((base + "/hugepages").c_str())) {
+        while (dirent* h = ::readdir(hd)) {
+          // hugepages-2048kB, hugepages-1048576kB
+          if (std::strncmp(h->d_name, "hugepages-", 10) != 0) continue;
+          const uint64_t page = std::strtoull(h->d_name + 10, nullptr, 10) << 10;
+          const std::string hp = base + "/hugepages/" + h->d_name;
+          nn.free_bytes  += read_u64(hp + "/free_hugepages") * page;
+          nn.total_bytes += read_u64(hp + "/nr_hugepages") * page;
+        }
+        ::closedir(hd);
+      }
+      if (size_t(nn.node) < socket_mem.size()) nn.socket_mem = socket_mem[nn.node];
+      rep.nodes.push_back(std::move(nn));
+    }
+    ::closedir(d);
+  }
+  std::sort(rep.nodes.begin(), rep.nodes.end(),
+            [](const auto& a, const auto& b) { return a.node < b.node; });
+
+  uint64_t free_total = 0, reserve_total = 0;
+  for (const auto& nn : rep.nodes) {
+    free_total += nn.free_bytes;
+    reserve_total += nn.socket_mem;
+    // A secondary maps the primary's hugepages; its socket_mem reserves nothing
+    if (nn.socket_mem > nn.free_bytes && !secondary)
+      add(Sev::Error, "node" + std::to_string(nn.node) + ": socket_mem " + mb(nn.socket_mem) +
+                      " > free hugepages " + mb(nn.free_bytes));
+  }
+  if (rep.nodes.empty())
+    add(Sev::Warn, std::string("no NUMA topology under ") + kSysNode + "; hugepage checks skipped");
+  if (socket_mem.size() > rep.nodes.size() && !rep.nodes.empty())
+    add(Sev::Warn, "socket_mem lists " + std::to_string(socket_mem.size()) +
+                   " sockets, host has " + std::to_string(rep.nodes.size()));
+  if (!rep.nodes.empty() && free_total == 0 && !secondary)
+    add(Sev::Error, "no free hugepages on any node");
+
+  if (!cfg_.eal.huge_dir.empty()) {
+    struct stat st{};
+    if (::stat(cfg_.eal.huge_dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode))
+      add(Sev::Error, "huge_dir " + cfg_.eal.huge_dir + " does not exist");
+  }
+
+  // ---- Pool footprint (creators only) ---------------------------------------
+  if (!secondary) {
+    // Same selection as FlexSDRPrimary::create_pools_: first non-empty creator block.
+    for (const auto* rc : {&cfg_.primary_ue, &cfg_.primary_gnb}) {
+      if (!*rc || (*rc)->pools.empty()) continue;
+      for (const auto& p : (*rc)->pools) rep.pool_bytes += pool_bytes(p.size, p.elt_size);
+      if (const auto& ic = (*rc)->interconnect; ic && ic->pool_size)
+        rep.pool_bytes += pool_bytes(*ic->pool_size, ic->pool_elt_size.value_or(2048));
+      break;
+    }
+    const uint64_t avail = reserve_total ? reserve_total : free_total;
+    if (rep.pool_bytes && !rep.nodes.empty() && rep.pool_bytes > avail)
+      add(Sev::Error, "pools need ~" + mb(rep.pool_bytes) + " but only " + mb(avail) +
+                      (reserve_total ? " reserved by socket_mem" : " of hugepages are free"));
+    else if (rep.pool_bytes && !rep.nodes.empty() && rep.pool_bytes > avail - avail / 8)
+      add(Sev::Warn, "pools need ~" + mb(rep.pool_bytes) + " of " + mb(avail) +
+                     "; little headroom left for rings/memzones");
+  }
+
+  // ---- CPU placement ---------------------------------------------------------
+  rep.isolated  = parse_cpulist(read_line(std::string(kSysCpu) + "/isolated"));
+  rep.nohz_full = parse_cpulist(read_line(std::string(kSysCpu) + "/nohz_full"));
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (unsigned c = 0; c < CPU_SETSIZE; ++c)
+      if (CPU_ISSET(c, &set)) rep.affinity.push_back(c);
+  }
+
+  if (cfg_.eal.lcores && !cfg_.eal.lcores->empty()) {
+    rep.lcore_cpus = parse_lcores_cpus(*cfg_.eal.lcores);
+  } else {
+    rep.lcore_cpus = rep.affinity;
+    add(Sev::Info, "no eal.lcores: EAL takes every CPU in the affinity mask (" +
+                   join(rep.affinity) + ")");
+  }
+
+  const int main_cpu = cfg_.eal.main_lcore.value_or(-1);
+  for (unsigned c : rep.lcore_cpus) {
+    const std::string cpu = "cpu" + std::to_string(c);
+    if (!rep.affinity.empty() && !contains(rep.affinity, c)) {
+      add(Sev::Error, cpu + " is outside this process's affinity mask (" + join(rep.affinity) + ")");
+      continue;
+    }
+    if (int(c) == main_cpu) continue;   // main lcore only runs control work
+    if (!rep.isolated.empty() && !contains(rep.isolated, c))
+      add(Sev::Warn, cpu + " is not in isolcpus; the scheduler may place other threads on it");
+    if (!rep.nohz_full.empty() && !contains(rep.nohz_full, c))
+      add(Sev::Info, cpu + " is not nohz_full; expect periodic tick interrupts");
+
+    for (const auto& nn : rep.nodes) {
+      if (contains(nn.cpus, c) && !socket_mem.empty() && nn.socket_mem == 0 && !secondary)
+        add(Sev::Warn, cpu + " is on node" + std::to_string(nn.node) +
+                       " but socket_mem reserves nothing there; pool memory will be remote");
+    }
+  }
+  if (rep.isolated.empty() && cfg_.eal.lcores)
+    add(Sev::Warn, "no isolcpus on this host; lcores share CPUs with OS and application threads");
+
+  // Two DPDK apps (or DPDK + OAI) pinned on the same core spin against each other.
+  // The affinity mask is the best hint we get: if it is wider than the lcores,
+  // the rest of the process (e.g. OAI threads) may still land on them.
+  if (!rep.lcore_cpus.empty() && rep.affinity.size() > rep.lcore_cpus.size() && !secondary) {
+    add(Sev::Info, "affinity (" + join(rep.affinity) + ") is wider than lcores (" +
+                   join(rep.lcore_cpus) + "); non-EAL threads may still run on lcore CPUs");
+  }
+
+  return rep;
+}
+
+size_t EalPreflight::count(Severity s) const {
+  return static_cast<size_t>(std::count_if(findings.begin(), findings.end(),
+                                           [s](const Finding& f) { return f.sev == s; }));
+}
+
+std::string EalPreflight::to_string() const {
+  std::ostringstream oss;
+  for (const auto& nn : nodes) {
+    oss << "[eal] preflight: node" << nn.node << " hugepages free=" << mb(nn.free_bytes)
+        << "/" << mb(nn.total_bytes) << " socket_mem=" << mb(nn.socket_mem)
+        << " cpus=" << join(nn.cpus) << "\n";
+  }
+  oss << "[eal] preflight: pools~" << mb(pool_bytes) << " lcores=" << join(lcore_cpus)
+      << " isolated=" << join(isolated) << " nohz_full=" << join(nohz_full) << "\n";
+  for (const auto& f : findings) {
+    const char* tag = f.sev == Severity::Error ? "ERROR" : f.sev == Severity::Warn ? "WARN" : "info";
+    oss << "[eal] preflight: " << tag << ": " << f.what << "\n";
+  }
+  if (findings.empty()) oss << "[eal] preflight: ok\n";
+  return oss.str();
+}
+
 std::string EalBootstrap::args_as_cmdline() const {
   std::ostringstream oss;
   for (std::size_t i = 0; i < args_str_storage_.size(); ++i) {
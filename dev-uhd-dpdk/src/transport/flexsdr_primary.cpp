@@ -1,11 +1,18 @@
 #include "transport/flexsdr_primary.hpp"
 #include "conf/config_params.hpp"
+#include "transport/primary_link.hpp"
+#include "transport/mbuf_stamp.hpp"
 
 #include <cstdio>
 #include <cstring>
 #include <string>
 #include <vector>
 #include <optional>
+#include <ctime>
+#include <chrono>
+#include <csignal>
+#include <cerrno>
+#include <unistd.h>
 
 // DPDK
 #include <rte_config.h>
@@ -68,8 +75,14 @@ FlexSDRPrimary::FlexSDRPrimary(std::string yaml_path)
   std::fprintf(stderr, "[primary] constructed FlexSDRPrimary\n");
 }
 
+FlexSDRPrimary::~FlexSDRPrimary() {
+  hb_stop_.store(true, std::memory_order_release);
+  if (hb_thr_.joinable()) hb_thr_.join();
+}
+
 int FlexSDRPrimary::load_config_() {
   int rc = conf::load_from_yaml(yaml_path_.c_str(), cfg_);
+  tunables_ = std::make_shared<conf::TunablesStore>(cfg_.tunables);
   if (rc) {
     std::fprintf(stderr, "[primary] load_from_yaml failed rc=%d\n", rc);
     return rc;
@@ -77,13 +90,52 @@ int FlexSDRPrimary::load_config_() {
   return 0;
 }
 
+int FlexSDRPrimary::watch_tunables() {
+  if (!tunables_watcher_) {
+    tunables_watcher_ = std::make_unique<conf::TunablesWatcher>(yaml_path_, *tunables_);
+    conf::TunablesWatcher::install_sighup();
+  }
+  return tunables_watcher_->start();
+}
+
+// A new id per primary instance lets secondaries tell a paused primary
+// (same id, re-attach) from a restarted one (new id, see PrimaryLink).
+static uint64_t write_boot_id() {
+  timespec ts{};
+  clock_gettime(CLOCK_REALTIME, &ts);
+  const uint64_t id = (uint64_t(ts.tv_sec) * 1000000000ull + uint64_t(ts.tv_nsec)) ^
+                      (uint64_t(getpid()) << 48);
+  const std::string path = primary_boot_path(rte_eal_get_runtime_dir());
+  const std::string tmp  = path + ".tmp";
+  bool ok = false;
+  if (std::FILE* f = std::fopen(tmp.c_str(), "w")) {
+    ok = std::fprintf(f, "%llu\n", static_cast<unsigned long long>(id)) > 0;
+    ok = (std::fclose(f) == 0) && ok;
+    ok = ok && std::rename(tmp.c_str(), path.c_str()) == 0;
+  }
+  if (!ok) {
+    std::fprintf(stderr, "[primary] could not write boot id %s; secondaries cannot re-attach\n",
+                 path.c_str());
+    return 0;
+  }
+  return id;
+}
+
 int FlexSDRPrimary::init_resources() {
   std::fprintf(stderr, "[primary] init_resources: role=%s ring_size=%u\n",
                role_str(cfg_.defaults.role), cfg_.defaults.ring_size);
 
+  boot_id_ = write_boot_id();
+
   // 1) pools
   if (int rc = create_pools_(); rc) return rc;
 
+  // Enqueue-time field for TX packets (queue age in the switch); optional
+  if (mbuf_stamp_init() < 0) {
+    std::fprintf(stderr, "[primary] enqueue stamp field: register failed rte_errno=%d (%s)\n",
+                 rte_errno, rte_strerror(rte_errno));
+  }
+
   // 2) TX rings
   if (int rc = create_rings_tx_(); rc) return rc;
 
@@ -100,9 +152,93 @@ int FlexSDRPrimary::init_resources() {
     if (int rc = lookup_interconnect_(); rc) return rc;
   }
 
+  // 5) Control/status memzone (best effort: secondaries fall back to lookups)
+  (void)publish_ctl_();
+
+  return 0;
+}
+
+int FlexSDRPrimary::publish_ctl_() {
+  ctl_ = shm_ctl_create(static_cast<int>(rte_socket_id()), boot_id_, role_str(cfg_.defaults.role));
+  if (!ctl_) {
+    std::fprintf(stderr, "[primary] control memzone %s: create failed rte_errno=%d (%s)\n",
+                 SHM_CTL_NAME, rte_errno, rte_strerror(rte_errno));
+    return -1;
+  }
+
+  // Watermarks come from the RingSpec of the same name
+  std::vector<const conf::RingSpec*> specs;
+  for (const auto& r : collect_tx_rings_(cfg_)) specs.push_back(&r);
+  for (const auto& r : collect_rx_rings_(cfg_)) specs.push_back(&r);
+  if (cfg_.primary_gnb && cfg_.primary_gnb->interconnect) {
+    for (const auto& r : cfg_.primary_gnb->interconnect->rings) specs.push_back(&r);
+  }
+
+  int added = 0, full = 0, watermarked = 0;
+  auto add = [&](const char* name, void* obj, uint32_t size, uint8_t kind, uint8_t dir, size_t qid) {
+    const int idx = shm_ctl_add(ctl_, name, obj, size, kind, dir, static_cast<uint16_t>(qid));
+    if (idx < 0) {
+      full++;
+      return;
+    }
+    added++;
+    if (kind != SHM_KIND_RING) return;
+    for (const auto* sp : specs) {
+      if (sp->name != name || !sp->hi_wm) continue;
+      shm_ring_bp& b = ctl_->bp[idx];
+      shm_bp_configure(&b, rte_ring_get_capacity(static_cast<rte_ring*>(obj)), sp->hi_wm, sp->lo_wm);
+      std::fprintf(stderr, "[primary] ring %s: back-pressure at %u, released at %u entries\n",
+                   name, b.hi, b.lo);
+      watermarked++;
+      break;
+    }
+  };
+  for (size_t i = 0; i < pools_.size(); i++)
+    add(pools_[i]->name, pools_[i], pools_[i]->size, SHM_KIND_POOL, SHM_DIR_NONE, i);
+  for (size_t i = 0; i < tx_rings_.size(); i++)
+    add(tx_rings_[i]->name, tx_rings_[i], rte_ring_get_size(tx_rings_[i]), SHM_KIND_RING, SHM_DIR_TX, i);
+  for (size_t i = 0; i < rx_rings_.size(); i++)
+    add(rx_rings_[i]->name, rx_rings_[i], rte_ring_get_size(rx_rings_[i]), SHM_KIND_RING, SHM_DIR_RX, i);
+  for (size_t i = 0; i < ic_tx_rings_.size(); i++)
+    add(ic_tx_rings_[i]->name, ic_tx_rings_[i], rte_ring_get_size(ic_tx_rings_[i]), SHM_KIND_RING, SHM_DIR_IC, i);
+  for (size_t i = 0; i < ic_rx_rings_.size(); i++)
+    add(ic_rx_rings_[i]->name, ic_rx_rings_[i], rte_ring_get_size(ic_rx_rings_[i]), SHM_KIND_RING, SHM_DIR_IC, i);
+  if (full) {
+    std::fprintf(stderr, "[primary] control memzone: directory full, %d entries left out\n", full);
+  }
+
+  ctl_->primary_heartbeat_ns.store(shm_now_ns(), std::memory_order_relaxed);
+  shm_ctl_publish(ctl_);
+  std::fprintf(stderr, "[primary] control memzone %s v%u: %d entries (%d with watermarks), %u attach slots\n",
+               SHM_CTL_NAME, SHM_CTL_VERSION, added, watermarked, SHM_CTL_MAX_SLOTS);
+
+  if (!hb_thr_.joinable()) {
+    hb_stop_.store(false, std::memory_order_release);
+    hb_thr_ = std::thread(&FlexSDRPrimary::heartbeat_loop_, this);
+  }
   return 0;
 }
 
+void FlexSDRPrimary::heartbeat_loop_() {
+  unsigned tick = 0;
+  while (!hb_stop_.load(std::memory_order_acquire)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ctl_->primary_heartbeat_ns.store(shm_now_ns(), std::memory_order_release);
+
+    // Once a second: free slots whose secondary died without detaching
+    if (++tick % 10) continue;
+    for (unsigned i = 0; i < SHM_CTL_MAX_SLOTS; i++) {
+      shm_attach_slot& sl = ctl_->slots[i];
+      if (sl.state.load(std::memory_order_acquire) != SHM_SLOT_ATTACHED || sl.pid <= 0) continue;
+      if (::kill(sl.pid, 0) != 0 && errno == ESRCH) {
+        std::fprintf(stderr, "[primary] secondary pid %d (%s) gone; freeing attach slot %u\n",
+                     sl.pid, sl.role, i);
+        shm_ctl_release_slot(ctl_, static_cast<int>(i));
+      }
+    }
+  }
+}
+
 int FlexSDRPrimary::create_pools_() {
   const auto& pools = collect_pools_(cfg_);
   for (const auto& p : pools) {
@@ -116,24 +252,30 @@ int FlexSDRPrimary::create_pools_() {
     // For DPDK 24.11, ensure we have enough total space by adding RTE_PKTMBUF_HEADROOM
     const unsigned data_room = esz + RTE_PKTMBUF_HEADROOM;
     
-    rte_mempool* mp = rte_pktmbuf_pool_create(
-        name.c_str(),
-        n,                 // number of elements
-        cache,             // per-lcore cache
-        0,                 // private data size
-        data_room,         // total buffer size including headroom
-        SOCKET_ID_ANY);
+    // Explicit ops (YAML) pick the mempool driver; secondaries attach to
+    // whatever the primary created, so this is the only place it matters.
+    rte_mempool* mp = p.ops.empty()
+        ? rte_pktmbuf_pool_create(
+              name.c_str(),
+              n,                 // number of elements
+              cache,             // per-lcore cache
+              0,                 // private data size
+              data_room,         // total buffer size including headroom
+              SOCKET_ID_ANY)
+        : rte_pktmbuf_pool_create_by_ops(
+              name.c_str(), n, cache, 0, data_room, SOCKET_ID_ANY, p.ops.c_str());
 
+    const char* ops = p.ops.empty() ? rte_mbuf_best_mempool_ops() : p.ops.c_str();
     if (!mp) {
       int err = rte_errno;
       std::fprintf(stderr,
-                   "[pool] create failed: %s (n=%u data_room=%u cache=%u) rc=%d rte_errno=%d (%s)\n",
-                   name.c_str(), n, data_room, cache, -1, err, rte_strerror(err));
+                   "[pool] create failed: %s (n=%u data_room=%u cache=%u ops=%s) rc=%d rte_errno=%d (%s)\n",
+                   name.c_str(), n, data_room, cache, ops, -1, err, rte_strerror(err));
       return -1;
     }
 
-    std::fprintf(stderr, "[pool] created: %s (n=%u data_room=%u cache=%u)\n",
-                 name.c_str(), n, data_room, cache);
+    std::fprintf(stderr, "[pool] created: %s (n=%u data_room=%u cache=%u ops=%s)\n",
+                 name.c_str(), n, data_room, cache, ops);
     pools_.push_back(mp);
   }
   return 0;
@@ -1,10 +1,17 @@
 #include "transport/flexsdr_secondary.hpp"
 #include "conf/config_params.hpp"
+#include "transport/mbuf_stamp.hpp"
 
 #include <cstdio>
 #include <cstring>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <utility>
+#include <chrono>
+#include <fstream>
+
+#include <unistd.h>
 
 // DPDK (must be in extern "C" block)
 extern "C" {
@@ -65,12 +72,15 @@ FlexSDRSecondary::FlexSDRSecondary(std::string yaml_path)
 }
 
 FlexSDRSecondary::~FlexSDRSecondary() {
-  // No mbuf cache to clean up
+  stop_watch_primary();
+  release_ctl_();
+  link_->closed.store(true, std::memory_order_release);   // see thread_caches::prune()
   std::fprintf(stderr, "[secondary] destroyed FlexSDRSecondary\n");
 }
 
 int FlexSDRSecondary::load_config_() {
   int rc = conf::load_from_yaml(yaml_path_.c_str(), cfg_);
+  tunables_ = std::make_shared<conf::TunablesStore>(cfg_.tunables);
   if (rc) {
     std::fprintf(stderr, "[secondary] load_from_yaml failed rc=%d\n", rc);
     return rc;
@@ -78,24 +88,219 @@ int FlexSDRSecondary::load_config_() {
   return 0;
 }
 
+int FlexSDRSecondary::watch_tunables() {
+  if (!tunables_watcher_) {
+    tunables_watcher_ = std::make_unique<conf::TunablesWatcher>(yaml_path_, *tunables_);
+    conf::TunablesWatcher::install_sighup();
+  }
+  return tunables_watcher_->start();
+}
+
 int FlexSDRSecondary::init_resources() {
   std::fprintf(stderr, "[secondary] init_resources: role=%s ring_size=%u\n",
                role_str(cfg_.defaults.role), cfg_.defaults.ring_size);
 
+  ctl_ = shm_ctl_attach();
+  if (!ctl_) {
+    std::fprintf(stderr, "[secondary] no control memzone '%s'; looking up rings by name\n",
+                 SHM_CTL_NAME);
+  }
+
   if (int rc = lookup_pools_(); rc) return rc;
   if (int rc = lookup_rings_tx_(); rc) return rc;
   if (int rc = lookup_rings_rx_(); rc) return rc;
-  // No mbuf cache needed - using direct alloc/free
 
+  if (mbuf_stamp_init() < 0) {
+    std::fprintf(stderr, "[secondary] enqueue stamp field unavailable (rte_errno=%d); packets go unstamped\n",
+                 rte_errno);
+  }
+  attach_ctl_();
+
+  boot_id_ = read_boot_id();
+  link_->state.store(PrimaryLink::UP, std::memory_order_release);
+  return 0;
+}
+
+// --------------------------- primary watch ----------------------------------
+
+uint64_t FlexSDRSecondary::read_boot_id() {
+  std::ifstream f(primary_boot_path(rte_eal_get_runtime_dir()));
+  unsigned long long id = 0;
+  if (!(f >> id)) return 0;
+  return id;
+}
+
+void FlexSDRSecondary::on_primary_change(std::function<void(uint32_t)> cb) {
+  std::lock_guard<std::mutex> lk(watch_mtx_);
+  on_change_ = std::move(cb);
+}
+
+void FlexSDRSecondary::set_link_state_(uint32_t st) {
+  const uint32_t prev = link_->state.exchange(st, std::memory_order_acq_rel);
+  if (prev == st) return;
+  std::fprintf(stderr, "[secondary] primary link %s -> %s\n",
+               primary_link_state_str(prev), primary_link_state_str(st));
+  std::function<void(uint32_t)> cb;
+  {
+    std::lock_guard<std::mutex> lk(watch_mtx_);
+    cb = on_change_;
+  }
+  if (cb) cb(st);
+}
+
+int FlexSDRSecondary::watch_primary(unsigned period_ms) {
+  if (watch_thr_.joinable()) return 0;
+  if (rte_eal_process_type() != RTE_PROC_SECONDARY) {
+    std::fprintf(stderr, "[secondary] watch_primary: not a DPDK secondary, nothing to watch\n");
+    return -1;
+  }
+  if (!boot_id_) {
+    std::fprintf(stderr, "[secondary] watch_primary: no primary boot id (%s); "
+                         "a lost primary will be reported STALE\n",
+                 primary_boot_path(rte_eal_get_runtime_dir()).c_str());
+  }
+  watch_stop_.store(false, std::memory_order_release);
+  watch_thr_ = std::thread(&FlexSDRSecondary::watch_loop_, this, period_ms ? period_ms : 100);
+  return 0;
+}
+
+void FlexSDRSecondary::stop_watch_primary() {
+  watch_stop_.store(true, std::memory_order_release);
+  if (watch_thr_.joinable()) watch_thr_.join();
+}
+
+void FlexSDRSecondary::watch_loop_(unsigned period_ms) {
+  while (!watch_stop_.load(std::memory_order_acquire)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(period_ms));
+
+    // fcntl lock on the primary's runtime config: no shared memory access
+    const bool alive = rte_eal_primary_proc_alive(nullptr) != 0;
+    const uint32_t st = link_->state.load(std::memory_order_acquire);
+
+    if (ctl_ && ctl_slot_ >= 0 && st == PrimaryLink::UP && alive) {
+      ctl_->slots[ctl_slot_].heartbeat_ns.store(shm_now_ns(), std::memory_order_relaxed);
+    }
+
+    if (st == PrimaryLink::UP && !alive) {
+      link_->losses.fetch_add(1, std::memory_order_relaxed);
+      set_link_state_(PrimaryLink::LOST);
+    } else if (st == PrimaryLink::LOST && alive) {
+      const uint64_t id = read_boot_id();
+      // Same instance: the probe also reports "not alive" when it cannot
+      // open the runtime config (e.g. out of file descriptors)
+      if (id && id == boot_id_) {
+        if (reattach() != 0) set_link_state_(PrimaryLink::STALE);
+      } else {
+        // New primary instance: its runtime config replaced the one this
+        // EAL mapped, so no DPDK object may be touched any more.
+        std::fprintf(stderr, "[secondary] primary restarted (boot id %llu -> %llu); "
+                             "this process must be restarted to attach to it\n",
+                     static_cast<unsigned long long>(boot_id_),
+                     static_cast<unsigned long long>(id));
+        set_link_state_(PrimaryLink::STALE);
+      }
+    }
+  }
+}
+
+int FlexSDRSecondary::reattach() {
+  // Only the instance this process attached to can be re-attached (see
+  // PrimaryLink), and it still owns the pools and rings held here. They are
+  // looked up by name to confirm that, never replaced: TX threads and
+  // streamers read the handles without a lock, and only init_resources()
+  // writes them. The control memzone, our attach slot and the mbuf stamp
+  // field registration survived with the instance as well.
+  auto gone = [](const char* what, const char* name) {
+    std::fprintf(stderr, "[secondary] reattach: %s %s is gone or moved; restart required\n",
+                 what, name);
+    return -1;
+  };
+  for (rte_mempool* mp : pools_) {
+    if (mp && rte_mempool_lookup(mp->name) != mp) return gone("pool", mp->name);
+  }
+  for (const auto* rings : {&tx_rings_, &rx_rings_}) {
+    for (rte_ring* r : *rings) {
+      if (r && rte_ring_lookup(r->name) != r) return gone("ring", r->name);
+    }
+  }
+  link_->generation.fetch_add(1, std::memory_order_relaxed);
+  set_link_state_(PrimaryLink::UP);
   return 0;
 }
 
+// --------------------------- control memzone --------------------------------
+
+void FlexSDRSecondary::attach_ctl_() {
+  tx_ctr_.assign(tx_rings_.size(), nullptr);
+  rx_ctr_.assign(rx_rings_.size(), nullptr);
+  tx_bp_.assign(tx_rings_.size(), nullptr);
+  if (!ctl_) return;
+
+  for (size_t i = 0; i < tx_rings_.size(); i++) {
+    tx_ctr_[i] = shm_ctl_counters(ctl_, tx_rings_[i]);
+    shm_ring_bp* b = shm_ctl_bp(ctl_, tx_rings_[i]);
+    if (b && b->hi) tx_bp_[i] = b;
+  }
+  for (size_t i = 0; i < rx_rings_.size(); i++) rx_ctr_[i] = shm_ctl_counters(ctl_, rx_rings_[i]);
+
+  if (ctl_slot_ < 0) {
+    ctl_slot_ = shm_ctl_claim_slot(ctl_, static_cast<int32_t>(::getpid()),
+                                   role_str(cfg_.defaults.role));
+    if (ctl_slot_ < 0) {
+      std::fprintf(stderr, "[secondary] control memzone: no free attach slot (max %u)\n",
+                   SHM_CTL_MAX_SLOTS);
+    } else {
+      std::fprintf(stderr, "[secondary] control memzone: slot %d, primary role=%s boot_id=%llu\n",
+                   ctl_slot_, ctl_->role, static_cast<unsigned long long>(ctl_->boot_id));
+    }
+  }
+}
+
+void FlexSDRSecondary::release_ctl_() {
+  // Only while the primary (and thus the memzone) is still mapped and ours
+  if (ctl_ && link_->up()) shm_ctl_release_slot(ctl_, ctl_slot_);
+  ctl_slot_ = -1;
+}
+
+FlexSDRSecondary::queue_stats FlexSDRSecondary::get_stats(uint16_t qid) const {
+  queue_stats st{};
+  {
+    std::lock_guard<std::mutex> lk(cache_mtx_);
+    for (const auto& c : cache_ctrs_) {
+      if (c->pool != qid) continue;
+      st.mbuf_cache_hits    += c->hits.load(std::memory_order_relaxed);
+      st.mbuf_cache_refills += c->refills.load(std::memory_order_relaxed);
+      st.mbuf_cache_bypass  += c->bypass.load(std::memory_order_relaxed);
+    }
+  }
+  if (!link_->up()) return st;
+  if (qid < rx_ctr_.size() && rx_ctr_[qid]) {
+    st.rx_packets = rx_ctr_[qid]->cons.pkts.load(std::memory_order_relaxed);
+    st.rx_bytes   = rx_ctr_[qid]->cons.bytes.load(std::memory_order_relaxed);
+  }
+  if (qid < tx_ctr_.size() && tx_ctr_[qid]) {
+    const auto& p = tx_ctr_[qid]->prod;
+    st.tx_packets       = p.pkts.load(std::memory_order_relaxed);
+    st.tx_bytes         = p.bytes.load(std::memory_order_relaxed);
+    st.ring_full_drops  = p.drops.load(std::memory_order_relaxed);
+    st.mbuf_alloc_fails = p.alloc_fails.load(std::memory_order_relaxed);
+  }
+  if (qid < tx_bp_.size() && tx_bp_[qid]) {
+    st.backpressure_raised = tx_bp_[qid]->raised.load(std::memory_order_relaxed);
+    st.backpressure        = shm_bp_asserted(tx_bp_[qid]);
+  }
+  return st;
+}
+
 // --------------------------- pool & ring lookups ------------------------------------
 
 int FlexSDRSecondary::lookup_pools_() {
   const auto& pools = collect_pools_(cfg_);
+  pool_cache_size_.clear();
   for (const auto& p : pools) {
-    rte_mempool* mp = rte_mempool_lookup(p.name.c_str());
+    const int e = shm_ctl_find(ctl_, p.name.c_str(), SHM_KIND_POOL);
+    rte_mempool* mp = e >= 0 ? static_cast<rte_mempool*>(ctl_->dir[e].obj)
+                             : rte_mempool_lookup(p.name.c_str());
     if (!mp) {
       std::fprintf(stderr, "[pool] lookup failed: %s rc=%d rte_errno=%d\n",
                    p.name.c_str(), -2, rte_errno);
@@ -104,13 +309,16 @@ int FlexSDRSecondary::lookup_pools_() {
     std::fprintf(stderr, "[pool] found: %s (capacity=%u)\n",
                  p.name.c_str(), rte_mempool_avail_count(mp) + rte_mempool_in_use_count(mp));
     pools_.push_back(mp);
+    pool_cache_size_.push_back(std::min<unsigned>(p.cache_size, RTE_MEMPOOL_CACHE_MAX_SIZE));
   }
   return 0;
 }
 
 int FlexSDRSecondary::lookup_ring_(const std::string& name, rte_ring** out) {
   *out = nullptr;
-  rte_ring* r = rte_ring_lookup(name.c_str());
+  const int e = shm_ctl_find(ctl_, name.c_str(), SHM_KIND_RING);
+  rte_ring* r = e >= 0 ? static_cast<rte_ring*>(ctl_->dir[e].obj)
+                       : rte_ring_lookup(name.c_str());
   if (!r) {
     std::fprintf(stderr, "[ring] lookup failed: %s rc=%d rte_errno=%d\n",
                  name.c_str(), -2, rte_errno);
@@ -146,14 +354,16 @@ int FlexSDRSecondary::lookup_rings_rx_() {
   return 0;
 }
 
-bool FlexSDRSecondary::send_burst(std::size_t chan,
-                                   const void* data,
-                                   std::size_t bytes,
-                                   uint64_t tsf,
-                                   uint32_t spp,
-                                   uint16_t fmt,
-                                   bool sob,
-                                   bool eob) {
+TxBackend::tx_status FlexSDRSecondary::send_burst(std::size_t chan,
+                                                   const void* data,
+                                                   std::size_t bytes,
+                                                   uint64_t tsf,
+                                                   uint32_t spp,
+                                                   uint16_t fmt,
+                                                   bool sob,
+                                                   bool eob) {
+  if (!link_->up()) return tx_status::rejected;   // primary gone: never touch its pools
+
   // Suppress unused parameter warnings
   (void)tsf;
   (void)spp;
@@ -167,23 +377,17 @@ bool FlexSDRSecondary::send_burst(std::size_t chan,
       std::fprintf(stderr, "[send_burst] ERROR: Invalid channel %zu (tx_rings=%zu, pools=%zu)\n",
                    chan, tx_rings_.size(), pools_.size());
     }
-    return false;
+    return tx_status::rejected;
   }
 
   rte_ring* r = tx_rings_[chan];
-  rte_mempool* pool = pools_[chan];
-
-  // Allocate mbuf directly from pool (simple approach)
-  rte_mbuf* m = rte_pktmbuf_alloc(pool);
-  if (!m) {
-    static uint64_t alloc_fail_count = 0;
-    if (++alloc_fail_count % 1000 == 1) {
-      std::fprintf(stderr, "[send_burst] ERROR: mbuf alloc failed (pool=%s, avail=%u, in_use=%u)\n",
-                   pool->name, rte_mempool_avail_count(pool), 
-                   rte_mempool_in_use_count(pool));
-    }
-    return false;
-  }
+
+  // Would block (ring full, pool empty): nothing built, nothing counted; the
+  // sender retries or reports the drop through tx_dropped()
+  shm_queue_counters* ctr = chan < tx_ctr_.size() ? tx_ctr_[chan] : nullptr;
+  if (rte_ring_free_count(r) == 0) return tx_status::would_block;
+  rte_mbuf* m = alloc_mbuf_(chan);
+  if (!m) return tx_status::would_block;
 
   // Validate mbuf structure
   if (!m->buf_addr || m->buf_len == 0) {
@@ -193,7 +397,7 @@ bool FlexSDRSecondary::send_burst(std::size_t chan,
                    m->buf_addr, m->buf_len);
     }
     rte_pktmbuf_free(m);
-    return false;
+    return tx_status::rejected;
   }
 
   // Check if we have enough tailroom
@@ -205,7 +409,7 @@ bool FlexSDRSecondary::send_burst(std::size_t chan,
                    bytes, tailroom);
     }
     rte_pktmbuf_free(m);
-    return false;
+    return tx_status::rejected;
   }
 
   // Get data pointer with proper bounds checking
@@ -216,7 +420,7 @@ bool FlexSDRSecondary::send_burst(std::size_t chan,
       std::fprintf(stderr, "[send_burst] ERROR: mbuf buf_addr is NULL\n");
     }
     rte_pktmbuf_free(m);
-    return false;
+    return tx_status::rejected;
   }
 
   // Calculate actual data pointer: buf_addr + headroom
@@ -230,7 +434,7 @@ bool FlexSDRSecondary::send_burst(std::size_t chan,
                    buf_addr, data_ptr, bytes, m->buf_len);
     }
     rte_pktmbuf_free(m);
-    return false;
+    return tx_status::rejected;
   }
 
   // Validate source pointer
@@ -240,7 +444,7 @@ bool FlexSDRSecondary::send_burst(std::size_t chan,
       std::fprintf(stderr, "[send_burst] ERROR: Source data pointer is NULL\n");
     }
     rte_pktmbuf_free(m);
-    return false;
+    return tx_status::rejected;
   }
 
   // DEBUG: Print all values before memcpy
@@ -262,97 +466,393 @@ bool FlexSDRSecondary::send_burst(std::size_t chan,
   m->pkt_len = static_cast<uint32_t>(bytes);
 
   // Enqueue to DPDK ring (single-producer per channel)
-  const unsigned enq = rte_ring_enqueue_burst(r, reinterpret_cast<void**>(&m), 1, nullptr);
+  mbuf_stamp_set(m, rte_get_tsc_cycles());
+  unsigned free_space = 0;
+  const unsigned enq = rte_ring_enqueue_burst(r, reinterpret_cast<void**>(&m), 1, &free_space);
+  if (chan < tx_bp_.size()) shm_bp_update(tx_bp_[chan], rte_ring_get_capacity(r) - free_space);
   if (!enq) {
+    // Room was checked above: only a second producer on the ring gets here
     static uint64_t ring_full_count = 0;
     if (++ring_full_count % 1000 == 1) {
-      std::fprintf(stderr, "[send_burst] ERROR: Ring full (ring=%s, capacity=%u, free=%u)\n",
+      std::fprintf(stderr, "[send_burst] ERROR: enqueue raced on ring %s (capacity=%u, free=%u)\n",
                    r->name, rte_ring_get_capacity(r), rte_ring_free_count(r));
     }
-    // Free mbuf since we couldn't enqueue it
     rte_pktmbuf_free(m);
-    return false;
+    return tx_status::would_block;
   }
   // mbuf successfully enqueued - it will be freed by the consumer
-  return true;
+  if (ctr) {
+    shm_queue_counters::add(ctr->prod.pkts, 1);
+    shm_queue_counters::add(ctr->prod.bytes, bytes);
+  }
+  return tx_status::sent;
 }
 
-// --------------------------- mbuf cache helpers ---------------------------------
+TxBackend::tx_status FlexSDRSecondary::send_burst_multi(const std::size_t* chans,
+                                                         const void* const* data,
+                                                         std::size_t nchans,
+                                                         std::size_t bytes,
+                                                         uint64_t tsf,
+                                                         uint32_t spp,
+                                                         uint16_t fmt,
+                                                         bool sob,
+                                                         bool eob) {
+  if (!link_->up()) return tx_status::rejected;
 
-int FlexSDRSecondary::init_mbuf_cache_() {
-  // Initialize cache for all channels
-  mbuf_cache_.resize(tx_rings_.size());
-  
-  for (size_t chan = 0; chan < tx_rings_.size(); ++chan) {
-    if (chan >= pools_.size() || !pools_[chan]) {
-      std::fprintf(stderr, "[mbuf_cache] ERROR: No pool for channel %zu\n", chan);
-      return -1;
+  (void)tsf;
+  (void)spp;
+  (void)fmt;
+  (void)sob;
+  (void)eob;
+  return send_multi_(chans, data, nchans, bytes, nullptr);
+}
+
+// --------------------------- zero-copy TX -----------------------------------
+
+struct FlexSDRSecondary::thread_extbufs {
+  struct entry {
+    const FlexSDRSecondary*      owner;
+    std::shared_ptr<PrimaryLink> link;     // with owner: unique per instance
+    std::unique_ptr<TxExtbuf>    xb;
+  };
+  std::vector<entry> v;
+
+  ~thread_extbufs() {
+    // Shared infos go back to the DPDK heap only while it is known to be alive
+    for (auto& e : v) {
+      if (!e.link->up()) (void)e.xb.release();
     }
-    
-    // Pre-allocate mbufs for this channel's cache
-    for (size_t i = 0; i < MBUF_CACHE_SIZE; ++i) {
-      rte_mbuf* m = rte_pktmbuf_alloc(pools_[chan]);
-      if (!m) {
-        std::fprintf(stderr, "[mbuf_cache] WARNING: Could only pre-allocate %zu/%zu mbufs for channel %zu\n",
-                     i, MBUF_CACHE_SIZE, chan);
-        break;
+  }
+};
+
+TxExtbuf* FlexSDRSecondary::thread_extbuf_(bool create) {
+  static thread_local thread_extbufs tl;
+  for (const auto& e : tl.v) {
+    if (e.owner == this && e.link == link_) return e.xb->ready() ? e.xb.get() : nullptr;
+  }
+  if (!create) return nullptr;
+
+  // Every in-flight packet sits in a TX ring or with the primary; twice the
+  // ring capacity covers the packets being freed on the primary side.
+  unsigned slots = 0;
+  for (auto* r : tx_rings_) slots += r ? rte_ring_get_capacity(r) : 0;
+  const int socket = pools_.empty() || !pools_[0] ? SOCKET_ID_ANY : pools_[0]->socket_id;
+  auto xb = std::make_unique<TxExtbuf>();
+  (void)xb->init(2 * slots, socket);   // on failure the entry stays, sends copy
+  tl.v.push_back({this, link_, std::move(xb)});
+  return tl.v.back().xb->ready() ? tl.v.back().xb.get() : nullptr;
+}
+
+std::size_t FlexSDRSecondary::reap_tx_completions() {
+  TxExtbuf* xb = thread_extbuf_(false);
+  return xb ? xb->reap() : 0;
+}
+
+TxBackend::tx_status FlexSDRSecondary::send_burst_zc(std::size_t chan,
+                                                      const void* data,
+                                                      std::size_t bytes,
+                                                      uint64_t tsf,
+                                                      uint32_t spp,
+                                                      uint16_t fmt,
+                                                      bool sob,
+                                                      bool eob,
+                                                      const tx_done& done) {
+  if (!link_->up()) return tx_status::rejected;
+
+  TxExtbuf* xb = thread_extbuf_(true);
+  if (xb && chan < tx_rings_.size() && tx_rings_[chan] &&
+      chan < pools_.size() && pools_[chan]) {
+    xb->reap();
+    shm_queue_counters* ctr = chan < tx_ctr_.size() ? tx_ctr_[chan] : nullptr;
+    if (rte_ring_free_count(tx_rings_[chan]) == 0) return tx_status::would_block;
+    bool alloc_failed = false;
+    rte_mbuf* m = xb->attach(pools_[chan], data, bytes, done, &alloc_failed);
+    if (alloc_failed) return tx_status::would_block;
+    if (m) {
+      mbuf_stamp_set(m, rte_get_tsc_cycles());
+      rte_ring* r = tx_rings_[chan];
+      unsigned free_space = 0;
+      const unsigned enq = rte_ring_enqueue_burst(r, reinterpret_cast<void**>(&m), 1, &free_space);
+      if (chan < tx_bp_.size()) shm_bp_update(tx_bp_[chan], rte_ring_get_capacity(r) - free_space);
+      if (!enq) {
+        xb->cancel(m);
+        return tx_status::would_block;
       }
-      mbuf_cache_[chan].push_back(m);
+      if (ctr) {
+        shm_queue_counters::add(ctr->prod.pkts, 1);
+        shm_queue_counters::add(ctr->prod.bytes, bytes);
+      }
+      return tx_status::sent;
     }
-    
-    std::fprintf(stderr, "[mbuf_cache] Channel %zu: pre-allocated %zu mbufs\n",
-                 chan, mbuf_cache_[chan].size());
   }
-  
-  return 0;
+
+  // Not attachable (ordinary memory, no free slot): copy
+  const tx_status st = send_burst(chan, data, bytes, tsf, spp, fmt, sob, eob);
+  if (st == tx_status::sent && done.fn) done.fn(data, done.opaque);
+  return st;
 }
 
-void FlexSDRSecondary::cleanup_mbuf_cache_() {
-  for (size_t chan = 0; chan < mbuf_cache_.size(); ++chan) {
-    for (rte_mbuf* m : mbuf_cache_[chan]) {
-      if (m) {
-        rte_pktmbuf_free(m);
+TxBackend::tx_status FlexSDRSecondary::send_burst_multi_zc(const std::size_t* chans,
+                                                            const void* const* data,
+                                                            std::size_t nchans,
+                                                            std::size_t bytes,
+                                                            uint64_t tsf,
+                                                            uint32_t spp,
+                                                            uint16_t fmt,
+                                                            bool sob,
+                                                            bool eob,
+                                                            const tx_done* done) {
+  if (!link_->up()) return tx_status::rejected;
+
+  (void)tsf;
+  (void)spp;
+  (void)fmt;
+  (void)sob;
+  (void)eob;
+  if (TxExtbuf* xb = thread_extbuf_(true)) xb->reap();
+  return send_multi_(chans, data, nchans, bytes, done);
+}
+
+TxBackend::tx_status FlexSDRSecondary::send_multi_(const std::size_t* chans,
+                                                   const void* const* data,
+                                                   std::size_t nchans,
+                                                   std::size_t bytes,
+                                                   const tx_done* done) {
+  constexpr std::size_t MAX_MULTI = 16;
+  if (nchans == 0 || nchans > MAX_MULTI) return tx_status::rejected;
+
+  rte_mbuf* mbufs[MAX_MULTI] = {};
+  bool      attached[MAX_MULTI] = {};
+  TxExtbuf* xb = done ? thread_extbuf_(false) : nullptr;
+  auto drop = [&](std::size_t from, std::size_t to) {
+    for (std::size_t i = from; i < to; ++i) {
+      if (attached[i]) xb->cancel(mbufs[i]);
+      else rte_pktmbuf_free(mbufs[i]);
+    }
+  };
+
+  // Every ring must have room before anything is built. With one producer
+  // per TX ring, free space only grows between this check and the enqueue,
+  // so the burst lands on all rings or on none. A full ring is "would
+  // block": nothing built, nothing counted (see tx_dropped()).
+  for (std::size_t i = 0; i < nchans; ++i) {
+    const std::size_t chan = chans[i];
+    if (chan >= tx_rings_.size() || !tx_rings_[chan] || chan >= pools_.size() || !pools_[chan]) {
+      static uint64_t err_count = 0;
+      if (++err_count % 1000 == 1) {
+        std::fprintf(stderr, "[send_burst_multi] ERROR: Invalid channel %zu (tx_rings=%zu, pools=%zu)\n",
+                     chan, tx_rings_.size(), pools_.size());
       }
+      return tx_status::rejected;
     }
-    mbuf_cache_[chan].clear();
+    unsigned need = 0;
+    for (std::size_t j = 0; j < nchans; ++j) need += (chans[j] == chan);
+    if (rte_ring_free_count(tx_rings_[chan]) < need) return tx_status::would_block;
   }
-  mbuf_cache_.clear();
-}
 
-rte_mbuf* FlexSDRSecondary::get_mbuf_from_cache(size_t chan) {
-  if (chan >= mbuf_cache_.size()) {
-    return nullptr;
+  // Build every packet first; nothing is visible to consumers yet
+  for (std::size_t i = 0; i < nchans; ++i) {
+    const std::size_t chan = chans[i];
+    bool alloc_failed = false;
+    if (xb) {
+      mbufs[i] = xb->attach(pools_[chan], data[i], bytes, done[i], &alloc_failed);
+      attached[i] = mbufs[i] != nullptr;
+      if (attached[i]) continue;
+    }
+    rte_mbuf* m = alloc_failed ? nullptr : alloc_mbuf_(chan);
+    if (!m) {                    // pool empty: would block
+      drop(0, i);
+      return tx_status::would_block;
+    }
+    if (!data[i] || rte_pktmbuf_tailroom(m) < bytes) {
+      static uint64_t size_err_count = 0;
+      if (++size_err_count % 1000 == 1) {
+        std::fprintf(stderr, "[send_burst_multi] ERROR: bad buffer or packet too large (chan=%zu, need=%zu)\n",
+                     chan, bytes);
+      }
+      rte_pktmbuf_free(m);
+      drop(0, i);
+      return tx_status::rejected;
+    }
+    std::memcpy(rte_pktmbuf_mtod(m, char*), data[i], bytes);
+    m->data_len = static_cast<uint16_t>(bytes);
+    m->pkt_len = static_cast<uint32_t>(bytes);
+    mbufs[i] = m;
   }
-  
-  // Try to get from cache first
-  if (!mbuf_cache_[chan].empty()) {
-    rte_mbuf* m = mbuf_cache_[chan].front();
-    mbuf_cache_[chan].pop_front();
-    return m;
+
+  const uint64_t now = rte_get_tsc_cycles();
+  for (std::size_t i = 0; i < nchans; ++i) mbuf_stamp_set(mbufs[i], now);
+  for (std::size_t i = 0; i < nchans; ++i) {
+    if (rte_ring_enqueue(tx_rings_[chans[i]], mbufs[i]) != 0) {
+      // Only possible if another producer shares the ring
+      std::fprintf(stderr, "[send_burst_multi] ERROR: enqueue raced on ring %s (%zu/%zu sent)\n",
+                   tx_rings_[chans[i]]->name, i, nchans);
+      // The caller is told the burst failed, so no completion for the sent part
+      for (std::size_t k = 0; k < i; ++k) if (attached[k]) xb->forget(mbufs[k]);
+      drop(i, nchans);
+      return tx_status::would_block;
+    }
+    if (chans[i] < tx_ctr_.size() && tx_ctr_[chans[i]]) {
+      shm_queue_counters::add(tx_ctr_[chans[i]]->prod.pkts, 1);
+      shm_queue_counters::add(tx_ctr_[chans[i]]->prod.bytes, bytes);
+    }
   }
-  
-  // Cache empty - allocate new mbuf (fallback)
-  if (chan >= pools_.size() || !pools_[chan]) {
-    return nullptr;
+  for (std::size_t i = 0; i < nchans; ++i) {
+    if (chans[i] < tx_bp_.size() && tx_bp_[chans[i]])
+      shm_bp_update(tx_bp_[chans[i]], rte_ring_count(tx_rings_[chans[i]]));
   }
-  
-  return rte_pktmbuf_alloc(pools_[chan]);
+  // Copied packets no longer need the caller's buffers
+  for (std::size_t i = 0; done && i < nchans; ++i) {
+    if (!attached[i] && done[i].fn) done[i].fn(data[i], done[i].opaque);
+  }
+  return tx_status::sent;
 }
 
-void FlexSDRSecondary::return_mbuf_to_cache(size_t chan, rte_mbuf* m) {
-  if (!m || chan >= mbuf_cache_.size()) {
-    if (m) rte_pktmbuf_free(m);
-    return;
+bool FlexSDRSecondary::tx_would_block(const std::size_t* chans, std::size_t nchans) {
+  if (!link_->up()) return false;   // let the send report the dead link
+  for (std::size_t i = 0; i < nchans; ++i) {
+    const std::size_t chan = chans[i];
+    if (chan >= tx_rings_.size() || !tx_rings_[chan] || chan >= pools_.size() || !pools_[chan])
+      return false;
+    unsigned need = 0;
+    for (std::size_t j = 0; j < nchans; ++j) need += (chans[j] == chan);
+    if (rte_ring_free_count(tx_rings_[chan]) < need) return true;
+    // Lookup only: probing must not create a cache (or take cache_mtx_)
+    rte_mempool_cache* c = nullptr;
+    (void)thread_cache_(chan, &c, false);
+    if (c && c->len >= need) continue;
+    // Includes other lcores' caches: a hint, the send itself decides
+    if (rte_mempool_avail_count(pools_[chan]) < need) return true;
   }
-  
-  // If cache is full, free the mbuf instead of caching
-  if (mbuf_cache_[chan].size() >= MBUF_CACHE_SIZE) {
-    rte_pktmbuf_free(m);
-    return;
+  return false;
+}
+
+void FlexSDRSecondary::tx_dropped(const std::size_t* chans, std::size_t nchans) {
+  if (!link_->up()) return;
+  static uint64_t drop_count = 0;
+  const bool log = ++drop_count % 1000 == 1;
+  for (std::size_t i = 0; i < nchans; ++i) {
+    const std::size_t chan = chans[i];
+    if (chan >= tx_rings_.size() || !tx_rings_[chan] || chan >= pools_.size() || !pools_[chan])
+      continue;
+    rte_ring* r = tx_rings_[chan];
+    rte_mempool* pool = pools_[chan];
+    const bool full = rte_ring_free_count(r) == 0;
+    if (chan < tx_ctr_.size() && tx_ctr_[chan])
+      shm_queue_counters::add(full ? tx_ctr_[chan]->prod.drops : tx_ctr_[chan]->prod.alloc_fails, 1);
+    if (!log) continue;
+    if (full) {
+      std::fprintf(stderr, "[send_burst] dropped packet: ring %s full (capacity=%u) (%lu drops)\n",
+                   r->name, rte_ring_get_capacity(r), drop_count);
+    } else {
+      std::fprintf(stderr, "[send_burst] dropped packet: no mbufs (pool=%s, avail=%u, in_use=%u) (%lu drops)\n",
+                   pool->name, rte_mempool_avail_count(pool), rte_mempool_in_use_count(pool), drop_count);
+    }
   }
-  
-  // Return to cache for reuse
-  mbuf_cache_[chan].push_back(m);
+}
+
+bool FlexSDRSecondary::tx_backpressure(std::size_t chan) {
+  if (!link_->up()) return false;   // send_burst() reports the dead link
+  if (chan >= tx_bp_.size() || !shm_bp_asserted(tx_bp_[chan])) return false;
+  shm_bp_update(tx_bp_[chan], rte_ring_count(tx_rings_[chan]));
+  return shm_bp_asserted(tx_bp_[chan]);
+}
+
+std::size_t FlexSDRSecondary::max_burst_bytes(std::size_t chan) const {
+  if (chan >= pools_.size() || !pools_[chan]) return 0;
+  return rte_pktmbuf_data_room_size(pools_[chan]) - RTE_PKTMBUF_HEADROOM;
+}
+
+// --------------------------- per-thread mbuf caches ---------------------------
+
+struct FlexSDRSecondary::thread_caches {
+  struct entry {
+    const FlexSDRSecondary*         owner;
+    rte_mempool*                    mp;
+    rte_mempool_cache*              cache;    // nullptr: bypass
+    std::shared_ptr<PrimaryLink>    link;
+    std::shared_ptr<mbuf_cache_ctr> ctr;
+  };
+  std::vector<entry> v;
+
+  static void release(entry& e) {
+    if (!e.cache) return;
+    // Cached mbufs go back to the pool only while it is known to be alive
+    if (e.link->up()) rte_mempool_cache_flush(e.cache, e.mp);
+    rte_mempool_cache_free(e.cache);
+  }
+
+  // Drop the entries of destroyed instances, so a later instance at the
+  // same address never picks up their caches and a long-lived thread does
+  // not keep them
+  void prune() {
+    for (size_t i = 0; i < v.size();) {
+      if (!v[i].link->closed.load(std::memory_order_acquire)) { i++; continue; }
+      release(v[i]);
+      std::swap(v[i], v.back());
+      v.pop_back();
+    }
+  }
+
+  ~thread_caches() {
+    for (auto& e : v) release(e);
+  }
+};
+
+FlexSDRSecondary::mbuf_cache_ctr* FlexSDRSecondary::thread_cache_(size_t chan, rte_mempool_cache** cache,
+                                                                 bool create) {
+  static thread_local thread_caches tl;
+  rte_mempool* mp = pools_[chan];
+  for (const auto& e : tl.v) {
+    if (e.owner == this && e.link == link_ && e.mp == mp) {
+      *cache = e.cache;
+      return e.ctr.get();
+    }
+  }
+  if (!create) return nullptr;
+  tl.prune();
+
+  // First allocation from this pool on this thread. EAL lcores already have
+  // the pool's own per-lcore cache.
+  const unsigned size = chan < pool_cache_size_.size() ? pool_cache_size_[chan] : 0;
+  rte_mempool_cache* c = nullptr;
+  if (size && rte_lcore_id() == LCORE_ID_ANY) {
+    c = rte_mempool_cache_create(size, mp->socket_id);
+    if (!c) {
+      std::fprintf(stderr, "[secondary] mbuf cache for %s: create failed rte_errno=%d; allocating uncached\n",
+                   mp->name, rte_errno);
+    }
+  }
+  auto ctr = std::make_shared<mbuf_cache_ctr>();
+  ctr->pool = chan;
+  {
+    std::lock_guard<std::mutex> lk(cache_mtx_);
+    cache_ctrs_.push_back(ctr);
+  }
+  tl.v.push_back({this, mp, c, link_, ctr});
+  *cache = c;
+  return ctr.get();
+}
+
+rte_mbuf* FlexSDRSecondary::alloc_mbuf_(size_t chan) {
+  rte_mempool_cache* c = nullptr;
+  mbuf_cache_ctr* ctr = thread_cache_(chan, &c, true);
+  auto bump = [](std::atomic<uint64_t>& x) {
+    x.store(x.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  };
+
+  if (!c) {
+    bump(ctr->bypass);
+    return rte_pktmbuf_alloc(pools_[chan]);
+  }
+  // An empty cache is refilled with cache->size objects in one backend get
+  const bool hit = c->len > 0;
+  void* obj = nullptr;
+  if (rte_mempool_generic_get(pools_[chan], &obj, 1, c) < 0) return nullptr;
+  rte_mbuf* m = static_cast<rte_mbuf*>(obj);
+  rte_pktmbuf_reset(m);
+  bump(hit ? ctr->hits : ctr->refills);
+  return m;
 }
 
 } // namespace flexsdr
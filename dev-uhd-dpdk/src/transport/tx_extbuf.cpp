@@ -0,0 +1,139 @@
+#include "transport/tx_extbuf.hpp"
+#include "transport/dpdk_common.hpp"
+
+#include <cstdio>
+
+extern "C" {
+#include <rte_malloc.h>
+#include <rte_mbuf.h>
+#include <rte_memory.h>
+}
+
+namespace flexsdr {
+
+// Never called: we keep one reference on every shared info ourselves.
+static void extbuf_free_noop(void*, void*) {}
+
+TxExtbuf::~TxExtbuf() {
+  if (!shinfo_) return;
+  // No callbacks here: their owners may already be gone.
+  std::size_t held = 0;
+  for (std::size_t i = 0; i < count_; i++) held += !released_(fifo_[(head_ + i) % fifo_.size()]);
+  if (held) {
+    // The primary still holds these mbufs and will write to their shared
+    // infos when it frees them, so the array has to stay allocated.
+    std::fprintf(stderr, "[tx_extbuf] %zu buffers still in flight at teardown; "
+                         "leaking their shared infos\n", held);
+    return;
+  }
+  rte_free(shinfo_);
+}
+
+int TxExtbuf::init(unsigned slots, int socket_id) {
+  if (shinfo_) return 0;
+  if (!slots) return -1;
+  shinfo_ = static_cast<rte_mbuf_ext_shared_info*>(
+      rte_zmalloc_socket("flexsdr_tx_extbuf", sizeof(rte_mbuf_ext_shared_info) * slots,
+                         RTE_CACHE_LINE_SIZE, socket_id));
+  if (!shinfo_) {
+    std::fprintf(stderr, "[tx_extbuf] rte_zmalloc_socket(%u slots) failed\n", slots);
+    return -1;
+  }
+  meta_.assign(slots, slot_meta{});
+  free_.clear();
+  free_.reserve(slots);
+  fifo_.assign(slots, 0);
+  head_ = count_ = 0;
+  for (unsigned i = slots; i-- > 0;) {
+    shinfo_[i].free_cb = extbuf_free_noop;
+    shinfo_[i].fcb_opaque = nullptr;
+    free_.push_back(i);
+  }
+  std::fprintf(stderr, "[tx_extbuf] %u zero-copy slots on socket %d\n", slots, socket_id);
+  return 0;
+}
+
+bool TxExtbuf::eligible(const void* data, std::size_t bytes) {
+  // extbuf lengths are 16 bit
+  return bytes <= UINT16_MAX && dpdk_resident(data, bytes);
+}
+
+rte_mbuf* TxExtbuf::attach(rte_mempool* pool, const void* data, std::size_t bytes,
+                           const TxBackend::tx_done& done, bool* alloc_failed) {
+  if (alloc_failed) *alloc_failed = false;
+  if (!shinfo_ || !eligible(data, bytes)) return nullptr;
+  if (free_.empty() && reap_all_() == 0) return nullptr;
+
+  rte_mbuf* m = rte_pktmbuf_alloc(pool);
+  if (!m) {
+    if (alloc_failed) *alloc_failed = true;
+    return nullptr;
+  }
+
+  const uint32_t s = free_.back();
+  free_.pop_back();
+  rte_mbuf_ext_refcnt_set(&shinfo_[s], 2);   // mbuf + ours
+
+  void* va = const_cast<void*>(data);
+  rte_pktmbuf_attach_extbuf(m, va, rte_mem_virt2iova(va), static_cast<uint16_t>(bytes), &shinfo_[s]);
+  m->data_len = static_cast<uint16_t>(bytes);
+  m->pkt_len  = static_cast<uint32_t>(bytes);
+
+  meta_[s] = slot_meta{done, data};
+  fifo_[(head_ + count_++) % fifo_.size()] = s;
+  return m;
+}
+
+void TxExtbuf::cancel(rte_mbuf* m) {
+  // The slot stays queued and is recycled by reap() without a callback
+  const auto s = static_cast<uint32_t>(m->shinfo - shinfo_);
+  meta_[s] = slot_meta{};
+  rte_pktmbuf_free(m);   // drops the mbuf's reference only
+}
+
+void TxExtbuf::forget(rte_mbuf* m) {
+  meta_[static_cast<uint32_t>(m->shinfo - shinfo_)] = slot_meta{};
+}
+
+bool TxExtbuf::released_(uint32_t s) const {
+  return rte_mbuf_ext_refcnt_read(&shinfo_[s]) == 1;
+}
+
+void TxExtbuf::complete_(uint32_t s) {
+  const slot_meta md = meta_[s];
+  meta_[s] = slot_meta{};
+  free_.push_back(s);
+  if (md.done.fn) md.done.fn(md.data, md.done.opaque);
+}
+
+std::size_t TxExtbuf::reap() {
+  std::size_t n = 0;
+  while (count_ && released_(fifo_[head_])) {
+    const uint32_t s = fifo_[head_];
+    head_ = (head_ + 1) % fifo_.size();
+    count_--;
+    complete_(s);
+    n++;
+  }
+  return n;
+}
+
+std::size_t TxExtbuf::reap_all_() {
+  // Rings drain independently, so a later buffer can be free while an older
+  // one on another channel is still queued.
+  const std::size_t cap = fifo_.size();
+  std::size_t n = 0, kept = 0;
+  for (std::size_t i = 0; i < count_; i++) {
+    const uint32_t s = fifo_[(head_ + i) % cap];
+    if (released_(s)) {
+      complete_(s);
+      n++;
+    } else {
+      fifo_[(head_ + kept++) % cap] = s;
+    }
+  }
+  count_ = kept;
+  return n;
+}
+
+} // namespace flexsdr
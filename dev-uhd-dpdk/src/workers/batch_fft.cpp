@@ -0,0 +1,132 @@
+#include "workers/batch_fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace flexsdr {
+
+namespace {
+
+// Four lanes of floats; one SSE2 register when available.
+#if defined(__SSE2__)
+struct v4 {
+  __m128 v;
+};
+inline v4 load(const float* p)          { return {_mm_load_ps(p)}; }
+inline void store(float* p, v4 a)       { _mm_store_ps(p, a.v); }
+inline v4 splat(float x)                { return {_mm_set1_ps(x)}; }
+inline v4 operator+(v4 a, v4 b)         { return {_mm_add_ps(a.v, b.v)}; }
+inline v4 operator-(v4 a, v4 b)         { return {_mm_sub_ps(a.v, b.v)}; }
+inline v4 operator*(v4 a, v4 b)         { return {_mm_mul_ps(a.v, b.v)}; }
+#else
+struct v4 {
+  float v[4];
+};
+inline v4 load(const float* p)          { return {{p[0], p[1], p[2], p[3]}}; }
+inline void store(float* p, v4 a)       { for (int k = 0; k < 4; k++) p[k] = a.v[k]; }
+inline v4 splat(float x)                { return {{x, x, x, x}}; }
+inline v4 operator+(v4 a, v4 b)         { for (int k = 0; k < 4; k++) a.v[k] += b.v[k]; return a; }
+inline v4 operator-(v4 a, v4 b)         { for (int k = 0; k < 4; k++) a.v[k] -= b.v[k]; return a; }
+inline v4 operator*(v4 a, v4 b)         { for (int k = 0; k < 4; k++) a.v[k] *= b.v[k]; return a; }
+#endif
+
+static_assert(BatchFft::kLanes == 4, "v4 holds one element of each lane");
+
+} // namespace
+
+BatchFft::BatchFft(size_t n) {
+  n = std::clamp<size_t>(n, 16, 65536);
+  n_ = size_t(1) << static_cast<unsigned>(std::log2(static_cast<double>(n)));
+
+  // Radix-4 decimation in frequency while the span allows, radix-2 last.
+  for (size_t span = n_; span >= 4; span /= 4) {
+    const size_t q = span / 4;
+    stages_.push_back({q, tw_.size()});
+    for (size_t j = 0; j < q; j++) {
+      for (int m = 1; m <= 3; m++) {
+        const double a = -2.0 * M_PI * double(m * j) / double(span);
+        tw_.push_back(static_cast<float>(std::cos(a)));
+        tw_.push_back(static_cast<float>(std::sin(a)));
+      }
+    }
+    if (q == 2) stages_.push_back({0, 0});
+  }
+
+  // Output position p = sum r_s * q_s holds bin sum r_s * (product of
+  // earlier radices): the stage digits, reversed.
+  perm_.resize(n_);
+  for (size_t p = 0; p < n_; p++) {
+    size_t k = 0, mult = 1, span = n_;
+    while (span > 1) {
+      const size_t radix = span >= 4 ? 4 : 2;
+      const size_t q = span / radix;
+      k += ((p / q) % radix) * mult;
+      mult *= radix;
+      span = q;
+    }
+    perm_[p] = static_cast<uint32_t>(k);
+  }
+}
+
+void BatchFft::forward(float* re, float* im) const {
+  constexpr size_t W = kLanes;
+
+  for (const stage& s : stages_) {
+    if (s.quarter == 0) {
+      for (size_t g = 0; g < n_; g += 2) {
+        float* r = re + g * W;
+        float* i = im + g * W;
+        const v4 r0 = load(r), r1 = load(r + W);
+        const v4 i0 = load(i), i1 = load(i + W);
+        store(r, r0 + r1);
+        store(i, i0 + i1);
+        store(r + W, r0 - r1);
+        store(i + W, i0 - i1);
+      }
+      continue;
+    }
+
+    const size_t q = s.quarter;
+    const size_t span = 4 * q;
+    const float* tw = tw_.data() + s.tw;
+    for (size_t j = 0; j < q; j++, tw += 6) {
+      const v4 w1r = splat(tw[0]), w1i = splat(tw[1]);
+      const v4 w2r = splat(tw[2]), w2i = splat(tw[3]);
+      const v4 w3r = splat(tw[4]), w3i = splat(tw[5]);
+
+      for (size_t g = j; g < n_; g += span) {
+        float* r = re + g * W;
+        float* i = im + g * W;
+        const v4 x0r = load(r),             x0i = load(i);
+        const v4 x1r = load(r + q * W),     x1i = load(i + q * W);
+        const v4 x2r = load(r + 2 * q * W), x2i = load(i + 2 * q * W);
+        const v4 x3r = load(r + 3 * q * W), x3i = load(i + 3 * q * W);
+
+        // a3 = -j * (x1 - x3)
+        const v4 a0r = x0r + x2r, a0i = x0i + x2i;
+        const v4 a1r = x0r - x2r, a1i = x0i - x2i;
+        const v4 a2r = x1r + x3r, a2i = x1i + x3i;
+        const v4 a3r = x1i - x3i, a3i = x3r - x1r;
+
+        const v4 y1r = a1r + a3r, y1i = a1i + a3i;
+        const v4 y2r = a0r - a2r, y2i = a0i - a2i;
+        const v4 y3r = a1r - a3r, y3i = a1i - a3i;
+
+        store(r, a0r + a2r);
+        store(i, a0i + a2i);
+        store(r + q * W,     y1r * w1r - y1i * w1i);
+        store(i + q * W,     y1r * w1i + y1i * w1r);
+        store(r + 2 * q * W, y2r * w2r - y2i * w2i);
+        store(i + 2 * q * W, y2r * w2i + y2i * w2r);
+        store(r + 3 * q * W, y3r * w3r - y3i * w3i);
+        store(i + 3 * q * W, y3r * w3i + y3i * w3r);
+      }
+    }
+  }
+}
+
+} // namespace flexsdr
@@ -0,0 +1,323 @@
+#include "workers/iq_playback.hpp"
+#include "transport/flexsdr_secondary.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <time.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// DPDK (must be in extern "C" block)
+extern "C" {
+#include <rte_config.h>
+#include <rte_cycles.h>
+#include <rte_mbuf.h>
+#include <rte_mempool.h>
+#include <rte_pause.h>
+#include <rte_ring.h>
+}
+
+namespace flexsdr {
+
+static constexpr unsigned kMaxBurst = 64;
+
+static bool ends_with_(const std::string& s, const char* suffix) {
+  const size_t n = std::strlen(suffix);
+  return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+// Minimal lookup of a numeric SigMF global field ("core:sample_rate": 30720000).
+static bool json_number_(const std::string& text, const char* key, double& out) {
+  const std::string k = std::string("\"") + key + "\"";
+  size_t p = text.find(k);
+  if (p == std::string::npos) return false;
+  p = text.find(':', p + k.size());
+  if (p == std::string::npos) return false;
+  char* end = nullptr;
+  const double v = std::strtod(text.c_str() + p + 1, &end);
+  if (end == text.c_str() + p + 1) return false;
+  out = v;
+  return true;
+}
+
+IqPlayback::IqPlayback(FlexSDRSecondary& sec, options opt)
+  : sec_(sec), opt_(std::move(opt)) {
+  opt_.burst = std::clamp(opt_.burst, 1u, kMaxBurst);
+  if (opt_.rate_multiplier <= 0.0) opt_.rate_multiplier = 1.0;
+}
+
+IqPlayback::~IqPlayback() {
+  stop();
+  unmap_();
+}
+
+IqPlayback::stats IqPlayback::get_stats() const {
+  stats s{};
+  s.packets          = packets_.load(std::memory_order_relaxed);
+  s.samples          = samples_.load(std::memory_order_relaxed);
+  s.loops            = loops_.load(std::memory_order_relaxed);
+  s.ring_full_drops  = ring_full_drops_.load(std::memory_order_relaxed);
+  s.mbuf_alloc_fails = alloc_fails_.load(std::memory_order_relaxed);
+  s.late_bursts      = late_bursts_.load(std::memory_order_relaxed);
+  return s;
+}
+
+// --------------------------- setup --------------------------------------------
+
+int IqPlayback::resolve_() {
+  ring_ = sec_.rx_ring_by_name(opt_.ring_name);
+  if (!ring_) {
+    std::fprintf(stderr, "[playback] ERROR: ring %s not in secondary lookup table\n", opt_.ring_name.c_str());
+    return -2;
+  }
+  pool_ = sec_.pool_by_name(opt_.pool_name);
+  if (!pool_) {
+    std::fprintf(stderr, "[playback] ERROR: pool %s not in secondary lookup table\n", opt_.pool_name.c_str());
+    return -2;
+  }
+
+  const size_t need = opt_.vrt_hdr_bytes + pkt_bytes_;
+  const size_t room = rte_pktmbuf_data_room_size(pool_) - RTE_PKTMBUF_HEADROOM;
+  if (need > room) {
+    std::fprintf(stderr, "[playback] ERROR: packet (%zu bytes) exceeds mbuf room of %s (%zu bytes)\n",
+                 need, opt_.pool_name.c_str(), room);
+    return -3;
+  }
+  if (opt_.vrt_hdr_bytes && opt_.tsf_offset + sizeof(uint64_t) > opt_.vrt_hdr_bytes) {
+    std::fprintf(stderr, "[playback] ERROR: tsf_offset %zu outside %zu-byte header\n",
+                 opt_.tsf_offset, opt_.vrt_hdr_bytes);
+    return -3;
+  }
+  return 0;
+}
+
+int IqPlayback::read_meta_(const std::string& meta_path) {
+  std::ifstream in(meta_path);
+  if (!in) return -1;
+  std::stringstream ss;
+  ss << in.rdbuf();
+  const std::string text = ss.str();
+
+  if (text.find("ci16_le") == std::string::npos) {
+    std::fprintf(stderr, "[playback] ERROR: %s: only core:datatype ci16_le is supported\n", meta_path.c_str());
+    return -3;
+  }
+
+  double v = 0.0;
+  if (opt_.sample_rate <= 0.0 && json_number_(text, "core:sample_rate", v)) opt_.sample_rate = v;
+  if (opt_.num_channels == 0 && json_number_(text, "core:num_channels", v)) opt_.num_channels = static_cast<unsigned>(v);
+  return 0;
+}
+
+int IqPlayback::map_file_(const std::string& data_path) {
+  const int fd = ::open(data_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    std::fprintf(stderr, "[playback] ERROR: open %s failed: %s\n", data_path.c_str(), std::strerror(errno));
+    return -1;
+  }
+  struct stat st{};
+  if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+    std::fprintf(stderr, "[playback] ERROR: %s is empty or unreadable\n", data_path.c_str());
+    ::close(fd);
+    return -1;
+  }
+
+  // Pre-fault the whole trace: page faults on the pacing thread show up as
+  // late bursts.
+  void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED) {
+    std::fprintf(stderr, "[playback] ERROR: mmap %s failed: %s\n", data_path.c_str(), std::strerror(errno));
+    return -1;
+  }
+  (void)::madvise(p, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+
+  map_       = static_cast<const uint8_t*>(p);
+  map_bytes_ = static_cast<size_t>(st.st_size);
+  return 0;
+}
+
+void IqPlayback::unmap_() {
+  if (map_) {
+    ::munmap(const_cast<uint8_t*>(map_), map_bytes_);
+    map_ = nullptr;
+    map_bytes_ = 0;
+  }
+}
+
+// --------------------------- lifecycle ---------------------------------------
+
+int IqPlayback::start() {
+  if (running()) return 0;
+
+  std::string data_path = opt_.path;
+  if (ends_with_(opt_.path, ".sigmf-meta") || ends_with_(opt_.path, ".sigmf-data")) {
+    const std::string base = opt_.path.substr(0, opt_.path.size() - std::strlen(".sigmf-data"));
+    data_path = base + ".sigmf-data";
+    if (int rc = read_meta_(base + ".sigmf-meta"); rc == -3) return rc;
+  }
+  if (opt_.sample_rate <= 0.0) opt_.sample_rate = 30.72e6;
+  if (opt_.num_channels == 0) opt_.num_channels = 1;
+
+  frame_bytes_ = 4u * opt_.num_channels;
+  pkt_bytes_   = static_cast<size_t>(opt_.spp) * frame_bytes_;
+
+  if (int rc = map_file_(data_path); rc) return rc;
+  if (map_bytes_ < frame_bytes_) {
+    std::fprintf(stderr, "[playback] ERROR: %s holds less than one sample\n", data_path.c_str());
+    unmap_();
+    return -1;
+  }
+  if (int rc = resolve_(); rc) {
+    unmap_();
+    return rc;
+  }
+
+  pos_ = 0;
+  tsf_ = 0;
+  finished_.store(false, std::memory_order_relaxed);
+  stop_req_.store(false, std::memory_order_relaxed);
+  running_.store(true, std::memory_order_release);
+  worker_ = std::thread(&IqPlayback::run_, this);
+
+  if (opt_.cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(opt_.cpu, &set);
+    if (pthread_setaffinity_np(worker_.native_handle(), sizeof(set), &set) != 0) {
+      std::fprintf(stderr, "[playback] WARNING: could not pin playback thread to cpu %d\n", opt_.cpu);
+    }
+  }
+
+  std::fprintf(stderr, "[playback] %s -> %s (pool=%s, %zu samples, %.3f Msps x%.2f, spp=%u, ch=%u%s)\n",
+               data_path.c_str(), opt_.ring_name.c_str(), opt_.pool_name.c_str(),
+               map_bytes_ / frame_bytes_, opt_.sample_rate / 1e6, opt_.rate_multiplier,
+               opt_.spp, opt_.num_channels, opt_.loop ? ", loop" : "");
+  return 0;
+}
+
+void IqPlayback::stop() {
+  stop_req_.store(true, std::memory_order_release);
+  if (worker_.joinable()) worker_.join();
+  running_.store(false, std::memory_order_release);
+}
+
+// --------------------------- playback thread ---------------------------------
+
+unsigned IqPlayback::fill_burst_(unsigned n) {
+  rte_mbuf* pkts[kMaxBurst];
+  if (rte_pktmbuf_alloc_bulk(pool_, pkts, n) != 0) {
+    alloc_fails_.fetch_add(n, std::memory_order_relaxed);
+    return 0;
+  }
+
+  unsigned built = 0;
+  for (; built < n; built++) {
+    if (pos_ >= map_bytes_) break;   // non-loop end of file
+
+    rte_mbuf* m = pkts[built];
+    uint8_t* dst = rte_pktmbuf_mtod(m, uint8_t*);
+    if (opt_.vrt_hdr_bytes) {
+      std::memset(dst, 0, opt_.vrt_hdr_bytes);
+      std::memcpy(dst + opt_.tsf_offset, &tsf_, sizeof(tsf_));
+      dst += opt_.vrt_hdr_bytes;
+    }
+
+    // A packet may straddle the end of the file: wrap when looping,
+    // zero-pad the final packet otherwise.
+    size_t left = pkt_bytes_;
+    while (left) {
+      const size_t c = std::min(left, map_bytes_ - pos_);
+      std::memcpy(dst, map_ + pos_, c);
+      dst  += c;
+      left -= c;
+      pos_ += c;
+      if (pos_ >= map_bytes_) {
+        if (!opt_.loop) {
+          std::memset(dst, 0, left);
+          break;
+        }
+        pos_ = 0;
+        loops_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    m->data_len = static_cast<uint16_t>(opt_.vrt_hdr_bytes + pkt_bytes_);
+    m->pkt_len  = m->data_len;
+    tsf_ += opt_.spp;
+  }
+
+  if (built < n) {
+    rte_pktmbuf_free_bulk(pkts + built, n - built);
+  }
+  if (!built) return 0;
+
+  unsigned sent = 0;
+  for (;;) {
+    sent += rte_ring_enqueue_burst(ring_, reinterpret_cast<void* const*>(pkts + sent), built - sent, nullptr);
+    if (sent == built || !opt_.block_on_full || stop_req_.load(std::memory_order_relaxed)) break;
+    rte_pause();
+  }
+  if (sent < built) {
+    ring_full_drops_.fetch_add(built - sent, std::memory_order_relaxed);
+    rte_pktmbuf_free_bulk(pkts + sent, built - sent);
+  }
+
+  packets_.fetch_add(built, std::memory_order_relaxed);
+  samples_.fetch_add(static_cast<uint64_t>(built) * opt_.spp, std::memory_order_relaxed);
+  return built;
+}
+
+void IqPlayback::run_() {
+  const double tsc_hz = static_cast<double>(rte_get_tsc_hz());
+  const double period = tsc_hz * opt_.burst * opt_.spp / (opt_.sample_rate * opt_.rate_multiplier);
+  const uint64_t sleep_threshold = static_cast<uint64_t>(tsc_hz * 200e-6);   // sleep if >200us early
+
+  double next = static_cast<double>(rte_rdtsc());
+
+  while (!stop_req_.load(std::memory_order_acquire)) {
+    const uint64_t now = rte_rdtsc();
+    const uint64_t due = static_cast<uint64_t>(next);
+
+    if (now < due) {
+      const uint64_t early = due - now;
+      if (early > sleep_threshold) {
+        // Sleep most of the gap, spin the rest for accurate release.
+        const double ns = (early - sleep_threshold / 2) * 1e9 / tsc_hz;
+        timespec ts{static_cast<time_t>(ns / 1e9), static_cast<long>(std::fmod(ns, 1e9))};
+        nanosleep(&ts, nullptr);
+      } else {
+        rte_pause();
+      }
+      continue;
+    }
+
+    if (now - due > static_cast<uint64_t>(period)) {
+      late_bursts_.fetch_add(1, std::memory_order_relaxed);
+      // Far behind (descheduled): resync instead of releasing a catch-up storm.
+      if (now - due > static_cast<uint64_t>(period * 64)) next = static_cast<double>(now);
+    }
+
+    (void)fill_burst_(opt_.burst);
+    if (!opt_.loop && pos_ >= map_bytes_) {
+      finished_.store(true, std::memory_order_release);
+      std::fprintf(stderr, "[playback] end of file after %lu packets\n",
+                   packets_.load(std::memory_order_relaxed));
+      break;
+    }
+    next += period;
+  }
+}
+
+} // namespace flexsdr
@@ -0,0 +1,430 @@
+#include "workers/iq_recorder.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#ifdef FLEXSDR_HAVE_LIBURING
+#include <liburing.h>
+#endif
+
+// DPDK (must be in extern "C" block)
+extern "C" {
+#include <rte_config.h>
+#include <rte_mbuf.h>
+#include <rte_ring.h>
+}
+
+namespace flexsdr {
+
+// O_DIRECT wants offset, length and buffer aligned to the logical block size;
+// 4 KiB covers every device we record to.
+static constexpr size_t kDirectAlign = 4096;
+
+struct IqRecorder::io_backend {
+#ifdef FLEXSDR_HAVE_LIBURING
+  io_uring ring{};
+  bool     ring_ok  = false;
+  bool     fixed_ok = false;   // buffers registered -> write_fixed
+#endif
+};
+
+IqRecorder::IqRecorder(options opt)
+  : opt_(std::move(opt)), io_(new io_backend{}) {
+  opt_.block_bytes = std::max(kDirectAlign, opt_.block_bytes / kDirectAlign * kDirectAlign);
+  opt_.num_blocks  = std::max(2u, opt_.num_blocks);
+  opt_.dequeue_burst = std::max(1u, opt_.dequeue_burst);
+  opt_.num_channels  = std::max(1u, opt_.num_channels);
+}
+
+IqRecorder::~IqRecorder() {
+  stop();
+}
+
+IqRecorder::stats IqRecorder::get_stats() const {
+  stats s{};
+  s.packets         = packets_.load(std::memory_order_relaxed);
+  s.bytes           = bytes_.load(std::memory_order_relaxed);
+  s.tap_drops       = ctl_ ? ctl_->drops.load(std::memory_order_relaxed) : 0;
+  s.write_errors    = write_errors_.load(std::memory_order_relaxed);
+  s.discontinuities = discontinuities_.load(std::memory_order_relaxed);
+  return s;
+}
+
+// --------------------------- lifecycle ---------------------------------------
+
+int IqRecorder::start() {
+  if (running()) return 0;
+  if (opt_.path_base.empty()) {
+    std::fprintf(stderr, "[recorder] ERROR: empty output path\n");
+    return -1;
+  }
+
+  tap_ = iq_tap_open(opt_.tap_name, opt_.tap_ring_size, &ctl_);
+  if (!tap_) return -2;
+
+  // Clones left over from a previous session belong to no capture.
+  if (unsigned stale = iq_tap_drain(tap_)) {
+    std::fprintf(stderr, "[recorder] released %u stale clones on %s\n", stale, opt_.tap_name.c_str());
+  }
+
+  if (int rc = open_data_(); rc) return rc;
+  if (int rc = init_io_(); rc) {
+    ::close(fd_);
+    fd_ = -1;
+    return rc;
+  }
+
+  char ts[32];
+  const std::time_t now = std::time(nullptr);
+  std::tm tm_utc{};
+  gmtime_r(&now, &tm_utc);
+  std::strftime(ts, sizeof(ts), "%Y-%m-%dT%H:%M:%SZ", &tm_utc);
+  datetime_ = ts;
+
+  cur_ = 0;
+  inflight_ = 0;
+  file_off_ = 0;
+  data_bytes_ = 0;
+  captures_.clear();
+  have_tsf_ = false;
+
+  stop_req_.store(false, std::memory_order_relaxed);
+  running_.store(true, std::memory_order_release);
+  worker_ = std::thread(&IqRecorder::writer_loop_, this);
+
+  if (opt_.cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(opt_.cpu, &set);
+    if (pthread_setaffinity_np(worker_.native_handle(), sizeof(set), &set) != 0) {
+      std::fprintf(stderr, "[recorder] WARNING: could not pin writer to cpu %d\n", opt_.cpu);
+    }
+  }
+
+  iq_tap_set_active(ctl_, true);
+  std::fprintf(stderr, "[recorder] recording %s -> %s.sigmf-data (block=%zu x %u, %s, %s)\n",
+               opt_.tap_name.c_str(), opt_.path_base.c_str(), opt_.block_bytes, opt_.num_blocks,
+               direct_ ? "O_DIRECT" : "buffered",
+#ifdef FLEXSDR_HAVE_LIBURING
+               io_->ring_ok ? "io_uring" : "pwrite"
+#else
+               "pwrite"
+#endif
+               );
+  return 0;
+}
+
+void IqRecorder::stop() {
+  if (!running()) return;
+
+  // Producers stop cloning first; the writer then drains what is queued.
+  iq_tap_set_active(ctl_, false);
+  stop_req_.store(true, std::memory_order_release);
+  if (worker_.joinable()) worker_.join();
+
+  (void)write_meta_();
+  fini_io_();
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  running_.store(false, std::memory_order_release);
+
+  const stats s = get_stats();
+  std::fprintf(stderr, "[recorder] stopped: packets=%lu bytes=%lu tap_drops=%lu write_errors=%lu gaps=%lu\n",
+               s.packets, s.bytes, s.tap_drops, s.write_errors, s.discontinuities);
+}
+
+// --------------------------- file / io setup ---------------------------------
+
+int IqRecorder::open_data_() {
+  const std::string path = opt_.path_base + ".sigmf-data";
+  const int base_flags = O_WRONLY | O_CREAT | O_TRUNC;
+
+  direct_ = false;
+  if (opt_.direct_io) {
+    fd_ = ::open(path.c_str(), base_flags | O_DIRECT, 0644);
+    if (fd_ >= 0) {
+      direct_ = true;
+      return 0;
+    }
+    // tmpfs and friends reject O_DIRECT with EINVAL; fall back to buffered.
+    std::fprintf(stderr, "[recorder] O_DIRECT unavailable for %s (%s), using buffered IO\n",
+                 path.c_str(), std::strerror(errno));
+  }
+
+  fd_ = ::open(path.c_str(), base_flags, 0644);
+  if (fd_ < 0) {
+    std::fprintf(stderr, "[recorder] ERROR: open %s failed: %s\n", path.c_str(), std::strerror(errno));
+    return -3;
+  }
+  return 0;
+}
+
+int IqRecorder::init_io_() {
+  blocks_.assign(opt_.num_blocks, block{});
+  for (auto& b : blocks_) {
+    if (posix_memalign(reinterpret_cast<void**>(&b.buf), kDirectAlign, opt_.block_bytes) != 0) {
+      std::fprintf(stderr, "[recorder] ERROR: block allocation failed (%zu bytes)\n", opt_.block_bytes);
+      fini_io_();
+      return -4;
+    }
+  }
+
+#ifdef FLEXSDR_HAVE_LIBURING
+  if (io_uring_queue_init(opt_.num_blocks, &io_->ring, 0) == 0) {
+    io_->ring_ok = true;
+    std::vector<iovec> iov(blocks_.size());
+    for (size_t i = 0; i < blocks_.size(); i++) {
+      iov[i].iov_base = blocks_[i].buf;
+      iov[i].iov_len  = opt_.block_bytes;
+    }
+    io_->fixed_ok = (io_uring_register_buffers(&io_->ring, iov.data(), iov.size()) == 0);
+  } else {
+    std::fprintf(stderr, "[recorder] io_uring unavailable, using pwrite\n");
+  }
+#endif
+  return 0;
+}
+
+void IqRecorder::fini_io_() {
+#ifdef FLEXSDR_HAVE_LIBURING
+  if (io_->ring_ok) {
+    if (io_->fixed_ok) io_uring_unregister_buffers(&io_->ring);
+    io_uring_queue_exit(&io_->ring);
+    io_->ring_ok = false;
+    io_->fixed_ok = false;
+  }
+#endif
+  for (auto& b : blocks_) {
+    std::free(b.buf);
+    b.buf = nullptr;
+  }
+  blocks_.clear();
+}
+
+// --------------------------- writer thread -----------------------------------
+
+void IqRecorder::writer_loop_() {
+  std::vector<void*> burst(opt_.dequeue_burst);
+
+  for (;;) {
+    const unsigned n = rte_ring_dequeue_burst(tap_, burst.data(), opt_.dequeue_burst, nullptr);
+    for (unsigned i = 0; i < n; i++) {
+      consume_(static_cast<rte_mbuf*>(burst[i]));
+    }
+
+    if (inflight_) reap_(false);
+
+    if (n == 0) {
+      // Producers are already inactive when stop is requested, so an empty
+      // ring here means everything has been consumed.
+      if (stop_req_.load(std::memory_order_acquire)) break;
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+  }
+
+  flush_tail_();
+}
+
+void IqRecorder::consume_(rte_mbuf* m) {
+  const size_t len = rte_pktmbuf_data_len(m);
+  if (len <= opt_.vrt_hdr_bytes) {
+    rte_pktmbuf_free(m);
+    return;
+  }
+
+  const size_t payload = len - opt_.vrt_hdr_bytes;
+  const uint64_t frame_bytes = 4ull * opt_.num_channels;   // sc16 per channel
+
+  if (opt_.parse_tsf && opt_.tsf_offset + sizeof(uint64_t) <= opt_.vrt_hdr_bytes) {
+    uint64_t tsf;
+    std::memcpy(&tsf, rte_pktmbuf_mtod_offset(m, const uint8_t*, opt_.tsf_offset), sizeof(tsf));
+    if (!have_tsf_ || tsf != next_tsf_) {
+      if (have_tsf_) discontinuities_.fetch_add(1, std::memory_order_relaxed);
+      captures_.push_back({data_bytes_ / frame_bytes, tsf});
+      have_tsf_ = true;
+    }
+    next_tsf_ = tsf + payload / frame_bytes;
+  } else if (captures_.empty()) {
+    captures_.push_back({0, 0});
+  }
+
+  append_(rte_pktmbuf_mtod_offset(m, const uint8_t*, opt_.vrt_hdr_bytes), payload);
+  rte_pktmbuf_free(m);   // our clone only
+
+  packets_.fetch_add(1, std::memory_order_relaxed);
+  bytes_.fetch_add(payload, std::memory_order_relaxed);
+}
+
+void IqRecorder::append_(const uint8_t* src, size_t len) {
+  while (len) {
+    block& b = blocks_[cur_];
+    const size_t c = std::min(opt_.block_bytes - b.fill, len);
+    std::memcpy(b.buf + b.fill, src, c);
+    b.fill += c;
+    src += c;
+    len -= c;
+    data_bytes_ += c;
+
+    if (b.fill == opt_.block_bytes) {
+      submit_block_(cur_);
+      cur_ = next_free_block_();
+    }
+  }
+}
+
+void IqRecorder::submit_block_(unsigned idx) {
+  block& b = blocks_[idx];
+
+  // Only the final block can be short; pad it so O_DIRECT accepts it and
+  // trim the file to the exact payload size in flush_tail_().
+  if (direct_ && (b.fill % kDirectAlign)) {
+    const size_t padded = RTE_ALIGN_CEIL(b.fill, kDirectAlign);
+    std::memset(b.buf + b.fill, 0, padded - b.fill);
+    b.fill = padded;
+  }
+
+  const uint64_t off = file_off_;
+  file_off_ += b.fill;
+
+#ifdef FLEXSDR_HAVE_LIBURING
+  if (io_->ring_ok) {
+    io_uring_sqe* sqe = io_uring_get_sqe(&io_->ring);
+    while (!sqe) {
+      reap_(true);
+      sqe = io_uring_get_sqe(&io_->ring);
+    }
+    if (io_->fixed_ok) {
+      io_uring_prep_write_fixed(sqe, fd_, b.buf, static_cast<unsigned>(b.fill), off, static_cast<int>(idx));
+    } else {
+      io_uring_prep_write(sqe, fd_, b.buf, static_cast<unsigned>(b.fill), off);
+    }
+    io_uring_sqe_set_data(sqe, reinterpret_cast<void*>(static_cast<uintptr_t>(idx)));
+    io_uring_submit(&io_->ring);
+    b.inflight = true;
+    inflight_++;
+    return;
+  }
+#endif
+
+  size_t done = 0;
+  while (done < b.fill) {
+    const ssize_t w = ::pwrite(fd_, b.buf + done, b.fill - done, static_cast<off_t>(off + done));
+    if (w < 0 && errno == EINTR) continue;
+    if (w <= 0) break;
+    done += static_cast<size_t>(w);
+  }
+  complete_block_(idx, static_cast<long>(done));
+}
+
+void IqRecorder::complete_block_(unsigned idx, long res) {
+  block& b = blocks_[idx];
+  if (res < 0 || static_cast<size_t>(res) != b.fill) {
+    const uint64_t e = write_errors_.fetch_add(1, std::memory_order_relaxed);
+    if (e % 100 == 0) {
+      std::fprintf(stderr, "[recorder] ERROR: short/failed write (res=%ld want=%zu) %s\n",
+                   res, b.fill, res < 0 ? std::strerror(static_cast<int>(-res)) : "");
+    }
+  }
+  b.fill = 0;
+  b.inflight = false;
+}
+
+bool IqRecorder::reap_(bool wait) {
+#ifdef FLEXSDR_HAVE_LIBURING
+  if (!io_->ring_ok || !inflight_) return false;
+
+  bool any = false;
+  io_uring_cqe* cqe = nullptr;
+  while (inflight_) {
+    const int rc = (wait && !any) ? io_uring_wait_cqe(&io_->ring, &cqe)
+                                  : io_uring_peek_cqe(&io_->ring, &cqe);
+    if (rc != 0 || !cqe) break;
+    const auto idx = static_cast<unsigned>(reinterpret_cast<uintptr_t>(io_uring_cqe_get_data(cqe)));
+    const long res = cqe->res;
+    io_uring_cqe_seen(&io_->ring, cqe);
+    complete_block_(idx, res);
+    inflight_--;
+    any = true;
+  }
+  return any;
+#else
+  (void)wait;
+  return false;
+#endif
+}
+
+unsigned IqRecorder::next_free_block_() {
+  for (;;) {
+    for (unsigned i = 1; i <= blocks_.size(); i++) {
+      const unsigned idx = (cur_ + i) % blocks_.size();
+      if (!blocks_[idx].inflight && blocks_[idx].fill == 0) return idx;
+    }
+    // Disk is behind: stall the writer (never the live path; the tap ring
+    // absorbs the burst or counts drops).
+    reap_(true);
+  }
+}
+
+void IqRecorder::flush_tail_() {
+  if (!blocks_.empty() && blocks_[cur_].fill) {
+    submit_block_(cur_);
+  }
+  while (inflight_) reap_(true);
+
+  // Remove O_DIRECT tail padding.
+  if (fd_ >= 0 && file_off_ != data_bytes_) {
+    if (::ftruncate(fd_, static_cast<off_t>(data_bytes_)) != 0) {
+      std::fprintf(stderr, "[recorder] WARNING: ftruncate failed: %s\n", std::strerror(errno));
+    }
+  }
+}
+
+// --------------------------- SigMF metadata ----------------------------------
+
+int IqRecorder::write_meta_() {
+  const std::string path = opt_.path_base + ".sigmf-meta";
+  std::FILE* f = std::fopen(path.c_str(), "w");
+  if (!f) {
+    std::fprintf(stderr, "[recorder] ERROR: open %s failed: %s\n", path.c_str(), std::strerror(errno));
+    return -1;
+  }
+
+  std::fprintf(f, "{\n  \"global\": {\n");
+  std::fprintf(f, "    \"core:datatype\": \"ci16_le\",\n");
+  std::fprintf(f, "    \"core:sample_rate\": %.17g,\n", opt_.sample_rate);
+  std::fprintf(f, "    \"core:num_channels\": %u,\n", opt_.num_channels);
+  std::fprintf(f, "    \"core:version\": \"1.0.0\",\n");
+  std::fprintf(f, "    \"core:recorder\": \"flexsdr iq_recorder (%s)\",\n", opt_.tap_name.c_str());
+  if (!opt_.description.empty()) {
+    std::fprintf(f, "    \"core:description\": \"%s\",\n", opt_.description.c_str());
+  }
+  std::fprintf(f, "    \"core:extensions\": [ { \"name\": \"flexsdr\", \"version\": \"1.0.0\", \"optional\": true } ]\n");
+  std::fprintf(f, "  },\n  \"captures\": [\n");
+
+  if (captures_.empty()) captures_.push_back({0, 0});
+  for (size_t i = 0; i < captures_.size(); i++) {
+    std::fprintf(f, "    { \"core:sample_start\": %lu, \"core:frequency\": %.17g, ",
+                 captures_[i].sample_start, opt_.center_freq);
+    if (i == 0) std::fprintf(f, "\"core:datetime\": \"%s\", ", datetime_.c_str());
+    std::fprintf(f, "\"flexsdr:tsf\": %lu }%s\n", captures_[i].tsf, (i + 1 < captures_.size()) ? "," : "");
+  }
+
+  std::fprintf(f, "  ],\n  \"annotations\": []\n}\n");
+  std::fclose(f);
+  return 0;
+}
+
+} // namespace flexsdr
@@ -0,0 +1,120 @@
+#include "workers/iq_tap.hpp"
+
+#include <cstdio>
+#include <new>
+
+// DPDK (must be in extern "C" block)
+extern "C" {
+#include <rte_config.h>
+#include <rte_errno.h>
+#include <rte_lcore.h>
+#include <rte_mbuf.h>
+#include <rte_memzone.h>
+#include <rte_ring.h>
+}
+
+namespace flexsdr {
+
+static inline std::string ctl_name_(const std::string& tap) {
+  return tap + "_ctl";
+}
+
+rte_ring* iq_tap_open(const std::string& name, unsigned size, iq_tap_ctl** ctl) {
+  if (ctl) *ctl = nullptr;
+
+  // Any number of producers (switch, streamers), one consumer.
+  rte_ring* r = rte_ring_create(name.c_str(), size, rte_socket_id(), RING_F_SC_DEQ);
+  if (!r && rte_errno == EEXIST) {
+    r = rte_ring_lookup(name.c_str());
+  }
+  if (!r) {
+    std::fprintf(stderr, "[tap] ring create failed: %s (size=%u) rte_errno=%d (%s)\n",
+                 name.c_str(), size, rte_errno, rte_strerror(rte_errno));
+    return nullptr;
+  }
+
+  const std::string zname = ctl_name_(name);
+  const rte_memzone* mz = rte_memzone_lookup(zname.c_str());
+  if (!mz) {
+    mz = rte_memzone_reserve_aligned(zname.c_str(), sizeof(iq_tap_ctl), rte_socket_id(),
+                                     0, alignof(iq_tap_ctl));
+    if (!mz) {
+      std::fprintf(stderr, "[tap] memzone reserve failed: %s rte_errno=%d (%s)\n",
+                   zname.c_str(), rte_errno, rte_strerror(rte_errno));
+      return nullptr;
+    }
+    new (mz->addr) iq_tap_ctl{};
+  }
+
+  if (ctl) *ctl = static_cast<iq_tap_ctl*>(mz->addr);
+  std::fprintf(stderr, "[tap] opened: %s (size=%u)\n", name.c_str(), rte_ring_get_size(r));
+  return r;
+}
+
+unsigned iq_tap_drain(rte_ring* tap) {
+  if (!tap) return 0;
+  unsigned total = 0;
+  void* objs[64];
+  unsigned n;
+  while ((n = rte_ring_dequeue_burst(tap, objs, 64, nullptr)) > 0) {
+    rte_pktmbuf_free_bulk(reinterpret_cast<rte_mbuf**>(objs), n);
+    total += n;
+  }
+  return total;
+}
+
+static unsigned iq_tap_push_all_(rte_ring* tap, iq_tap_ctl* ctl, rte_mbuf* const* pkts, unsigned n) {
+  for (unsigned i = 0; i < n; i++) {
+    rte_pktmbuf_refcnt_update(pkts[i], 1);
+  }
+
+  const unsigned k = rte_ring_enqueue_burst(tap, reinterpret_cast<void* const*>(pkts), n, nullptr);
+
+  // Drop only our extra reference; the live path still owns the original.
+  for (unsigned i = k; i < n; i++) {
+    rte_pktmbuf_free(pkts[i]);
+  }
+
+  if (k < n) ctl->drops.fetch_add(n - k, std::memory_order_relaxed);
+  return k;
+}
+
+unsigned iq_tap_push(rte_ring* tap, iq_tap_ctl* ctl, rte_mbuf* const* pkts, unsigned n) {
+  if (!tap || !ctl || n == 0) return 0;
+  if (!ctl->active.load(std::memory_order_acquire)) return 0;
+
+  const uint64_t seq = ctl->offered.fetch_add(n, std::memory_order_relaxed);
+  const uint32_t every = ctl->every.load(std::memory_order_relaxed);
+  if (every > 1) {
+    // First packet whose running index is a multiple of 'every'
+    unsigned i = static_cast<unsigned>((every - seq % every) % every);
+    if (i >= n) return 0;
+    rte_mbuf* pick[64];
+    unsigned m = 0, total = 0;
+    for (; i < n; i += every) {
+      pick[m++] = pkts[i];
+      if (m == 64) {
+        total += iq_tap_push_all_(tap, ctl, pick, m);
+        m = 0;
+      }
+    }
+    if (m) total += iq_tap_push_all_(tap, ctl, pick, m);
+    return total;
+  }
+  return iq_tap_push_all_(tap, ctl, pkts, n);
+}
+
+bool IqTapPoint::resolve_() {
+  if ((calls_++ % resolve_every_) != 0) return false;
+
+  rte_ring* r = rte_ring_lookup(name_.c_str());
+  const rte_memzone* mz = r ? rte_memzone_lookup(ctl_name_(name_).c_str()) : nullptr;
+  if (!r || !mz) return false;
+
+  ring_ = r;
+  ctl_  = static_cast<iq_tap_ctl*>(mz->addr);
+  std::fprintf(stderr, "[tap] attached to %s\n", name_.c_str());
+  return true;
+}
+
+} // namespace flexsdr
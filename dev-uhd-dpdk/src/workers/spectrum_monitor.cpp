@@ -0,0 +1,438 @@
+#include "workers/spectrum_monitor.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include <pthread.h>
+#include <sched.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// DPDK (must be in extern "C" block)
+extern "C" {
+#include <rte_config.h>
+#include <rte_mbuf.h>
+#include <rte_ring.h>
+#include <rte_telemetry.h>
+}
+
+namespace flexsdr {
+
+static constexpr size_t kLanes = BatchFft::kLanes;
+
+static uint64_t mono_ns_() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static inline int centi_db_(double dbfs) {
+  return static_cast<int>(std::lrint(std::max(dbfs, -300.0) * 100.0));
+}
+
+// Sum of I^2 + Q^2 per channel over nsamps interleaved sc16 frames of nch
+// channels. pmaddwd gives I^2 + Q^2 per word; it is non-negative, so the
+// one overflowing case (-32768, -32768) is still right read as unsigned.
+static void power_sums_(const uint32_t* w, size_t nsamps, unsigned nch, double* out) {
+  const size_t nw = nsamps * nch;
+  size_t i = 0;
+  uint64_t lane[4] = {0, 0, 0, 0};
+#if defined(__SSE2__)
+  if (4 % nch == 0) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc01 = zero, acc23 = zero;
+    for (; i + 4 <= nw; i += 4) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i));
+      const __m128i p = _mm_madd_epi16(v, v);
+      acc01 = _mm_add_epi64(acc01, _mm_unpacklo_epi32(p, zero));
+      acc23 = _mm_add_epi64(acc23, _mm_unpackhi_epi32(p, zero));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lane), acc01);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lane + 2), acc23);
+  }
+#endif
+  for (unsigned c = 0; c < nch; c++) out[c] = 0.0;
+  for (unsigned k = 0; k < 4 && i; k++) out[k % nch] += static_cast<double>(lane[k]);
+  for (; i < nw; i++) {
+    const int32_t re = static_cast<int16_t>(w[i] & 0xffff);
+    const int32_t im = static_cast<int16_t>(w[i] >> 16);
+    out[i % nch] += static_cast<double>(re * re + im * im);
+  }
+}
+
+// --------------------------- telemetry ---------------------------------------
+
+static std::mutex                    g_reg_mtx;
+static std::vector<SpectrumMonitor*> g_registry;
+
+static SpectrumMonitor* find_locked_(const char* params, unsigned* chan) {
+  if (!params || !*params) return nullptr;
+  std::string name = params;
+  *chan = 0;
+  const auto comma = name.find(',');
+  if (comma != std::string::npos) {
+    *chan = static_cast<unsigned>(std::strtoul(name.c_str() + comma + 1, nullptr, 0));
+    name.resize(comma);
+  }
+  for (SpectrumMonitor* m : g_registry) {
+    if (m->opts().name == name) return m;
+  }
+  return nullptr;
+}
+
+static int tel_list_(const char*, const char*, rte_tel_data* d) {
+  std::lock_guard<std::mutex> lk(g_reg_mtx);
+  rte_tel_data_start_array(d, RTE_TEL_STRING_VAL);
+  for (SpectrumMonitor* m : g_registry) rte_tel_data_add_array_string(d, m->opts().name.c_str());
+  return 0;
+}
+
+static int tel_power_(const char*, const char* params, rte_tel_data* d) {
+  std::lock_guard<std::mutex> lk(g_reg_mtx);
+  unsigned chan;
+  SpectrumMonitor* m = find_locked_(params, &chan);
+  if (!m) return -EINVAL;
+
+  const auto s = m->get_stats();
+  rte_tel_data_start_dict(d);
+  rte_tel_data_add_dict_string(d, "tap", m->opts().tap_name.c_str());
+  rte_tel_data_add_dict_uint(d, "packets", s.packets);
+  rte_tel_data_add_dict_uint(d, "frames", s.frames);
+  rte_tel_data_add_dict_uint(d, "short_packets", s.short_packets);
+  rte_tel_data_add_dict_uint(d, "tap_drops", s.tap_drops);
+  rte_tel_data_add_dict_uint(d, "cpu_load_ppm", static_cast<uint64_t>(s.cpu_load * 1e6));
+
+  rte_tel_data* rms = rte_tel_data_alloc();
+  if (!rms) return -ENOMEM;
+  rte_tel_data_start_array(rms, RTE_TEL_INT_VAL);
+  for (unsigned c = 0; c < m->opts().num_channels; c++) {
+    SpectrumMonitor::snapshot sn;
+    rte_tel_data_add_array_int(rms, m->get_snapshot(c, sn) ? centi_db_(sn.rms_dbfs) : centi_db_(-300.0));
+  }
+  rte_tel_data_add_dict_container(d, "rms_cdbfs", rms, 0);
+  return 0;
+}
+
+static int tel_psd_(const char*, const char* params, rte_tel_data* d) {
+  std::lock_guard<std::mutex> lk(g_reg_mtx);
+  unsigned chan;
+  SpectrumMonitor* m = find_locked_(params, &chan);
+  if (!m || chan >= m->opts().num_channels) return -EINVAL;
+
+  SpectrumMonitor::snapshot sn;
+  if (!m->get_snapshot(chan, sn)) return -EAGAIN;
+
+  rte_tel_data_start_dict(d);
+  rte_tel_data_add_dict_uint(d, "chan", chan);
+  rte_tel_data_add_dict_uint(d, "seq", sn.seq);
+  rte_tel_data_add_dict_uint(d, "frames", sn.frames);
+  rte_tel_data_add_dict_uint(d, "fft_size", m->opts().fft_size);
+  rte_tel_data_add_dict_uint(d, "sample_rate", static_cast<uint64_t>(m->opts().sample_rate));
+  rte_tel_data_add_dict_uint(d, "center_freq", static_cast<uint64_t>(m->opts().center_freq));
+  rte_tel_data_add_dict_int(d, "rms_cdbfs", centi_db_(sn.rms_dbfs));
+  if (sn.psd_dbfs.empty()) return 0;
+
+  // Telemetry arrays are short: average power over groups of bins
+  const size_t n = sn.psd_dbfs.size();
+  const size_t bins = std::min<size_t>(std::clamp(m->opts().psd_bins, 1u, 512u), n);
+  const size_t group = n / bins;
+  rte_tel_data* psd = rte_tel_data_alloc();
+  if (!psd) return -ENOMEM;
+  rte_tel_data_start_array(psd, RTE_TEL_INT_VAL);
+  for (size_t b = 0; b < bins; b++) {
+    double p = 0.0;
+    for (size_t k = 0; k < group; k++) p += std::pow(10.0, sn.psd_dbfs[b * group + k] / 10.0);
+    rte_tel_data_add_array_int(psd, centi_db_(10.0 * std::log10(p / group)));
+  }
+  rte_tel_data_add_dict_uint(d, "bin_hz", static_cast<uint64_t>(m->opts().sample_rate * group / n));
+  rte_tel_data_add_dict_container(d, "psd_cdbfs", psd, 0);
+  return 0;
+}
+
+void SpectrumMonitor::register_telemetry_() {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    rte_telemetry_register_cmd("/flexsdr/spectrum/list", tel_list_,
+                               "Lists spectrum monitors. No parameters");
+    rte_telemetry_register_cmd("/flexsdr/spectrum/power", tel_power_,
+                               "Monitor counters and RMS power per channel (0.01 dBFS). Parameters: name");
+    rte_telemetry_register_cmd("/flexsdr/spectrum/psd", tel_psd_,
+                               "Averaged PSD (0.01 dBFS, DC centred). Parameters: name[,chan]");
+  });
+}
+
+// --------------------------- lifecycle ---------------------------------------
+
+SpectrumMonitor::SpectrumMonitor(options opt)
+  : opt_(std::move(opt)), fft_(opt_.fft_size) {
+  opt_.fft_size      = fft_.size();
+  opt_.num_channels  = std::max(1u, opt_.num_channels);
+  opt_.avg_frames    = std::max<unsigned>(kLanes, (opt_.avg_frames + kLanes - 1) / kLanes * kLanes);
+  opt_.sample_every  = std::max(1u, opt_.sample_every);
+  opt_.dequeue_burst = std::max(1u, opt_.dequeue_burst);
+
+  // Hann window; PSD scaled so a full-scale complex tone peaks at 0 dBFS
+  const size_t n = opt_.fft_size;
+  window_.resize(n);
+  double sum = 0.0;
+  for (size_t i = 0; i < n; i++) {
+    window_[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * M_PI * double(i) / double(n)));
+    sum += window_[i];
+  }
+  win_gain_ = 1.0 / (sum * sum * 32768.0 * 32768.0);
+
+  ch_.resize(opt_.num_channels);
+  for (auto& c : ch_) {
+    const size_t bytes = n * kLanes * sizeof(float);
+    if (posix_memalign(reinterpret_cast<void**>(&c.re), 64, bytes) != 0) c.re = nullptr;
+    if (posix_memalign(reinterpret_cast<void**>(&c.im), 64, bytes) != 0) c.im = nullptr;
+    c.acc.assign(n * kLanes, 0.f);
+  }
+  snap_.resize(opt_.num_channels);
+}
+
+SpectrumMonitor::~SpectrumMonitor() {
+  stop();
+  for (auto& c : ch_) {
+    std::free(c.re);
+    std::free(c.im);
+  }
+}
+
+SpectrumMonitor::stats SpectrumMonitor::get_stats() const {
+  stats s{};
+  s.packets       = packets_.load(std::memory_order_relaxed);
+  s.frames        = frames_.load(std::memory_order_relaxed);
+  s.short_packets = short_packets_.load(std::memory_order_relaxed);
+  s.tap_drops     = ctl_ ? ctl_->drops.load(std::memory_order_relaxed) : 0;
+
+  clockid_t cid;
+  timespec ts{};
+  if (running() && pthread_getcpuclockid(const_cast<std::thread&>(worker_).native_handle(), &cid) == 0 &&
+      clock_gettime(cid, &ts) == 0) {
+    const double wall = static_cast<double>(mono_ns_() - start_ns_);
+    if (wall > 0) s.cpu_load = (ts.tv_sec * 1e9 + ts.tv_nsec) / wall;
+  }
+  return s;
+}
+
+bool SpectrumMonitor::get_snapshot(size_t ch, snapshot& out) const {
+  std::lock_guard<std::mutex> lk(snap_mtx_);
+  if (ch >= snap_.size() || snap_[ch].seq == 0) return false;
+  out = snap_[ch];
+  return true;
+}
+
+int SpectrumMonitor::start() {
+  if (running()) return 0;
+  for (const auto& c : ch_) {
+    if (!c.re || !c.im) {
+      std::fprintf(stderr, "[monitor] ERROR: FFT buffer allocation failed\n");
+      return -1;
+    }
+  }
+
+  tap_ = iq_tap_open(opt_.tap_name, opt_.tap_ring_size, &ctl_);
+  if (!tap_) return -2;
+  if (unsigned stale = iq_tap_drain(tap_)) {
+    std::fprintf(stderr, "[monitor] released %u stale clones on %s\n", stale, opt_.tap_name.c_str());
+  }
+
+  for (auto& c : ch_) {
+    c.lanes = 0;
+    c.acc_frames = 0;
+    std::fill(c.acc.begin(), c.acc.end(), 0.f);
+    c.pwr_sum = 0.0;
+    c.pwr_n = 0;
+    c.budget = opt_.max_frames_per_sec;
+  }
+  budget_sec_ = 0;
+  start_ns_ = mono_ns_();
+
+  stop_req_.store(false, std::memory_order_relaxed);
+  running_.store(true, std::memory_order_release);
+  worker_ = std::thread(&SpectrumMonitor::worker_loop_, this);
+
+  if (opt_.cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(opt_.cpu, &set);
+    if (pthread_setaffinity_np(worker_.native_handle(), sizeof(set), &set) != 0) {
+      std::fprintf(stderr, "[monitor] WARNING: could not pin monitor thread to cpu %d\n", opt_.cpu);
+    }
+  }
+
+  if (opt_.telemetry) {
+    register_telemetry_();
+    std::lock_guard<std::mutex> lk(g_reg_mtx);
+    g_registry.push_back(this);
+  }
+
+  iq_tap_set_every(ctl_, opt_.sample_every);
+  iq_tap_set_active(ctl_, true);
+  std::fprintf(stderr, "[monitor] %s: tap %s (1 in %u), fft %zu x %u avg, <= %u frames/s/chan\n",
+               opt_.name.c_str(), opt_.tap_name.c_str(), opt_.sample_every, opt_.fft_size,
+               opt_.avg_frames, opt_.max_frames_per_sec);
+  return 0;
+}
+
+void SpectrumMonitor::stop() {
+  if (!running()) return;
+
+  iq_tap_set_active(ctl_, false);
+  {
+    // Telemetry callbacks hold the registry lock while reading us
+    std::lock_guard<std::mutex> lk(g_reg_mtx);
+    g_registry.erase(std::remove(g_registry.begin(), g_registry.end(), this), g_registry.end());
+  }
+  stop_req_.store(true, std::memory_order_release);
+  if (worker_.joinable()) worker_.join();
+  iq_tap_drain(tap_);
+  running_.store(false, std::memory_order_release);
+
+  const stats s = get_stats();
+  std::fprintf(stderr, "[monitor] %s stopped: packets=%lu frames=%lu short=%lu tap_drops=%lu\n",
+               opt_.name.c_str(), s.packets, s.frames, s.short_packets, s.tap_drops);
+}
+
+// --------------------------- monitor thread ----------------------------------
+
+void SpectrumMonitor::worker_loop_() {
+  std::vector<void*> burst(opt_.dequeue_burst);
+
+  while (!stop_req_.load(std::memory_order_acquire)) {
+    // Once a second: refill frame budgets, publish channels that have power
+    // figures but too few frames for a full average.
+    const uint64_t sec = (mono_ns_() - start_ns_) / 1000000000ull;
+    if (sec != budget_sec_) {
+      budget_sec_ = sec;
+      for (size_t c = 0; c < ch_.size(); c++) {
+        ch_[c].budget = opt_.max_frames_per_sec;
+        if (ch_[c].pwr_n) publish_(c, ch_[c]);
+      }
+    }
+
+    const unsigned n = rte_ring_dequeue_burst(tap_, burst.data(), opt_.dequeue_burst, nullptr);
+    for (unsigned i = 0; i < n; i++) {
+      consume_(static_cast<rte_mbuf*>(burst[i]));
+    }
+    if (n == 0) std::this_thread::sleep_for(std::chrono::microseconds(opt_.idle_sleep_us));
+  }
+}
+
+void SpectrumMonitor::consume_(rte_mbuf* m) {
+  const size_t len = rte_pktmbuf_data_len(m);
+  const size_t frame_bytes = 4u * opt_.num_channels;
+  if (len < opt_.vrt_hdr_bytes + frame_bytes) {
+    rte_pktmbuf_free(m);
+    return;
+  }
+
+  const uint32_t* s = rte_pktmbuf_mtod_offset(m, const uint32_t*, opt_.vrt_hdr_bytes);
+  const size_t nsamps = (len - opt_.vrt_hdr_bytes) / frame_bytes;
+  const unsigned nch = opt_.num_channels;
+
+  double pwr[8];
+  std::vector<double> pwr_big;
+  double* p = pwr;
+  if (nch > 8) {
+    pwr_big.resize(nch);
+    p = pwr_big.data();
+  }
+  power_sums_(s, nsamps, nch, p);
+
+  const bool full = nsamps >= opt_.fft_size;
+  if (!full) short_packets_.fetch_add(1, std::memory_order_relaxed);
+  for (unsigned c = 0; c < nch; c++) {
+    chan_state& cs = ch_[c];
+    cs.pwr_sum += p[c];
+    cs.pwr_n += nsamps;
+    if (full && cs.budget) {
+      cs.budget--;
+      add_frame_(cs, s + c, nch);
+      if (cs.acc_frames >= opt_.avg_frames) publish_(c, cs);
+    }
+  }
+
+  rte_pktmbuf_free(m);   // our clone only
+  packets_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SpectrumMonitor::add_frame_(chan_state& c, const uint32_t* s, size_t stride) {
+  const size_t n = opt_.fft_size;
+  float* re = c.re + c.lanes;
+  float* im = c.im + c.lanes;
+  for (size_t i = 0; i < n; i++, s += stride) {
+    const float w = window_[i];
+    re[i * kLanes] = w * static_cast<int16_t>(*s & 0xffff);
+    im[i * kLanes] = w * static_cast<int16_t>(*s >> 16);
+  }
+  if (++c.lanes == kLanes) run_batch_(c);
+}
+
+void SpectrumMonitor::run_batch_(chan_state& c) {
+  fft_.forward(c.re, c.im);
+
+  // |X|^2 per lane, still in FFT output order; lanes are summed and bins
+  // put in order once per publish.
+  const size_t nf = opt_.fft_size * kLanes;
+  float* acc = c.acc.data();
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 4 <= nf; i += 4) {
+    const __m128 r = _mm_load_ps(c.re + i);
+    const __m128 m = _mm_load_ps(c.im + i);
+    const __m128 p = _mm_add_ps(_mm_mul_ps(r, r), _mm_mul_ps(m, m));
+    _mm_storeu_ps(acc + i, _mm_add_ps(_mm_loadu_ps(acc + i), p));
+  }
+#endif
+  for (; i < nf; i++) acc[i] += c.re[i] * c.re[i] + c.im[i] * c.im[i];
+
+  c.lanes = 0;
+  c.acc_frames += kLanes;
+  frames_.fetch_add(kLanes, std::memory_order_relaxed);
+}
+
+void SpectrumMonitor::publish_(size_t ch, chan_state& c) {
+  const size_t n = opt_.fft_size;
+
+  snapshot next;
+  next.frames = c.acc_frames;
+  next.rms_dbfs = c.pwr_n ? 10.0 * std::log10(std::max(c.pwr_sum / double(c.pwr_n), 1e-30) / (32768.0 * 32768.0))
+                          : -300.0;
+  if (c.acc_frames) {
+    next.psd_dbfs.resize(n);
+    const double scale = win_gain_ / c.acc_frames;
+    for (size_t pos = 0; pos < n; pos++) {
+      const float* a = c.acc.data() + pos * kLanes;
+      const double pw = (double(a[0]) + a[1] + a[2] + a[3]) * scale;
+      const size_t k = (fft_.bin(pos) + n / 2) & (n - 1);   // DC to the middle
+      next.psd_dbfs[k] = static_cast<float>(10.0 * std::log10(std::max(pw, 1e-30)));
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lk(snap_mtx_);
+    next.seq = snap_[ch].seq + 1;
+    if (next.psd_dbfs.empty()) {
+      // Power-only update: keep the last spectrum
+      next.psd_dbfs.swap(snap_[ch].psd_dbfs);
+      next.frames = snap_[ch].frames;
+    }
+    snap_[ch] = std::move(next);
+  }
+
+  std::fill(c.acc.begin(), c.acc.end(), 0.f);
+  c.acc_frames = 0;
+  c.pwr_sum = 0.0;
+  c.pwr_n = 0;
+}
+
+} // namespace flexsdr
@@ -0,0 +1,147 @@
+// test/bench_rx_unpack.cpp
+//
+// Micro-benchmark for the RX streamer's sc16 deinterleave (no DPDK, no
+// device). Synthetic interleaved packets are spread over a working set
+// larger than the LLC and copied into a ring of slot-sized planar outputs,
+// the way recv() consumes a burst.
+//
+//   bench_rx_unpack [--nch N] [--seconds S] [--mib M] [--spp N]
+//
+// Reports Msps per channel for the old per-sample copy ("scalar"), the
+// current unpacker ("simd") and the streaming-store variant ("simd+nt").
+#include "device/iq_deinterleave.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// The unpacker before the SIMD path: one I/Q pair per channel per sample.
+void deinterleave_scalar(void* const* ch_buffs, size_t nch, size_t dst_samp,
+                         const uint8_t* src, size_t nsamps, bool) {
+  const auto* in = reinterpret_cast<const int16_t*>(src);
+  for (size_t s = 0; s < nsamps; s++) {
+    for (size_t c = 0; c < nch; c++) {
+      int16_t* out = static_cast<int16_t*>(ch_buffs[c]);
+      out[(dst_samp + s) * 2]     = in[(s * nch + c) * 2];
+      out[(dst_samp + s) * 2 + 1] = in[(s * nch + c) * 2 + 1];
+    }
+  }
+}
+
+using kernel_t = void (*)(void* const*, size_t, size_t, const uint8_t*, size_t, bool);
+
+struct setup {
+  size_t nch     = 1;
+  size_t spp     = 1024;         // samples per packet
+  size_t slot    = 61440;        // one 0.5 ms slot at 122.88 Msps
+  size_t mib     = 768;          // packet working set
+  double seconds = 2.0;
+};
+
+// 64-byte aligned storage, as the arena/UHD buffers usually are.
+struct aligned_buf {
+  explicit aligned_buf(size_t n) : raw(n + 64) {
+    const auto a = reinterpret_cast<uintptr_t>(raw.data());
+    p = raw.data() + ((64 - (a & 63)) & 63);
+  }
+  std::vector<uint8_t> raw;
+  uint8_t* p;
+};
+
+double run(const setup& st, kernel_t k, bool nt, const std::vector<const uint8_t*>& pkts) {
+  const size_t nslots = 16;
+  std::vector<aligned_buf> out;
+  for (size_t c = 0; c < st.nch; c++) out.emplace_back(nslots * st.slot * 4);
+
+  size_t total = 0, next = 0, slot = 0;
+  std::vector<void*> bp(st.nch);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (;;) {
+    for (size_t c = 0; c < st.nch; c++) bp[c] = out[c].p + (slot % nslots) * st.slot * 4;
+    slot++;
+    for (size_t got = 0; got < st.slot;) {
+      const size_t n = std::min(st.spp, st.slot - got);
+      k(bp.data(), st.nch, got, pkts[next], n, nt);
+      next = (next + 1) % pkts.size();
+      got += n;
+    }
+#if defined(__SSE2__)
+    if (nt) _mm_sfence();
+#endif
+    total += st.slot;
+    if ((slot & 15) == 0 &&
+        std::chrono::steady_clock::now() - t0 >= std::chrono::duration<double>(st.seconds))
+      break;
+  }
+  const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+  return total / sec / 1e6;
+}
+
+bool verify(size_t nch) {
+  const size_t n = 1021;   // odd length: exercises the scalar tail and NT peel
+  std::vector<uint32_t> src(n * nch);
+  for (size_t i = 0; i < src.size(); i++) src[i] = uint32_t(i * 2654435761u);
+  for (int nt = 0; nt < 2; nt++) {
+    std::vector<std::vector<uint32_t>> out(nch, std::vector<uint32_t>(n + 3, 0));
+    std::vector<void*> bp(nch);
+    for (size_t c = 0; c < nch; c++) bp[c] = out[c].data();
+    flexsdr::deinterleave_sc16(bp.data(), nch, 3, reinterpret_cast<const uint8_t*>(src.data()), n, nt);
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+    for (size_t c = 0; c < nch; c++)
+      for (size_t s = 0; s < n; s++)
+        if (out[c][3 + s] != src[s * nch + c]) {
+          std::fprintf(stderr, "[bench] mismatch nch=%zu nt=%d ch=%zu samp=%zu\n", nch, nt, c, s);
+          return false;
+        }
+  }
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  setup st;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string a = argv[i];
+    if      (a == "--nch")     st.nch     = std::strtoul(argv[i + 1], nullptr, 10);
+    else if (a == "--seconds") st.seconds = std::strtod(argv[i + 1], nullptr);
+    else if (a == "--mib")     st.mib     = std::strtoul(argv[i + 1], nullptr, 10);
+    else if (a == "--spp")     st.spp     = std::strtoul(argv[i + 1], nullptr, 10);
+    else {
+      std::fprintf(stderr, "usage: %s [--nch N] [--seconds S] [--mib M] [--spp N]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (!st.nch || !st.spp) return 2;
+
+  for (size_t n : {1, 2, 3, 4})
+    if (!verify(n)) return 1;
+
+  // Packet payloads back to back, 64-byte aligned like mbuf data rooms
+  const size_t pkt_bytes = (st.spp * st.nch * 4 + 63) & ~size_t(63);
+  const size_t npkts = std::max<size_t>(1, (st.mib << 20) / pkt_bytes);
+  aligned_buf mem(npkts * pkt_bytes);
+  for (size_t i = 0; i < npkts * pkt_bytes; i++) mem.p[i] = uint8_t(i * 131);
+  std::vector<const uint8_t*> pkts(npkts);
+  for (size_t i = 0; i < npkts; i++) pkts[i] = mem.p + i * pkt_bytes;
+
+  std::printf("nch=%zu spp=%zu slot=%zu working set=%zu MiB\n", st.nch, st.spp, st.slot,
+              npkts * pkt_bytes >> 20);
+  std::printf("  scalar   %8.1f Msps/ch\n", run(st, &deinterleave_scalar, false, pkts));
+  std::printf("  simd     %8.1f Msps/ch\n", run(st, &flexsdr::deinterleave_sc16, false, pkts));
+  std::printf("  simd+nt  %8.1f Msps/ch\n", run(st, &flexsdr::deinterleave_sc16, true, pkts));
+  return 0;
+}
@@ -44,6 +44,17 @@ typedef enum {
     MAX_RF_DEV_TYPE
 } dev_type_t;
 
+// TX burst flags passed in trx_write 'flags' (low 4 bits; upper bits are
+// GPIO controls in newer OAI)
+typedef enum {
+    TX_BURST_INVALID       = 0,
+    TX_BURST_MIDDLE        = 1,
+    TX_BURST_START         = 2,
+    TX_BURST_END           = 3,
+    TX_BURST_START_AND_END = 4,
+    TX_BURST_END_NO_TIME_SPEC = 10   // end of burst, send as soon as possible
+} radio_tx_burst_flag_t;
+
 // Host types
 typedef enum {
     BBU_HOST = 0,
@@ -101,6 +112,9 @@ struct openair0_device_t;
 // Function pointer types for device operations
 typedef int (*trx_start_func_t)(struct openair0_device_t *device);
 typedef void (*trx_stop_func_t)(struct openair0_device_t *device);
+// Upstream OAI passes (nsamps, cc, flags) with cc = number of antennas;
+// this header keeps (flags, cc). FlexSDR's trx_write reads cc as the
+// component carrier and maps anything it has not opened to carrier 0.
 typedef int (*trx_write_func_t)(struct openair0_device_t *device,
                                 openair0_timestamp timestamp,
                                 void **buff,
@@ -5,6 +5,7 @@
 #include <string>
 #include <memory>
 #include <iostream>
+#include <chrono>
 
 // UHD headers
 #include <uhd/device.hpp>
@@ -12,6 +13,9 @@
 
 // FlexSDR headers
 #include "device/flexsdr_device.hpp"
+#include "device/flexsdr_rx_streamer.hpp"
+#include "device/flexsdr_tx_streamer.hpp"
+#include "device/iq_arena.hpp"
 #include "transport/flexsdr_secondary.hpp"
 #include "transport/eal_bootstrap.hpp"
 #include "conf/config_params.hpp"
@@ -30,6 +34,10 @@ extern "C" void flexsdr_register_with_uhd();
 
 extern int flexsdr_tx_thread;
 
+#define FLEXSDR_MAX_RX_CH 8
+#define FLEXSDR_MAX_TX_CH 8
+#define FLEXSDR_MAX_CC    4
+
 typedef struct {
   // --------------------------------
   // variables for USRP configuration
@@ -45,8 +53,15 @@ typedef struct {
 
   //! USRP TX Stream
   uhd::tx_streamer::sptr tx_stream;
+  //! TX stream per component carrier (cc 0 is tx_stream), each on its own TX rings
+  uhd::tx_streamer::sptr tx_cc_stream[FLEXSDR_MAX_CC];
+  //! Same streams as the FlexSDR type (pointer-list send), null otherwise
+  std::shared_ptr<flexsdr::flexsdr_tx_streamer> fx_tx_cc[FLEXSDR_MAX_CC];
+  int num_tx_cc;
   //! USRP RX Stream
   uhd::rx_streamer::sptr rx_stream;
+  //! Same stream as the FlexSDR type (exact-size read path), null otherwise
+  std::shared_ptr<flexsdr::flexsdr_rx_streamer> fx_rx_stream;
 
   //! USRP TX Metadata
   uhd::tx_metadata_t tx_md;
@@ -77,6 +92,21 @@ typedef struct {
   int use_gps;
   //! timestamp of RX packet
   openair0_timestamp rx_timestamp;
+
+  // --------------------------------
+  // RX read scratch (reused every trx_read)
+  // --------------------------------
+  void*  rx_ptrs[FLEXSDR_MAX_RX_CH];
+  //! rx_ptrs advanced past the samples read so far (generic streamer)
+  void*  rx_cur[FLEXSDR_MAX_RX_CH];
+  //! sink for streamer channels OAI did not ask for
+  void*  rx_sink;
+  size_t rx_sink_samps;
+  //! per-read deadline in seconds (FLEXSDR_RX_TIMEOUT_MS)
+  double rx_timeout;
+
+  //! TX channel pointers (reused every trx_write)
+  const void* tx_ptrs[FLEXSDR_MAX_TX_CH];
 } flexsdr_state_t;
 
 // Start FlexSDR streaming (minimal start similar to USRP start)
@@ -113,22 +143,63 @@ static int trx_write_wrapper(openair0_device_t* device,
                              int cc) {
     auto* s = static_cast<flexsdr_state_t*>(device->priv);
     if (!s || !s->tx_stream) return -1;
+    if (cc < 0 || cc >= s->num_tx_cc || !s->tx_cc_stream[cc]) {
+        // Callers that pass the antenna count here still get the main carrier
+        static bool warned = false;
+        if (!warned) {
+            LOG_W(HW, "trx_write: cc %d not configured (%d carriers); using carrier 0",
+                  cc, s->num_tx_cc);
+            warned = true;
+        }
+        cc = 0;
+    }
+    if (!buffers || nsamps < 0) return -1;
+
+    // OAI burst flags live in the low nibble (upper bits are GPIO controls)
+    uhd::tx_metadata_t& md = s->tx_md;
+    md.has_time_spec = true;
+    switch (flags & 0xf) {
+      case TX_BURST_START:
+        md.start_of_burst = true;
+        md.end_of_burst   = false;
+        break;
+      case TX_BURST_END:
+        md.start_of_burst = false;
+        md.end_of_burst   = true;
+        break;
+      case TX_BURST_START_AND_END:
+        md.start_of_burst = true;
+        md.end_of_burst   = true;
+        break;
+      case TX_BURST_END_NO_TIME_SPEC:
+        md.start_of_burst = false;
+        md.end_of_burst   = true;
+        md.has_time_spec  = false;
+        break;
+      default:  // TX_BURST_MIDDLE / TX_BURST_INVALID: continuous
+        md.start_of_burst = false;
+        md.end_of_burst   = false;
+        break;
+    }
+    if (md.has_time_spec) md.time_spec = uhd::time_spec_t::from_ticks(ts, /*rate*/ s->sample_rate);
 
-    uhd::tx_metadata_t md{};
-    //md.start_of_burst = (flags & SOME_SOB_FLAG) != 0;
-    //md.end_of_burst   = (flags & SOME_EOB_FLAG) != 0;
-    md.has_time_spec  = true;
-    md.time_spec = uhd::time_spec_t::from_ticks(ts, /*rate*/ s->sample_rate);
-
-    // Convert buffers array to UHD ref_vector (buffers is void**, not the data itself!)
-    const size_t num_chans = s->tx_stream->get_num_channels();
-    std::vector<const void*> buff_ptrs;
+    // Whole slot in one send(); the streamer packetizes it
+    const uhd::tx_streamer::sptr& stream = s->tx_cc_stream[cc];
+    const size_t num_chans = std::min<size_t>(stream->get_num_channels(), FLEXSDR_MAX_TX_CH);
     for (size_t i = 0; i < num_chans; i++) {
-        buff_ptrs.push_back(buffers[i]);
+        s->tx_ptrs[i] = buffers[i];
     }
 
-    size_t sent = s->tx_stream->send(buff_ptrs, nsamps, md, /*timeout*/ 0.1);
-   
+    size_t sent;
+    if (s->fx_tx_cc[cc]) {
+        sent = s->fx_tx_cc[cc]->send_ptrs(s->tx_ptrs, num_chans, nsamps, md, /*timeout*/ 0.1);
+    } else {
+        std::vector<const void*> buff_ptrs(s->tx_ptrs, s->tx_ptrs + num_chans);
+        sent = stream->send(buff_ptrs, nsamps, md, /*timeout*/ 0.1);
+    }
+
+    if (sent < static_cast<size_t>(nsamps)) s->num_underflows++;
+    s->tx_count += static_cast<int64_t>(sent);
     return static_cast<int>(sent);
 }
 
@@ -141,51 +212,64 @@ static int trx_read_wrapper(openair0_device_t* device,
     if (!s || !s->rx_stream) return -1;
     if (!buffers || !buffers[0] || nsamps <= 0) return 0;
 
-    // Our FlexSDR RX streamer currently supports a single channel.
-    // Tolerate callers passing more antennas; we fill only supported channels.
-    const size_t streamer_ch = s->rx_stream->get_num_channels();
+    const size_t streamer_ch = std::min<size_t>(s->rx_stream->get_num_channels(), FLEXSDR_MAX_RX_CH);
     if (streamer_ch == 0) return 0;
-
-    uhd::rx_metadata_t md{};
-    // Clamp nsamps to a sane upper bound and the streamer's own limit
     const size_t req = static_cast<size_t>(nsamps);
-    const size_t max_req = 1u << 20; // 1M complex samples
-    size_t nsamps_clamped = std::min(req, max_req);
-    nsamps_clamped = std::min(nsamps_clamped, s->rx_stream->get_max_num_samps());
-
-    // Accumulate reads until the requested number of samples is returned
-    size_t total_read = 0;
-    // Build a working vector for the recv API
-    std::vector<void*> buffv(streamer_ch);
-    // bytes per complex sample for sc16
     constexpr size_t bytes_per_sample = sizeof(int16_t) * 2;
 
-    while (total_read < nsamps_clamped) {
-      // Advance per-channel pointers by total_read
-      for (size_t ch = 0; ch < streamer_ch; ++ch) {
-        // Use the provided buffers; if caller passed fewer than streamer_ch, reuse buffers[0]
-        void* base = buffers[(num_antennas > (int)ch) ? ch : 0];
-        buffv[ch] = static_cast<void*>(
-            reinterpret_cast<uint8_t*>(base) + total_read * bytes_per_sample);
-      }
-
-      const size_t remaining = nsamps_clamped - total_read;
-      const size_t got = s->rx_stream->recv(buffv, remaining, md, /*timeout*/ 0.2, /*one_packet*/ false);
-
-      if (got == 0) {
-        // Timeout or no data yet; try again to meet OAI's blocking semantics
-        continue;
-      }
-
-      // Record timestamp from the first chunk if provided
-      if (total_read == 0 && md.has_time_spec && ts && s->sample_rate > 0.0) {
-        *ts = static_cast<openair0_timestamp>(md.time_spec.to_ticks(/*rate*/ s->sample_rate));
-      }
-
-      total_read += got;
+    // Streamer channels beyond what OAI asked for go to a per-device sink
+    if (static_cast<size_t>(num_antennas) < streamer_ch && s->rx_sink_samps < req) {
+        free(s->rx_sink);
+        s->rx_sink = nullptr;
+        s->rx_sink_samps = 0;
+        if (posix_memalign(&s->rx_sink, 64, req * bytes_per_sample) != 0) return -1;
+        s->rx_sink_samps = req;
+    }
+    for (size_t ch = 0; ch < streamer_ch; ++ch) {
+        s->rx_ptrs[ch] = (static_cast<int>(ch) < num_antennas && buffers[ch]) ? buffers[ch] : s->rx_sink;
+    }
+
+    uhd::rx_metadata_t& md = s->rx_md;
+    uint64_t tsf = 0;
+    size_t got = 0;
+
+    if (s->fx_rx_stream) {
+        // Exactly nsamps across packets, bounded by the deadline
+        got = s->fx_rx_stream->recv_exact(s->rx_ptrs, streamer_ch, req, md, s->rx_timeout, &tsf);
+    } else {
+        // Generic UHD streamer: accumulate until nsamps or the deadline
+        const auto deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration<double>(s->rx_timeout);
+        const uhd::rx_streamer::buffs_type buffv(s->rx_cur, streamer_ch);   // refers to rx_cur
+        while (got < req && std::chrono::steady_clock::now() < deadline) {
+            for (size_t ch = 0; ch < streamer_ch; ++ch) {
+                s->rx_cur[ch] = static_cast<uint8_t*>(s->rx_ptrs[ch]) + got * bytes_per_sample;
+            }
+            uhd::rx_metadata_t cmd;
+            const size_t n = s->rx_stream->recv(buffv, req - got, cmd, s->rx_timeout, false);
+            if (got == 0) md = cmd;
+            if (cmd.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW) md.error_code = cmd.error_code;
+            got += n;
+        }
+        if (md.has_time_spec && s->sample_rate > 0.0) {
+            tsf = static_cast<uint64_t>(md.time_spec.to_ticks(s->sample_rate));
+        }
+    }
+
+    if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW) s->num_overflows++;
+    if (md.out_of_sequence) s->num_seq_errors++;
+
+    // Timestamp: the stream's TSF when it carries one, else a running count
+    if (got) {
+        if (md.has_time_spec) s->rx_timestamp = static_cast<openair0_timestamp>(tsf);
+        if (ts) *ts = s->rx_timestamp;
+        s->rx_timestamp += static_cast<openair0_timestamp>(got);
+        s->rx_count += static_cast<int64_t>(got);
     }
 
-    return static_cast<int>(total_read);
+    // A short read tells OAI about a deadline miss, gap or overflow; the
+    // next read resumes at the new timestamp.
+    return static_cast<int>(got);
 }
 
 //TODO CHECK
@@ -245,8 +329,14 @@ static void trx_end_wrapper(openair0_device_t* device) {
     if (!s) return;
 
     // Clean up streams first
+    for (int cc = 0; cc < FLEXSDR_MAX_CC; cc++) {
+        s->fx_tx_cc[cc].reset();
+        s->tx_cc_stream[cc].reset();
+    }
     s->tx_stream.reset();
+    s->fx_rx_stream.reset();
     s->rx_stream.reset();
+    free(s->rx_sink);
 
     // Clean up DPDK context
     s->dpdk_ctx.reset();
@@ -261,6 +351,18 @@ static void trx_end_wrapper(openair0_device_t* device) {
 }
 
 
+// Sample buffers in DPDK hugepage memory (flexsdr::iq_arena). OAI can
+// resolve these with dlsym() after device_init (the EAL must be up) and
+// allocate its rx/tx buffers there; with FLEXSDR_TX_ZERO_COPY=1 such TX
+// buffers go out without a copy. nullptr = fall back to malloc.
+extern "C" void* flexsdr_iq_alloc(size_t bytes) {
+    return flexsdr::iq_arena::instance().alloc(bytes);
+}
+
+extern "C" void flexsdr_iq_free(void* p) {
+    flexsdr::iq_arena::instance().free(p);
+}
+
 extern "C" int device_init(openair0_device_t* device, openair0_config_t* cfg) {
     printf("******Initializing FlexSDR device...******\n");
   
@@ -283,6 +385,9 @@ extern "C" int device_init(openair0_device_t* device, openair0_config_t* cfg) {
       
       // Store config path for secondary init
       state->yaml_config_path = yaml_config;
+
+      const char* env_rx_to = std::getenv("FLEXSDR_RX_TIMEOUT_MS");
+      state->rx_timeout = (env_rx_to ? std::atof(env_rx_to) : 100.0) / 1e3;
       
       printf("[FlexSDR] Using configuration: %s\n", yaml_config.c_str());
       printf("[FlexSDR] Device address: %s\n", device_args.c_str());
@@ -393,11 +498,44 @@ extern "C" int device_init(openair0_device_t* device, openair0_config_t* cfg) {
         uhd::stream_args_t rx_args{"sc16", "sc16"};
         rx_args.channels = {0, 1, 2, 3};
         state->rx_stream = state->flexsdr->get_rx_stream(rx_args);
-
-        // Create TX stream (single channel for now)
-        uhd::stream_args_t tx_args{"sc16", "sc16"};
-        tx_args.channels = {0};
-        state->tx_stream = state->flexsdr->get_tx_stream(tx_args);
+        state->fx_rx_stream = std::dynamic_pointer_cast<flexsdr::flexsdr_rx_streamer>(state->rx_stream);
+
+        // Create TX streams: one per component carrier (FLEXSDR_TX_CC,
+        // default 1). Carrier c uses TX queues [c*N, c*N+N) for N antennas.
+        // With fewer TX rings than carriers x antennas (e.g. one ring for
+        // two antennas), each carrier packs its antennas into TX queue c.
+        const char* env_cc = std::getenv("FLEXSDR_TX_CC");
+        const int want_cc = std::max(1, std::min(env_cc ? std::atoi(env_cc) : 1, FLEXSDR_MAX_CC));
+        const int tx_nch = std::max(1, std::min(cfg ? cfg->tx_num_channels : 1, FLEXSDR_MAX_TX_CH));
+        const int tx_nq = static_cast<int>(state->secondary->num_tx_queues());
+        const bool tx_interleave = tx_nch > 1 && tx_nq < want_cc * tx_nch;
+        if (tx_interleave) {
+            printf("[FlexSDR] %d TX antennas x %d CC but %d TX rings: interleaving antennas per ring\n",
+                   tx_nch, want_cc, tx_nq);
+        }
+        const char* env_zc = std::getenv("FLEXSDR_TX_ZERO_COPY");
+        for (int cc = 0; cc < want_cc; cc++) {
+            uhd::stream_args_t tx_args{"sc16", "sc16"};
+            if (env_zc && std::atoi(env_zc)) tx_args.args["tx_zero_copy"] = "1";
+            if (tx_interleave) {
+                tx_args.args["tx_interleave"] = "1";
+                tx_args.channels.assign(tx_nch, cc);   // packed into TX queue cc
+            } else {
+                for (int i = 0; i < tx_nch; i++) tx_args.channels.push_back(cc * tx_nch + i);
+            }
+            try {
+                state->tx_cc_stream[cc] = state->flexsdr->get_tx_stream(tx_args);
+            } catch (const std::exception& e) {
+                if (cc == 0) throw;
+                std::cerr << "[FlexSDR] WARNING: CC " << cc << " disabled: " << e.what() << "\n";
+                break;
+            }
+            state->fx_tx_cc[cc] =
+                std::dynamic_pointer_cast<flexsdr::flexsdr_tx_streamer>(state->tx_cc_stream[cc]);
+            state->num_tx_cc = cc + 1;
+        }
+        state->tx_stream = state->tx_cc_stream[0];
+        printf("[FlexSDR] TX component carriers: %d\n", state->num_tx_cc);
 
         printf("[FlexSDR] Streams created: RX=%zu channels, TX=%zu channels\n",
                state->rx_stream->get_num_channels(),
@@ -0,0 +1,92 @@
+// test/test_batch_fft.cpp
+//
+// Standalone checks for BatchFft (no DPDK, no device): bin() is a
+// permutation (the stage digits reversed), and a complex exponential at
+// bin k in any lane comes out as a single bin at the position bin() names,
+// for radix-4-only and mixed radix-4/2 sizes.
+#include "workers/batch_fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using flexsdr::BatchFft;
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const char* what, size_t n, size_t k = 0) {
+  if (!ok) {
+    std::fprintf(stderr, "[test_batch_fft] FAIL: %s (n=%zu k=%zu)\n", what, n, k);
+    failures++;
+  }
+}
+
+struct lanes_buf {
+  explicit lanes_buf(size_t n)
+    : re(static_cast<float*>(std::aligned_alloc(64, n * BatchFft::kLanes * sizeof(float)))),
+      im(static_cast<float*>(std::aligned_alloc(64, n * BatchFft::kLanes * sizeof(float)))) {}
+  ~lanes_buf() { std::free(re); std::free(im); }
+  float* re;
+  float* im;
+};
+
+void test_perm(const BatchFft& fft) {
+  const size_t n = fft.size();
+  std::vector<bool> seen(n, false);
+  for (size_t p = 0; p < n; p++) {
+    const size_t k = fft.bin(p);
+    check(k < n && !seen[k], "bin() is a permutation", n, k);
+    if (k < n) seen[k] = true;
+  }
+  check(fft.bin(0) == 0, "position 0 is DC", n);
+}
+
+// Lane f carries exp(+j 2 pi k_f n / N); every other bin must stay empty
+void test_single_bin(const BatchFft& fft) {
+  const size_t n = fft.size(), W = BatchFft::kLanes;
+  lanes_buf b(n);
+  for (size_t k0 = 0; k0 < n; k0 += (n > 64 ? n / 16 + 1 : 1)) {
+    size_t k[W];
+    for (size_t f = 0; f < W; f++) k[f] = (k0 + f * (n / 4 + 1)) % n;
+    for (size_t i = 0; i < n; i++) {
+      for (size_t f = 0; f < W; f++) {
+        const double a = 2.0 * M_PI * double(k[f] * i % n) / double(n);
+        b.re[i * W + f] = static_cast<float>(std::cos(a));
+        b.im[i * W + f] = static_cast<float>(std::sin(a));
+      }
+    }
+    fft.forward(b.re, b.im);
+    for (size_t f = 0; f < W; f++) {
+      double leak = 0.0;
+      for (size_t p = 0; p < n; p++) {
+        const double mag = std::hypot(b.re[p * W + f], b.im[p * W + f]);
+        if (fft.bin(p) == k[f]) check(std::fabs(mag - double(n)) < 1e-3 * n, "tone bin holds N", n, k[f]);
+        else                    leak = std::max(leak, mag);
+      }
+      check(leak < 1e-3 * n, "no energy outside the tone bin", n, k[f]);
+    }
+  }
+}
+
+} // namespace
+
+int main() {
+  // 16/64/1024: radix-4 only; 32/128/2048: final radix-2 stage
+  for (size_t n : {16u, 32u, 64u, 128u, 1024u, 2048u}) {
+    const BatchFft fft(n);
+    check(fft.size() == n, "size()", n);
+    test_perm(fft);
+    test_single_bin(fft);
+  }
+  check(BatchFft(1000).size() == 512, "sizes round down to a power of two", 1000);
+  if (failures) {
+    std::fprintf(stderr, "[test_batch_fft] %d check(s) failed\n", failures);
+    return 1;
+  }
+  std::printf("[test_batch_fft] ok\n");
+  return 0;
+}
@@ -0,0 +1,95 @@
+// test/test_derive_sizing.cpp
+//
+// Standalone checks for conf::derive_sizing() (pure, no YAML file or EAL):
+// ring/pool/element sizes for typical rates, the clamps at both ends, the
+// otw fallback and the rejected inputs.
+#include "conf/config_params.hpp"
+
+#include <cstdio>
+
+using flexsdr::conf::DerivedSizing;
+using flexsdr::conf::StreamSizing;
+using flexsdr::conf::derive_sizing;
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const char* what) {
+  if (!ok) {
+    std::fprintf(stderr, "[test_derive_sizing] FAIL: %s\n", what);
+    failures++;
+  }
+}
+
+StreamSizing sizing(double rate, unsigned spp, const char* otw = "", double ms = 10.0) {
+  StreamSizing s;
+  s.sample_rate = rate;
+  s.spp         = spp;
+  s.otw         = otw;
+  s.buffer_ms   = ms;
+  return s;
+}
+
+bool is_pow2(unsigned v) { return v && !(v & (v - 1)); }
+
+void test_typical() {
+  // 30.72 Msps, 1024 spp: 30000 pkt/s, 300 in flight over 10 ms
+  DerivedSizing d;
+  check(derive_sizing(sizing(30.72e6, 1024), 1, "cs16", d), "30.72 Msps accepted");
+  check(d.pkts_per_sec == 30000.0, "pkts_per_sec");
+  check(d.ring_size == 512, "ring holds 10 ms (300 pkts) -> 512");
+  check(d.cache_size == 64, "cache = ring/8");
+  check(d.nb_mbuf == 1023, "nb_mbuf = 2^k - 1 over ring + ring/2 + 2 caches");
+  check(d.elt_size == 4160, "32 B header + 4 KiB samples, 64 B aligned");
+
+  check(derive_sizing(sizing(30.72e6, 1024), 2, "cs16", d), "two channels accepted");
+  check(d.elt_size == 8256, "element carries every channel");
+  check(derive_sizing(sizing(30.72e6, 1024, "sc12"), 1, "cs16", d) && d.elt_size == 3136,
+        "explicit otw overrides the default");
+  check(derive_sizing(sizing(30.72e6, 1024), 1, "fc32", d) && d.elt_size == 8256,
+        "empty otw uses the default format");
+
+  for (double rate : {1e6, 7.68e6, 61.44e6, 122.88e6, 245.76e6}) {
+    check(derive_sizing(sizing(rate, 512), 1, "cs16", d), "rate accepted");
+    check(is_pow2(d.ring_size), "ring size is a power of two");
+    check(d.ring_size - 1 >= static_cast<unsigned>(d.pkts_per_sec * 0.010), "ring holds buffer_ms");
+    check(is_pow2(d.nb_mbuf + 1) && d.nb_mbuf >= d.ring_size, "pool covers the ring");
+    check(d.elt_size % 64 == 0, "element size 64 B aligned");
+  }
+}
+
+void test_clamps() {
+  DerivedSizing d;
+  check(derive_sizing(sizing(1e6, 1024), 1, "cs16", d), "low rate accepted");
+  check(d.ring_size == 64 && d.cache_size == 32 && d.nb_mbuf == 255, "lower clamps");
+  check(derive_sizing(sizing(1e9, 64, "", 100.0), 1, "cs16", d), "high rate accepted");
+  check(d.ring_size == 65536 && d.cache_size == 512, "upper clamps");
+  check(d.nb_mbuf == 131071, "pool for the largest ring");
+}
+
+void test_rejected() {
+  DerivedSizing d;
+  d.ring_size = 7;
+  check(!derive_sizing(sizing(0, 1024), 1, "cs16", d), "zero rate rejected");
+  check(!derive_sizing(sizing(30.72e6, 0), 1, "cs16", d), "zero spp rejected");
+  check(!derive_sizing(sizing(30.72e6, 1024), 0, "cs16", d), "zero channels rejected");
+  check(!derive_sizing(sizing(30.72e6, 1024, "bogus"), 1, "cs16", d), "unknown otw rejected");
+  check(!derive_sizing(sizing(30.72e6, 1024), 1, "", d), "no format at all rejected");
+  check(!derive_sizing(sizing(30.72e6, 1024, "", 0.0), 1, "cs16", d), "zero buffer_ms rejected");
+  check(d.ring_size == 7, "output untouched on failure");
+}
+
+} // namespace
+
+int main() {
+  test_typical();
+  test_clamps();
+  test_rejected();
+  if (failures) {
+    std::fprintf(stderr, "[test_derive_sizing] %d check(s) failed\n", failures);
+    return 1;
+  }
+  std::printf("[test_derive_sizing] ok\n");
+  return 0;
+}
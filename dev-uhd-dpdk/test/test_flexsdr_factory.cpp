@@ -72,7 +72,7 @@ static void usage(const char* prog) {
       << "Options:\n"
       << "  --cfg <yaml>      Configuration file (default: conf/configurations-ue.yaml)\n"
       << "  --args <uhd_args> UHD device args (default: type=flexsdr,addr=127.0.0.1,port=50051)\n"
-      << "  --mode <mode>     Test mode: tx, rx, or both (default: tx)\n"
+      << "  --mode <mode>     Test mode: tx, rx, both or params (default: tx)\n"
       << "  --hold <seconds>  How long to run test (default: 180)\n"
       << "  -h, --help       Show this help\n";
 }
@@ -297,6 +297,58 @@ void test_rx_reception(uhd::rx_streamer::sptr rx_stream, int max_bursts, double
     std::cout << "========================================\n\n";
 }
 
+// PARAMS TEST: a setter called with ALL_CHANS must update every channel's
+// cached value. Each channel is first set (and cached) on its own, so a
+// stale per-channel slot shows up as a mismatch.
+bool test_all_chans_params(flexsdr::flexsdr_device& dev, size_t num_rx, size_t num_tx) {
+    std::cout << "\n========================================\n";
+    std::cout << "PARAMS TEST: ALL_CHANS gain/frequency\n";
+    std::cout << "========================================\n";
+
+    const size_t ALL = flexsdr::flexsdr_device::ALL_CHANS;
+    int failures = 0;
+    auto check = [&](const char* what, size_t ch, double got, double want, double tol) {
+        if (std::fabs(got - want) <= tol) {
+            std::cout << "[PARAMS] " << what << " ch" << ch << ": " << got << " OK\n";
+        } else {
+            std::cout << "[PARAMS] " << what << " ch" << ch << ": " << got
+                      << " MISMATCH (want " << want << ")\n";
+            failures++;
+        }
+    };
+
+    for (size_t ch = 0; ch < num_rx; ch++) {
+        dev.set_rx_gain(10.0 + ch, ch);
+        (void)dev.get_rx_gain(ch);
+        dev.set_rx_freq(uhd::tune_request_t(1.0e9 + ch * 1e6), ch);
+        (void)dev.get_rx_freq(ch);
+    }
+    for (size_t ch = 0; ch < num_tx; ch++) {
+        dev.set_tx_gain(10.0 + ch, ch);
+        (void)dev.get_tx_gain(ch);
+        dev.set_tx_freq(uhd::tune_request_t(1.0e9 + ch * 1e6), ch);
+        (void)dev.get_tx_freq(ch);
+    }
+
+    dev.set_rx_gain(30.0, ALL);
+    dev.set_tx_gain(20.0, ALL);
+    dev.set_rx_freq(uhd::tune_request_t(2.0e9), ALL);
+    dev.set_tx_freq(uhd::tune_request_t(2.1e9), ALL);
+
+    for (size_t ch = 0; ch < num_rx; ch++) {
+        check("RX gain", ch, dev.get_rx_gain(ch), 30.0, 0.5);
+        check("RX freq", ch, dev.get_rx_freq(ch), 2.0e9, 1.0);
+    }
+    for (size_t ch = 0; ch < num_tx; ch++) {
+        check("TX gain", ch, dev.get_tx_gain(ch), 20.0, 0.5);
+        check("TX freq", ch, dev.get_tx_freq(ch), 2.1e9, 1.0);
+    }
+
+    std::cout << "[PARAMS] " << (failures ? "FAILED" : "PASSED")
+              << " (" << failures << " mismatches)\n";
+    return failures == 0;
+}
+
 int main(int argc, char** argv) {
     std::cout << "========================================\n";
     std::cout << "FlexSDR Factory Test\n";
@@ -463,8 +515,12 @@ int main(int argc, char** argv) {
             rx->issue_stream_cmd(cmd);
             
             std::cout << "\n[INFO] Both tests complete. TX: 400 packets sent, RX: " << rx_packets_received.load() << " packets received\n";
+        } else if (cli.mode == "params") {
+            if (!test_all_chans_params(*fdev, rx->get_num_channels(), secondary->num_tx_queues())) {
+                return 6;
+            }
         } else {
-            std::cerr << "[ERROR] Invalid mode: " << cli.mode << " (use tx, rx, or both)\n";
+            std::cerr << "[ERROR] Invalid mode: " << cli.mode << " (use tx, rx, both or params)\n";
             return 5;
         }
 
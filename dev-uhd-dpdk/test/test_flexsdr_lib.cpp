@@ -11,6 +11,7 @@
  * - gRPC server should be available
  */
 
+#include <algorithm>
 #include <iostream>
 #include <cstdio>
 #include <cstdlib>
@@ -62,12 +63,11 @@ void test_tx_transmission(openair0_device_t* device, int num_bursts = 100) {
     std::cout << "========================================\n";
     
     const int samps_per_burst = 1024;
-    const int num_channels = 1;  // Single TX channel
+    const int num_channels = std::max(1, device->openair0_cfg->tx_num_channels);
     
-    // Allocate buffers for TX
+    // Allocate buffers for TX (same tone on every antenna)
     std::vector<std::complex<int16_t>> tx_buffer(samps_per_burst);
-    void* buffers[num_channels];
-    buffers[0] = tx_buffer.data();
+    std::vector<void*> buffers(num_channels, tx_buffer.data());
     
     // Generate test tone (complex sinusoid)
     const double freq_norm = 0.1;  // Normalized frequency
@@ -81,7 +81,8 @@ void test_tx_transmission(openair0_device_t* device, int num_bursts = 100) {
         );
     }
     
-    std::cout << "[TX] Generated tone at normalized freq " << freq_norm << "\n";
+    std::cout << "[TX] Generated tone at normalized freq " << freq_norm
+              << " on " << num_channels << " antenna(s)\n";
     std::cout << "[TX] Transmitting " << num_bursts << " bursts...\n\n";
     
     // Statistics
@@ -98,10 +99,10 @@ void test_tx_transmission(openair0_device_t* device, int num_bursts = 100) {
         int sent = device->trx_write_func(
             device,
             current_ts,
-            buffers,
+            buffers.data(),
             samps_per_burst,
             0,  // flags
-            1   // cc (component carrier)
+            0   // cc (component carrier)
         );
         
         if (sent == samps_per_burst) {
@@ -279,7 +280,7 @@ void test_bidirectional(openair0_device_t* device, int num_packets = 50) {
     
     openair0_timestamp current_ts = 0;
     while (tx_count.load() < static_cast<uint64_t>(num_packets) && !g_shutdown_requested.load()) {
-        int sent = device->trx_write_func(device, current_ts, buffers, samps_per_burst, 0, 1);
+        int sent = device->trx_write_func(device, current_ts, buffers, samps_per_burst, 0, 0);
         if (sent == samps_per_burst) {
             tx_count++;
             current_ts += samps_per_burst;
@@ -328,6 +329,7 @@ int main(int argc, char** argv) {
     // Parse command line arguments
     std::string test_mode = "all";  // all, tx, rx, bidir
     int num_packets = 100;
+    int tx_channels = 1;
     std::string config_file = "conf/configurations-ue.yaml";  // Default to UE
     std::string role = "ue";  // ue or gnb
     
@@ -337,6 +339,8 @@ int main(int argc, char** argv) {
             test_mode = argv[++i];
         } else if (arg == "--packets" && i+1 < argc) {
             num_packets = std::stoi(argv[++i]);
+        } else if (arg == "--tx-channels" && i+1 < argc) {
+            tx_channels = std::max(1, std::min(std::stoi(argv[++i]), MAX_CHANNELS));
         } else if (arg == "--config" && i+1 < argc) {
             config_file = argv[++i];
         } else if (arg == "--role" && i+1 < argc) {
@@ -354,11 +358,13 @@ int main(int argc, char** argv) {
             std::cout << "  --packets <n>     Number of packets to send/receive (default: 100)\n";
             std::cout << "  --role <role>     Device role: ue or gnb (default: ue)\n";
             std::cout << "  --config <file>   Configuration file path (default: auto from role)\n";
+            std::cout << "  --tx-channels <n> TX antennas (OAI tx_num_channels, default: 1)\n";
             std::cout << "  -h, --help        Show this help\n";
             std::cout << "\nExamples:\n";
             std::cout << "  " << argv[0] << " --role ue --mode all\n";
             std::cout << "  " << argv[0] << " --role gnb --mode tx --packets 200\n";
             std::cout << "  " << argv[0] << " --config conf/configurations-ue.yaml --mode rx\n";
+            std::cout << "  " << argv[0] << " --role ue --tx-channels 2 --mode tx   # 2 antennas, 1 TX ring\n";
             return 0;
         }
     }
@@ -383,10 +389,12 @@ int main(int argc, char** argv) {
     config.sample_rate = 30.72e6;  // 30.72 MHz for 30 MHz BW
     config.samples_per_frame = 307200;  // 10ms frame
     
-    // TX configuration (1 antenna)
-    config.tx_num_channels = 1;
-    config.tx_freq[0] = 3.5e9;  // 3.5 GHz
-    config.tx_gain[0] = 90.0;
+    // TX configuration (1 antenna unless --tx-channels)
+    config.tx_num_channels = tx_channels;
+    for (int i = 0; i < tx_channels; i++) {
+        config.tx_freq[i] = 3.5e9;  // 3.5 GHz
+        config.tx_gain[i] = 90.0;
+    }
     config.tx_bw = 30e6;
     
     // RX configuration (2 antennas)
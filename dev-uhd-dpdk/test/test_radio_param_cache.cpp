@@ -0,0 +1,122 @@
+// test/test_radio_param_cache.cpp
+//
+// Standalone checks for RadioParamCache stamp/floor versioning: hits and
+// misses after put/invalidate, version bumps only on effective updates,
+// invalidate_all() as a floor that later puts rise above.
+#include "device/radio_param_cache.hpp"
+
+#include <cstdio>
+
+using flexsdr::RadioParamCache;
+using flexsdr::radio_param;
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const char* what) {
+  if (!ok) {
+    std::fprintf(stderr, "[test_radio_param_cache] FAIL: %s\n", what);
+    failures++;
+  }
+}
+
+bool hit(const RadioParamCache& c, radio_param p, size_t chan, double want) {
+  double v = -1.0;
+  return c.get(p, chan, v) && v == want;
+}
+
+void test_put_get() {
+  RadioParamCache c;
+  double v;
+  check(!c.get(radio_param::RX_FREQ, 0, v) && !c.cached(radio_param::RX_FREQ, 0), "empty slot misses");
+  check(c.version() == 0, "fresh cache at version 0");
+
+  c.put(radio_param::RX_FREQ, 0, 3.5e9);
+  check(hit(c, radio_param::RX_FREQ, 0, 3.5e9), "put then get");
+  check(!c.cached(radio_param::RX_FREQ, 1) && !c.cached(radio_param::TX_FREQ, 0),
+        "other channels and params untouched");
+  const uint64_t v1 = c.version();
+  check(v1 == 1, "put bumps the version");
+
+  c.put(radio_param::RX_FREQ, 0, 3.5e9);
+  check(c.version() == v1, "same value: no version bump");
+  c.put(radio_param::RX_FREQ, 0, 3.6e9);
+  check(c.version() == v1 + 1 && hit(c, radio_param::RX_FREQ, 0, 3.6e9), "new value bumps");
+
+  c.put_all(radio_param::TX_GAIN, 20.0);
+  for (size_t ch = 0; ch < RadioParamCache::MAX_CHANS; ch++)
+    check(hit(c, radio_param::TX_GAIN, ch, 20.0), "put_all fills every channel");
+}
+
+void test_invalidate() {
+  RadioParamCache c;
+  c.put(radio_param::RX_GAIN, 0, 10.0);
+  c.put(radio_param::RX_GAIN, 1, 11.0);
+  c.put(radio_param::TX_GAIN, 0, 12.0);
+
+  uint64_t v = c.version();
+  c.invalidate(radio_param::RX_GAIN, 0);
+  check(!c.cached(radio_param::RX_GAIN, 0), "invalidate() drops the slot");
+  check(hit(c, radio_param::RX_GAIN, 1, 11.0), "... and only that slot");
+  check(c.version() > v, "invalidate() bumps the version");
+
+  // Re-filling with the old value counts as an update: the slot was empty
+  v = c.version();
+  c.put(radio_param::RX_GAIN, 0, 10.0);
+  check(hit(c, radio_param::RX_GAIN, 0, 10.0) && c.version() > v, "refill after invalidate()");
+
+  c.invalidate_all(radio_param::RX_GAIN);
+  check(!c.cached(radio_param::RX_GAIN, 0) && !c.cached(radio_param::RX_GAIN, 1),
+        "invalidate_all(p) drops every channel of p");
+  check(hit(c, radio_param::TX_GAIN, 0, 12.0), "... and leaves other params");
+}
+
+void test_floor() {
+  RadioParamCache c;
+  c.put(radio_param::RX_RATE, 0, 30.72e6);
+  c.put(radio_param::TX_RATE, 3, 30.72e6);
+  const uint64_t v = c.version();
+
+  c.invalidate_all();
+  check(c.version() > v, "invalidate_all() bumps the version");
+  check(!c.cached(radio_param::RX_RATE, 0) && !c.cached(radio_param::TX_RATE, 3),
+        "stamps at or below the floor miss");
+
+  // Same value as before the floor: must re-stamp above it, not short-cut
+  c.put(radio_param::RX_RATE, 0, 30.72e6);
+  check(hit(c, radio_param::RX_RATE, 0, 30.72e6), "put after invalidate_all() hits");
+  check(!c.cached(radio_param::TX_RATE, 3), "untouched slots stay below the floor");
+
+  c.invalidate_all();
+  c.invalidate_all();
+  c.put(radio_param::TX_RATE, 3, 15.36e6);
+  check(hit(c, radio_param::TX_RATE, 3, 15.36e6) && !c.cached(radio_param::RX_RATE, 0),
+        "repeated floors");
+}
+
+void test_out_of_range() {
+  RadioParamCache c;
+  const size_t ch = RadioParamCache::MAX_CHANS;
+  c.put(radio_param::RX_FREQ, ch, 1e9);
+  double v;
+  check(!c.get(radio_param::RX_FREQ, ch, v), "chan >= MAX_CHANS is never cached");
+  check(c.version() == 0, "... and does not bump the version");
+  c.invalidate(radio_param::RX_FREQ, ch);
+  check(c.version() == 0, "invalidate() out of range is a no-op");
+}
+
+} // namespace
+
+int main() {
+  test_put_get();
+  test_invalidate();
+  test_floor();
+  test_out_of_range();
+  if (failures) {
+    std::fprintf(stderr, "[test_radio_param_cache] %d check(s) failed\n", failures);
+    return 1;
+  }
+  std::printf("[test_radio_param_cache] ok\n");
+  return 0;
+}